@@ -9,7 +9,10 @@
 set( CELLULAR_COMMON_SOURCES
      ${CMAKE_CURRENT_LIST_DIR}/source/cellular_at_core.c
      ${CMAKE_CURRENT_LIST_DIR}/source/cellular_common.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/cellular_comm_capture.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/cellular_cmux.c
      ${CMAKE_CURRENT_LIST_DIR}/source/cellular_common_api.c
+     ${CMAKE_CURRENT_LIST_DIR}/source/cellular_heap.c
      ${CMAKE_CURRENT_LIST_DIR}/source/cellular_3gpp_urc_handler.c
      ${CMAKE_CURRENT_LIST_DIR}/source/cellular_3gpp_api.c
      ${CMAKE_CURRENT_LIST_DIR}/source/cellular_pkthandler.c
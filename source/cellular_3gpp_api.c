@@ -33,6 +33,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 
 #include "cellular_platform.h"
 
@@ -45,12 +46,11 @@
 #include "cellular_common_internal.h"
 #include "cellular_common_api.h"
 #include "cellular_at_core.h"
+#include "cellular_heap.h"
 #include "cellular_types.h"
 
 /*-----------------------------------------------------------*/
 
-#define CELLULAR_CEDRXS_POS_ACT             ( 0U )
-#define CELLULAR_CEDRXS_POS_VALUE           ( 1U )
 #define CELLULAR_CEDRXS_MAX_ENTRY           ( 4U )
 
 #define CELLULAR_AT_CMD_TYPICAL_MAX_SIZE    ( 32U )
@@ -62,17 +62,9 @@
 /* Length of HPLMN including RAT. */
 #define CRSM_HPLMN_RAT_LENGTH               ( 9U )
 
-#define PRINTF_BINARY_PATTERN_INT4          "%c%c%c%c"
-#define PRINTF_BYTE_TO_BINARY_INT4( i )          \
-    ( ( ( ( i ) & 0x08U ) != 0U ) ? '1' : '0' ), \
-    ( ( ( ( i ) & 0x04U ) != 0U ) ? '1' : '0' ), \
-    ( ( ( ( i ) & 0x02U ) != 0U ) ? '1' : '0' ), \
-    ( ( ( ( i ) & 0x01U ) != 0U ) ? '1' : '0' )
-
-#define PRINTF_BINARY_PATTERN_INT8 \
-    PRINTF_BINARY_PATTERN_INT4 PRINTF_BINARY_PATTERN_INT4
-#define PRINTF_BYTE_TO_BINARY_INT8( i ) \
-    PRINTF_BYTE_TO_BINARY_INT4( ( i ) >> 4 ), PRINTF_BYTE_TO_BINARY_INT4( i )
+/* Number of bits in the binary pattern of eDRX and PSM timer values. */
+#define EDRX_VALUE_BIT_COUNT                ( 4U )
+#define PSM_TIMER_BIT_COUNT                 ( 8U )
 
 #define CPSMS_POS_MODE           ( 0U )
 #define CPSMS_POS_RAU            ( 1U )
@@ -118,6 +110,18 @@ typedef struct cellularOperatorInfo
     char operatorName[ CELLULAR_NETWORK_NAME_MAX_SIZE + 1 ]; /**<  Registered network operator name. */
 } cellularOperatorInfo_t;
 
+/**
+ * @brief The fields of the +CPSMS response before the timers are converted to seconds.
+ */
+typedef struct cellularCpsmsFields
+{
+    uint8_t mode;           /**<  PSM mode. */
+    uint8_t periodicRau;    /**<  Requested periodic RAU in the T3412 timer format. */
+    uint8_t gprsReadyTimer; /**<  Requested GPRS READY timer in the T3324 timer format. */
+    uint8_t periodicTau;    /**<  Requested periodic TAU in the T3412 timer format. */
+    uint8_t activeTime;     /**<  Requested active time in the T3324 timer format. */
+} cellularCpsmsFields_t;
+
 /*-----------------------------------------------------------*/
 
 static CellularPktStatus_t _parseTimeZoneInCCLKResponse( char ** ppToken,
@@ -180,10 +184,6 @@ static CellularPktStatus_t _Cellular_RecvFuncIpAddress( CellularContext_t * pCon
                                                         const CellularATCommandResponse_t * pAtResp,
                                                         void * pData,
                                                         uint16_t dataLen );
-static CellularATError_t parseEidrxToken( char * pToken,
-                                          uint8_t tokenIndex,
-                                          CellularEidrxSettingsList_t * pEidrxSettingsList,
-                                          uint8_t count );
 static CellularATError_t parseEidrxLine( char * pInputLine,
                                          uint8_t count,
                                          CellularEidrxSettingsList_t * pEidrxSettingsList );
@@ -195,10 +195,10 @@ static CellularError_t atcmdUpdateMccMnc( CellularContext_t * pContext,
                                           cellularOperatorInfo_t * pOperatorInfo );
 static CellularError_t atcmdQueryRegStatus( CellularContext_t * pContext,
                                             CellularServiceStatus_t * pServiceStatus );
-static CellularATError_t parseT3412TimerValue( char * pToken,
-                                               uint32_t * pTimerValueSeconds );
-static CellularATError_t parseT3324TimerValue( char * pToken,
-                                               uint32_t * pTimerValueSeconds );
+static CellularATError_t convertT3412TimerValue( uint32_t timerCode,
+                                                 uint32_t * pTimerValueSeconds );
+static CellularATError_t convertT3324TimerValue( uint32_t timerCode,
+                                                 uint32_t * pTimerValueSeconds );
 static CellularSimCardLockState_t _getSimLockState( char * pToken );
 static CellularPktStatus_t _Cellular_RecvFuncGetSimLockStatus( CellularContext_t * pContext,
                                                                const CellularATCommandResponse_t * pAtResp,
@@ -222,15 +222,12 @@ static CellularPktStatus_t _Cellular_RecvFuncGetImsi( CellularContext_t * pConte
                                                       const CellularATCommandResponse_t * pAtResp,
                                                       void * pData,
                                                       uint16_t dataLen );
-static uint32_t appendBinaryPattern( char * cmdBuf,
-                                     uint32_t cmdLen,
-                                     uint32_t value,
-                                     bool endOfString );
-static CellularATError_t parseCpsmsMode( char * pToken,
-                                         CellularPsmSettings_t * pPsmSettings );
-static CellularATError_t parseGetPsmToken( char * pToken,
-                                           uint8_t tokenIndex,
-                                           CellularPsmSettings_t * pPsmSettings );
+static void appendBinaryPattern( CellularATCmdBuilder_t * pCmdBuilder,
+                                 uint32_t value,
+                                 bool endOfString );
+static void storePsmSettings( const cellularCpsmsFields_t * pCpsmsFields,
+                              uint32_t decodedFields,
+                              CellularPsmSettings_t * pPsmSettings );
 static CellularPktStatus_t _Cellular_RecvFuncGetPsmSettings( CellularContext_t * pContext,
                                                              const CellularATCommandResponse_t * pAtResp,
                                                              void * pData,
@@ -238,6 +235,39 @@ static CellularPktStatus_t _Cellular_RecvFuncGetPsmSettings( CellularContext_t *
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Field descriptors of the +CEDRXS response.
+ * +CEDRXS: <AcT-type>,<Requested_eDRX_value>
+ */
+static const CellularATFieldDesc_t eidrxFields[] =
+{
+    { CELLULAR_AT_FIELD_INT, 10U, 0U, ( uint16_t ) offsetof( CellularEidrxSettings_t, rat ),
+      ( uint16_t ) sizeof( uint8_t ), 0, ( int32_t ) UINT8_MAX },
+    { CELLULAR_AT_FIELD_INT, 2U,  0U, ( uint16_t ) offsetof( CellularEidrxSettings_t, requestedEdrxValue ),
+      ( uint16_t ) sizeof( uint8_t ), 0, ( int32_t ) UINT8_MAX }
+};
+
+/**
+ * @brief Field descriptors of the +CPSMS response in CPSMS_POS_* order. The timers
+ * are one byte in 8 bits format.
+ * +CPSMS: <mode>[,<Requested_Periodic-RAU>[,<Requested_GPRS-READY-timer>[,<Requested_Periodic-TAU>[,<Requested_Active-Time>]]]]
+ */
+static const CellularATFieldDesc_t cpsmsFields[] =
+{
+    { CELLULAR_AT_FIELD_INT,  2U,                             0U,
+      ( uint16_t ) offsetof( cellularCpsmsFields_t, mode ), ( uint16_t ) sizeof( uint8_t ), 0, ( int32_t ) UINT8_MAX },
+    { CELLULAR_AT_FIELD_BITS, ( uint8_t ) PSM_TIMER_BIT_COUNT, CELLULAR_AT_FIELD_FLAG_OPTIONAL,
+      ( uint16_t ) offsetof( cellularCpsmsFields_t, periodicRau ), ( uint16_t ) sizeof( uint8_t ), 0, ( int32_t ) UINT8_MAX },
+    { CELLULAR_AT_FIELD_BITS, ( uint8_t ) PSM_TIMER_BIT_COUNT, CELLULAR_AT_FIELD_FLAG_OPTIONAL,
+      ( uint16_t ) offsetof( cellularCpsmsFields_t, gprsReadyTimer ), ( uint16_t ) sizeof( uint8_t ), 0, ( int32_t ) UINT8_MAX },
+    { CELLULAR_AT_FIELD_BITS, ( uint8_t ) PSM_TIMER_BIT_COUNT, CELLULAR_AT_FIELD_FLAG_OPTIONAL,
+      ( uint16_t ) offsetof( cellularCpsmsFields_t, periodicTau ), ( uint16_t ) sizeof( uint8_t ), 0, ( int32_t ) UINT8_MAX },
+    { CELLULAR_AT_FIELD_BITS, ( uint8_t ) PSM_TIMER_BIT_COUNT, CELLULAR_AT_FIELD_FLAG_OPTIONAL,
+      ( uint16_t ) offsetof( cellularCpsmsFields_t, activeTime ), ( uint16_t ) sizeof( uint8_t ), 0, ( int32_t ) UINT8_MAX }
+};
+
+/*-----------------------------------------------------------*/
+
 static CellularPktStatus_t _parseTimeZoneInCCLKResponse( char ** ppToken,
                                                          bool * pTimeZoneSignNegative,
                                                          const char * pTimeZoneResp,
@@ -583,12 +613,9 @@ static CellularPktStatus_t _Cellular_RecvFuncGetFirmwareVersion( CellularContext
     else
     {
         pRespLine = pAtResp->pItm->pLine;
-        atCoreStatus = Cellular_ATRemoveLeadingWhiteSpaces( &pRespLine );
-
-        if( atCoreStatus == CELLULAR_AT_SUCCESS )
-        {
-            atCoreStatus = Cellular_ATRemoveTrailingWhiteSpaces( pRespLine );
-        }
+        atCoreStatus = Cellular_ATNormalize( &pRespLine,
+                                             CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES | CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES,
+                                             NULL );
 
         if( atCoreStatus == CELLULAR_AT_SUCCESS )
         {
@@ -630,12 +657,9 @@ static CellularPktStatus_t _Cellular_RecvFuncGetImei( CellularContext_t * pConte
     else
     {
         pRespLine = pAtResp->pItm->pLine;
-        atCoreStatus = Cellular_ATRemoveLeadingWhiteSpaces( &pRespLine );
-
-        if( atCoreStatus == CELLULAR_AT_SUCCESS )
-        {
-            atCoreStatus = Cellular_ATRemoveAllWhiteSpaces( pRespLine );
-        }
+        atCoreStatus = Cellular_ATNormalize( &pRespLine,
+                                             CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES | CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES,
+                                             NULL );
 
         if( atCoreStatus == CELLULAR_AT_SUCCESS )
         {
@@ -677,12 +701,9 @@ static CellularPktStatus_t _Cellular_RecvFuncGetModelId( CellularContext_t * pCo
     else
     {
         pRespLine = pAtResp->pItm->pLine;
-        atCoreStatus = Cellular_ATRemoveLeadingWhiteSpaces( &pRespLine );
-
-        if( atCoreStatus == CELLULAR_AT_SUCCESS )
-        {
-            atCoreStatus = Cellular_ATRemoveTrailingWhiteSpaces( pRespLine );
-        }
+        atCoreStatus = Cellular_ATNormalize( &pRespLine,
+                                             CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES | CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES,
+                                             NULL );
 
         if( atCoreStatus == CELLULAR_AT_SUCCESS )
         {
@@ -724,12 +745,9 @@ static CellularPktStatus_t _Cellular_RecvFuncGetManufactureId( CellularContext_t
     else
     {
         pRespLine = pAtResp->pItm->pLine;
-        atCoreStatus = Cellular_ATRemoveLeadingWhiteSpaces( &pRespLine );
-
-        if( atCoreStatus == CELLULAR_AT_SUCCESS )
-        {
-            atCoreStatus = Cellular_ATRemoveTrailingWhiteSpaces( pRespLine );
-        }
+        atCoreStatus = Cellular_ATNormalize( &pRespLine,
+                                             CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES | CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES,
+                                             NULL );
 
         if( atCoreStatus == CELLULAR_AT_SUCCESS )
         {
@@ -1233,73 +1251,12 @@ static CellularPktStatus_t _Cellular_RecvFuncIpAddress( CellularContext_t * pCon
 
 /*-----------------------------------------------------------*/
 
-static CellularATError_t parseEidrxToken( char * pToken,
-                                          uint8_t tokenIndex,
-                                          CellularEidrxSettingsList_t * pEidrxSettingsList,
-                                          uint8_t count )
-{
-    int32_t tempValue = 0;
-    CellularATError_t atCoreStatus = CELLULAR_AT_SUCCESS;
-
-    switch( tokenIndex )
-    {
-        case CELLULAR_CEDRXS_POS_ACT:
-            atCoreStatus = Cellular_ATStrtoi( pToken, 10, &tempValue );
-
-            if( atCoreStatus == CELLULAR_AT_SUCCESS )
-            {
-                if( ( tempValue >= 0 ) &&
-                    ( tempValue <= ( int32_t ) UINT8_MAX ) )
-                {
-                    pEidrxSettingsList->eidrxList[ count ].rat = ( uint8_t ) tempValue;
-                }
-                else
-                {
-                    LogError( ( "Error in processing RAT value. Token %s", pToken ) );
-                    atCoreStatus = CELLULAR_AT_ERROR;
-                }
-            }
-
-            break;
-
-        case CELLULAR_CEDRXS_POS_VALUE:
-            atCoreStatus = Cellular_ATStrtoi( pToken, 2, &tempValue );
-
-            if( atCoreStatus == CELLULAR_AT_SUCCESS )
-            {
-                if( ( tempValue >= 0 ) &&
-                    ( tempValue <= ( int32_t ) UINT8_MAX ) )
-                {
-                    pEidrxSettingsList->eidrxList[ count ].requestedEdrxValue = ( uint8_t ) tempValue;
-                }
-                else
-                {
-                    LogError( ( "Error in processing Requested Edrx value. Token %s", pToken ) );
-                    atCoreStatus = CELLULAR_AT_ERROR;
-                }
-            }
-
-            break;
-
-        default:
-            LogError( ( "Unknown Parameter Position in AT+CEDRXS Response" ) );
-            atCoreStatus = CELLULAR_AT_ERROR;
-            break;
-    }
-
-    return atCoreStatus;
-}
-
-/*-----------------------------------------------------------*/
-
 static CellularATError_t parseEidrxLine( char * pInputLine,
                                          uint8_t count,
                                          CellularEidrxSettingsList_t * pEidrxSettingsList )
 {
-    char * pToken = NULL;
     char * pLocalInputLine = pInputLine;
     CellularATError_t atCoreStatus = CELLULAR_AT_SUCCESS;
-    uint8_t tokenIndex = 0;
 
     CELLULAR_CONFIG_ASSERT( count < CELLULAR_EDRX_LIST_MAX_SIZE );
 
@@ -1307,31 +1264,15 @@ static CellularATError_t parseEidrxLine( char * pInputLine,
 
     if( atCoreStatus == CELLULAR_AT_SUCCESS )
     {
-        atCoreStatus = Cellular_ATRemoveAllDoubleQuote( pLocalInputLine );
-    }
-
-    if( atCoreStatus == CELLULAR_AT_SUCCESS )
-    {
-        atCoreStatus = Cellular_ATGetNextTok( &pLocalInputLine, &pToken );
-    }
-
-    if( atCoreStatus == CELLULAR_AT_SUCCESS )
-    {
-        tokenIndex = 0;
+        atCoreStatus = Cellular_ATDecodeFields( pLocalInputLine, ( uint16_t ) strlen( pLocalInputLine ),
+                                                eidrxFields, ( uint8_t ) ARRAY_SIZE( eidrxFields ),
+                                                &pEidrxSettingsList->eidrxList[ count ], NULL );
 
-        while( pToken != NULL )
+        if( atCoreStatus == CELLULAR_AT_ERROR )
         {
-            if( parseEidrxToken( pToken, tokenIndex, pEidrxSettingsList, count ) != CELLULAR_AT_SUCCESS )
-            {
-                LogInfo( ( "parseEidrxToken %s index %d failed", pToken, tokenIndex ) );
-            }
-
-            tokenIndex++;
-
-            if( Cellular_ATGetNextTok( &pLocalInputLine, &pToken ) != CELLULAR_AT_SUCCESS )
-            {
-                break;
-            }
+            /* Fields that failed to decode are left unchanged. The other fields are still valid. */
+            LogInfo( ( "parseEidrxLine %s decode fields failed", pLocalInputLine ) );
+            atCoreStatus = CELLULAR_AT_SUCCESS;
         }
     }
 
@@ -1506,69 +1447,51 @@ static CellularError_t atcmdQueryRegStatus( CellularContext_t * pContext,
 
 /*-----------------------------------------------------------*/
 
-static CellularATError_t parseT3412TimerValue( char * pToken,
-                                               uint32_t * pTimerValueSeconds )
+static CellularATError_t convertT3412TimerValue( uint32_t timerCode,
+                                                 uint32_t * pTimerValueSeconds )
 {
-    int32_t tempValue = 0;
-    uint32_t tokenValue = 0;
     uint32_t timerUnitIndex = 0;
     uint32_t timerValue = 0;
-    CellularATError_t atCoreStatus = Cellular_ATStrtoi( pToken, 2, &tempValue );
+    CellularATError_t atCoreStatus = CELLULAR_AT_SUCCESS;
 
-    if( atCoreStatus == CELLULAR_AT_SUCCESS )
-    {
-        if( tempValue < 0 )
-        {
-            LogError( ( "Error in processing Periodic Processing Active time value. Token %s", pToken ) );
-            atCoreStatus = CELLULAR_AT_ERROR;
-        }
-        else
-        {
-            tokenValue = ( uint32_t ) tempValue;
-        }
-    }
+    timerUnitIndex = T3412_TIMER_UNIT( timerCode );
+    timerValue = T3412_TIMER_VALUE( timerCode );
 
-    if( atCoreStatus == CELLULAR_AT_SUCCESS )
+    /* Parse the time unit. */
+    switch( timerUnitIndex )
     {
-        timerUnitIndex = T3412_TIMER_UNIT( tokenValue );
-        timerValue = T3412_TIMER_VALUE( tokenValue );
-
-        /* Parse the time unit. */
-        switch( timerUnitIndex )
-        {
-            case T3412_TIMER_UNIT_10MINUTES:
-                *pTimerValueSeconds = timerValue * ( 10U * 60U );
-                break;
+        case T3412_TIMER_UNIT_10MINUTES:
+            *pTimerValueSeconds = timerValue * ( 10U * 60U );
+            break;
 
-            case T3412_TIMER_UNIT_1HOURS:
-                *pTimerValueSeconds = timerValue * ( 1U * 60U * 60U );
-                break;
+        case T3412_TIMER_UNIT_1HOURS:
+            *pTimerValueSeconds = timerValue * ( 1U * 60U * 60U );
+            break;
 
-            case T3412_TIMER_UNIT_10HOURS:
-                *pTimerValueSeconds = timerValue * ( 10U * 60U * 60U );
-                break;
+        case T3412_TIMER_UNIT_10HOURS:
+            *pTimerValueSeconds = timerValue * ( 10U * 60U * 60U );
+            break;
 
-            case T3412_TIMER_UNIT_2SECONDS:
-                *pTimerValueSeconds = timerValue * 2U;
-                break;
+        case T3412_TIMER_UNIT_2SECONDS:
+            *pTimerValueSeconds = timerValue * 2U;
+            break;
 
-            case T3412_TIMER_UNIT_30SECONDS:
-                *pTimerValueSeconds = timerValue * 30U;
-                break;
+        case T3412_TIMER_UNIT_30SECONDS:
+            *pTimerValueSeconds = timerValue * 30U;
+            break;
 
-            case T3412_TIMER_UNIT_1MINUTES:
-                *pTimerValueSeconds = timerValue * 60U;
-                break;
+        case T3412_TIMER_UNIT_1MINUTES:
+            *pTimerValueSeconds = timerValue * 60U;
+            break;
 
-            case T3412_TIMER_UNIT_DEACTIVATED:
-                *pTimerValueSeconds = T3412_TIMER_DEACTIVATED;
-                break;
+        case T3412_TIMER_UNIT_DEACTIVATED:
+            *pTimerValueSeconds = T3412_TIMER_DEACTIVATED;
+            break;
 
-            default:
-                LogError( ( "Invalid T3412 timer unit index" ) );
-                atCoreStatus = CELLULAR_AT_ERROR;
-                break;
-        }
+        default:
+            LogError( ( "Invalid T3412 timer unit index" ) );
+            atCoreStatus = CELLULAR_AT_ERROR;
+            break;
     }
 
     return atCoreStatus;
@@ -1576,57 +1499,39 @@ static CellularATError_t parseT3412TimerValue( char * pToken,
 
 /*-----------------------------------------------------------*/
 
-static CellularATError_t parseT3324TimerValue( char * pToken,
-                                               uint32_t * pTimerValueSeconds )
+static CellularATError_t convertT3324TimerValue( uint32_t timerCode,
+                                                 uint32_t * pTimerValueSeconds )
 {
-    int32_t tempValue = 0;
-    uint32_t tokenValue = 0;
     uint32_t timerUnitIndex = 0;
     uint32_t timerValue = 0;
-    CellularATError_t atCoreStatus = Cellular_ATStrtoi( pToken, 2, &tempValue );
+    CellularATError_t atCoreStatus = CELLULAR_AT_SUCCESS;
 
-    if( atCoreStatus == CELLULAR_AT_SUCCESS )
-    {
-        if( tempValue < 0 )
-        {
-            LogError( ( "Error in processing Periodic Processing Active time value. Token %s", pToken ) );
-            atCoreStatus = CELLULAR_AT_ERROR;
-        }
-        else
-        {
-            tokenValue = ( uint32_t ) tempValue;
-        }
-    }
+    timerUnitIndex = T3324_TIMER_UNIT( timerCode );
+    timerValue = T3324_TIMER_VALUE( timerCode );
 
-    if( atCoreStatus == CELLULAR_AT_SUCCESS )
+    /* Parse the time unit. */
+    switch( timerUnitIndex )
     {
-        timerUnitIndex = T3324_TIMER_UNIT( tokenValue );
-        timerValue = T3324_TIMER_VALUE( tokenValue );
-
-        /* Parse the time unit. */
-        switch( timerUnitIndex )
-        {
-            case T3324_TIMER_UNIT_2SECONDS:
-                *pTimerValueSeconds = timerValue * 2U;
-                break;
+        case T3324_TIMER_UNIT_2SECONDS:
+            *pTimerValueSeconds = timerValue * 2U;
+            break;
 
-            case T3324_TIMER_UNIT_1MINUTE:
-                *pTimerValueSeconds = timerValue * 60U;
-                break;
+        case T3324_TIMER_UNIT_1MINUTE:
+            *pTimerValueSeconds = timerValue * 60U;
+            break;
 
-            case T3324_TIMER_UNIT_DECIHOURS:
-                *pTimerValueSeconds = timerValue * ( 6U * 60U );
-                break;
+        case T3324_TIMER_UNIT_DECIHOURS:
+            *pTimerValueSeconds = timerValue * ( 6U * 60U );
+            break;
 
-            case T3324_TIMER_UNIT_DEACTIVATED:
-                *pTimerValueSeconds = T3324_TIMER_DEACTIVATED;
-                break;
+        case T3324_TIMER_UNIT_DEACTIVATED:
+            *pTimerValueSeconds = T3324_TIMER_DEACTIVATED;
+            break;
 
-            default:
-                LogError( ( "Invalid T3324 timer unit index" ) );
-                atCoreStatus = CELLULAR_AT_ERROR;
-                break;
-        }
+        default:
+            LogError( ( "Invalid T3324 timer unit index" ) );
+            atCoreStatus = CELLULAR_AT_ERROR;
+            break;
     }
 
     return atCoreStatus;
@@ -1685,6 +1590,7 @@ CellularError_t Cellular_CommonSetEidrxSettings( CellularHandle_t cellularHandle
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
     char cmdBuf[ CELLULAR_AT_CMD_MAX_SIZE ] = { '\0' };
+    CellularATCmdBuilder_t cmdBuilder = { 0 };
     CellularAtReq_t atReqSetEidrx = { 0 };
 
     atReqSetEidrx.pAtCmd = cmdBuf;
@@ -1708,23 +1614,31 @@ CellularError_t Cellular_CommonSetEidrxSettings( CellularHandle_t cellularHandle
     else
     {
         /* Form the AT command. */
+        ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, CELLULAR_AT_CMD_MAX_SIZE );
+        ( void ) Cellular_ATCmdAppendStr( &cmdBuilder, "AT+CEDRXS=" );
+        ( void ) Cellular_ATCmdAppendUint( &cmdBuilder, pEidrxSettings->mode );
+        ( void ) Cellular_ATCmdAppendChar( &cmdBuilder, ',' );
+        ( void ) Cellular_ATCmdAppendUint( &cmdBuilder, pEidrxSettings->rat );
+        ( void ) Cellular_ATCmdAppendStr( &cmdBuilder, ",\"" );
+        ( void ) Cellular_ATCmdAppendBinary( &cmdBuilder, pEidrxSettings->requestedEdrxValue, EDRX_VALUE_BIT_COUNT );
+        ( void ) Cellular_ATCmdAppendChar( &cmdBuilder, '"' );
 
-        /* MISRA Ref 21.6.1 [Use of snprintf] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-216 */
-        /* coverity[misra_c_2012_rule_21_6_violation]. */
-        ( void ) snprintf( cmdBuf, CELLULAR_AT_CMD_MAX_SIZE, "%s%d,%d,\"" PRINTF_BINARY_PATTERN_INT4 "\"",
-                           "AT+CEDRXS=",
-                           pEidrxSettings->mode,
-                           pEidrxSettings->rat,
-                           PRINTF_BYTE_TO_BINARY_INT4( pEidrxSettings->requestedEdrxValue ) );
-        LogDebug( ( "Eidrx setting: %s ", cmdBuf ) );
-        /* Query the PSMsettings from the network. */
-        pktStatus = _Cellular_AtcmdRequestWithCallback( pContext, atReqSetEidrx );
-
-        if( pktStatus != CELLULAR_PKT_STATUS_OK )
+        if( Cellular_ATCmdBuilderFinish( &cmdBuilder, NULL ) != CELLULAR_AT_SUCCESS )
         {
-            LogError( ( "_Cellular_SetEidrxSettings: couldn't set Eidrx settings" ) );
-            cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
+            LogError( ( "Cellular_CommonSetEidrxSettings : AT command too long" ) );
+            cellularStatus = CELLULAR_BAD_PARAMETER;
+        }
+        else
+        {
+            LogDebug( ( "Eidrx setting: %s ", cmdBuf ) );
+            /* Query the PSMsettings from the network. */
+            pktStatus = _Cellular_AtcmdRequestWithCallback( pContext, atReqSetEidrx );
+
+            if( pktStatus != CELLULAR_PKT_STATUS_OK )
+            {
+                LogError( ( "_Cellular_SetEidrxSettings: couldn't set Eidrx settings" ) );
+                cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
+            }
         }
     }
 
@@ -1794,7 +1708,7 @@ CellularError_t Cellular_CommonGetRegisteredNetwork( CellularHandle_t cellularHa
 {
     CellularContext_t * pContext = ( CellularContext_t * ) cellularHandle;
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
-    cellularOperatorInfo_t * pOperatorInfo = ( cellularOperatorInfo_t * ) Platform_Malloc( sizeof( cellularOperatorInfo_t ) );
+    cellularOperatorInfo_t * pOperatorInfo = ( cellularOperatorInfo_t * ) _Cellular_Malloc( sizeof( cellularOperatorInfo_t ), CELLULAR_HEAP_SITE_OPERATOR_INFO );
 
     /* pContext is checked in _Cellular_CheckLibraryStatus function. */
     cellularStatus = _Cellular_CheckLibraryStatus( pContext );
@@ -1834,7 +1748,7 @@ CellularError_t Cellular_CommonGetRegisteredNetwork( CellularHandle_t cellularHa
         }
     }
 
-    Platform_Free( pOperatorInfo );
+    _Cellular_Free( pOperatorInfo );
 
     return cellularStatus;
 }
@@ -2158,6 +2072,7 @@ CellularError_t Cellular_CommonSetPdnConfig( CellularHandle_t cellularHandle,
     CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
     char cmdBuf[ CELLULAR_AT_CMD_MAX_SIZE ] = { '\0' };
     char pPdpTypeStr[ CELLULAR_PDN_CONTEXT_TYPE_MAX_SIZE ] = { '\0' };
+    CellularATCmdBuilder_t cmdBuilder = { 0 };
     CellularAtReq_t atReqSetPdn = { 0 };
 
     atReqSetPdn.pAtCmd = cmdBuf;
@@ -2210,20 +2125,181 @@ CellularError_t Cellular_CommonSetPdnConfig( CellularHandle_t cellularHandle,
     if( cellularStatus == CELLULAR_SUCCESS )
     {
         /* Form the AT command. */
+        ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, CELLULAR_AT_CMD_MAX_SIZE );
+        ( void ) Cellular_ATCmdAppendStr( &cmdBuilder, "AT+CGDCONT=" );
+        ( void ) Cellular_ATCmdAppendUint( &cmdBuilder, contextId );
+        ( void ) Cellular_ATCmdAppendChar( &cmdBuilder, ',' );
+        ( void ) Cellular_ATCmdAppendQuotedStr( &cmdBuilder, pPdpTypeStr );
+        ( void ) Cellular_ATCmdAppendChar( &cmdBuilder, ',' );
+        ( void ) Cellular_ATCmdAppendQuotedStr( &cmdBuilder, pPdnConfig->apnName );
+
+        if( Cellular_ATCmdBuilderFinish( &cmdBuilder, NULL ) != CELLULAR_AT_SUCCESS )
+        {
+            LogError( ( "Cellular_CommonSetPdnConfig: AT command too long" ) );
+            cellularStatus = CELLULAR_BAD_PARAMETER;
+        }
+    }
 
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        pktStatus = _Cellular_AtcmdRequestWithCallback( pContext, atReqSetPdn );
+
+        if( pktStatus != CELLULAR_PKT_STATUS_OK )
+        {
+            LogError( ( "Cellular_CommonSetPdnConfig: can't set PDN, cmdBuf:%s, PktRet: %d", cmdBuf, pktStatus ) );
+            cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CommonDataModeEnter( CellularHandle_t cellularHandle,
+                                              uint8_t contextId,
+                                              CellularDataModeReceiveCallback_t receiveCallback,
+                                              CellularDataModeExitCallback_t exitCallback,
+                                              void * pCallbackContext )
+{
+    CellularContext_t * pContext = ( CellularContext_t * ) cellularHandle;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    char cmdBuf[ CELLULAR_AT_CMD_TYPICAL_MAX_SIZE ] = { '\0' };
+    const char * pDialSuccessTokenTable[] = { "CONNECT" };
+    CellularAtReq_t atReqDial = { 0 };
+
+    atReqDial.pAtCmd = cmdBuf;
+    atReqDial.atCmdType = CELLULAR_AT_NO_RESULT;
+    atReqDial.pAtRspPrefix = NULL;
+    atReqDial.respCallback = NULL;
+    atReqDial.pData = NULL;
+    atReqDial.dataLen = 0;
+
+    if( receiveCallback == NULL )
+    {
+        LogError( ( "Cellular_CommonDataModeEnter: Invalid receiveCallback" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else
+    {
+        cellularStatus = _Cellular_IsValidPdn( contextId );
+    }
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        /* Make sure the library is open. */
+        cellularStatus = _Cellular_CheckLibraryStatus( pContext );
+    }
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
         /* MISRA Ref 21.6.1 [Use of snprintf] */
         /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-216 */
         /* coverity[misra_c_2012_rule_21_6_violation]. */
-        ( void ) snprintf( cmdBuf, CELLULAR_AT_CMD_MAX_SIZE, "%s%d,\"%s\",\"%s\"",
-                           "AT+CGDCONT=",
-                           contextId,
-                           pPdpTypeStr,
-                           pPdnConfig->apnName );
-        pktStatus = _Cellular_AtcmdRequestWithCallback( pContext, atReqSetPdn );
+        ( void ) snprintf( cmdBuf, CELLULAR_AT_CMD_TYPICAL_MAX_SIZE, "%s%d#", "ATD*99***", contextId );
+        pktStatus = _Cellular_PktioDataModeStart( pContext, cmdBuf, receiveCallback, exitCallback, pCallbackContext );
+        cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
+    }
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        /* Packet IO enters data mode when the modem returns CONNECT to cmdBuf. */
+        pktStatus = _Cellular_AtcmdRequestSuccessToken( pContext, atReqDial, PDN_ACT_PACKET_REQ_TIMEOUT_MS,
+                                                        pDialSuccessTokenTable, 1U );
 
         if( pktStatus != CELLULAR_PKT_STATUS_OK )
         {
-            LogError( ( "Cellular_CommonSetPdnConfig: can't set PDN, cmdBuf:%s, PktRet: %d", cmdBuf, pktStatus ) );
+            LogError( ( "Cellular_CommonDataModeEnter: can't dial context %u, PktRet: %d", contextId, pktStatus ) );
+            _Cellular_PktioDataModeStop( pContext );
+            cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CommonDataModeSend( CellularHandle_t cellularHandle,
+                                             const uint8_t * pData,
+                                             uint32_t dataLength,
+                                             uint32_t * pSentDataLength )
+{
+    CellularContext_t * pContext = ( CellularContext_t * ) cellularHandle;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    /* Make sure the library is open. */
+    cellularStatus = _Cellular_CheckLibraryStatus( pContext );
+
+    if( cellularStatus != CELLULAR_SUCCESS )
+    {
+        LogDebug( ( "_Cellular_CheckLibraryStatus failed" ) );
+    }
+    else if( ( pData == NULL ) || ( dataLength == 0U ) || ( pSentDataLength == NULL ) )
+    {
+        LogError( ( "Cellular_CommonDataModeSend: Invalid parameter" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( _Cellular_PktioDataModeIsActive( pContext ) == false )
+    {
+        LogError( ( "Cellular_CommonDataModeSend: Not in data mode or leaving data mode" ) );
+        cellularStatus = CELLULAR_NOT_ALLOWED;
+    }
+    else
+    {
+        *pSentDataLength = _Cellular_PktioSendData( pContext, pData, dataLength );
+
+        if( *pSentDataLength == 0U )
+        {
+            cellularStatus = CELLULAR_INTERNAL_FAILURE;
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CommonDataModeExit( CellularHandle_t cellularHandle )
+{
+    CellularContext_t * pContext = ( CellularContext_t * ) cellularHandle;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularAtReq_t atReqHangUp = { 0 };
+
+    atReqHangUp.pAtCmd = "ATH";
+    atReqHangUp.atCmdType = CELLULAR_AT_NO_RESULT;
+    atReqHangUp.pAtRspPrefix = NULL;
+    atReqHangUp.respCallback = NULL;
+    atReqHangUp.pData = NULL;
+    atReqHangUp.dataLen = 0;
+
+    /* Make sure the library is open. */
+    cellularStatus = _Cellular_CheckLibraryStatus( pContext );
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        if( _Cellular_PktioDataModeIsActive( pContext ) == false )
+        {
+            LogError( ( "Cellular_CommonDataModeExit: Not in data mode" ) );
+            cellularStatus = CELLULAR_NOT_ALLOWED;
+        }
+        else
+        {
+            /* Switch the modem to command mode before hanging up the call. */
+            pktStatus = _Cellular_PktioDataModeEscape( pContext );
+            cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
+        }
+    }
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        pktStatus = _Cellular_AtcmdRequestWithCallback( pContext, atReqHangUp );
+
+        if( pktStatus != CELLULAR_PKT_STATUS_OK )
+        {
+            LogError( ( "Cellular_CommonDataModeExit: can't hang up, PktRet: %d", pktStatus ) );
             cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
         }
     }
@@ -2793,32 +2869,22 @@ CellularError_t Cellular_CommonGetSimCardInfo( CellularHandle_t cellularHandle,
 
 /*-----------------------------------------------------------*/
 
-static uint32_t appendBinaryPattern( char * cmdBuf,
-                                     uint32_t cmdLen,
-                                     uint32_t value,
-                                     bool endOfString )
+static void appendBinaryPattern( CellularATCmdBuilder_t * pCmdBuilder,
+                                 uint32_t value,
+                                 bool endOfString )
 {
-    uint32_t retLen = 0;
-
+    /* A timer value 0 is omitted. */
     if( value != 0U )
     {
-        /* MISRA Ref 21.6.1 [Use of snprintf] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-216 */
-        /* coverity[misra_c_2012_rule_21_6_violation]. */
-        ( void ) snprintf( cmdBuf, cmdLen, "\"" PRINTF_BINARY_PATTERN_INT8 "\"%c",
-                           PRINTF_BYTE_TO_BINARY_INT8( value ), endOfString ? '\0' : ',' );
+        ( void ) Cellular_ATCmdAppendChar( pCmdBuilder, '"' );
+        ( void ) Cellular_ATCmdAppendBinary( pCmdBuilder, value, PSM_TIMER_BIT_COUNT );
+        ( void ) Cellular_ATCmdAppendChar( pCmdBuilder, '"' );
     }
-    else
+
+    if( endOfString == false )
     {
-        /* MISRA Ref 21.6.1 [Use of snprintf] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-216 */
-        /* coverity[misra_c_2012_rule_21_6_violation]. */
-        ( void ) snprintf( cmdBuf, cmdLen, "%c", endOfString ? '\0' : ',' );
+        ( void ) Cellular_ATCmdAppendChar( pCmdBuilder, ',' );
     }
-
-    retLen = ( uint32_t ) strlen( cmdBuf );
-
-    return retLen;
 }
 
 /*-----------------------------------------------------------*/
@@ -2830,7 +2896,7 @@ CellularError_t Cellular_CommonSetPsmSettings( CellularHandle_t cellularHandle,
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
     char cmdBuf[ CELLULAR_AT_CMD_MAX_SIZE ] = { '\0' };
-    uint32_t cmdBufLen = 0;
+    CellularATCmdBuilder_t cmdBuilder = { 0 };
     CellularAtReq_t atReqSetPsm = { 0 };
 
     atReqSetPsm.pAtCmd = cmdBuf;
@@ -2854,30 +2920,32 @@ CellularError_t Cellular_CommonSetPsmSettings( CellularHandle_t cellularHandle,
     else
     {
         /* Form the AT command. */
+        ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, CELLULAR_AT_CMD_MAX_SIZE );
+        ( void ) Cellular_ATCmdAppendStr( &cmdBuilder, "AT+CPSMS=" );
+        ( void ) Cellular_ATCmdAppendUint( &cmdBuilder, pPsmSettings->mode );
+        ( void ) Cellular_ATCmdAppendChar( &cmdBuilder, ',' );
+        appendBinaryPattern( &cmdBuilder, pPsmSettings->periodicRauValue, false );
+        appendBinaryPattern( &cmdBuilder, pPsmSettings->gprsReadyTimer, false );
+        appendBinaryPattern( &cmdBuilder, pPsmSettings->periodicTauValue, false );
+        appendBinaryPattern( &cmdBuilder, pPsmSettings->activeTimeValue, true );
 
-        /* MISRA Ref 21.6.1 [Use of snprintf] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-216 */
-        /* coverity[misra_c_2012_rule_21_6_violation]. */
-        ( void ) snprintf( cmdBuf, CELLULAR_AT_CMD_MAX_SIZE, "AT+CPSMS=%d,", pPsmSettings->mode );
-        cmdBufLen = ( uint32_t ) strlen( cmdBuf );
-        cmdBufLen = cmdBufLen + appendBinaryPattern( &( cmdBuf[ cmdBufLen ] ), ( CELLULAR_AT_CMD_MAX_SIZE - cmdBufLen ),
-                                                     pPsmSettings->periodicRauValue, false );
-        cmdBufLen = cmdBufLen + appendBinaryPattern( &( cmdBuf[ cmdBufLen ] ), ( CELLULAR_AT_CMD_MAX_SIZE - cmdBufLen ),
-                                                     pPsmSettings->gprsReadyTimer, false );
-        cmdBufLen = cmdBufLen + appendBinaryPattern( &( cmdBuf[ cmdBufLen ] ), ( CELLULAR_AT_CMD_MAX_SIZE - cmdBufLen ),
-                                                     pPsmSettings->periodicTauValue, false );
-        ( void ) appendBinaryPattern( &( cmdBuf[ cmdBufLen ] ), ( CELLULAR_AT_CMD_MAX_SIZE - cmdBufLen ),
-                                      pPsmSettings->activeTimeValue, true );
-
-        LogDebug( ( "PSM setting: %s ", cmdBuf ) );
+        if( Cellular_ATCmdBuilderFinish( &cmdBuilder, NULL ) != CELLULAR_AT_SUCCESS )
+        {
+            LogError( ( "Cellular_CommonSetPsmSettings : AT command too long" ) );
+            cellularStatus = CELLULAR_BAD_PARAMETER;
+        }
+        else
+        {
+            LogDebug( ( "PSM setting: %s ", cmdBuf ) );
 
-        /* Query the PSMsettings from the network. */
-        pktStatus = _Cellular_AtcmdRequestWithCallback( pContext, atReqSetPsm );
+            /* Query the PSMsettings from the network. */
+            pktStatus = _Cellular_AtcmdRequestWithCallback( pContext, atReqSetPsm );
 
-        if( pktStatus != CELLULAR_PKT_STATUS_OK )
-        {
-            LogError( ( "Cellular_SetPsmSettings: couldn't set PSM settings" ) );
-            cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
+            if( pktStatus != CELLULAR_PKT_STATUS_OK )
+            {
+                LogError( ( "Cellular_SetPsmSettings: couldn't set PSM settings" ) );
+                cellularStatus = _Cellular_TranslatePktStatus( pktStatus );
+            }
         }
     }
 
@@ -2886,65 +2954,35 @@ CellularError_t Cellular_CommonSetPsmSettings( CellularHandle_t cellularHandle,
 
 /*-----------------------------------------------------------*/
 
-static CellularATError_t parseCpsmsMode( char * pToken,
-                                         CellularPsmSettings_t * pPsmSettings )
+/* Store the decoded +CPSMS fields. The fields failed to decode are left unchanged. */
+static void storePsmSettings( const cellularCpsmsFields_t * pCpsmsFields,
+                              uint32_t decodedFields,
+                              CellularPsmSettings_t * pPsmSettings )
 {
-    int32_t tempValue = 0;
-    CellularATError_t atCoreStatus = Cellular_ATStrtoi( pToken, 2, &tempValue );
-
-    if( atCoreStatus == CELLULAR_AT_SUCCESS )
+    if( ( decodedFields & ( 1UL << CPSMS_POS_MODE ) ) != 0U )
     {
-        if( ( tempValue >= 0 ) && ( tempValue <= ( int32_t ) UINT8_MAX ) )
-        {
-            pPsmSettings->mode = ( uint8_t ) tempValue;
-        }
-        else
-        {
-            LogError( ( "Error in processing mode. Token %s", pToken ) );
-            atCoreStatus = CELLULAR_AT_ERROR;
-        }
+        pPsmSettings->mode = pCpsmsFields->mode;
     }
 
-    return atCoreStatus;
-}
-
-/*-----------------------------------------------------------*/
-
-static CellularATError_t parseGetPsmToken( char * pToken,
-                                           uint8_t tokenIndex,
-                                           CellularPsmSettings_t * pPsmSettings )
-{
-    CellularATError_t atCoreStatus = CELLULAR_AT_SUCCESS;
-
-    switch( tokenIndex )
+    if( ( decodedFields & ( 1UL << CPSMS_POS_RAU ) ) != 0U )
     {
-        case CPSMS_POS_MODE:
-            atCoreStatus = parseCpsmsMode( pToken, pPsmSettings );
-            break;
-
-        case CPSMS_POS_RAU:
-            atCoreStatus = parseT3412TimerValue( pToken, &( pPsmSettings->periodicRauValue ) );
-            break;
-
-        case CPSMS_POS_RDY_TIMER:
-            atCoreStatus = parseT3324TimerValue( pToken, &( pPsmSettings->gprsReadyTimer ) );
-            break;
-
-        case CPSMS_POS_TAU:
-            atCoreStatus = parseT3412TimerValue( pToken, &( pPsmSettings->periodicTauValue ) );
-            break;
+        ( void ) convertT3412TimerValue( pCpsmsFields->periodicRau, &( pPsmSettings->periodicRauValue ) );
+    }
 
-        case CPSMS_POS_ACTIVE_TIME:
-            atCoreStatus = parseT3324TimerValue( pToken, &( pPsmSettings->activeTimeValue ) );
-            break;
+    if( ( decodedFields & ( 1UL << CPSMS_POS_RDY_TIMER ) ) != 0U )
+    {
+        ( void ) convertT3324TimerValue( pCpsmsFields->gprsReadyTimer, &( pPsmSettings->gprsReadyTimer ) );
+    }
 
-        default:
-            LogError( ( "Unknown Parameter Position in AT+QPSMS Response" ) );
-            atCoreStatus = CELLULAR_AT_ERROR;
-            break;
+    if( ( decodedFields & ( 1UL << CPSMS_POS_TAU ) ) != 0U )
+    {
+        ( void ) convertT3412TimerValue( pCpsmsFields->periodicTau, &( pPsmSettings->periodicTauValue ) );
     }
 
-    return atCoreStatus;
+    if( ( decodedFields & ( 1UL << CPSMS_POS_ACTIVE_TIME ) ) != 0U )
+    {
+        ( void ) convertT3324TimerValue( pCpsmsFields->activeTime, &( pPsmSettings->activeTimeValue ) );
+    }
 }
 
 /*-----------------------------------------------------------*/
@@ -2954,11 +2992,12 @@ static CellularPktStatus_t _Cellular_RecvFuncGetPsmSettings( CellularContext_t *
                                                              void * pData,
                                                              uint16_t dataLen )
 {
-    char * pInputLine = NULL, * pToken = NULL;
-    uint8_t tokenIndex = 0;
+    char * pInputLine = NULL;
     CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
     CellularATError_t atCoreStatus = CELLULAR_AT_SUCCESS;
     CellularPsmSettings_t * pPsmSettings = NULL;
+    cellularCpsmsFields_t cpsmsData = { 0 };
+    uint32_t decodedFields = 0;
 
     if( pContext == NULL )
     {
@@ -2983,34 +3022,21 @@ static CellularPktStatus_t _Cellular_RecvFuncGetPsmSettings( CellularContext_t *
 
         if( atCoreStatus == CELLULAR_AT_SUCCESS )
         {
-            atCoreStatus = Cellular_ATRemoveAllDoubleQuote( pInputLine );
-        }
+            atCoreStatus = Cellular_ATDecodeFields( pInputLine, ( uint16_t ) strlen( pInputLine ),
+                                                    cpsmsFields, ( uint8_t ) ARRAY_SIZE( cpsmsFields ),
+                                                    &cpsmsData, &decodedFields );
 
-        if( atCoreStatus == CELLULAR_AT_SUCCESS )
-        {
-            atCoreStatus = Cellular_ATGetNextTok( &pInputLine, &pToken );
+            if( atCoreStatus == CELLULAR_AT_ERROR )
+            {
+                /* Fields that failed to decode are left unchanged. The other fields are still valid. */
+                LogInfo( ( "GetPsmSettings: %s decode fields failed", pInputLine ) );
+                atCoreStatus = CELLULAR_AT_SUCCESS;
+            }
         }
 
         if( atCoreStatus == CELLULAR_AT_SUCCESS )
         {
-            tokenIndex = 0;
-
-            while( pToken != NULL )
-            {
-                atCoreStatus = parseGetPsmToken( pToken, tokenIndex, pPsmSettings );
-
-                if( atCoreStatus != CELLULAR_AT_SUCCESS )
-                {
-                    LogInfo( ( "parseGetPsmToken %s index %d failed", pToken, tokenIndex ) );
-                }
-
-                tokenIndex++;
-
-                if( Cellular_ATGetNextTok( &pInputLine, &pToken ) != CELLULAR_AT_SUCCESS )
-                {
-                    break;
-                }
-            }
+            storePsmSettings( &cpsmsData, decodedFields, pPsmSettings );
         }
 
         pktStatus = _Cellular_TranslateAtCoreStatus( atCoreStatus );
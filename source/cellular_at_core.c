@@ -42,6 +42,67 @@
 
 #include "cellular_at_core.h"
 #include "cellular_internal.h"
+#include "cellular_heap.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief 0x01 in each byte of a 32 bits word.
+ */
+#define AT_SWAR_BYTES_ONE     ( 0x01010101U )
+
+/**
+ * @brief 0x80 in each byte of a 32 bits word.
+ */
+#define AT_SWAR_BYTES_HIGH    ( 0x80808080U )
+
+/**
+ * @brief Maximum number of bits of CELLULAR_AT_FIELD_BITS field. The value fits in int32_t.
+ */
+#define AT_FIELD_MAX_BITS     ( 31U )
+
+/**
+ * @brief All the CELLULAR_AT_NORMALIZE_* flags.
+ */
+#define AT_NORMALIZE_FLAGS    \
+    ( CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES |   \
+      CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES |  \
+      CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES |       \
+      CELLULAR_AT_NORMALIZE_OUTERMOST_DOUBLE_QUOTE | \
+      CELLULAR_AT_NORMALIZE_ALL_DOUBLE_QUOTE )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Value of each character as a hex digit. 0xFF if the character is not a hex digit.
+ */
+static const uint8_t hexDigitTable[ 256 ] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/**
+ * @brief Hex digit character of each nibble value.
+ */
+static const char hexCharTable[ 16 ] =
+{
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
 
 /*-----------------------------------------------------------*/
 
@@ -61,6 +122,50 @@ typedef enum CellularATStringValidationResult
 static void validateString( const char * pString,
                             CellularATStringValidationResult_t * pStringValidationResult );
 static uint8_t _charToNibble( char c );
+static bool _isDelimiter( char c,
+                          const char * pDelimiter );
+static bool _isValidStrView( const CellularATStrView_t * pView );
+static CellularATError_t _stringToStrView( const char * pString,
+                                           CellularATStrView_t * pView );
+static void _trimToken( CellularATToken_t * pToken );
+#if ( CELLULAR_CONFIG_AT_SWAR_DECODE == 1 )
+    static uint32_t _loadWord( const char * pStr );
+    static uint32_t _wordInRange( uint32_t word,
+                                  uint32_t low,
+                                  uint32_t high );
+    static bool _swarDecodeWord( uint32_t word,
+                                 uint8_t base,
+                                 uint32_t * pChunk );
+#endif
+static bool _decodeDigits( const char * pStr,
+                           uint16_t strLength,
+                           uint8_t base,
+                           uint32_t limit,
+                           uint32_t * pValue,
+                           uint16_t * pConsumed );
+static bool _decodeSigned( const char * pStr,
+                           uint16_t strLength,
+                           uint8_t base,
+                           int32_t * pValue,
+                           uint16_t * pConsumed );
+static bool _decodeBits( const char * pStr,
+                         uint16_t strLength,
+                         int32_t * pValue );
+static bool _storeIntField( const CellularATFieldDesc_t * pField,
+                            int32_t value,
+                            uint8_t * pDest );
+static bool _decodeField( const CellularATFieldDesc_t * pField,
+                          const CellularATToken_t * pToken,
+                          uint8_t * pDest );
+#if ( CELLULAR_CONFIG_AT_SWAR_DECODE == 1 )
+    static bool _hexDecodeBlock( const char * pHexStr,
+                                 uint8_t * pData );
+#endif
+static uint16_t _hexDecodeValid( const char * pHexStr,
+                                 uint16_t pairCount,
+                                 uint8_t * pData );
+static char * _cmdBuilderReserve( CellularATCmdBuilder_t * pBuilder,
+                                  uint32_t appendLength );
 
 /*-----------------------------------------------------------*/
 
@@ -93,27 +198,84 @@ static void validateString( const char * pString,
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATIsPrefixPresent( const char * pString,
-                                              bool * pResult )
+static bool _isValidStrView( const CellularATStrView_t * pView )
+{
+    bool ret = false;
+
+    if( ( pView != NULL ) && ( pView->pStr != NULL ) &&
+        ( pView->length > 0U ) && ( pView->length <= CELLULAR_AT_MAX_STRING_SIZE ) )
+    {
+        ret = true;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularATError_t _stringToStrView( const char * pString,
+                                           CellularATStrView_t * pView )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    char * ptrPrefixChar = NULL;
-    char * ptrChar = NULL;
+    const char * pNullCharacterLocation = NULL;
 
-    if( ( pResult == NULL ) || ( pString == NULL ) )
+    if( pString == NULL )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
-
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    else
     {
-        validateString( pString, &stringValidationResult );
+        /* Validate the string and get the length with one scan. */
+        pNullCharacterLocation = memchr( pString, ( int32_t ) '\0', ( CELLULAR_AT_MAX_STRING_SIZE + 1U ) );
 
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        if( ( pNullCharacterLocation == NULL ) || ( pNullCharacterLocation == pString ) )
         {
             atStatus = CELLULAR_AT_BAD_PARAMETER;
         }
+        else
+        {
+            /* The read-only functions don't modify the string through the view. */
+            pView->pStr = ( char * ) pString;
+            pView->length = ( uint16_t ) ( pNullCharacterLocation - pString );
+        }
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATStrViewInit( CellularATStrView_t * pView,
+                                          char * pStr,
+                                          uint16_t strLength )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+
+    if( ( pView == NULL ) || ( pStr == NULL ) || ( strLength > CELLULAR_AT_MAX_STRING_SIZE ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        pView->pStr = pStr;
+        pView->length = strLength;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATStrViewIsPrefixPresent( const CellularATStrView_t * pView,
+                                                     bool * pResult )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    const char * ptrPrefixChar = NULL;
+    const char * ptrChar = NULL;
+
+    if( ( pResult == NULL ) || ( _isValidStrView( pView ) == false ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
     /* Find location of first ':'. */
@@ -121,20 +283,20 @@ CellularATError_t Cellular_ATIsPrefixPresent( const char * pString,
     {
         *pResult = true;
 
-        ptrPrefixChar = strchr( pString, ( int32_t ) ':' );
+        ptrPrefixChar = memchr( pView->pStr, ( int32_t ) ':', pView->length );
 
         if( ptrPrefixChar == NULL )
         {
             *pResult = false;
         }
-        else if( !CELLULAR_CHECK_IS_PREFIX_LEADING_CHAR( *pString ) )
+        else if( !CELLULAR_CHECK_IS_PREFIX_LEADING_CHAR( pView->pStr[ 0 ] ) )
         {
             *pResult = false;
         }
         else
         {
             /* There should be only '+', '_', characters or digit before seperator. */
-            for( ptrChar = ( char * ) pString; ptrChar < ptrPrefixChar; ptrChar++ )
+            for( ptrChar = pView->pStr; ptrChar < ptrPrefixChar; ptrChar++ )
             {
                 /* It's caused by stanard api isalpha and isdigit. */
                 /* MISRA Ref 4.6.1  [Basic numerical type] */
@@ -160,23 +322,22 @@ CellularATError_t Cellular_ATIsPrefixPresent( const char * pString,
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATStrStartWith( const char * pString,
-                                           const char * pPrefix,
-                                           bool * pResult )
+CellularATError_t Cellular_ATStrViewStartWith( const CellularATStrView_t * pView,
+                                               const char * pPrefix,
+                                               bool * pResult )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
     CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    const char * pTempString = pString;
-    const char * pTempPrefix = pPrefix;
+    uint16_t i = 0;
 
-    if( ( pResult == NULL ) || ( pString == NULL ) || ( pPrefix == NULL ) )
+    if( ( pResult == NULL ) || ( pPrefix == NULL ) || ( _isValidStrView( pView ) == false ) )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        validateString( pTempString, &stringValidationResult );
+        validateString( pPrefix, &stringValidationResult );
 
         if( stringValidationResult != CELLULAR_AT_STRING_VALID )
         {
@@ -186,28 +347,50 @@ CellularATError_t Cellular_ATStrStartWith( const char * pString,
 
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        validateString( pTempPrefix, &stringValidationResult );
+        *pResult = true;
 
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        while( pPrefix[ i ] != '\0' )
         {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
+            if( ( i >= pView->length ) || ( pPrefix[ i ] != pView->pStr[ i ] ) )
+            {
+                *pResult = false;
+                break;
+            }
+
+            i++;
         }
     }
 
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATStrViewCheckErrorCode( const CellularATStrView_t * pView,
+                                                    const char * const * const ppKeyList,
+                                                    size_t keyListLen,
+                                                    bool * pResult )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    uint8_t i = 0;
+    bool tmpResult;
+
+    if( ( ppKeyList == NULL ) || ( pResult == NULL ) || ( _isValidStrView( pView ) == false ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        *pResult = true;
+        *pResult = false;
 
-        while( *pTempPrefix != '\0' )
+        for( i = 0; i < keyListLen; i++ )
         {
-            if( *pTempPrefix != *pTempString )
+            if( ( Cellular_ATStrViewStartWith( pView, ppKeyList[ i ], &tmpResult ) == CELLULAR_AT_SUCCESS ) && tmpResult )
             {
-                *pResult = false;
+                *pResult = true;
                 break;
             }
-
-            pTempPrefix++;
-            pTempString++;
         }
     }
 
@@ -216,42 +399,65 @@ CellularATError_t Cellular_ATStrStartWith( const char * pString,
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATRemovePrefix( char ** ppString )
+CellularATError_t Cellular_ATStrViewIsStrDigit( const CellularATStrView_t * pView,
+                                                bool * pResult )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
+    uint16_t i = 0;
 
-    if( ( ppString == NULL ) || ( *ppString == NULL ) )
+    if( ( pResult == NULL ) || ( _isValidStrView( pView ) == false ) )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        validateString( *ppString, &stringValidationResult );
+        *pResult = true;
 
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        for( i = 0; i < pView->length; i++ )
         {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
+            /* isdigit is a standard library function and we cannot control it. */
+            /* MISRA Ref 4.6.1  [Basic numerical type] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#directive-46 */
+            /* coverity[misra_c_2012_directive_4_6_violation] */
+            if( isdigit( ( ( int ) ( pView->pStr[ i ] ) ) ) == 0U )
+            {
+                *pResult = false;
+            }
         }
     }
 
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATStrViewRemovePrefix( CellularATStrView_t * pView )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    const char * pColon = NULL;
+    uint16_t prefixLength = 0;
+
+    if( _isValidStrView( pView ) == false )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        /* The strchr() function returns a pointer to the first occurrence of
-         * the character in the string or NULL if the character is not found.
-         *
-         * In case of AT response, prefix is always followed by a colon (':'). */
-        *ppString = strchr( *ppString, ( int32_t ) ':' );
+        /* In case of AT response, prefix is always followed by a colon (':'). */
+        pColon = memchr( pView->pStr, ( int32_t ) ':', pView->length );
 
-        if( *ppString == NULL )
+        if( pColon == NULL )
         {
             atStatus = CELLULAR_AT_BAD_PARAMETER;
         }
         else
         {
             /* Note that we remove both the prefix and the colon. */
-            ( *ppString )++;
+            prefixLength = ( uint16_t ) ( pColon - pView->pStr ) + 1U;
+            pView->pStr = &( pView->pStr[ prefixLength ] );
+            pView->length = pView->length - prefixLength;
         }
     }
 
@@ -260,26 +466,15 @@ CellularATError_t Cellular_ATRemovePrefix( char ** ppString )
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATRemoveLeadingWhiteSpaces( char ** ppString )
+CellularATError_t Cellular_ATStrViewRemoveLeadingWhiteSpaces( CellularATStrView_t * pView )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
 
-    if( ( ppString == NULL ) || ( *ppString == NULL ) )
+    if( _isValidStrView( pView ) == false )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        validateString( *ppString, &stringValidationResult );
-
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
-        {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
-        }
-    }
-
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
         /* isspace is a standard library function and we cannot control it. */
@@ -289,9 +484,10 @@ CellularATError_t Cellular_ATRemoveLeadingWhiteSpaces( char ** ppString )
         /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-2113 */
         /* coverity[misra_c_2012_rule_21_13_violation] */
         /* coverity[misra_c_2012_directive_4_6_violation] */
-        while( ( **ppString != '\0' ) && ( isspace( ( ( int ) ( **ppString ) ) ) != 0U ) )
+        while( ( pView->length > 0U ) && ( isspace( ( ( int ) ( pView->pStr[ 0 ] ) ) ) != 0U ) )
         {
-            ( *ppString )++;
+            pView->pStr++;
+            pView->length--;
         }
     }
 
@@ -300,51 +496,29 @@ CellularATError_t Cellular_ATRemoveLeadingWhiteSpaces( char ** ppString )
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATRemoveTrailingWhiteSpaces( char * pString )
+CellularATError_t Cellular_ATStrViewRemoveTrailingWhiteSpaces( CellularATStrView_t * pView )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    char * p = NULL;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    uint32_t stringLen = 0;
 
-    if( pString == NULL )
+    if( _isValidStrView( pView ) == false )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        validateString( pString, &stringValidationResult );
-
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
-        {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
-        }
-    }
-
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    /* This API intend to remove the trailing space, and this should be functional
+     * when the string length is greater than 2. The first character is kept. */
+    if( ( atStatus == CELLULAR_AT_SUCCESS ) && ( pView->length > 2U ) )
     {
-        stringLen = ( uint32_t ) strlen( pString );
-
-        /* This API intend to remove the trailing space, and this should be functional
-         * when the string length is greater than 2. */
-        if( stringLen > 2U )
+        /* isspace is a standard library function and we cannot control it. */
+        /* MISRA Ref 4.6.1  [Basic numerical type] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#directive-46 */
+        /* MISRA Ref 21.13.1  [Character representation] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-2113 */
+        /* coverity[misra_c_2012_directive_4_6_violation] */
+        /* coverity[misra_c_2012_rule_21_13_violation] */
+        while( ( pView->length > 1U ) && ( isspace( ( int ) ( pView->pStr[ pView->length - 1U ] ) ) != 0U ) )
         {
-            p = &( pString[ stringLen ] );
-
-            do
-            {
-                --p;
-                /* isspace is a standard library function and we cannot control it. */
-                /* MISRA Ref 4.6.1  [Basic numerical type] */
-                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#directive-46 */
-                /* MISRA Ref 21.13.1  [Character representation] */
-                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-2113 */
-                /* coverity[misra_c_2012_directive_4_6_violation] */
-                /* coverity[misra_c_2012_rule_21_13_violation] */
-            } while( ( p > pString ) && ( isspace( ( int ) ( *p ) ) != 0U ) );
-
-            p[ 1 ] = '\0';
+            pView->length--;
         }
     }
 
@@ -353,34 +527,20 @@ CellularATError_t Cellular_ATRemoveTrailingWhiteSpaces( char * pString )
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATRemoveAllWhiteSpaces( char * pString )
+CellularATError_t Cellular_ATStrViewRemoveAllWhiteSpaces( CellularATStrView_t * pView )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    char * p = NULL;
+    uint16_t i = 0;
     uint16_t ind = 0;
-    char * pTempString = pString;
 
-    if( pString == NULL )
+    if( _isValidStrView( pView ) == false )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        validateString( pTempString, &stringValidationResult );
-
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
-        {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
-        }
-    }
-
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        p = pTempString;
-
-        while( ( *pTempString ) != '\0' )
+        for( i = 0; i < pView->length; i++ )
         {
             /* isspace is a standard library function and we cannot control it. */
             /* MISRA Ref 4.6.1  [Basic numerical type] */
@@ -389,16 +549,14 @@ CellularATError_t Cellular_ATRemoveAllWhiteSpaces( char * pString )
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-2113 */
             /* coverity[misra_c_2012_rule_21_13_violation] */
             /* coverity[misra_c_2012_directive_4_6_violation] */
-            if( isspace( ( ( int ) ( *pTempString ) ) ) == 0U )
+            if( isspace( ( ( int ) ( pView->pStr[ i ] ) ) ) == 0U )
             {
-                p[ ind ] = *pTempString;
+                pView->pStr[ ind ] = pView->pStr[ i ];
                 ind++;
             }
-
-            pTempString++;
         }
 
-        p[ ind ] = '\0';
+        pView->length = ind;
     }
 
     return atStatus;
@@ -406,50 +564,26 @@ CellularATError_t Cellular_ATRemoveAllWhiteSpaces( char * pString )
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATRemoveOutermostDoubleQuote( char ** ppString )
+CellularATError_t Cellular_ATStrViewRemoveOutermostDoubleQuote( CellularATStrView_t * pView )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    char * p = NULL;
-    uint32_t stringLen = 0;
 
-    if( ( ppString == NULL ) || ( *ppString == NULL ) )
+    if( _isValidStrView( pView ) == false )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    if( ( atStatus == CELLULAR_AT_SUCCESS ) && ( pView->length > 2U ) )
     {
-        validateString( *ppString, &stringValidationResult );
-
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        if( pView->pStr[ 0 ] == '\"' )
         {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
+            pView->pStr++;
+            pView->length--;
         }
-    }
-
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        stringLen = ( uint32_t ) strlen( *ppString );
 
-        if( stringLen > 2U )
+        if( pView->pStr[ pView->length - 1U ] == '\"' )
         {
-            if( **ppString == '\"' )
-            {
-                ( *ppString )++;
-            }
-
-            p = *ppString;
-
-            while( *p != '\0' )
-            {
-                p++;
-            }
-
-            if( *--p == '\"' )
-            {
-                *p = '\0';
-            }
+            pView->length--;
         }
     }
 
@@ -458,45 +592,29 @@ CellularATError_t Cellular_ATRemoveOutermostDoubleQuote( char ** ppString )
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATRemoveAllDoubleQuote( char * pString )
+CellularATError_t Cellular_ATStrViewRemoveAllDoubleQuote( CellularATStrView_t * pView )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    char * p = NULL;
+    uint16_t i = 0;
     uint16_t ind = 0;
-    char * pTempString = pString;
 
-    if( pString == NULL )
+    if( _isValidStrView( pView ) == false )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        validateString( pTempString, &stringValidationResult );
-
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
-        {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
-        }
-    }
-
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        p = pTempString;
-
-        while( ( *pTempString ) != '\0' )
+        for( i = 0; i < pView->length; i++ )
         {
-            if( *pTempString != '\"' )
+            if( pView->pStr[ i ] != '\"' )
             {
-                p[ ind ] = *pTempString;
+                pView->pStr[ ind ] = pView->pStr[ i ];
                 ind++;
             }
-
-            pTempString++;
         }
 
-        p[ ind ] = '\0';
+        pView->length = ind;
     }
 
     return atStatus;
@@ -504,20 +622,20 @@ CellularATError_t Cellular_ATRemoveAllDoubleQuote( char * pString )
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATGetNextTok( char ** ppString,
-                                         char ** ppTokOutput )
+CellularATError_t Cellular_ATStrViewGetNextTok( CellularATStrView_t * pView,
+                                                CellularATStrView_t * pToken )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
     const char * pDelimiter = ",";
 
-    if( ( ppString == NULL ) || ( ppTokOutput == NULL ) )
+    if( ( pView == NULL ) || ( pToken == NULL ) )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        atStatus = Cellular_ATGetSpecificNextTok( ppString, pDelimiter, ppTokOutput );
+        atStatus = Cellular_ATStrViewGetSpecificNextTok( pView, pDelimiter, pToken );
     }
 
     return atStatus;
@@ -525,60 +643,1508 @@ CellularATError_t Cellular_ATGetNextTok( char ** ppString,
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATGetSpecificNextTok( char ** ppString,
-                                                 const char * pDelimiter,
-                                                 char ** ppTokOutput )
+static bool _isDelimiter( char c,
+                          const char * pDelimiter )
+{
+    const char * pDelimiterChar = pDelimiter;
+    bool ret = false;
+
+    while( ( *pDelimiterChar != '\0' ) && ( ret == false ) )
+    {
+        if( c == *pDelimiterChar )
+        {
+            ret = true;
+        }
+
+        pDelimiterChar++;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATStrViewGetSpecificNextTok( CellularATStrView_t * pView,
+                                                        const char * pDelimiter,
+                                                        CellularATStrView_t * pToken )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    uint16_t tokStrLen = 0, dataStrlen = 0;
-    char * tok = NULL;
+    uint16_t tokStart = 0;
+    uint16_t tokEnd = 0;
 
-    if( ( ppString == NULL ) || ( pDelimiter == NULL ) ||
-        ( ppTokOutput == NULL ) || ( *ppString == NULL ) )
+    if( ( pDelimiter == NULL ) || ( pToken == NULL ) || ( _isValidStrView( pView ) == false ) )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
 
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        validateString( *ppString, &stringValidationResult );
-
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        /* A delimiter at the start is an empty token. Otherwise skip the leading
+         * delimiters. */
+        if( pView->pStr[ 0 ] != ( *pDelimiter ) )
         {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
+            while( ( tokStart < pView->length ) && ( _isDelimiter( pView->pStr[ tokStart ], pDelimiter ) == true ) )
+            {
+                tokStart++;
+            }
+
+            if( tokStart == pView->length )
+            {
+                atStatus = CELLULAR_AT_ERROR;
+            }
         }
     }
 
     if( atStatus == CELLULAR_AT_SUCCESS )
     {
-        dataStrlen = ( uint16_t ) strlen( *ppString );
+        tokEnd = tokStart;
 
-        if( ( **ppString ) == ( *pDelimiter ) )
+        while( ( tokEnd < pView->length ) && ( _isDelimiter( pView->pStr[ tokEnd ], pDelimiter ) == false ) )
         {
-            **ppString = '\0';
-            tok = *ppString;
+            tokEnd++;
         }
-        else
+
+        pToken->pStr = &( pView->pStr[ tokStart ] );
+        pToken->length = tokEnd - tokStart;
+
+        /* Skip the delimiter which ends the token. */
+        if( tokEnd < pView->length )
         {
-            tok = strtok( *ppString, pDelimiter );
+            tokEnd++;
         }
+
+        pView->pStr = &( pView->pStr[ tokEnd ] );
+        pView->length = pView->length - tokEnd;
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATStrViewNormalize( CellularATStrView_t * pView,
+                                               uint8_t flags )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    char * pOut = NULL;
+    uint16_t start = 0;
+    uint16_t i = 0;
+    uint16_t ind = 0;
+    uint16_t keepLength = 0;
+    bool isSpace = false;
+    bool removeChar = false;
+
+    if( ( _isValidStrView( pView ) == false ) || ( ( flags & ~AT_NORMALIZE_FLAGS ) != 0U ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        if( ( flags & ( CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES | CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES ) ) != 0U )
+        {
+            /* isspace is a standard library function and we cannot control it. */
+            /* MISRA Ref 4.6.1  [Basic numerical type] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#directive-46 */
+            /* MISRA Ref 21.13.1  [Character representation] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-2113 */
+            /* coverity[misra_c_2012_rule_21_13_violation] */
+            /* coverity[misra_c_2012_directive_4_6_violation] */
+            while( ( start < pView->length ) && ( isspace( ( ( int ) ( pView->pStr[ start ] ) ) ) != 0U ) )
+            {
+                start++;
+            }
+        }
+
+        /* Compact the string in place. The write index never passes the read index.
+         * keepLength is the length without trailing white spaces. The first character
+         * is always kept as Cellular_ATRemoveTrailingWhiteSpaces does. */
+        pOut = &( pView->pStr[ start ] );
+
+        for( i = start; i < pView->length; i++ )
+        {
+            /* isspace is a standard library function and we cannot control it. */
+            /* MISRA Ref 4.6.1  [Basic numerical type] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#directive-46 */
+            /* MISRA Ref 21.13.1  [Character representation] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-2113 */
+            /* coverity[misra_c_2012_rule_21_13_violation] */
+            /* coverity[misra_c_2012_directive_4_6_violation] */
+            isSpace = ( isspace( ( ( int ) ( pView->pStr[ i ] ) ) ) != 0U ) ? true : false;
+
+            removeChar = ( ( ( flags & CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES ) != 0U ) && ( isSpace == true ) ) ||
+                         ( ( ( flags & CELLULAR_AT_NORMALIZE_ALL_DOUBLE_QUOTE ) != 0U ) && ( pView->pStr[ i ] == '\"' ) );
+
+            if( removeChar == false )
+            {
+                pOut[ ind ] = pView->pStr[ i ];
+                ind++;
+            }
+
+            if( ( isSpace == false ) || ( i == start ) )
+            {
+                keepLength = ind;
+            }
+        }
+
+        if( ( ( flags & CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES ) != 0U ) && ( ( uint16_t ) ( pView->length - start ) > 2U ) )
+        {
+            ind = keepLength;
+        }
+
+        /* All the double quotes are removed already if CELLULAR_AT_NORMALIZE_ALL_DOUBLE_QUOTE is set. */
+        if( ( ( flags & CELLULAR_AT_NORMALIZE_OUTERMOST_DOUBLE_QUOTE ) != 0U ) && ( ind > 2U ) )
+        {
+            if( pOut[ 0 ] == '\"' )
+            {
+                pOut++;
+                ind--;
+            }
+
+            if( pOut[ ind - 1U ] == '\"' )
+            {
+                ind--;
+            }
+        }
+
+        pView->pStr = pOut;
+        pView->length = ind;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATIsPrefixPresent( const char * pString,
+                                              bool * pResult )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    if( pResult == NULL )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = _stringToStrView( pString, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewIsPrefixPresent( &view, pResult );
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATStrStartWith( const char * pString,
+                                           const char * pPrefix,
+                                           bool * pResult )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    if( ( pResult == NULL ) || ( pPrefix == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = _stringToStrView( pString, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewStartWith( &view, pPrefix, pResult );
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATRemovePrefix( char ** ppString )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    if( ppString == NULL )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = _stringToStrView( *ppString, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewRemovePrefix( &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        *ppString = view.pStr;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATRemoveLeadingWhiteSpaces( char ** ppString )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    if( ppString == NULL )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = _stringToStrView( *ppString, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewRemoveLeadingWhiteSpaces( &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        *ppString = view.pStr;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATRemoveTrailingWhiteSpaces( char * pString )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    atStatus = _stringToStrView( pString, &view );
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewRemoveTrailingWhiteSpaces( &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        pString[ view.length ] = '\0';
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATRemoveAllWhiteSpaces( char * pString )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    atStatus = _stringToStrView( pString, &view );
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewRemoveAllWhiteSpaces( &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        pString[ view.length ] = '\0';
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATRemoveOutermostDoubleQuote( char ** ppString )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    if( ppString == NULL )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = _stringToStrView( *ppString, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewRemoveOutermostDoubleQuote( &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        /* Replace the trailing double quote with NULL terminator if it is removed. */
+        if( view.pStr[ view.length ] != '\0' )
+        {
+            view.pStr[ view.length ] = '\0';
+        }
+
+        *ppString = view.pStr;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATRemoveAllDoubleQuote( char * pString )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    atStatus = _stringToStrView( pString, &view );
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewRemoveAllDoubleQuote( &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        pString[ view.length ] = '\0';
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATGetNextTok( char ** ppString,
+                                         char ** ppTokOutput )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    const char * pDelimiter = ",";
+
+    if( ( ppString == NULL ) || ( ppTokOutput == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATGetSpecificNextTok( ppString, pDelimiter, ppTokOutput );
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATGetSpecificNextTok( char ** ppString,
+                                                 const char * pDelimiter,
+                                                 char ** ppTokOutput )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+    CellularATStrView_t token = { 0 };
+
+    if( ( ppString == NULL ) || ( pDelimiter == NULL ) || ( ppTokOutput == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = _stringToStrView( *ppString, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewGetSpecificNextTok( &view, pDelimiter, &token );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        /* Replace the delimiter which ends the token with NULL terminator. */
+        token.pStr[ token.length ] = '\0';
+        *ppString = view.pStr;
+        *ppTokOutput = token.pStr;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATNormalize( char ** ppString,
+                                        uint8_t flags,
+                                        uint16_t * pLength )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    if( ppString == NULL )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = _stringToStrView( *ppString, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewNormalize( &view, flags );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        /* The string is not modified if nothing is removed at the end. */
+        if( view.pStr[ view.length ] != '\0' )
+        {
+            view.pStr[ view.length ] = '\0';
+        }
+
+        *ppString = view.pStr;
+
+        if( pLength != NULL )
+        {
+            *pLength = view.length;
+        }
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATTokenCursorInit( CellularATTokenCursor_t * pCursor,
+                                              const char * pString,
+                                              uint16_t stringLength,
+                                              char delimiter )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+
+    if( ( pCursor == NULL ) || ( pString == NULL ) ||
+        ( delimiter == '\0' ) || ( delimiter == '"' ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else if( stringLength > CELLULAR_AT_MAX_STRING_SIZE )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        pCursor->pNext = pString;
+        pCursor->pEnd = &( pString[ stringLength ] );
+        pCursor->delimiter = delimiter;
+
+        /* An empty AT response has no field. */
+        pCursor->done = ( stringLength == 0U ) ? true : false;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATTokenCursorNext( CellularATTokenCursor_t * pCursor,
+                                              CellularATToken_t * pToken )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    const char * pStart = NULL;
+    const char * pChar = NULL;
+    bool inQuote = false;
+    uint16_t tokenLength = 0;
+
+    if( ( pCursor == NULL ) || ( pToken == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else if( pCursor->done == true )
+    {
+        atStatus = CELLULAR_AT_ERROR;
+    }
+    else
+    {
+        pStart = pCursor->pNext;
+        pChar = pStart;
+
+        /* Scan to the next delimiter outside double quotes. */
+        while( pChar < pCursor->pEnd )
+        {
+            if( *pChar == '"' )
+            {
+                inQuote = ( inQuote == true ) ? false : true;
+            }
+            else if( ( inQuote == false ) && ( *pChar == pCursor->delimiter ) )
+            {
+                break;
+            }
+            else
+            {
+                /* Empty else MISRA 15.7 */
+            }
+
+            pChar++;
+        }
+
+        if( inQuote == true )
+        {
+            pCursor->done = true;
+            atStatus = CELLULAR_AT_BAD_PARAMETER;
+        }
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        tokenLength = ( uint16_t ) ( pChar - pStart );
+
+        if( ( tokenLength >= 2U ) && ( pStart[ 0 ] == '"' ) && ( pStart[ tokenLength - 1U ] == '"' ) )
+        {
+            pToken->pToken = &( pStart[ 1 ] );
+            pToken->tokenLength = ( uint16_t ) ( tokenLength - 2U );
+            pToken->quoted = true;
+        }
+        else
+        {
+            pToken->pToken = pStart;
+            pToken->tokenLength = tokenLength;
+            pToken->quoted = false;
+        }
+
+        if( pChar < pCursor->pEnd )
+        {
+            /* Skip the delimiter. A trailing delimiter is followed by an empty field. */
+            pCursor->pNext = &( pChar[ 1 ] );
+        }
+        else
+        {
+            pCursor->pNext = pChar;
+            pCursor->done = true;
+        }
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static void _trimToken( CellularATToken_t * pToken )
+{
+    const char * pStart = pToken->pToken;
+    uint16_t tokenLength = pToken->tokenLength;
+
+    while( ( tokenLength > 0U ) && ( ( *pStart == ' ' ) || ( *pStart == '\t' ) ) )
+    {
+        pStart++;
+        tokenLength--;
+    }
+
+    while( ( tokenLength > 0U ) &&
+           ( ( pStart[ tokenLength - 1U ] == ' ' ) || ( pStart[ tokenLength - 1U ] == '\t' ) ) )
+    {
+        tokenLength--;
+    }
+
+    /* The token cursor only removes double quotes at the start and end of the field. */
+    if( ( tokenLength >= 2U ) && ( pStart[ 0 ] == '"' ) && ( pStart[ tokenLength - 1U ] == '"' ) )
+    {
+        pStart++;
+        tokenLength = ( uint16_t ) ( tokenLength - 2U );
+    }
+
+    pToken->pToken = pStart;
+    pToken->tokenLength = tokenLength;
+}
+
+/*-----------------------------------------------------------*/
+
+#if ( CELLULAR_CONFIG_AT_SWAR_DECODE == 1 )
+
+    static uint32_t _loadWord( const char * pStr )
+    {
+        /* The first character is in the lowest byte regardless of the endianness. */
+        return ( ( uint32_t ) ( uint8_t ) pStr[ 0 ] ) |
+               ( ( ( uint32_t ) ( uint8_t ) pStr[ 1 ] ) << 8 ) |
+               ( ( ( uint32_t ) ( uint8_t ) pStr[ 2 ] ) << 16 ) |
+               ( ( ( uint32_t ) ( uint8_t ) pStr[ 3 ] ) << 24 );
+    }
+
+/*-----------------------------------------------------------*/
+
+    static uint32_t _wordInRange( uint32_t word,
+                                  uint32_t low,
+                                  uint32_t high )
+    {
+        uint32_t notBelow = 0;
+        uint32_t above = 0;
+
+        /* Each byte of the word is less than 0x80. Adding to a byte never carries
+         * to the next byte. The high bit of a byte is set if the byte is not below
+         * low and is not above high. */
+        notBelow = word + ( AT_SWAR_BYTES_ONE * ( 0x80U - low ) );
+        above = word + ( AT_SWAR_BYTES_ONE * ( 0x7FU - high ) );
+
+        return notBelow & ( ~above ) & AT_SWAR_BYTES_HIGH;
+    }
+
+/*-----------------------------------------------------------*/
+
+    static bool _swarDecodeWord( uint32_t word,
+                                 uint8_t base,
+                                 uint32_t * pChunk )
+    {
+        bool ret = false;
+        uint32_t lowerCase = 0;
+        uint32_t digits = 0;
+        uint32_t pairs = 0;
+
+        if( ( word & AT_SWAR_BYTES_HIGH ) != 0U )
+        {
+            /* Not ASCII characters. */
+        }
+        else if( base == 10U )
+        {
+            if( _wordInRange( word, ( uint32_t ) '0', ( uint32_t ) '9' ) == AT_SWAR_BYTES_HIGH )
+            {
+                /* Combine adjacent digits to two two-digit values in byte 0 and byte 2. */
+                digits = word - ( AT_SWAR_BYTES_ONE * ( uint32_t ) '0' );
+                pairs = ( digits * 10U ) + ( digits >> 8 );
+                *pChunk = ( ( pairs & 0xFFU ) * 100U ) + ( ( pairs >> 16 ) & 0xFFU );
+                ret = true;
+            }
+        }
+        else if( base == 16U )
+        {
+            lowerCase = word | ( AT_SWAR_BYTES_ONE * 0x20U );
+
+            if( ( _wordInRange( word, ( uint32_t ) '0', ( uint32_t ) '9' ) |
+                  _wordInRange( lowerCase, ( uint32_t ) 'a', ( uint32_t ) 'f' ) ) == AT_SWAR_BYTES_HIGH )
+            {
+                /* Letters have bit 6 set. 'a' to 'f' are 1 to 6 in the lower nibble. */
+                digits = ( lowerCase & ( AT_SWAR_BYTES_ONE * 0x0FU ) ) +
+                         ( ( ( lowerCase >> 6 ) & AT_SWAR_BYTES_ONE ) * 9U );
+                pairs = ( ( digits << 4 ) | ( digits >> 8 ) ) & 0x00FF00FFU;
+                *pChunk = ( ( pairs & 0xFFU ) << 8 ) | ( pairs >> 16 );
+                ret = true;
+            }
+        }
+        else if( base == 2U )
+        {
+            if( ( word & ( ~AT_SWAR_BYTES_ONE ) ) == ( AT_SWAR_BYTES_ONE * ( uint32_t ) '0' ) )
+            {
+                /* Gather the lowest bit of each byte to bit 27 to bit 24. */
+                *pChunk = ( ( ( word & AT_SWAR_BYTES_ONE ) * 0x08040201U ) >> 24 ) & 0x0FU;
+                ret = true;
+            }
+        }
+        else
+        {
+            /* Other bases are decoded one digit at a time. */
+        }
+
+        return ret;
+    }
+
+/*-----------------------------------------------------------*/
+
+#endif /* CELLULAR_CONFIG_AT_SWAR_DECODE == 1 */
+
+static bool _decodeDigits( const char * pStr,
+                           uint16_t strLength,
+                           uint8_t base,
+                           uint32_t limit,
+                           uint32_t * pValue,
+                           uint16_t * pConsumed )
+{
+    bool ret = true;
+    bool digitEnd = false;
+    uint16_t i = 0;
+    uint32_t digit = 0;
+    uint32_t value = 0;
+
+    #if ( CELLULAR_CONFIG_AT_SWAR_DECODE == 1 )
+        uint32_t chunk = 0;
+        uint32_t chunkScale = 0;
+
+        while( ( ret == true ) && ( ( ( uint32_t ) strLength - i ) >= 4U ) &&
+               ( _swarDecodeWord( _loadWord( &pStr[ i ] ), base, &chunk ) == true ) )
+        {
+            chunkScale = ( uint32_t ) base * base * base * base;
+
+            if( value > ( ( limit - chunk ) / chunkScale ) )
+            {
+                /* Overflow. */
+                ret = false;
+            }
+            else
+            {
+                value = ( value * chunkScale ) + chunk;
+                i = i + 4U;
+            }
+        }
+    #endif /* CELLULAR_CONFIG_AT_SWAR_DECODE == 1 */
+
+    while( ( i < strLength ) && ( ret == true ) && ( digitEnd == false ) )
+    {
+        digit = ( uint32_t ) _charToNibble( pStr[ i ] );
+
+        if( digit >= ( uint32_t ) base )
+        {
+            /* The first character which is not a digit ends the number. */
+            digitEnd = true;
+        }
+        else if( value > ( ( limit - digit ) / ( uint32_t ) base ) )
+        {
+            /* Overflow. */
+            ret = false;
+        }
+        else
+        {
+            value = ( value * ( uint32_t ) base ) + digit;
+            i++;
+        }
+    }
+
+    if( ( ret == true ) && ( i > 0U ) )
+    {
+        *pValue = value;
+        *pConsumed = i;
+    }
+    else
+    {
+        ret = false;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+static bool _decodeSigned( const char * pStr,
+                           uint16_t strLength,
+                           uint8_t base,
+                           int32_t * pValue,
+                           uint16_t * pConsumed )
+{
+    bool ret = false;
+    bool negative = false;
+    uint16_t signLength = 0;
+    uint16_t digitLength = 0;
+    uint32_t value = 0;
+    uint32_t limit = ( uint32_t ) INT32_MAX;
+
+    if( ( strLength > 0U ) && ( ( pStr[ 0 ] == '-' ) || ( pStr[ 0 ] == '+' ) ) )
+    {
+        if( pStr[ 0 ] == '-' )
+        {
+            negative = true;
+            limit = ( uint32_t ) INT32_MAX + 1U;
+        }
+
+        signLength = 1U;
+    }
+
+    ret = _decodeDigits( &pStr[ signLength ], strLength - signLength, base, limit, &value, &digitLength );
+
+    if( ret == true )
+    {
+        if( negative == true )
+        {
+            *pValue = ( int32_t ) ( 0U - value );
+        }
+        else
+        {
+            *pValue = ( int32_t ) value;
+        }
+
+        *pConsumed = signLength + digitLength;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+static bool _decodeBits( const char * pStr,
+                         uint16_t strLength,
+                         int32_t * pValue )
+{
+    bool ret = true;
+    uint32_t value = 0;
+    uint16_t i = 0;
+
+    /* The most significant bit comes first. */
+    for( i = 0; ( i < strLength ) && ( ret == true ); i++ )
+    {
+        if( pStr[ i ] == '0' )
+        {
+            value = value << 1;
+        }
+        else if( pStr[ i ] == '1' )
+        {
+            value = ( value << 1 ) | 1U;
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+
+    if( ret == true )
+    {
+        *pValue = ( int32_t ) value;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+static bool _storeIntField( const CellularATFieldDesc_t * pField,
+                            int32_t value,
+                            uint8_t * pDest )
+{
+    bool ret = false;
+    uint8_t value8 = 0;
+    uint16_t value16 = 0;
+
+    if( ( value >= pField->minValue ) && ( value <= pField->maxValue ) )
+    {
+        ret = true;
+
+        if( pField->size == sizeof( uint8_t ) )
+        {
+            value8 = ( uint8_t ) value;
+            ( void ) memcpy( pDest, &value8, sizeof( uint8_t ) );
+        }
+        else if( pField->size == sizeof( uint16_t ) )
+        {
+            value16 = ( uint16_t ) value;
+            ( void ) memcpy( pDest, &value16, sizeof( uint16_t ) );
+        }
+        else if( pField->size == sizeof( int32_t ) )
+        {
+            ( void ) memcpy( pDest, &value, sizeof( int32_t ) );
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+static bool _decodeField( const CellularATFieldDesc_t * pField,
+                          const CellularATToken_t * pToken,
+                          uint8_t * pDest )
+{
+    bool ret = false;
+    int32_t value = 0;
+    uint16_t i = 0;
+    uint16_t consumed = 0;
+    uint8_t upperNibble = 0, lowerNibble = 0;
+
+    switch( pField->type )
+    {
+        case CELLULAR_AT_FIELD_INT:
+
+            if( ( _decodeSigned( pToken->pToken, pToken->tokenLength, pField->base, &value, &consumed ) == true ) &&
+                ( consumed == pToken->tokenLength ) )
+            {
+                ret = _storeIntField( pField, value, pDest );
+            }
+
+            break;
+
+        case CELLULAR_AT_FIELD_BITS:
+
+            /* The bit string must have exactly the number of bits in the descriptor. */
+            if( ( pField->base <= AT_FIELD_MAX_BITS ) && ( pToken->tokenLength == pField->base ) &&
+                ( _decodeBits( pToken->pToken, pToken->tokenLength, &value ) == true ) )
+            {
+                ret = _storeIntField( pField, value, pDest );
+            }
+
+            break;
+
+        case CELLULAR_AT_FIELD_HEX:
+
+            if( ( ( pToken->tokenLength % 2U ) == 0U ) && ( ( pToken->tokenLength / 2U ) <= pField->size ) )
+            {
+                ret = true;
+
+                /* Validate all the characters before writing to the destination. */
+                for( i = 0; ( i < pToken->tokenLength ) && ( ret == true ); i++ )
+                {
+                    if( _charToNibble( pToken->pToken[ i ] ) > 0x0FU )
+                    {
+                        ret = false;
+                    }
+                }
+
+                for( i = 0; ( i < pToken->tokenLength ) && ( ret == true ); i = i + 2U )
+                {
+                    upperNibble = _charToNibble( pToken->pToken[ i ] );
+                    lowerNibble = _charToNibble( pToken->pToken[ i + 1U ] );
+                    pDest[ i / 2U ] = ( uint8_t ) ( upperNibble << 4 ) | lowerNibble;
+                }
+            }
+
+            break;
+
+        case CELLULAR_AT_FIELD_STRING:
+
+            if( pToken->tokenLength < pField->size )
+            {
+                ( void ) memcpy( pDest, pToken->pToken, pToken->tokenLength );
+                pDest[ pToken->tokenLength ] = ( uint8_t ) '\0';
+                ret = true;
+            }
+
+            break;
+
+        default:
+            /* CELLULAR_AT_FIELD_SKIP is handled by the caller. */
+            break;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATDecodeFields( const char * pString,
+                                           uint16_t stringLength,
+                                           const CellularATFieldDesc_t * pFields,
+                                           uint8_t fieldCount,
+                                           void * pDest,
+                                           uint32_t * pDecodedFields )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATError_t fieldStatus = CELLULAR_AT_SUCCESS;
+    CellularATTokenCursor_t cursor = { 0 };
+    CellularATToken_t token = { 0 };
+    uint32_t decodedFields = 0;
+    uint8_t fieldIndex = 0;
+    const CellularATFieldDesc_t * pField = NULL;
+    bool fieldError = false;
+
+    if( ( pString == NULL ) || ( pFields == NULL ) || ( pDest == NULL ) ||
+        ( fieldCount == 0U ) || ( fieldCount > CELLULAR_AT_MAX_DECODE_FIELDS ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = Cellular_ATTokenCursorInit( &cursor, pString, stringLength, ',' );
+    }
+
+    for( fieldIndex = 0; ( fieldIndex < fieldCount ) && ( atStatus == CELLULAR_AT_SUCCESS ); fieldIndex++ )
+    {
+        pField = &pFields[ fieldIndex ];
+        fieldStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+
+        if( fieldStatus == CELLULAR_AT_SUCCESS )
+        {
+            _trimToken( &token );
+
+            if( token.tokenLength == 0U )
+            {
+                fieldStatus = CELLULAR_AT_ERROR;
+            }
+        }
+        else if( fieldStatus == CELLULAR_AT_BAD_PARAMETER )
+        {
+            /* Unterminated double quote. The remaining fields are not decoded. */
+            atStatus = CELLULAR_AT_ERROR;
+        }
+        else
+        {
+            /* Empty else MISRA 15.7 */
+        }
+
+        if( atStatus != CELLULAR_AT_SUCCESS )
+        {
+            /* Stop decoding. */
+        }
+        else if( fieldStatus != CELLULAR_AT_SUCCESS )
+        {
+            /* Empty or missing field. */
+            if( ( pField->flags & CELLULAR_AT_FIELD_FLAG_OPTIONAL ) == 0U )
+            {
+                fieldStatus = CELLULAR_AT_ERROR;
+            }
+            else
+            {
+                fieldStatus = CELLULAR_AT_SUCCESS;
+            }
+        }
+        else if( pField->type == CELLULAR_AT_FIELD_SKIP )
+        {
+            /* This field is not decoded. */
+        }
+        else if( _decodeField( pField, &token, &( ( ( uint8_t * ) pDest )[ pField->offset ] ) ) == true )
+        {
+            decodedFields = decodedFields | ( 1UL << fieldIndex );
+        }
+        else
+        {
+            fieldStatus = CELLULAR_AT_ERROR;
+        }
+
+        if( fieldStatus != CELLULAR_AT_SUCCESS )
+        {
+            /* Keep decoding the other fields. Report the error after all fields are decoded. */
+            fieldError = true;
+        }
+    }
+
+    if( ( atStatus == CELLULAR_AT_SUCCESS ) && ( fieldError == true ) )
+    {
+        atStatus = CELLULAR_AT_ERROR;
+    }
+
+    if( ( atStatus != CELLULAR_AT_BAD_PARAMETER ) && ( pDecodedFields != NULL ) )
+    {
+        *pDecodedFields = decodedFields;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t _charToNibble( char c )
+{
+    return hexDigitTable[ ( uint8_t ) c ];
+}
+
+/*-----------------------------------------------------------*/
+
+#if ( CELLULAR_CONFIG_AT_SWAR_DECODE == 1 )
+
+    static bool _hexDecodeBlock( const char * pHexStr,
+                                 uint8_t * pData )
+    {
+        bool ret = false;
+        uint32_t firstChunk = 0;
+        uint32_t secondChunk = 0;
+
+        /* Decode 8 hex characters to 4 bytes. Nothing is written if any character is invalid. */
+        if( ( _swarDecodeWord( _loadWord( pHexStr ), 16U, &firstChunk ) == true ) &&
+            ( _swarDecodeWord( _loadWord( &pHexStr[ 4 ] ), 16U, &secondChunk ) == true ) )
+        {
+            pData[ 0 ] = ( uint8_t ) ( firstChunk >> 8 );
+            pData[ 1 ] = ( uint8_t ) firstChunk;
+            pData[ 2 ] = ( uint8_t ) ( secondChunk >> 8 );
+            pData[ 3 ] = ( uint8_t ) secondChunk;
+            ret = true;
+        }
+
+        return ret;
+    }
+
+/*-----------------------------------------------------------*/
+
+#endif /* CELLULAR_CONFIG_AT_SWAR_DECODE == 1 */
+
+static uint16_t _hexDecodeValid( const char * pHexStr,
+                                 uint16_t pairCount,
+                                 uint8_t * pData )
+{
+    uint16_t i = 0;
+    bool valid = true;
+    uint8_t highNibble = 0, lowNibble = 0;
+
+    #if ( CELLULAR_CONFIG_AT_SWAR_DECODE == 1 )
+        while( ( ( ( uint32_t ) pairCount - i ) >= 4U ) &&
+               ( _hexDecodeBlock( &pHexStr[ i * 2U ], &pData[ i ] ) == true ) )
+        {
+            i = i + 4U;
+        }
+    #endif /* CELLULAR_CONFIG_AT_SWAR_DECODE == 1 */
+
+    while( ( i < pairCount ) && ( valid == true ) )
+    {
+        highNibble = _charToNibble( pHexStr[ i * 2U ] );
+        lowNibble = _charToNibble( pHexStr[ ( i * 2U ) + 1U ] );
+
+        if( ( highNibble | lowNibble ) > 0x0FU )
+        {
+            valid = false;
+        }
+        else
+        {
+            pData[ i ] = ( uint8_t ) ( highNibble << 4 ) | lowNibble;
+            i++;
+        }
+    }
+
+    /* Return the number of pairs decoded before the first invalid pair. */
+    return i;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATHexStrToHex( const char * pString,
+                                          uint8_t * pHexData,
+                                          uint16_t hexDataLen )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
+    uint16_t strHexLen = 0, i = 0;
+
+    if( ( pString == NULL ) || ( pHexData == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        validateString( pString, &stringValidationResult );
+
+        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        {
+            atStatus = CELLULAR_AT_BAD_PARAMETER;
+        }
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        strHexLen = ( uint16_t ) ( strlen( pString ) / 2U );
+
+        if( strHexLen >= hexDataLen )
+        {
+            atStatus = CELLULAR_AT_NO_MEMORY;
+        }
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        while( i < strHexLen )
+        {
+            i = i + _hexDecodeValid( &pString[ i * 2U ], strHexLen - i, &pHexData[ i ] );
+
+            if( i < strHexLen )
+            {
+                /* The pair contains a character which is not a hex digit. */
+                pHexData[ i ] = 0xFFU;
+                i++;
+            }
+        }
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATHexDecode( const char * pHexStr,
+                                        uint16_t hexStrLength,
+                                        uint8_t * pData,
+                                        uint16_t dataLength )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    uint16_t pairCount = hexStrLength / 2U;
+
+    if( ( pHexStr == NULL ) || ( pData == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else if( ( hexStrLength % 2U ) != 0U )
+    {
+        atStatus = CELLULAR_AT_ERROR;
+    }
+    else if( pairCount > dataLength )
+    {
+        atStatus = CELLULAR_AT_NO_MEMORY;
+    }
+    else if( _hexDecodeValid( pHexStr, pairCount, pData ) != pairCount )
+    {
+        atStatus = CELLULAR_AT_ERROR;
+    }
+    else
+    {
+        /* Empty else MISRA 15.7 */
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATHexDecoderInit( CellularATHexDecoder_t * pDecoder )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+
+    if( pDecoder == NULL )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        pDecoder->highNibble = 0;
+        pDecoder->nibblePending = false;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATHexDecodeChunk( CellularATHexDecoder_t * pDecoder,
+                                             const char * pChunk,
+                                             uint16_t chunkLength,
+                                             uint8_t * pData,
+                                             uint16_t dataLength,
+                                             uint16_t * pDataDecoded )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    uint32_t nibbleCount = 0;
+    uint16_t charIndex = 0;
+    uint16_t dataIndex = 0;
+    uint16_t pairCount = 0;
+    uint16_t pairDecoded = 0;
+    uint8_t nibble = 0;
+
+    if( ( pDecoder == NULL ) || ( pChunk == NULL ) || ( pData == NULL ) || ( pDataDecoded == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        nibbleCount = ( uint32_t ) chunkLength + ( ( pDecoder->nibblePending == true ) ? 1U : 0U );
+
+        if( ( nibbleCount / 2U ) > dataLength )
+        {
+            atStatus = CELLULAR_AT_NO_MEMORY;
+        }
+    }
+
+    /* Complete the byte split across the previous chunk and this chunk. */
+    if( ( atStatus == CELLULAR_AT_SUCCESS ) && ( pDecoder->nibblePending == true ) && ( chunkLength > 0U ) )
+    {
+        nibble = _charToNibble( pChunk[ 0 ] );
+
+        if( nibble > 0x0FU )
+        {
+            atStatus = CELLULAR_AT_ERROR;
+        }
+        else
+        {
+            pData[ 0 ] = ( uint8_t ) ( pDecoder->highNibble << 4 ) | nibble;
+            pDecoder->nibblePending = false;
+            charIndex = 1U;
+            dataIndex = 1U;
+        }
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        pairCount = ( uint16_t ) ( ( chunkLength - charIndex ) / 2U );
+        pairDecoded = _hexDecodeValid( &pChunk[ charIndex ], pairCount, &pData[ dataIndex ] );
+        /* pairDecoded is at most pairCount, so charIndex stays within chunkLength
+         * and dataIndex within dataLength. */
+        charIndex = ( uint16_t ) ( charIndex + ( pairDecoded * 2U ) );
+        dataIndex = ( uint16_t ) ( dataIndex + pairDecoded );
+
+        if( pairDecoded != pairCount )
+        {
+            atStatus = CELLULAR_AT_ERROR;
+        }
+    }
+
+    /* Keep the last nibble for the next chunk. */
+    if( ( atStatus == CELLULAR_AT_SUCCESS ) && ( charIndex < chunkLength ) )
     {
-        tokStrLen = ( uint16_t ) strlen( tok );
+        nibble = _charToNibble( pChunk[ charIndex ] );
+
+        if( nibble > 0x0FU )
+        {
+            atStatus = CELLULAR_AT_ERROR;
+        }
+        else
+        {
+            pDecoder->highNibble = nibble;
+            pDecoder->nibblePending = true;
+        }
+    }
+
+    if( atStatus != CELLULAR_AT_BAD_PARAMETER )
+    {
+        *pDataDecoded = dataIndex;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATHexDecoderFinish( const CellularATHexDecoder_t * pDecoder )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+
+    if( pDecoder == NULL )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else if( pDecoder->nibblePending == true )
+    {
+        /* Odd number of hex characters. */
+        atStatus = CELLULAR_AT_ERROR;
+    }
+    else
+    {
+        /* Empty else MISRA 15.7 */
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATHexEncode( const uint8_t * pData,
+                                        uint16_t dataLength,
+                                        char * pHexStr,
+                                        uint16_t hexStrLength )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    uint16_t i = 0;
+
+    if( ( pData == NULL ) || ( pHexStr == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else if( ( ( uint32_t ) dataLength * 2U ) >= hexStrLength )
+    {
+        /* No space for the NULL terminator. */
+        atStatus = CELLULAR_AT_NO_MEMORY;
+    }
+    else
+    {
+        for( i = 0; i < dataLength; i++ )
+        {
+            pHexStr[ i * 2U ] = hexCharTable[ pData[ i ] >> 4 ];
+            pHexStr[ ( i * 2U ) + 1U ] = hexCharTable[ pData[ i ] & 0x0FU ];
+        }
+
+        pHexStr[ ( uint32_t ) dataLength * 2U ] = '\0';
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATIsStrDigit( const char * pString,
+                                         bool * pResult )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    if( pResult == NULL )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        atStatus = _stringToStrView( pString, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewIsStrDigit( &view, pResult );
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATcheckErrorCode( const char * pInputBuf,
+                                             const char * const * const ppKeyList,
+                                             size_t keyListLen,
+                                             bool * pResult )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+
+    if( ( ppKeyList == NULL ) || ( pResult == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        /* The input buffer is validated once for all the keys. */
+        atStatus = _stringToStrView( pInputBuf, &view );
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        atStatus = Cellular_ATStrViewCheckErrorCode( &view, ppKeyList, keyListLen, pResult );
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATStrDup( char ** ppDst,
+                                     const char * pSrc )
+{
+    char * p = NULL;
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    const char * pTempSrc = pSrc;
+    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
+
+    if( ( ppDst == NULL ) || ( pTempSrc == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        validateString( pTempSrc, &stringValidationResult );
+
+        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        {
+            atStatus = CELLULAR_AT_BAD_PARAMETER;
+        }
+    }
+
+    if( atStatus == CELLULAR_AT_SUCCESS )
+    {
+        *ppDst = ( char * ) _Cellular_Malloc( sizeof( char ) * ( strlen( pTempSrc ) + 1U ), CELLULAR_HEAP_SITE_AT_STRING );
+
+        if( *ppDst != NULL )
+        {
+            p = *ppDst;
+
+            while( *pTempSrc != '\0' )
+            {
+                *p = *pTempSrc;
+                p++;
+                pTempSrc++;
+            }
 
-        if( ( tokStrLen < dataStrlen ) && ( ( *ppString )[ tokStrLen + 1U ] != '\0' ) )
-        {
-            *ppString = &( tok[ strlen( tok ) + 1U ] );
+            *p = '\0';
         }
         else
         {
-            *ppString = &( tok[ strlen( tok ) ] );
+            atStatus = CELLULAR_AT_NO_MEMORY;
         }
-
-        *ppTokOutput = tok;
     }
 
     return atStatus;
@@ -586,86 +2152,105 @@ CellularATError_t Cellular_ATGetSpecificNextTok( char ** ppString,
 
 /*-----------------------------------------------------------*/
 
-static uint8_t _charToNibble( char c )
+CellularATError_t Cellular_ATStrtoi( const char * pStr,
+                                     int32_t base,
+                                     int32_t * pResult )
 {
-    uint8_t ret = 0xFF;
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    const char * pDigits = pStr;
+    uint16_t strLength = 0;
+    uint16_t consumed = 0;
+    int32_t value = 0;
 
-    if( ( c >= '0' ) && ( c <= '9' ) )
-    {
-        ret = ( uint8_t ) ( ( uint32_t ) c - ( uint32_t ) '0' );
-    }
-    else if( ( c >= 'a' ) && ( c <= 'f' ) )
+    if( ( pStr == NULL ) || ( pResult == NULL ) || ( base < 2 ) || ( base > 16 ) )
     {
-        ret = ( uint8_t ) ( ( uint32_t ) c - ( uint32_t ) 'a' + ( uint32_t ) 10 );
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
     else
     {
-        if( ( c >= 'A' ) && ( c <= 'F' ) )
+        /* Skip the leading white spaces like strtol. */
+        while( ( *pDigits == ' ' ) || ( *pDigits == '\t' ) )
+        {
+            pDigits++;
+        }
+
+        while( ( strLength < CELLULAR_AT_MAX_STRING_SIZE ) && ( pDigits[ strLength ] != '\0' ) )
+        {
+            strLength++;
+        }
+
+        /* The characters after the number are not checked like strtol. */
+        if( _decodeSigned( pDigits, strLength, ( uint8_t ) base, &value, &consumed ) == true )
         {
-            ret = ( uint8_t ) ( ( uint32_t ) c - ( uint32_t ) 'A' + ( uint32_t ) 10 );
+            *pResult = value;
+        }
+        else
+        {
+            atStatus = CELLULAR_AT_ERROR;
         }
     }
 
-    return ret;
+    return atStatus;
 }
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATHexStrToHex( const char * pString,
-                                          uint8_t * pHexData,
-                                          uint16_t hexDataLen )
+CellularATError_t Cellular_ATDecodeDec( const char * pStr,
+                                        uint16_t strLength,
+                                        int32_t * pResult,
+                                        uint16_t * pConsumed )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    uint16_t strHexLen = 0, i = 0;
-    const char * p;
-    uint8_t firstNibble = 0, secondNibble = 0;
+    uint16_t consumed = 0;
+    int32_t value = 0;
 
-    if( ( pString == NULL ) || ( pHexData == NULL ) )
+    if( ( pStr == NULL ) || ( pResult == NULL ) )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
-
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    else if( _decodeSigned( pStr, strLength, 10U, &value, &consumed ) == false )
     {
-        validateString( pString, &stringValidationResult );
-
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
-        {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
-        }
+        atStatus = CELLULAR_AT_ERROR;
     }
-
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    else
     {
-        strHexLen = ( uint16_t ) ( strlen( pString ) / 2U );
+        *pResult = value;
 
-        if( strHexLen >= hexDataLen )
+        if( pConsumed != NULL )
         {
-            atStatus = CELLULAR_AT_NO_MEMORY;
+            *pConsumed = consumed;
         }
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        p = pString;
+    return atStatus;
+}
 
-        for( i = 0; i < strHexLen; i++ )
-        {
-            firstNibble = _charToNibble( *p );
-            secondNibble = _charToNibble( p[ 1 ] );
+/*-----------------------------------------------------------*/
 
-            if( firstNibble == 0xFFU )
-            {
-                ( pHexData )[ i ] = firstNibble;
-            }
-            else
-            {
-                firstNibble = ( uint8_t ) ( firstNibble << 4 );
-                ( pHexData )[ i ] = firstNibble | secondNibble;
-            }
+CellularATError_t Cellular_ATDecodeHex( const char * pStr,
+                                        uint16_t strLength,
+                                        uint32_t * pResult,
+                                        uint16_t * pConsumed )
+{
+    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
+    uint16_t consumed = 0;
+    uint32_t value = 0;
 
-            p = &( p[ 2 ] );
+    if( ( pStr == NULL ) || ( pResult == NULL ) )
+    {
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else if( _decodeDigits( pStr, strLength, 16U, UINT32_MAX, &value, &consumed ) == false )
+    {
+        atStatus = CELLULAR_AT_ERROR;
+    }
+    else
+    {
+        *pResult = value;
+
+        if( pConsumed != NULL )
+        {
+            *pConsumed = consumed;
         }
     }
 
@@ -674,89 +2259,167 @@ CellularATError_t Cellular_ATHexStrToHex( const char * pString,
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATIsStrDigit( const char * pString,
-                                         bool * pResult )
+CellularATError_t Cellular_ATDecodeBin( const char * pStr,
+                                        uint16_t strLength,
+                                        uint32_t * pResult,
+                                        uint16_t * pConsumed )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    const char * pTempString = pString;
+    uint16_t consumed = 0;
+    uint32_t value = 0;
 
-    if( ( pResult == NULL ) || ( pString == NULL ) )
+    if( ( pStr == NULL ) || ( pResult == NULL ) )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
-
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    else if( _decodeDigits( pStr, strLength, 2U, UINT32_MAX, &value, &consumed ) == false )
     {
-        validateString( pTempString, &stringValidationResult );
+        atStatus = CELLULAR_AT_ERROR;
+    }
+    else
+    {
+        *pResult = value;
 
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        if( pConsumed != NULL )
         {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
+            *pConsumed = consumed;
         }
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        *pResult = true;
+    return atStatus;
+}
 
-        while( ( *pTempString != '\0' ) )
-        {
-            /* isdigit is a standard library function and we cannot control it. */
-            /* MISRA Ref 4.6.1  [Basic numerical type] */
-            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#directive-46 */
-            /* coverity[misra_c_2012_directive_4_6_violation] */
-            if( isdigit( ( ( int ) ( *pTempString ) ) ) == 0U )
-            {
-                *pResult = false;
-            }
+/*-----------------------------------------------------------*/
 
-            pTempString++;
-        }
+static char * _cmdBuilderReserve( CellularATCmdBuilder_t * pBuilder,
+                                  uint32_t appendLength )
+{
+    char * pDst = NULL;
+
+    if( pBuilder->status != CELLULAR_AT_SUCCESS )
+    {
+        /* Keep the first error. */
+    }
+    else if( appendLength >= ( pBuilder->bufSize - pBuilder->length ) )
+    {
+        /* No space for the NULL terminator. */
+        pBuilder->status = CELLULAR_AT_NO_MEMORY;
+    }
+    else
+    {
+        pDst = &( pBuilder->pBuf[ pBuilder->length ] );
+        pBuilder->length = pBuilder->length + appendLength;
+        pBuilder->pBuf[ pBuilder->length ] = '\0';
     }
 
-    return atStatus;
+    return pDst;
 }
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATcheckErrorCode( const char * pInputBuf,
-                                             const char * const * const ppKeyList,
-                                             size_t keyListLen,
-                                             bool * pResult )
+CellularATError_t Cellular_ATCmdBuilderInit( CellularATCmdBuilder_t * pBuilder,
+                                             char * pBuf,
+                                             uint32_t bufSize )
 {
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    uint8_t i = 0;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
-    bool tmpResult;
 
-    if( ( pInputBuf == NULL ) || ( ppKeyList == NULL ) || ( pResult == NULL ) )
+    if( pBuilder == NULL )
     {
         atStatus = CELLULAR_AT_BAD_PARAMETER;
     }
+    else if( ( pBuf == NULL ) || ( bufSize == 0U ) )
+    {
+        /* Later appends to this builder fail. */
+        pBuilder->pBuf = NULL;
+        pBuilder->bufSize = 0;
+        pBuilder->length = 0;
+        pBuilder->status = CELLULAR_AT_BAD_PARAMETER;
+        atStatus = CELLULAR_AT_BAD_PARAMETER;
+    }
+    else
+    {
+        pBuilder->pBuf = pBuf;
+        pBuilder->bufSize = bufSize;
+        pBuilder->length = 0;
+        pBuilder->status = CELLULAR_AT_SUCCESS;
+        pBuf[ 0 ] = '\0';
+    }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATCmdAppendStr( CellularATCmdBuilder_t * pBuilder,
+                                           const char * pString )
+{
+    CellularATError_t atStatus = CELLULAR_AT_BAD_PARAMETER;
+    const char * pEnd = NULL;
+    char * pDst = NULL;
+
+    if( pBuilder != NULL )
     {
-        validateString( pInputBuf, &stringValidationResult );
+        if( pString == NULL )
+        {
+            if( pBuilder->status == CELLULAR_AT_SUCCESS )
+            {
+                pBuilder->status = CELLULAR_AT_BAD_PARAMETER;
+            }
+        }
+        else if( pBuilder->status == CELLULAR_AT_SUCCESS )
+        {
+            /* Look for the end of the string only within the space left. */
+            pEnd = memchr( pString, ( int32_t ) '\0', ( size_t ) ( pBuilder->bufSize - pBuilder->length ) );
 
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+            if( pEnd == NULL )
+            {
+                pBuilder->status = CELLULAR_AT_NO_MEMORY;
+            }
+            else
+            {
+                pDst = _cmdBuilderReserve( pBuilder, ( uint32_t ) ( pEnd - pString ) );
+
+                if( pDst != NULL )
+                {
+                    ( void ) memcpy( pDst, pString, ( size_t ) ( pEnd - pString ) );
+                }
+            }
+        }
+        else
         {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
+            /* Empty else MISRA 15.7 */
         }
+
+        atStatus = pBuilder->status;
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        *pResult = false;
+    return atStatus;
+}
 
-        for( i = 0; i < keyListLen; i++ )
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATCmdAppendQuotedStr( CellularATCmdBuilder_t * pBuilder,
+                                                 const char * pString )
+{
+    CellularATError_t atStatus = CELLULAR_AT_BAD_PARAMETER;
+
+    if( pBuilder != NULL )
+    {
+        if( pString == NULL )
         {
-            if( ( Cellular_ATStrStartWith( pInputBuf, ppKeyList[ i ], &tmpResult ) == CELLULAR_AT_SUCCESS ) && tmpResult )
+            if( pBuilder->status == CELLULAR_AT_SUCCESS )
             {
-                *pResult = true;
-                break;
+                pBuilder->status = CELLULAR_AT_BAD_PARAMETER;
             }
         }
+        else
+        {
+            ( void ) Cellular_ATCmdAppendChar( pBuilder, '"' );
+            ( void ) Cellular_ATCmdAppendStr( pBuilder, pString );
+            ( void ) Cellular_ATCmdAppendChar( pBuilder, '"' );
+        }
+
+        atStatus = pBuilder->status;
     }
 
     return atStatus;
@@ -764,50 +2427,108 @@ CellularATError_t Cellular_ATcheckErrorCode( const char * pInputBuf,
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATStrDup( char ** ppDst,
-                                     const char * pSrc )
+CellularATError_t Cellular_ATCmdAppendChar( CellularATCmdBuilder_t * pBuilder,
+                                            char c )
 {
-    char * p = NULL;
-    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    const char * pTempSrc = pSrc;
-    CellularATStringValidationResult_t stringValidationResult = CELLULAR_AT_STRING_UNKNOWN;
+    CellularATError_t atStatus = CELLULAR_AT_BAD_PARAMETER;
+    char * pDst = NULL;
 
-    if( ( ppDst == NULL ) || ( pTempSrc == NULL ) )
+    if( pBuilder != NULL )
     {
-        atStatus = CELLULAR_AT_BAD_PARAMETER;
+        if( c == '\0' )
+        {
+            if( pBuilder->status == CELLULAR_AT_SUCCESS )
+            {
+                pBuilder->status = CELLULAR_AT_BAD_PARAMETER;
+            }
+        }
+        else
+        {
+            pDst = _cmdBuilderReserve( pBuilder, 1U );
+
+            if( pDst != NULL )
+            {
+                *pDst = c;
+            }
+        }
+
+        atStatus = pBuilder->status;
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATCmdAppendUint( CellularATCmdBuilder_t * pBuilder,
+                                            uint32_t value )
+{
+    CellularATError_t atStatus = CELLULAR_AT_BAD_PARAMETER;
+    char digits[ 10 ] = { '\0' };
+    uint32_t digitCount = 0;
+    uint32_t remain = value;
+    uint32_t i = 0;
+    char * pDst = NULL;
+
+    if( pBuilder != NULL )
     {
-        validateString( pTempSrc, &stringValidationResult );
+        /* Digits are generated from the least significant one. */
+        do
+        {
+            digits[ digitCount ] = hexCharTable[ remain % 10U ];
+            remain = remain / 10U;
+            digitCount++;
+        } while( remain != 0U );
 
-        if( stringValidationResult != CELLULAR_AT_STRING_VALID )
+        pDst = _cmdBuilderReserve( pBuilder, digitCount );
+
+        if( pDst != NULL )
         {
-            atStatus = CELLULAR_AT_BAD_PARAMETER;
+            for( i = 0; i < digitCount; i++ )
+            {
+                pDst[ i ] = digits[ digitCount - 1U - i ];
+            }
         }
+
+        atStatus = pBuilder->status;
     }
 
-    if( atStatus == CELLULAR_AT_SUCCESS )
-    {
-        *ppDst = ( char * ) Platform_Malloc( sizeof( char ) * ( strlen( pTempSrc ) + 1U ) );
+    return atStatus;
+}
 
-        if( *ppDst != NULL )
-        {
-            p = *ppDst;
+/*-----------------------------------------------------------*/
 
-            while( *pTempSrc != '\0' )
+CellularATError_t Cellular_ATCmdAppendBinary( CellularATCmdBuilder_t * pBuilder,
+                                              uint32_t value,
+                                              uint8_t bitCount )
+{
+    CellularATError_t atStatus = CELLULAR_AT_BAD_PARAMETER;
+    uint32_t i = 0;
+    char * pDst = NULL;
+
+    if( pBuilder != NULL )
+    {
+        if( ( bitCount == 0U ) || ( bitCount > 32U ) )
+        {
+            if( pBuilder->status == CELLULAR_AT_SUCCESS )
             {
-                *p = *pTempSrc;
-                p++;
-                pTempSrc++;
+                pBuilder->status = CELLULAR_AT_BAD_PARAMETER;
             }
-
-            *p = '\0';
         }
         else
         {
-            atStatus = CELLULAR_AT_NO_MEMORY;
+            pDst = _cmdBuilderReserve( pBuilder, bitCount );
+
+            if( pDst != NULL )
+            {
+                for( i = 0; i < bitCount; i++ )
+                {
+                    pDst[ i ] = ( ( ( value >> ( bitCount - 1U - i ) ) & 0x01U ) != 0U ) ? '1' : '0';
+                }
+            }
         }
+
+        atStatus = pBuilder->status;
     }
 
     return atStatus;
@@ -815,45 +2536,60 @@ CellularATError_t Cellular_ATStrDup( char ** ppDst,
 
 /*-----------------------------------------------------------*/
 
-CellularATError_t Cellular_ATStrtoi( const char * pStr,
-                                     int32_t base,
-                                     int32_t * pResult )
+CellularATError_t Cellular_ATCmdAppendHex( CellularATCmdBuilder_t * pBuilder,
+                                           const uint8_t * pData,
+                                           uint16_t dataLength )
 {
-    CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
-    int32_t retStrtol = 0;
-    char * pEndStr = NULL;
+    CellularATError_t atStatus = CELLULAR_AT_BAD_PARAMETER;
+    uint32_t i = 0;
+    char * pDst = NULL;
 
-    if( ( pStr == NULL ) || ( pResult == NULL ) )
-    {
-        atStatus = CELLULAR_AT_BAD_PARAMETER;
-    }
-    else
+    if( pBuilder != NULL )
     {
-        /* MISRA Ref 22.8.1 [Initialize errno] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-228 */
-        /* coverity[misra_c_2012_rule_22_8_violation] */
-        retStrtol = ( int32_t ) strtol( pStr, &pEndStr, base );
-
-        /* The return value zero may stand for the failure of strtol. So if the return value
-         * is zero, need to check the address of pEndStr, if it's greater than the pStr, that
-         * means there is an real parsed zero before pEndStr.
-         */
-        if( pEndStr == pStr )
+        if( pData == NULL )
         {
-            atStatus = CELLULAR_AT_ERROR;
+            if( pBuilder->status == CELLULAR_AT_SUCCESS )
+            {
+                pBuilder->status = CELLULAR_AT_BAD_PARAMETER;
+            }
         }
         else
         {
-            *pResult = retStrtol;
+            pDst = _cmdBuilderReserve( pBuilder, ( uint32_t ) dataLength * 2U );
+
+            if( pDst != NULL )
+            {
+                for( i = 0; i < dataLength; i++ )
+                {
+                    pDst[ i * 2U ] = hexCharTable[ pData[ i ] >> 4 ];
+                    pDst[ ( i * 2U ) + 1U ] = hexCharTable[ pData[ i ] & 0x0FU ];
+                }
+            }
+        }
+
+        atStatus = pBuilder->status;
+    }
+
+    return atStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularATError_t Cellular_ATCmdBuilderFinish( const CellularATCmdBuilder_t * pBuilder,
+                                               uint32_t * pLength )
+{
+    CellularATError_t atStatus = CELLULAR_AT_BAD_PARAMETER;
+
+    if( pBuilder != NULL )
+    {
+        atStatus = pBuilder->status;
+
+        if( ( atStatus == CELLULAR_AT_SUCCESS ) && ( pLength != NULL ) )
+        {
+            *pLength = pBuilder->length;
         }
     }
 
-    /* MISRA Ref 4.7.1 [Testing errno] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#directive-47 */
-    /* MISRA Ref 22.9.1 [Testing errno] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-229 */
-    /* coverity[need_errno_test] */
-    /* coverity[return_without_test] */
     return atStatus;
 }
 
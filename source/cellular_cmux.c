@@ -0,0 +1,1224 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @brief FreeRTOS Cellular Library 3GPP TS 27.010 basic mode multiplexer.
+ */
+
+/* The config header is always included first. */
+
+#ifndef CELLULAR_DO_NOT_USE_CUSTOM_CONFIG
+    /* Include custom config file before other headers. */
+    #include "cellular_config.h"
+#endif
+#include "cellular_config_defaults.h"
+
+/* Standard includes. */
+#include <string.h>
+
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_internal.h"
+#include "cellular_comm_interface.h"
+#include "cellular_cmux.h"
+
+/*-----------------------------------------------------------*/
+
+#if ( CELLULAR_CONFIG_CMUX_MAX_CHANNELS > CELLULAR_CMUX_MAX_SUPPORTED_CHANNELS )
+    #error "CELLULAR_CONFIG_CMUX_MAX_CHANNELS exceeds CELLULAR_CMUX_MAX_SUPPORTED_CHANNELS."
+#endif
+
+#if ( CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE > 32767U )
+    #error "CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE exceeds the 15 bits length field."
+#endif
+
+/**
+ * @brief The flag sequence at the start and end of a frame.
+ */
+#define CMUX_FLAG                   ( 0xF9U )
+
+/**
+ * @brief The extension bit of the address and length fields.
+ */
+#define CMUX_EA                     ( 0x01U )
+
+/**
+ * @brief The command / response bit of the address field.
+ */
+#define CMUX_CR                     ( 0x02U )
+
+/**
+ * @brief The poll / final bit of the control field.
+ */
+#define CMUX_PF                     ( 0x10U )
+
+/**
+ * @brief Frame types in the control field without the poll / final bit.
+ */
+#define CMUX_CTRL_SABM              ( 0x2FU )
+#define CMUX_CTRL_UA                ( 0x63U )
+#define CMUX_CTRL_DM                ( 0x0FU )
+#define CMUX_CTRL_DISC              ( 0x43U )
+#define CMUX_CTRL_UIH               ( 0xEFU )
+#define CMUX_CTRL_UI                ( 0x03U )
+
+/**
+ * @brief The DLCI of the multiplexer control channel.
+ */
+#define CMUX_CONTROL_DLCI           ( 0U )
+
+/**
+ * @brief The type and length octets of a modem status command with a DLCI and a V.24 signals octet.
+ */
+#define CMUX_MSC_COMMAND            ( 0xE3U )
+#define CMUX_MSC_LENGTH             ( 0x05U )
+
+/**
+ * @brief The V.24 signals of a modem status command. RTC, RTR and DV are set.
+ */
+#define CMUX_MSC_SIGNALS            ( 0x8DU )
+
+/**
+ * @brief The flow control bit of the V.24 signals. The DLCI is not able to accept frames.
+ */
+#define CMUX_MSC_FC                 ( 0x02U )
+
+/**
+ * @brief The maximum length field value in a single byte.
+ */
+#define CMUX_SHORT_LENGTH_MAX       ( 0x7FU )
+
+/**
+ * @brief The FCS initial value and the value of a received frame with valid FCS.
+ */
+#define CMUX_FCS_INIT               ( 0xFFU )
+#define CMUX_FCS_GOOD               ( 0xCFU )
+
+/**
+ * @brief The reversed polynomial of the FCS.
+ */
+#define CMUX_FCS_POLYNOMIAL         ( 0xE0U )
+
+/**
+ * @brief The size of a frame with CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE information field.
+ *
+ * Opening flag, address, control, 2 bytes length, FCS and closing flag.
+ */
+#define CMUX_FRAME_BUFFER_SIZE      ( CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE + 7U )
+
+/**
+ * @brief The number of times a SABM frame is sent before giving up. N2 of TS 27.010.
+ */
+#define CMUX_SABM_RETRY_COUNT       ( 3U )
+
+/**
+ * @brief The number of polls of the physical comm interface for a response to SABM.
+ */
+#define CMUX_RESPONSE_POLL_COUNT    ( 30U )
+
+/**
+ * @brief The interval of the polls of the physical comm interface for a response to SABM.
+ */
+#define CMUX_RESPONSE_POLL_MS       ( 10U )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @ingroup cellular_datatypes_enums
+ * @brief State of a CMUX DLCI.
+ */
+typedef enum cellularCmuxChannelState
+{
+    CMUX_CHANNEL_CLOSED = 0,  /**<  The DLCI is not established. */
+    CMUX_CHANNEL_OPENING,     /**<  SABM is sent and waiting for the response. */
+    CMUX_CHANNEL_ESTABLISHED, /**<  UA is received. */
+    CMUX_CHANNEL_REJECTED     /**<  DM is received. */
+} cellularCmuxChannelState_t;
+
+/**
+ * @ingroup cellular_datatypes_enums
+ * @brief Result of checking the frame in the receive buffer.
+ */
+typedef enum cellularCmuxFrameStatus
+{
+    CMUX_FRAME_VALID = 0,  /**<  A complete frame with valid FCS. */
+    CMUX_FRAME_INCOMPLETE, /**<  More data is required. */
+    CMUX_FRAME_INVALID     /**<  The data is not a valid frame. */
+} cellularCmuxFrameStatus_t;
+
+/**
+ * @ingroup cellular_datatypes_structs
+ * @brief Context of a CMUX channel.
+ */
+typedef struct cellularCmuxChannel
+{
+    uint8_t dlci;                                                 /**<  The DLCI of the channel. */
+    volatile cellularCmuxChannelState_t state;                    /**<  The state of the DLCI. */
+    CellularCommInterfaceReceiveCallback_t receiveCB;             /**<  The receive callback registered by the channel user. */
+    void * pReceiveCBUserData;                                    /**<  The user data of the receive callback. */
+    uint8_t rxBuffer[ CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE ]; /**<  The ring of data received for the channel. */
+    uint32_t rxHead;                                              /**<  Offset of the oldest byte in the ring. */
+    uint32_t rxUsed;                                              /**<  The bytes used in the ring. */
+    bool bFlowStopped;                                            /**<  The modem is asked to stop sending frames of the DLCI. */
+} cellularCmuxChannel_t;
+
+/**
+ * @ingroup cellular_datatypes_structs
+ * @brief Context of the multiplexer.
+ */
+typedef struct cellularCmuxContext
+{
+    bool bInitialized;                                                   /**<  The multiplexer is initialized. */
+    const CellularCommInterface_t * pCommInterface;                      /**<  The comm interface of the physical link. */
+    CellularCommInterfaceHandle_t hCommInterface;                        /**<  The handle of the physical comm interface. */
+    volatile cellularCmuxChannelState_t controlState;                    /**<  The state of the control channel DLCI 0. */
+    uint8_t openChannelCount;                                            /**<  The number of opened channels. */
+    PlatformMutex_t txMutex;                                             /**<  The mutex to protect txFrame and the physical send. */
+    PlatformMutex_t rxMutex;                                             /**<  The mutex to protect rxFrame, the physical recv and channel state changes. */
+    PlatformMutex_t ringMutex;                                           /**<  The mutex to protect the channel rings. */
+    uint8_t txFrame[ CMUX_FRAME_BUFFER_SIZE ];                           /**<  The buffer to build the frame to send. */
+    uint8_t rxFrame[ CMUX_FRAME_BUFFER_SIZE ];                           /**<  The buffer of the data received from the physical link. */
+    uint32_t rxFrameLength;                                              /**<  The length of the data in rxFrame. */
+    cellularCmuxChannel_t channels[ CELLULAR_CONFIG_CMUX_MAX_CHANNELS ]; /**<  The channels. channels[ n ] is DLCI n + 1. */
+} cellularCmuxContext_t;
+
+/*-----------------------------------------------------------*/
+
+static uint8_t _cmuxFcsCompute( uint8_t fcs,
+                                const uint8_t * pData,
+                                uint32_t length );
+static volatile cellularCmuxChannelState_t * _cmuxGetState( uint8_t dlci );
+static uint32_t _cmuxRingPush( cellularCmuxChannel_t * pChannel,
+                               const uint8_t * pData,
+                               uint32_t length );
+static uint32_t _cmuxRingPop( cellularCmuxChannel_t * pChannel,
+                              uint8_t * pBuffer,
+                              uint32_t bufferLength );
+static CellularCommInterfaceError_t _cmuxSendFrame( uint8_t dlci,
+                                                    uint8_t control,
+                                                    const uint8_t * pInfo,
+                                                    uint32_t infoLength,
+                                                    uint32_t timeoutMilliseconds );
+static void _cmuxSendFlowControl( uint8_t dlci,
+                                  bool bStop );
+static void _cmuxDispatchFrame( uint8_t dlci,
+                                uint8_t control,
+                                const uint8_t * pInfo,
+                                uint32_t infoLength );
+static cellularCmuxFrameStatus_t _cmuxCheckFrame( const uint8_t * pFrame,
+                                                  uint32_t availableLength,
+                                                  uint32_t * pHeaderLength,
+                                                  uint32_t * pInfoLength );
+static void _cmuxParseFrames( void );
+static uint32_t _cmuxPull( uint32_t timeoutMilliseconds );
+static CellularCommInterfaceError_t _cmuxEstablish( uint8_t dlci );
+static CellularCommInterfaceError_t _cmuxClosePhysical( void );
+static CellularCommInterfaceError_t _cmuxReceiveCallback( void * pUserData,
+                                                          CellularCommInterfaceHandle_t commInterfaceHandle );
+static CellularCommInterfaceError_t _cmuxOpen( uint8_t dlci,
+                                               CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                               void * pUserData,
+                                               CellularCommInterfaceHandle_t * pCommInterfaceHandle );
+static CellularCommInterfaceError_t _cmuxOpenChannel1( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                       void * pUserData,
+                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle );
+static CellularCommInterfaceError_t _cmuxOpenChannel2( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                       void * pUserData,
+                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle );
+static CellularCommInterfaceError_t _cmuxOpenChannel3( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                       void * pUserData,
+                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle );
+static CellularCommInterfaceError_t _cmuxOpenChannel4( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                       void * pUserData,
+                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle );
+static CellularCommInterfaceError_t _cmuxSend( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                               const uint8_t * pData,
+                                               uint32_t dataLength,
+                                               uint32_t timeoutMilliseconds,
+                                               uint32_t * pDataSentLength );
+static CellularCommInterfaceError_t _cmuxRecv( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                               uint8_t * pBuffer,
+                                               uint32_t bufferLength,
+                                               uint32_t timeoutMilliseconds,
+                                               uint32_t * pDataReceivedLength );
+static CellularCommInterfaceError_t _cmuxClose( CellularCommInterfaceHandle_t commInterfaceHandle );
+
+/*-----------------------------------------------------------*/
+
+static cellularCmuxContext_t cellularCmuxContext = { 0 };
+
+/* The open function of each comm interface establishes its own DLCI. The
+ * optional functions are not supported since each frame is copied. */
+static const CellularCommInterface_t cellularCmuxChannelInterface[ CELLULAR_CMUX_MAX_SUPPORTED_CHANNELS ] =
+{
+    { _cmuxOpenChannel1, _cmuxSend, _cmuxRecv, _cmuxClose, NULL, NULL, NULL, NULL },
+    { _cmuxOpenChannel2, _cmuxSend, _cmuxRecv, _cmuxClose, NULL, NULL, NULL, NULL },
+    { _cmuxOpenChannel3, _cmuxSend, _cmuxRecv, _cmuxClose, NULL, NULL, NULL, NULL },
+    { _cmuxOpenChannel4, _cmuxSend, _cmuxRecv, _cmuxClose, NULL, NULL, NULL, NULL }
+};
+
+/*-----------------------------------------------------------*/
+
+static uint8_t _cmuxFcsCompute( uint8_t fcs,
+                                const uint8_t * pData,
+                                uint32_t length )
+{
+    uint8_t crc = fcs;
+    uint32_t i = 0;
+    uint8_t bit = 0;
+
+    /* Reversed CRC-8 with polynomial x^8 + x^2 + x + 1 defined in TS 27.010. */
+    for( i = 0; i < length; i++ )
+    {
+        crc = crc ^ pData[ i ];
+
+        for( bit = 0; bit < 8U; bit++ )
+        {
+            if( ( crc & 0x01U ) != 0U )
+            {
+                crc = ( uint8_t ) ( ( crc >> 1 ) ^ CMUX_FCS_POLYNOMIAL );
+            }
+            else
+            {
+                crc = ( uint8_t ) ( crc >> 1 );
+            }
+        }
+    }
+
+    return crc;
+}
+
+/*-----------------------------------------------------------*/
+
+static volatile cellularCmuxChannelState_t * _cmuxGetState( uint8_t dlci )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    volatile cellularCmuxChannelState_t * pState = NULL;
+
+    if( dlci == CMUX_CONTROL_DLCI )
+    {
+        pState = &pCmux->controlState;
+    }
+    else if( dlci <= CELLULAR_CONFIG_CMUX_MAX_CHANNELS )
+    {
+        pState = &pCmux->channels[ dlci - 1U ].state;
+    }
+    else
+    {
+        /* Empty else MISRA 15.7 */
+    }
+
+    return pState;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t _cmuxRingPush( cellularCmuxChannel_t * pChannel,
+                               const uint8_t * pData,
+                               uint32_t length )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    uint32_t pushLength = 0;
+    uint32_t tail = 0;
+    uint32_t firstLength = 0;
+
+    PlatformMutex_Lock( &pCmux->ringMutex );
+
+    pushLength = CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE - pChannel->rxUsed;
+
+    if( pushLength > length )
+    {
+        pushLength = length;
+    }
+
+    tail = ( pChannel->rxHead + pChannel->rxUsed ) % CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE;
+    firstLength = CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE - tail;
+
+    if( firstLength > pushLength )
+    {
+        firstLength = pushLength;
+    }
+
+    ( void ) memcpy( &pChannel->rxBuffer[ tail ], pData, firstLength );
+
+    if( firstLength < pushLength )
+    {
+        ( void ) memcpy( pChannel->rxBuffer, &pData[ firstLength ], pushLength - firstLength );
+    }
+
+    pChannel->rxUsed = pChannel->rxUsed + pushLength;
+
+    /* Stop the DLCI before the ring can't take another frame. The MSC is sent
+     * with ringMutex taken to keep the order with the one sent by _cmuxRingPop. */
+    if( ( pChannel->bFlowStopped == false ) &&
+        ( ( CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE - pChannel->rxUsed ) < CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE ) )
+    {
+        pChannel->bFlowStopped = true;
+        _cmuxSendFlowControl( pChannel->dlci, true );
+    }
+
+    PlatformMutex_Unlock( &pCmux->ringMutex );
+
+    return pushLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t _cmuxRingPop( cellularCmuxChannel_t * pChannel,
+                              uint8_t * pBuffer,
+                              uint32_t bufferLength )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    uint32_t popLength = 0;
+    uint32_t firstLength = 0;
+
+    PlatformMutex_Lock( &pCmux->ringMutex );
+
+    popLength = pChannel->rxUsed;
+
+    if( popLength > bufferLength )
+    {
+        popLength = bufferLength;
+    }
+
+    firstLength = CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE - pChannel->rxHead;
+
+    if( firstLength > popLength )
+    {
+        firstLength = popLength;
+    }
+
+    ( void ) memcpy( pBuffer, &pChannel->rxBuffer[ pChannel->rxHead ], firstLength );
+
+    if( firstLength < popLength )
+    {
+        ( void ) memcpy( &pBuffer[ firstLength ], pChannel->rxBuffer, popLength - firstLength );
+    }
+
+    pChannel->rxHead = ( pChannel->rxHead + popLength ) % CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE;
+    pChannel->rxUsed = pChannel->rxUsed - popLength;
+
+    /* Resume the DLCI when the ring is half empty and can take a frame, or is empty. */
+    if( ( pChannel->bFlowStopped == true ) &&
+        ( ( pChannel->rxUsed == 0U ) ||
+          ( ( pChannel->rxUsed <= ( CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE / 2U ) ) &&
+            ( ( CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE - pChannel->rxUsed ) >= CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE ) ) ) )
+    {
+        pChannel->bFlowStopped = false;
+        _cmuxSendFlowControl( pChannel->dlci, false );
+    }
+
+    PlatformMutex_Unlock( &pCmux->ringMutex );
+
+    return popLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxSendFrame( uint8_t dlci,
+                                                    uint8_t control,
+                                                    const uint8_t * pInfo,
+                                                    uint32_t infoLength,
+                                                    uint32_t timeoutMilliseconds )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+    uint8_t * pFrame = pCmux->txFrame;
+    uint32_t frameLength = 0;
+    uint32_t headerLength = 0;
+    uint32_t sentLength = 0;
+
+    PlatformMutex_Lock( &pCmux->txMutex );
+
+    pFrame[ 0 ] = CMUX_FLAG;
+    pFrame[ 1 ] = ( uint8_t ) ( ( uint8_t ) ( dlci << 2 ) | CMUX_CR | CMUX_EA );
+    pFrame[ 2 ] = control;
+
+    if( infoLength <= CMUX_SHORT_LENGTH_MAX )
+    {
+        pFrame[ 3 ] = ( uint8_t ) ( ( uint8_t ) ( infoLength << 1 ) | CMUX_EA );
+        headerLength = 3U;
+    }
+    else
+    {
+        pFrame[ 3 ] = ( uint8_t ) ( ( infoLength & CMUX_SHORT_LENGTH_MAX ) << 1 );
+        pFrame[ 4 ] = ( uint8_t ) ( infoLength >> 7 );
+        headerLength = 4U;
+    }
+
+    frameLength = 1U + headerLength;
+
+    if( infoLength > 0U )
+    {
+        ( void ) memcpy( &pFrame[ frameLength ], pInfo, infoLength );
+        frameLength = frameLength + infoLength;
+    }
+
+    /* The FCS of UIH frames is calculated over the address, control and length fields only. */
+    pFrame[ frameLength ] = ( uint8_t ) ( CMUX_FCS_INIT - _cmuxFcsCompute( CMUX_FCS_INIT, &pFrame[ 1 ], headerLength ) );
+    pFrame[ frameLength + 1U ] = CMUX_FLAG;
+    frameLength = frameLength + 2U;
+
+    commIntRet = pCmux->pCommInterface->send( pCmux->hCommInterface, pFrame, frameLength,
+                                              timeoutMilliseconds, &sentLength );
+
+    if( ( commIntRet == IOT_COMM_INTERFACE_SUCCESS ) && ( sentLength != frameLength ) )
+    {
+        LogError( ( "_cmuxSendFrame : DLCI %u frame sent %u of %u bytes", dlci,
+                    ( unsigned int ) sentLength, ( unsigned int ) frameLength ) );
+        commIntRet = IOT_COMM_INTERFACE_FAILURE;
+    }
+
+    PlatformMutex_Unlock( &pCmux->txMutex );
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static void _cmuxSendFlowControl( uint8_t dlci,
+                                  bool bStop )
+{
+    uint8_t msc[ 4 ] = { CMUX_MSC_COMMAND, CMUX_MSC_LENGTH, 0, CMUX_MSC_SIGNALS };
+
+    /* The address octet of the MSC always has the bit 2 set. */
+    msc[ 2 ] = ( uint8_t ) ( ( uint8_t ) ( dlci << 2 ) | CMUX_CR | CMUX_EA );
+
+    if( bStop == true )
+    {
+        msc[ 3 ] = ( uint8_t ) ( msc[ 3 ] | CMUX_MSC_FC );
+    }
+
+    if( _cmuxSendFrame( CMUX_CONTROL_DLCI, CMUX_CTRL_UIH, msc, sizeof( msc ),
+                        CELLULAR_COMM_IF_SEND_TIMEOUT_MS ) != IOT_COMM_INTERFACE_SUCCESS )
+    {
+        LogError( ( "_cmuxSendFlowControl : DLCI %u flow control %d failed", dlci, ( int ) bStop ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void _cmuxDispatchFrame( uint8_t dlci,
+                                uint8_t control,
+                                const uint8_t * pInfo,
+                                uint32_t infoLength )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    volatile cellularCmuxChannelState_t * pState = _cmuxGetState( dlci );
+    cellularCmuxChannel_t * pChannel = NULL;
+    uint32_t pushLength = 0;
+
+    if( pState == NULL )
+    {
+        LogDebug( ( "_cmuxDispatchFrame : Frame for unknown DLCI %u", dlci ) );
+    }
+    else
+    {
+        switch( ( uint8_t ) ( control & ( uint8_t ) ~CMUX_PF ) )
+        {
+            case CMUX_CTRL_UA:
+
+                if( *pState == CMUX_CHANNEL_OPENING )
+                {
+                    *pState = CMUX_CHANNEL_ESTABLISHED;
+                }
+
+                break;
+
+            case CMUX_CTRL_DM:
+
+                if( *pState == CMUX_CHANNEL_OPENING )
+                {
+                    *pState = CMUX_CHANNEL_REJECTED;
+                }
+                else
+                {
+                    LogWarn( ( "_cmuxDispatchFrame : DLCI %u disconnected by the modem", dlci ) );
+                }
+
+                break;
+
+            case CMUX_CTRL_UIH:
+            case CMUX_CTRL_UI:
+
+                if( dlci == CMUX_CONTROL_DLCI )
+                {
+                    /* Multiplexer control messages are not supported. */
+                    LogDebug( ( "_cmuxDispatchFrame : Control message of %u bytes ignored", ( unsigned int ) infoLength ) );
+                }
+                else if( ( *pState == CMUX_CHANNEL_OPENING ) || ( *pState == CMUX_CHANNEL_ESTABLISHED ) )
+                {
+                    pChannel = &pCmux->channels[ dlci - 1U ];
+                    pushLength = _cmuxRingPush( pChannel, pInfo, infoLength );
+
+                    /* Only frames sent by the modem before the flow control takes effect are dropped. */
+                    if( pushLength < infoLength )
+                    {
+                        LogWarn( ( "_cmuxDispatchFrame : DLCI %u buffer full, %u bytes dropped", dlci,
+                                   ( unsigned int ) ( infoLength - pushLength ) ) );
+                    }
+
+                    /* The channel is not notified. It is notified by the physical receive
+                     * callback of this data and waits for rxMutex in _cmuxRecv. */
+                }
+                else
+                {
+                    LogDebug( ( "_cmuxDispatchFrame : Data for closed DLCI %u dropped", dlci ) );
+                }
+
+                break;
+
+            default:
+                LogDebug( ( "_cmuxDispatchFrame : DLCI %u frame 0x%02x ignored", dlci, control ) );
+                break;
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static cellularCmuxFrameStatus_t _cmuxCheckFrame( const uint8_t * pFrame,
+                                                  uint32_t availableLength,
+                                                  uint32_t * pHeaderLength,
+                                                  uint32_t * pInfoLength )
+{
+    cellularCmuxFrameStatus_t frameStatus = CMUX_FRAME_VALID;
+    uint32_t headerLength = 3U;
+    uint32_t infoLength = 0;
+    uint32_t frameLength = 0;
+    uint32_t fcsLength = 0;
+    uint8_t fcs = 0;
+
+    /* pFrame[ 0 ] is the opening flag. */
+    if( availableLength < 4U )
+    {
+        frameStatus = CMUX_FRAME_INCOMPLETE;
+    }
+    else if( ( pFrame[ 3 ] & CMUX_EA ) != 0U )
+    {
+        infoLength = ( uint32_t ) pFrame[ 3 ] >> 1;
+    }
+    else if( availableLength < 5U )
+    {
+        frameStatus = CMUX_FRAME_INCOMPLETE;
+    }
+    else
+    {
+        headerLength = 4U;
+        infoLength = ( ( uint32_t ) pFrame[ 3 ] >> 1 ) | ( ( uint32_t ) pFrame[ 4 ] << 7 );
+    }
+
+    if( frameStatus == CMUX_FRAME_VALID )
+    {
+        frameLength = 1U + headerLength + infoLength + 2U;
+
+        if( ( infoLength > CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE ) || ( ( pFrame[ 1 ] & CMUX_EA ) == 0U ) )
+        {
+            frameStatus = CMUX_FRAME_INVALID;
+        }
+        else if( availableLength < frameLength )
+        {
+            frameStatus = CMUX_FRAME_INCOMPLETE;
+        }
+        else if( pFrame[ frameLength - 1U ] != CMUX_FLAG )
+        {
+            frameStatus = CMUX_FRAME_INVALID;
+        }
+        else
+        {
+            /* The FCS of UI frames also covers the information field. */
+            fcsLength = headerLength;
+
+            if( ( uint8_t ) ( pFrame[ 2 ] & ( uint8_t ) ~CMUX_PF ) == CMUX_CTRL_UI )
+            {
+                fcsLength = fcsLength + infoLength;
+            }
+
+            fcs = _cmuxFcsCompute( CMUX_FCS_INIT, &pFrame[ 1 ], fcsLength );
+            fcs = _cmuxFcsCompute( fcs, &pFrame[ frameLength - 2U ], 1U );
+
+            if( fcs != CMUX_FCS_GOOD )
+            {
+                frameStatus = CMUX_FRAME_INVALID;
+            }
+        }
+    }
+
+    *pHeaderLength = headerLength;
+    *pInfoLength = infoLength;
+
+    return frameStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static void _cmuxParseFrames( void )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    cellularCmuxFrameStatus_t frameStatus = CMUX_FRAME_VALID;
+    const uint8_t * pFrame = NULL;
+    uint32_t offset = 0;
+    uint32_t availableLength = 0;
+    uint32_t headerLength = 0;
+    uint32_t infoLength = 0;
+
+    while( ( frameStatus != CMUX_FRAME_INCOMPLETE ) && ( offset < pCmux->rxFrameLength ) )
+    {
+        pFrame = &pCmux->rxFrame[ offset ];
+        availableLength = pCmux->rxFrameLength - offset;
+
+        if( pFrame[ 0 ] != CMUX_FLAG )
+        {
+            /* Skip the data before the opening flag. */
+            offset++;
+        }
+        else if( availableLength < 2U )
+        {
+            frameStatus = CMUX_FRAME_INCOMPLETE;
+        }
+        else if( pFrame[ 1 ] == CMUX_FLAG )
+        {
+            /* Consecutive flags. The last one is the opening flag. */
+            offset++;
+        }
+        else
+        {
+            frameStatus = _cmuxCheckFrame( pFrame, availableLength, &headerLength, &infoLength );
+
+            if( frameStatus == CMUX_FRAME_VALID )
+            {
+                _cmuxDispatchFrame( ( uint8_t ) ( pFrame[ 1 ] >> 2 ), pFrame[ 2 ],
+                                    &pFrame[ 1U + headerLength ], infoLength );
+
+                /* The closing flag may be the opening flag of the next frame. */
+                offset = offset + headerLength + infoLength + 2U;
+            }
+            else if( frameStatus == CMUX_FRAME_INVALID )
+            {
+                LogDebug( ( "_cmuxParseFrames : Invalid frame dropped" ) );
+                offset++;
+            }
+            else
+            {
+                /* Empty else MISRA 15.7 */
+            }
+        }
+    }
+
+    if( offset > 0U )
+    {
+        pCmux->rxFrameLength = pCmux->rxFrameLength - offset;
+        ( void ) memmove( pCmux->rxFrame, &pCmux->rxFrame[ offset ], pCmux->rxFrameLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t _cmuxPull( uint32_t timeoutMilliseconds )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+    uint32_t freeLength = CMUX_FRAME_BUFFER_SIZE - pCmux->rxFrameLength;
+    uint32_t receivedLength = 0;
+
+    /* rxMutex is taken by the caller. The parser always leaves space for the rest of an incomplete frame. */
+    commIntRet = pCmux->pCommInterface->recv( pCmux->hCommInterface, &pCmux->rxFrame[ pCmux->rxFrameLength ],
+                                              freeLength, timeoutMilliseconds, &receivedLength );
+
+    if( ( commIntRet != IOT_COMM_INTERFACE_SUCCESS ) || ( receivedLength > freeLength ) )
+    {
+        receivedLength = 0;
+    }
+
+    if( receivedLength > 0U )
+    {
+        pCmux->rxFrameLength = pCmux->rxFrameLength + receivedLength;
+        _cmuxParseFrames();
+    }
+
+    return receivedLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxEstablish( uint8_t dlci )
+{
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+    volatile cellularCmuxChannelState_t * pState = _cmuxGetState( dlci );
+    uint32_t retry = 0;
+    uint32_t poll = 0;
+
+    /* rxMutex is taken by the caller. The response is received by polling the physical link. */
+    *pState = CMUX_CHANNEL_OPENING;
+
+    for( retry = 0; ( retry < CMUX_SABM_RETRY_COUNT ) && ( *pState == CMUX_CHANNEL_OPENING ); retry++ )
+    {
+        commIntRet = _cmuxSendFrame( dlci, CMUX_CTRL_SABM | CMUX_PF, NULL, 0U, CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+
+        if( commIntRet != IOT_COMM_INTERFACE_SUCCESS )
+        {
+            break;
+        }
+
+        for( poll = 0; ( poll < CMUX_RESPONSE_POLL_COUNT ) && ( *pState == CMUX_CHANNEL_OPENING ); poll++ )
+        {
+            if( _cmuxPull( CMUX_RESPONSE_POLL_MS ) == 0U )
+            {
+                Platform_Delay( CMUX_RESPONSE_POLL_MS );
+            }
+        }
+    }
+
+    if( *pState != CMUX_CHANNEL_ESTABLISHED )
+    {
+        LogError( ( "_cmuxEstablish : DLCI %u is not established, state %d", dlci, ( int ) *pState ) );
+        *pState = CMUX_CHANNEL_CLOSED;
+        commIntRet = IOT_COMM_INTERFACE_FAILURE;
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxClosePhysical( void )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+
+    if( pCmux->controlState == CMUX_CHANNEL_ESTABLISHED )
+    {
+        /* The response is not waited. The physical link is closed anyway. */
+        ( void ) _cmuxSendFrame( CMUX_CONTROL_DLCI, CMUX_CTRL_DISC | CMUX_PF, NULL, 0U,
+                                 CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+    }
+
+    pCmux->controlState = CMUX_CHANNEL_CLOSED;
+    commIntRet = pCmux->pCommInterface->close( pCmux->hCommInterface );
+    pCmux->hCommInterface = NULL;
+    pCmux->rxFrameLength = 0;
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxReceiveCallback( void * pUserData,
+                                                          CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    cellularCmuxContext_t * pCmux = ( cellularCmuxContext_t * ) pUserData;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_FAILURE;
+    CellularCommInterfaceError_t channelRet = IOT_COMM_INTERFACE_FAILURE;
+    cellularCmuxChannel_t * pChannel = NULL;
+    uint32_t i = 0;
+
+    ( void ) commInterfaceHandle;
+
+    /* This function may be called from ISR. The data may belong to any channel.
+     * Forward the event to all the channels. The first channel to receive
+     * demultiplexes the data. */
+    for( i = 0; i < CELLULAR_CONFIG_CMUX_MAX_CHANNELS; i++ )
+    {
+        pChannel = &pCmux->channels[ i ];
+
+        if( ( pChannel->state == CMUX_CHANNEL_ESTABLISHED ) && ( pChannel->receiveCB != NULL ) )
+        {
+            channelRet = pChannel->receiveCB( pChannel->pReceiveCBUserData,
+                                              ( CellularCommInterfaceHandle_t ) pChannel );
+
+            if( ( channelRet == IOT_COMM_INTERFACE_SUCCESS ) ||
+                ( ( channelRet == IOT_COMM_INTERFACE_BUSY ) && ( commIntRet != IOT_COMM_INTERFACE_SUCCESS ) ) )
+            {
+                commIntRet = channelRet;
+            }
+        }
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxOpen( uint8_t dlci,
+                                               CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                               void * pUserData,
+                                               CellularCommInterfaceHandle_t * pCommInterfaceHandle )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+    cellularCmuxChannel_t * pChannel = NULL;
+    bool bPhysicalOpened = false;
+
+    if( pCmux->bInitialized == false )
+    {
+        LogError( ( "_cmuxOpen : Multiplexer is not initialized" ) );
+        commIntRet = IOT_COMM_INTERFACE_FAILURE;
+    }
+    else if( ( pCommInterfaceHandle == NULL ) || ( dlci > CELLULAR_CONFIG_CMUX_MAX_CHANNELS ) )
+    {
+        commIntRet = IOT_COMM_INTERFACE_BAD_PARAMETER;
+    }
+    else
+    {
+        pChannel = &pCmux->channels[ dlci - 1U ];
+        PlatformMutex_Lock( &pCmux->rxMutex );
+
+        if( pChannel->state != CMUX_CHANNEL_CLOSED )
+        {
+            LogError( ( "_cmuxOpen : DLCI %u is already opened", dlci ) );
+            commIntRet = IOT_COMM_INTERFACE_FAILURE;
+        }
+        else
+        {
+            if( pCmux->openChannelCount == 0U )
+            {
+                pCmux->rxFrameLength = 0;
+                commIntRet = pCmux->pCommInterface->open( _cmuxReceiveCallback, pCmux, &pCmux->hCommInterface );
+                bPhysicalOpened = ( commIntRet == IOT_COMM_INTERFACE_SUCCESS ) ? true : false;
+            }
+
+            if( ( commIntRet == IOT_COMM_INTERFACE_SUCCESS ) && ( pCmux->controlState != CMUX_CHANNEL_ESTABLISHED ) )
+            {
+                commIntRet = _cmuxEstablish( CMUX_CONTROL_DLCI );
+            }
+
+            if( commIntRet == IOT_COMM_INTERFACE_SUCCESS )
+            {
+                pChannel->receiveCB = receiveCallback;
+                pChannel->pReceiveCBUserData = pUserData;
+                pChannel->rxHead = 0;
+                pChannel->rxUsed = 0;
+                pChannel->bFlowStopped = false;
+                commIntRet = _cmuxEstablish( dlci );
+            }
+
+            if( commIntRet == IOT_COMM_INTERFACE_SUCCESS )
+            {
+                pCmux->openChannelCount++;
+                *pCommInterfaceHandle = ( CellularCommInterfaceHandle_t ) pChannel;
+            }
+            else
+            {
+                pChannel->receiveCB = NULL;
+                pChannel->pReceiveCBUserData = NULL;
+
+                if( bPhysicalOpened == true )
+                {
+                    ( void ) _cmuxClosePhysical();
+                }
+            }
+        }
+
+        PlatformMutex_Unlock( &pCmux->rxMutex );
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxOpenChannel1( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                       void * pUserData,
+                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle )
+{
+    return _cmuxOpen( 1U, receiveCallback, pUserData, pCommInterfaceHandle );
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxOpenChannel2( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                       void * pUserData,
+                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle )
+{
+    return _cmuxOpen( 2U, receiveCallback, pUserData, pCommInterfaceHandle );
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxOpenChannel3( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                       void * pUserData,
+                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle )
+{
+    return _cmuxOpen( 3U, receiveCallback, pUserData, pCommInterfaceHandle );
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxOpenChannel4( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                       void * pUserData,
+                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle )
+{
+    return _cmuxOpen( 4U, receiveCallback, pUserData, pCommInterfaceHandle );
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxSend( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                               const uint8_t * pData,
+                                               uint32_t dataLength,
+                                               uint32_t timeoutMilliseconds,
+                                               uint32_t * pDataSentLength )
+{
+    const cellularCmuxChannel_t * pChannel = ( const cellularCmuxChannel_t * ) commInterfaceHandle;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+    uint32_t sentLength = 0;
+    uint32_t infoLength = 0;
+
+    if( ( pChannel == NULL ) || ( pData == NULL ) || ( pDataSentLength == NULL ) )
+    {
+        commIntRet = IOT_COMM_INTERFACE_BAD_PARAMETER;
+    }
+    else if( pChannel->state != CMUX_CHANNEL_ESTABLISHED )
+    {
+        commIntRet = IOT_COMM_INTERFACE_FAILURE;
+    }
+    else
+    {
+        /* Split the data into UIH frames of at most N1 bytes. */
+        while( ( sentLength < dataLength ) && ( commIntRet == IOT_COMM_INTERFACE_SUCCESS ) )
+        {
+            infoLength = dataLength - sentLength;
+
+            if( infoLength > CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE )
+            {
+                infoLength = CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE;
+            }
+
+            commIntRet = _cmuxSendFrame( pChannel->dlci, CMUX_CTRL_UIH, &pData[ sentLength ], infoLength,
+                                         timeoutMilliseconds );
+
+            if( commIntRet == IOT_COMM_INTERFACE_SUCCESS )
+            {
+                sentLength = sentLength + infoLength;
+            }
+        }
+
+        *pDataSentLength = sentLength;
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxRecv( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                               uint8_t * pBuffer,
+                                               uint32_t bufferLength,
+                                               uint32_t timeoutMilliseconds,
+                                               uint32_t * pDataReceivedLength )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    cellularCmuxChannel_t * pChannel = ( cellularCmuxChannel_t * ) commInterfaceHandle;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+    uint32_t receivedLength = 0;
+
+    if( ( pChannel == NULL ) || ( pBuffer == NULL ) || ( pDataReceivedLength == NULL ) )
+    {
+        commIntRet = IOT_COMM_INTERFACE_BAD_PARAMETER;
+    }
+    else if( pChannel->state != CMUX_CHANNEL_ESTABLISHED )
+    {
+        commIntRet = IOT_COMM_INTERFACE_FAILURE;
+    }
+    else
+    {
+        receivedLength = _cmuxRingPop( pChannel, pBuffer, bufferLength );
+
+        /* If another channel is receiving from the physical link, the data of
+         * this channel may be demultiplexed to the ring by that channel. Wait
+         * for it instead of being notified from the task context. */
+        if( receivedLength == 0U )
+        {
+            PlatformMutex_Lock( &pCmux->rxMutex );
+            receivedLength = _cmuxRingPop( pChannel, pBuffer, bufferLength );
+
+            if( receivedLength == 0U )
+            {
+                ( void ) _cmuxPull( timeoutMilliseconds );
+                receivedLength = _cmuxRingPop( pChannel, pBuffer, bufferLength );
+            }
+
+            PlatformMutex_Unlock( &pCmux->rxMutex );
+        }
+
+        *pDataReceivedLength = receivedLength;
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _cmuxClose( CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    cellularCmuxChannel_t * pChannel = ( cellularCmuxChannel_t * ) commInterfaceHandle;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+
+    if( pChannel == NULL )
+    {
+        commIntRet = IOT_COMM_INTERFACE_BAD_PARAMETER;
+    }
+    else
+    {
+        PlatformMutex_Lock( &pCmux->rxMutex );
+
+        if( pChannel->state != CMUX_CHANNEL_ESTABLISHED )
+        {
+            commIntRet = IOT_COMM_INTERFACE_FAILURE;
+        }
+        else
+        {
+            /* The response is not waited. The modem releases the DLCI anyway. */
+            ( void ) _cmuxSendFrame( pChannel->dlci, CMUX_CTRL_DISC | CMUX_PF, NULL, 0U,
+                                     CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+            pChannel->state = CMUX_CHANNEL_CLOSED;
+            pChannel->receiveCB = NULL;
+            pChannel->pReceiveCBUserData = NULL;
+            pCmux->openChannelCount--;
+
+            if( pCmux->openChannelCount == 0U )
+            {
+                commIntRet = _cmuxClosePhysical();
+            }
+        }
+
+        PlatformMutex_Unlock( &pCmux->rxMutex );
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CmuxInit( const CellularCommInterface_t * pCommInterface )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    uint8_t i = 0;
+
+    if( ( pCommInterface == NULL ) ||
+        ( pCommInterface->open == NULL ) ||
+        ( pCommInterface->send == NULL ) ||
+        ( pCommInterface->recv == NULL ) ||
+        ( pCommInterface->close == NULL ) )
+    {
+        LogError( ( "Cellular_CmuxInit : Invalid comm interface" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( pCmux->bInitialized == true )
+    {
+        LogError( ( "Cellular_CmuxInit : Multiplexer is already initialized" ) );
+        cellularStatus = CELLULAR_NOT_ALLOWED;
+    }
+    else
+    {
+        ( void ) memset( pCmux, 0, sizeof( cellularCmuxContext_t ) );
+
+        if( PlatformMutex_Create( &pCmux->txMutex, false ) != true )
+        {
+            cellularStatus = CELLULAR_RESOURCE_CREATION_FAIL;
+        }
+        else if( PlatformMutex_Create( &pCmux->rxMutex, false ) != true )
+        {
+            PlatformMutex_Destroy( &pCmux->txMutex );
+            cellularStatus = CELLULAR_RESOURCE_CREATION_FAIL;
+        }
+        else if( PlatformMutex_Create( &pCmux->ringMutex, false ) != true )
+        {
+            PlatformMutex_Destroy( &pCmux->txMutex );
+            PlatformMutex_Destroy( &pCmux->rxMutex );
+            cellularStatus = CELLULAR_RESOURCE_CREATION_FAIL;
+        }
+        else
+        {
+            /* Empty else MISRA 15.7 */
+        }
+
+        if( cellularStatus != CELLULAR_SUCCESS )
+        {
+            LogError( ( "Cellular_CmuxInit : Create mutex failed" ) );
+        }
+    }
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        for( i = 0; i < CELLULAR_CONFIG_CMUX_MAX_CHANNELS; i++ )
+        {
+            pCmux->channels[ i ].dlci = ( uint8_t ) ( i + 1U );
+        }
+
+        pCmux->pCommInterface = pCommInterface;
+        pCmux->bInitialized = true;
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CmuxGetChannel( uint8_t dlci,
+                                         const CellularCommInterface_t ** ppChannelCommInterface )
+{
+    const cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    if( ( ppChannelCommInterface == NULL ) || ( dlci == CMUX_CONTROL_DLCI ) ||
+        ( dlci > CELLULAR_CONFIG_CMUX_MAX_CHANNELS ) )
+    {
+        LogError( ( "Cellular_CmuxGetChannel : Bad parameter" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( pCmux->bInitialized == false )
+    {
+        LogError( ( "Cellular_CmuxGetChannel : Multiplexer is not initialized" ) );
+        cellularStatus = CELLULAR_NOT_ALLOWED;
+    }
+    else
+    {
+        *ppChannelCommInterface = &cellularCmuxChannelInterface[ dlci - 1U ];
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+void Cellular_CmuxDeinit( void )
+{
+    cellularCmuxContext_t * pCmux = &cellularCmuxContext;
+
+    if( pCmux->bInitialized == true )
+    {
+        PlatformMutex_Destroy( &pCmux->txMutex );
+        PlatformMutex_Destroy( &pCmux->rxMutex );
+        PlatformMutex_Destroy( &pCmux->ringMutex );
+        ( void ) memset( pCmux, 0, sizeof( cellularCmuxContext_t ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
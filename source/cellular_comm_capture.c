@@ -0,0 +1,550 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @brief FreeRTOS Cellular Library comm interface capture recorder.
+ */
+
+/* The config header is always included first. */
+
+#ifndef CELLULAR_DO_NOT_USE_CUSTOM_CONFIG
+    /* Include custom config file before other headers. */
+    #include "cellular_config.h"
+#endif
+#include "cellular_config_defaults.h"
+
+/* Standard includes. */
+#include <string.h>
+
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_internal.h"
+#include "cellular_comm_interface.h"
+#include "cellular_comm_capture.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Maximum payload length of a record.
+ */
+#define CAPTURE_MAX_PAYLOAD_LENGTH    ( 0xFFFFU )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @ingroup cellular_datatypes_structs
+ * @brief Context of the capture recorder.
+ */
+typedef struct cellularCommCaptureContext
+{
+    bool bInitialized;                                /**<  The recorder is initialized. */
+    bool bEnabled;                                    /**<  Recording is enabled. */
+    PlatformMutex_t captureMutex;                     /**<  The mutex to protect the ring. */
+    CellularCommCaptureConfig_t config;               /**<  The capture recorder configuration. */
+    CellularCommInterfaceHandle_t hCommInterface;     /**<  The handle of the captured comm interface. */
+    CellularCommInterfaceReceiveCallback_t receiveCB; /**<  The receive callback registered by the cellular library. */
+    void * pReceiveCBUserData;                        /**<  The user data of the receive callback. */
+    uint32_t ringHead;                                /**<  Offset of the oldest record in the ring. */
+    uint32_t ringUsed;                                /**<  The bytes used in the ring. */
+} cellularCommCaptureContext_t;
+
+/*-----------------------------------------------------------*/
+
+static void _ringRead( uint32_t offset,
+                       uint8_t * pDst,
+                       uint32_t length );
+static void _ringWrite( uint32_t offset,
+                        const uint8_t * pSrc,
+                        uint32_t length );
+static void _ringDropOldest( void );
+static void _captureRecord( CellularCommCaptureRecordType_t recordType,
+                            const uint8_t * pPayload,
+                            uint32_t payloadLength );
+static CellularCommInterfaceError_t _captureReceiveCallback( void * pUserData,
+                                                              CellularCommInterfaceHandle_t commInterfaceHandle );
+static CellularCommInterfaceError_t _captureOpen( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                  void * pUserData,
+                                                  CellularCommInterfaceHandle_t * pCommInterfaceHandle );
+static CellularCommInterfaceError_t _captureSend( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                  const uint8_t * pData,
+                                                  uint32_t dataLength,
+                                                  uint32_t timeoutMilliseconds,
+                                                  uint32_t * pDataSentLength );
+static CellularCommInterfaceError_t _captureRecv( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                  uint8_t * pBuffer,
+                                                  uint32_t bufferLength,
+                                                  uint32_t timeoutMilliseconds,
+                                                  uint32_t * pDataReceivedLength );
+static CellularCommInterfaceError_t _captureClose( CellularCommInterfaceHandle_t commInterfaceHandle );
+
+/*-----------------------------------------------------------*/
+
+static cellularCommCaptureContext_t cellularCommCaptureContext = { 0 };
+
+static const CellularCommInterface_t cellularCommCaptureInterface =
+{
+    _captureOpen,
+    _captureSend,
+    _captureRecv,
+    _captureClose,
+    NULL, /* Segments are sent with _captureSend to record each of them. */
+    NULL, /* Received data is copied with _captureRecv to record it. */
+    NULL,
+    NULL  /* Data is sent with _captureSend to record it. */
+};
+
+/*-----------------------------------------------------------*/
+
+static void _ringRead( uint32_t offset,
+                       uint8_t * pDst,
+                       uint32_t length )
+{
+    const cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+    uint32_t ringOffset = offset % pCapture->config.ringBufferSize;
+    uint32_t firstLength = pCapture->config.ringBufferSize - ringOffset;
+
+    if( firstLength > length )
+    {
+        firstLength = length;
+    }
+
+    ( void ) memcpy( pDst, &pCapture->config.pRingBuffer[ ringOffset ], firstLength );
+
+    if( firstLength < length )
+    {
+        ( void ) memcpy( &pDst[ firstLength ], pCapture->config.pRingBuffer, length - firstLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void _ringWrite( uint32_t offset,
+                        const uint8_t * pSrc,
+                        uint32_t length )
+{
+    const cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+    uint32_t ringOffset = offset % pCapture->config.ringBufferSize;
+    uint32_t firstLength = pCapture->config.ringBufferSize - ringOffset;
+
+    if( firstLength > length )
+    {
+        firstLength = length;
+    }
+
+    ( void ) memcpy( &pCapture->config.pRingBuffer[ ringOffset ], pSrc, firstLength );
+
+    if( firstLength < length )
+    {
+        ( void ) memcpy( pCapture->config.pRingBuffer, &pSrc[ firstLength ], length - firstLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void _ringDropOldest( void )
+{
+    cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+    uint8_t recordHeader[ CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ] = { 0 };
+    uint32_t recordLength = 0;
+
+    _ringRead( pCapture->ringHead, recordHeader, CELLULAR_COMM_CAPTURE_REC_HDR_SIZE );
+    recordLength = CELLULAR_COMM_CAPTURE_REC_HDR_SIZE +
+                   ( ( uint32_t ) recordHeader[ 5 ] | ( ( uint32_t ) recordHeader[ 6 ] << 8 ) );
+
+    pCapture->ringHead = ( pCapture->ringHead + recordLength ) % pCapture->config.ringBufferSize;
+    pCapture->ringUsed = pCapture->ringUsed - recordLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static void _captureRecord( CellularCommCaptureRecordType_t recordType,
+                            const uint8_t * pPayload,
+                            uint32_t payloadLength )
+{
+    cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+    uint8_t recordHeader[ CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ] = { 0 };
+    uint32_t timestampMs = CELLULAR_CONFIG_GET_TIME_MS();
+    uint32_t storedLength = payloadLength;
+    uint8_t typeField = ( uint8_t ) recordType;
+    const uint8_t * pStoredPayload = pPayload;
+
+    if( storedLength > CAPTURE_MAX_PAYLOAD_LENGTH )
+    {
+        storedLength = CAPTURE_MAX_PAYLOAD_LENGTH;
+    }
+
+    if( ( pCapture->config.pRingBuffer != NULL ) &&
+        ( ( storedLength + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ) > pCapture->config.ringBufferSize ) )
+    {
+        /* Keep the tail of the chunk which is the latest data. */
+        storedLength = pCapture->config.ringBufferSize - CELLULAR_COMM_CAPTURE_REC_HDR_SIZE;
+    }
+
+    if( storedLength < payloadLength )
+    {
+        typeField = typeField | ( uint8_t ) CELLULAR_COMM_CAPTURE_FLAG_TRUNCATED;
+        pStoredPayload = &pPayload[ payloadLength - storedLength ];
+    }
+
+    recordHeader[ 0 ] = typeField;
+    recordHeader[ 1 ] = ( uint8_t ) ( timestampMs & 0xFFU );
+    recordHeader[ 2 ] = ( uint8_t ) ( ( timestampMs >> 8 ) & 0xFFU );
+    recordHeader[ 3 ] = ( uint8_t ) ( ( timestampMs >> 16 ) & 0xFFU );
+    recordHeader[ 4 ] = ( uint8_t ) ( ( timestampMs >> 24 ) & 0xFFU );
+    recordHeader[ 5 ] = ( uint8_t ) ( storedLength & 0xFFU );
+    recordHeader[ 6 ] = ( uint8_t ) ( ( storedLength >> 8 ) & 0xFFU );
+
+    PlatformMutex_Lock( &pCapture->captureMutex );
+
+    if( pCapture->config.pRingBuffer != NULL )
+    {
+        while( ( pCapture->config.ringBufferSize - pCapture->ringUsed ) <
+               ( storedLength + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ) )
+        {
+            _ringDropOldest();
+        }
+
+        _ringWrite( pCapture->ringHead + pCapture->ringUsed, recordHeader, CELLULAR_COMM_CAPTURE_REC_HDR_SIZE );
+
+        if( storedLength > 0U )
+        {
+            _ringWrite( pCapture->ringHead + pCapture->ringUsed + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE,
+                        pStoredPayload, storedLength );
+        }
+
+        pCapture->ringUsed = pCapture->ringUsed + storedLength + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE;
+    }
+
+    if( pCapture->config.sink != NULL )
+    {
+        pCapture->config.sink( recordHeader, pStoredPayload, ( uint16_t ) storedLength, pCapture->config.pSinkContext );
+    }
+
+    PlatformMutex_Unlock( &pCapture->captureMutex );
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _captureReceiveCallback( void * pUserData,
+                                                              CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    const cellularCommCaptureContext_t * pCapture = ( const cellularCommCaptureContext_t * ) pUserData;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_FAILURE;
+
+    ( void ) commInterfaceHandle;
+
+    /* This function may be called from ISR. Forward the event only. */
+    if( pCapture->receiveCB != NULL )
+    {
+        commIntRet = pCapture->receiveCB( pCapture->pReceiveCBUserData,
+                                          ( CellularCommInterfaceHandle_t ) pCapture );
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _captureOpen( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                  void * pUserData,
+                                                  CellularCommInterfaceHandle_t * pCommInterfaceHandle )
+{
+    cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+
+    if( pCapture->bInitialized == false )
+    {
+        LogError( ( "_captureOpen : Capture recorder is not initialized" ) );
+        commIntRet = IOT_COMM_INTERFACE_FAILURE;
+    }
+    else if( pCommInterfaceHandle == NULL )
+    {
+        commIntRet = IOT_COMM_INTERFACE_BAD_PARAMETER;
+    }
+    else
+    {
+        pCapture->receiveCB = receiveCallback;
+        pCapture->pReceiveCBUserData = pUserData;
+        commIntRet = pCapture->config.pCommInterface->open( _captureReceiveCallback, pCapture,
+                                                            &pCapture->hCommInterface );
+
+        if( commIntRet == IOT_COMM_INTERFACE_SUCCESS )
+        {
+            *pCommInterfaceHandle = ( CellularCommInterfaceHandle_t ) pCapture;
+
+            if( pCapture->bEnabled == true )
+            {
+                _captureRecord( CELLULAR_COMM_CAPTURE_RECORD_OPEN, NULL, 0U );
+            }
+        }
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _captureSend( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                  const uint8_t * pData,
+                                                  uint32_t dataLength,
+                                                  uint32_t timeoutMilliseconds,
+                                                  uint32_t * pDataSentLength )
+{
+    const cellularCommCaptureContext_t * pCapture = ( const cellularCommCaptureContext_t * ) commInterfaceHandle;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+
+    if( ( pCapture == NULL ) || ( pDataSentLength == NULL ) )
+    {
+        commIntRet = IOT_COMM_INTERFACE_BAD_PARAMETER;
+    }
+    else
+    {
+        commIntRet = pCapture->config.pCommInterface->send( pCapture->hCommInterface, pData, dataLength,
+                                                            timeoutMilliseconds, pDataSentLength );
+
+        /* Record the data actually sent even if the send is not complete. */
+        if( ( pCapture->bEnabled == true ) && ( *pDataSentLength > 0U ) && ( *pDataSentLength <= dataLength ) )
+        {
+            _captureRecord( CELLULAR_COMM_CAPTURE_RECORD_SEND, pData, *pDataSentLength );
+        }
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _captureRecv( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                  uint8_t * pBuffer,
+                                                  uint32_t bufferLength,
+                                                  uint32_t timeoutMilliseconds,
+                                                  uint32_t * pDataReceivedLength )
+{
+    const cellularCommCaptureContext_t * pCapture = ( const cellularCommCaptureContext_t * ) commInterfaceHandle;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+
+    if( ( pCapture == NULL ) || ( pDataReceivedLength == NULL ) )
+    {
+        commIntRet = IOT_COMM_INTERFACE_BAD_PARAMETER;
+    }
+    else
+    {
+        commIntRet = pCapture->config.pCommInterface->recv( pCapture->hCommInterface, pBuffer, bufferLength,
+                                                            timeoutMilliseconds, pDataReceivedLength );
+
+        if( ( pCapture->bEnabled == true ) && ( *pDataReceivedLength > 0U ) && ( *pDataReceivedLength <= bufferLength ) )
+        {
+            _captureRecord( CELLULAR_COMM_CAPTURE_RECORD_RECV, pBuffer, *pDataReceivedLength );
+        }
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _captureClose( CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    cellularCommCaptureContext_t * pCapture = ( cellularCommCaptureContext_t * ) commInterfaceHandle;
+    CellularCommInterfaceError_t commIntRet = IOT_COMM_INTERFACE_SUCCESS;
+
+    if( pCapture == NULL )
+    {
+        commIntRet = IOT_COMM_INTERFACE_BAD_PARAMETER;
+    }
+    else
+    {
+        commIntRet = pCapture->config.pCommInterface->close( pCapture->hCommInterface );
+
+        if( pCapture->bEnabled == true )
+        {
+            _captureRecord( CELLULAR_COMM_CAPTURE_RECORD_CLOSE, NULL, 0U );
+        }
+
+        pCapture->hCommInterface = NULL;
+        pCapture->receiveCB = NULL;
+        pCapture->pReceiveCBUserData = NULL;
+    }
+
+    return commIntRet;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CommCaptureInit( const CellularCommCaptureConfig_t * pConfig,
+                                          const CellularCommInterface_t ** ppCaptureCommInterface )
+{
+    cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    if( ( pConfig == NULL ) || ( ppCaptureCommInterface == NULL ) )
+    {
+        LogError( ( "Cellular_CommCaptureInit : Bad parameter" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( ( pConfig->pCommInterface == NULL ) ||
+             ( pConfig->pCommInterface->open == NULL ) ||
+             ( pConfig->pCommInterface->send == NULL ) ||
+             ( pConfig->pCommInterface->recv == NULL ) ||
+             ( pConfig->pCommInterface->close == NULL ) )
+    {
+        LogError( ( "Cellular_CommCaptureInit : Invalid comm interface" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( ( pConfig->pRingBuffer != NULL ) &&
+             ( pConfig->ringBufferSize <= CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ) )
+    {
+        LogError( ( "Cellular_CommCaptureInit : Ring buffer size %u too small", ( unsigned int ) pConfig->ringBufferSize ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( ( pConfig->pRingBuffer == NULL ) && ( pConfig->sink == NULL ) )
+    {
+        LogError( ( "Cellular_CommCaptureInit : No ring buffer or sink" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( pCapture->bInitialized == true )
+    {
+        LogError( ( "Cellular_CommCaptureInit : Capture recorder is already initialized" ) );
+        cellularStatus = CELLULAR_NOT_ALLOWED;
+    }
+    else
+    {
+        ( void ) memset( pCapture, 0, sizeof( cellularCommCaptureContext_t ) );
+
+        if( PlatformMutex_Create( &pCapture->captureMutex, false ) != true )
+        {
+            LogError( ( "Cellular_CommCaptureInit : Create mutex failed" ) );
+            cellularStatus = CELLULAR_RESOURCE_CREATION_FAIL;
+        }
+    }
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        pCapture->config = *pConfig;
+        pCapture->bEnabled = true;
+        pCapture->bInitialized = true;
+        *ppCaptureCommInterface = &cellularCommCaptureInterface;
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+void Cellular_CommCaptureDeinit( void )
+{
+    cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+
+    if( pCapture->bInitialized == true )
+    {
+        PlatformMutex_Destroy( &pCapture->captureMutex );
+        ( void ) memset( pCapture, 0, sizeof( cellularCommCaptureContext_t ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+void Cellular_CommCaptureEnable( bool enable )
+{
+    cellularCommCaptureContext.bEnabled = enable;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CommCaptureDump( uint8_t * pBuffer,
+                                          uint32_t bufferLength,
+                                          uint32_t * pDumpLength )
+{
+    cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    uint8_t recordHeader[ CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ] = { 0 };
+    uint32_t readOffset = 0;
+    uint32_t dumpLength = 0;
+    uint32_t recordLength = 0;
+
+    if( ( pBuffer == NULL ) || ( pDumpLength == NULL ) ||
+        ( bufferLength < CELLULAR_COMM_CAPTURE_FILE_HDR_SIZE ) )
+    {
+        LogError( ( "Cellular_CommCaptureDump : Bad parameter" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( ( pCapture->bInitialized == false ) || ( pCapture->config.pRingBuffer == NULL ) )
+    {
+        LogError( ( "Cellular_CommCaptureDump : No capture ring" ) );
+        cellularStatus = CELLULAR_NOT_ALLOWED;
+    }
+    else
+    {
+        ( void ) memcpy( pBuffer, CELLULAR_COMM_CAPTURE_MAGIC, 4U );
+        pBuffer[ 4 ] = ( uint8_t ) CELLULAR_COMM_CAPTURE_VERSION;
+        pBuffer[ 5 ] = 0U;
+        pBuffer[ 6 ] = 0U;
+        pBuffer[ 7 ] = 0U;
+        dumpLength = CELLULAR_COMM_CAPTURE_FILE_HDR_SIZE;
+
+        PlatformMutex_Lock( &pCapture->captureMutex );
+
+        while( readOffset < pCapture->ringUsed )
+        {
+            _ringRead( pCapture->ringHead + readOffset, recordHeader, CELLULAR_COMM_CAPTURE_REC_HDR_SIZE );
+            recordLength = CELLULAR_COMM_CAPTURE_REC_HDR_SIZE +
+                           ( ( uint32_t ) recordHeader[ 5 ] | ( ( uint32_t ) recordHeader[ 6 ] << 8 ) );
+
+            if( recordLength > ( bufferLength - dumpLength ) )
+            {
+                break;
+            }
+
+            _ringRead( pCapture->ringHead + readOffset, &pBuffer[ dumpLength ], recordLength );
+            dumpLength = dumpLength + recordLength;
+            readOffset = readOffset + recordLength;
+        }
+
+        PlatformMutex_Unlock( &pCapture->captureMutex );
+
+        *pDumpLength = dumpLength;
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+void Cellular_CommCaptureClear( void )
+{
+    cellularCommCaptureContext_t * pCapture = &cellularCommCaptureContext;
+
+    if( pCapture->bInitialized == true )
+    {
+        PlatformMutex_Lock( &pCapture->captureMutex );
+        pCapture->ringHead = 0U;
+        pCapture->ringUsed = 0U;
+        PlatformMutex_Unlock( &pCapture->captureMutex );
+    }
+}
+
+/*-----------------------------------------------------------*/
@@ -48,6 +48,7 @@
 #include "cellular_pkthandler_internal.h"
 #include "cellular_pktio_internal.h"
 #include "cellular_at_core.h"
+#include "cellular_heap.h"
 
 /*-----------------------------------------------------------*/
 
@@ -62,6 +63,9 @@
 /* Only supports a single cellular instance. */
 #define CELLULAR_CONTEXT_MAX            ( 1U )
 
+/* Event bit to wake up Cellular_SocketPoll. */
+#define SOCKET_POLL_EVT_MASK            ( 0x0001UL )
+
 /*-----------------------------------------------------------*/
 
 /**
@@ -98,6 +102,50 @@ static CellularError_t checkInitParameter( const CellularHandle_t * pCellularHan
 
 static void _Cellular_SetShutdownCallback( CellularContext_t * pContext,
                                            _pPktioShutdownCallback_t shutdownCb );
+static CellularError_t _socketRecvPrefetchFill( CellularContext_t * pContext,
+                                                CellularSocketHandle_t socketHandle,
+                                                CellularSocketRecvFunc_t recvFunc );
+static uint32_t _socketRecvPrefetchCopy( CellularSocketRecvPrefetch_t * pPrefetch,
+                                         uint8_t * pBuffer,
+                                         uint32_t bufferLength );
+static CellularError_t _socketSendCoalesceFlush( CellularContext_t * pContext,
+                                                 CellularSocketHandle_t socketHandle,
+                                                 CellularSocketSendFunc_t sendFunc );
+static bool _socketSendCoalesceExpired( const CellularSocketSendCoalesce_t * pCoalesce );
+static void _socketSendCoalescePush( CellularContext_t * pContext,
+                                     CellularSocketHandle_t socketHandle );
+static bool _Cellular_CreateSocketPollEvent( CellularContext_t * pContext );
+static void _Cellular_DestroySocketPollEvent( CellularContext_t * pContext );
+static CellularError_t _socketPollCheckParams( const CellularContext_t * pContext,
+                                               const CellularSocketPollFd_t * pPollFds,
+                                               uint8_t numPollFds,
+                                               const uint8_t * pNumReady );
+static bool _socketPollIsValid( const CellularContext_t * pContext,
+                                CellularSocketHandle_t socketHandle );
+static uint8_t _socketPollCollect( const CellularContext_t * pContext,
+                                   CellularSocketPollFd_t * pPollFds,
+                                   uint8_t numPollFds );
+static void _socketModemIdUnbind( CellularContext_t * pContext,
+                                  CellularSocketContext_t * pSocketData );
+static CellularError_t _Cellular_AllocSocketTable( CellularContext_t * pContext );
+static CellularError_t _socketModemSend( CellularContext_t * pContext,
+                                         CellularSocketHandle_t socketHandle,
+                                         const uint8_t * pData,
+                                         uint32_t dataLength,
+                                         uint32_t * pSentDataLength,
+                                         CellularSocketSendFunc_t sendFunc );
+static CellularError_t _socketModemRecv( CellularContext_t * pContext,
+                                         CellularSocketHandle_t socketHandle,
+                                         uint8_t * pBuffer,
+                                         uint32_t bufferLength,
+                                         uint32_t * pReceivedDataLength,
+                                         CellularSocketRecvFunc_t recvFunc );
+static void _socketStatsSend( CellularSocketHandle_t socketHandle,
+                              uint32_t dataLength );
+static void _socketStatsRecv( CellularSocketHandle_t socketHandle,
+                              CellularError_t cellularStatus,
+                              const uint32_t * pReceivedDataLength );
+static void _Cellular_FreeSocketTable( CellularContext_t * pContext );
 
 /*-----------------------------------------------------------*/
 
@@ -107,8 +155,12 @@ static CellularContext_t cellularStaticContextTable[ CELLULAR_CONTEXT_MAX ] = {
 
 static CellularContext_t * cellularContextTable[ CELLULAR_CONTEXT_MAX ] = { 0 };
 
+#if ( CELLULAR_CONFIG_STATIC_ALLOCATION_CONTEXT == 1 )
+static CellularSocketContext_t * cellularStaticSocketTable[ CELLULAR_CONTEXT_MAX ][ CELLULAR_NUM_SOCKET_MAX ] = { 0 };
+#endif
+
 #if ( CELLULAR_CONFIG_STATIC_SOCKET_CONTEXT_ALLOCATION == 1 )
-static CellularSocketContext_t cellularStaticSocketDataTable[ CELLULAR_NUM_SOCKET_MAX ] = { 0 };
+static CellularSocketContext_t cellularStaticSocketDataTable[ CELLULAR_CONTEXT_MAX ][ CELLULAR_NUM_SOCKET_MAX ] = { 0 };
 #endif
 
 /*-----------------------------------------------------------*/
@@ -128,7 +180,7 @@ static CellularContext_t * _Cellular_AllocContext( void )
             }
             #else
             {
-                pContext = ( CellularContext_t * ) Platform_Malloc( sizeof( CellularContext_t ) );
+                pContext = ( CellularContext_t * ) _Cellular_Malloc( sizeof( CellularContext_t ), CELLULAR_HEAP_SITE_CONTEXT );
             }
             #endif
 
@@ -158,7 +210,7 @@ static void _Cellular_FreeContext( CellularContext_t * pContext )
             cellularContextTable[ i ] = NULL;
             #if ( CELLULAR_CONFIG_STATIC_ALLOCATION_CONTEXT == 0 )
             {
-                Platform_Free( pContext );
+                _Cellular_Free( pContext );
             }
             #endif
             break;
@@ -184,14 +236,24 @@ static CellularError_t libOpen( CellularContext_t * pContext )
 
     PlatformMutex_Lock( &( pContext->libStatusMutex ) );
 
-    ( CellularPktStatus_t ) _Cellular_AtParseInit( pContext );
-    _Cellular_LockAtDataMutex( pContext );
-    _Cellular_InitAtData( pContext, 0 );
-    _Cellular_UnlockAtDataMutex( pContext );
-    _Cellular_SetShutdownCallback( pContext, &_shutdownCallback );
-    pktStatus = _Cellular_PktHandlerInit( pContext );
+    /* Allocate the default socket table here so that out of memory is reported
+     * by Cellular_Init instead of the first socket creation. */
+    if( pContext->numSocketMax == 0U )
+    {
+        cellularStatus = _Cellular_AllocSocketTable( pContext );
+    }
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        ( CellularPktStatus_t ) _Cellular_AtParseInit( pContext );
+        _Cellular_LockAtDataMutex( pContext );
+        _Cellular_InitAtData( pContext, 0 );
+        _Cellular_UnlockAtDataMutex( pContext );
+        _Cellular_SetShutdownCallback( pContext, &_shutdownCallback );
+        pktStatus = _Cellular_PktHandlerInit( pContext );
+    }
 
-    if( pktStatus == CELLULAR_PKT_STATUS_OK )
+    if( ( cellularStatus == CELLULAR_SUCCESS ) && ( pktStatus == CELLULAR_PKT_STATUS_OK ) )
     {
         pktStatus = _Cellular_PktioInit( pContext, &_Cellular_HandlePacket );
 
@@ -249,19 +311,21 @@ static void libClose( CellularContext_t * pContext )
     pContext->bLibClosing = false;
 
     /* Remove all created sockets. */
-    for( i = 0; i < CELLULAR_NUM_SOCKET_MAX; i++ )
+    for( i = 0; i < pContext->numSocketMax; i++ )
     {
         if( pContext->pSocketData[ i ] != NULL )
         {
-            #if ( CELLULAR_CONFIG_STATIC_SOCKET_CONTEXT_ALLOCATION == 0 )
+            if( pContext->pSocketSlab == NULL )
             {
-                Platform_Free( pContext->pSocketData[ i ] );
+                _Cellular_Free( pContext->pSocketData[ i ] );
             }
-            #endif
+
             pContext->pSocketData[ i ] = NULL;
         }
     }
 
+    ( void ) memset( pContext->pModemSocketData, 0, sizeof( pContext->pModemSocketData ) );
+
     PlatformMutex_Unlock( &( pContext->libStatusMutex ) );
     LogDebug( ( "CELLULARLib closed" ) );
 }
@@ -286,6 +350,35 @@ static void _Cellular_DestroyLibStatusMutex( CellularContext_t * pContext )
 
 /*-----------------------------------------------------------*/
 
+static bool _Cellular_CreateSocketPollEvent( CellularContext_t * pContext )
+{
+    bool status = false;
+
+    pContext->pSocketPollEvent = ( PlatformEventGroupHandle_t ) PlatformEventGroup_Create();
+
+    if( pContext->pSocketPollEvent != NULL )
+    {
+        ( void ) PlatformEventGroup_ClearBits( ( PlatformEventGroupHandle_t ) pContext->pSocketPollEvent,
+                                               ( PlatformEventBits_t ) SOCKET_POLL_EVT_MASK );
+        status = true;
+    }
+
+    return status;
+}
+
+/*-----------------------------------------------------------*/
+
+static void _Cellular_DestroySocketPollEvent( CellularContext_t * pContext )
+{
+    if( pContext->pSocketPollEvent != NULL )
+    {
+        ( void ) PlatformEventGroup_Delete( ( PlatformEventGroupHandle_t ) pContext->pSocketPollEvent );
+        pContext->pSocketPollEvent = ( PlatformEventGroupHandle_t ) ( uintptr_t ) ( uintptr_t * ) NULL;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
 /* Internal function of _Cellular_CreateSocket to reduce complexity. */
 static void createSocketSetSocketData( uint8_t contextId,
                                        uint8_t socketId,
@@ -297,6 +390,7 @@ static void createSocketSetSocketData( uint8_t contextId,
     ( void ) memset( pSocketData, 0, sizeof( CellularSocketContext_t ) );
     pSocketData->socketState = SOCKETSTATE_ALLOCATED;
     pSocketData->socketId = socketId;
+    pSocketData->modemSocketId = CELLULAR_INVALID_MODEM_SOCKET_ID;
     pSocketData->contextId = contextId;
     pSocketData->socketDomain = socketDomain;
     pSocketData->socketType = socketType;
@@ -403,6 +497,15 @@ static CellularError_t checkInitParameter( const CellularHandle_t * pCellularHan
         LogError( ( "All the token tables in the CellularTokenTable should be valid." ) );
         cellularStatus = CELLULAR_BAD_PARAMETER;
     }
+    else if( ( pTokenTable->pTokenLookup != NULL ) &&
+             ( ( pTokenTable->pTokenLookup->pUrcHashSlots == NULL ) ||
+               ( pTokenTable->pTokenLookup->pUrcTokenHash == NULL ) ||
+               ( pTokenTable->pTokenLookup->pUrcTokenLength == NULL ) ||
+               ( pTokenTable->pTokenLookup->pFirstByteClass == NULL ) ) )
+    {
+        LogError( ( "All the tables in the CellularTokenLookup should be valid." ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
     else
     {
         /* Empty Else MISRA 15.7 */
@@ -421,6 +524,203 @@ static void _Cellular_SetShutdownCallback( CellularContext_t * pContext,
 
 /*-----------------------------------------------------------*/
 
+static CellularError_t _socketRecvPrefetchFill( CellularContext_t * pContext,
+                                                CellularSocketHandle_t socketHandle,
+                                                CellularSocketRecvFunc_t recvFunc )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketRecvPrefetch_t * pPrefetch = &( socketHandle->recvPrefetch );
+    uint32_t writeIndex = 0;
+    uint32_t readLength = 0;
+    uint32_t receivedLength = 0;
+    bool moreData = true;
+
+    while( ( cellularStatus == CELLULAR_SUCCESS ) && ( moreData == true ) &&
+           ( pPrefetch->dataLength < pPrefetch->bufferLength ) )
+    {
+        /* Read into the contiguous free space after the buffered data. */
+        writeIndex = pPrefetch->readIndex + pPrefetch->dataLength;
+
+        if( writeIndex >= pPrefetch->bufferLength )
+        {
+            writeIndex = writeIndex - pPrefetch->bufferLength;
+            readLength = pPrefetch->readIndex - writeIndex;
+        }
+        else
+        {
+            readLength = pPrefetch->bufferLength - writeIndex;
+        }
+
+        if( readLength > CELLULAR_MAX_RECV_DATA_LEN )
+        {
+            readLength = CELLULAR_MAX_RECV_DATA_LEN;
+        }
+
+        /* Data ready informed during the read requests one more read. */
+        taskENTER_CRITICAL();
+        pPrefetch->dataReady = false;
+        taskEXIT_CRITICAL();
+
+        receivedLength = 0;
+        cellularStatus = _socketModemRecv( pContext, socketHandle, &( pPrefetch->pBuffer[ writeIndex ] ),
+                                           readLength, &receivedLength, recvFunc );
+
+        if( cellularStatus == CELLULAR_SUCCESS )
+        {
+            if( receivedLength > readLength )
+            {
+                LogError( ( "_Cellular_SocketRecvPrefetch: Received length %u is larger than %u",
+                            ( unsigned int ) receivedLength, ( unsigned int ) readLength ) );
+                cellularStatus = CELLULAR_INTERNAL_FAILURE;
+            }
+            else
+            {
+                pPrefetch->dataLength = pPrefetch->dataLength + receivedLength;
+
+                /* A short read means the modem has no more data. */
+                if( ( receivedLength == 0U ) ||
+                    ( ( receivedLength < readLength ) && ( pPrefetch->dataReady == false ) ) )
+                {
+                    moreData = false;
+                }
+            }
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t _socketRecvPrefetchCopy( CellularSocketRecvPrefetch_t * pPrefetch,
+                                         uint8_t * pBuffer,
+                                         uint32_t bufferLength )
+{
+    uint32_t copyLength = bufferLength;
+    uint32_t firstLength = 0;
+
+    if( copyLength > pPrefetch->dataLength )
+    {
+        copyLength = pPrefetch->dataLength;
+    }
+
+    /* The buffered data may wrap around the end of the ring buffer. */
+    firstLength = pPrefetch->bufferLength - pPrefetch->readIndex;
+
+    if( firstLength > copyLength )
+    {
+        firstLength = copyLength;
+    }
+
+    ( void ) memcpy( pBuffer, &( pPrefetch->pBuffer[ pPrefetch->readIndex ] ), firstLength );
+    ( void ) memcpy( &( pBuffer[ firstLength ] ), pPrefetch->pBuffer, copyLength - firstLength );
+
+    pPrefetch->dataLength = pPrefetch->dataLength - copyLength;
+
+    if( pPrefetch->dataLength == 0U )
+    {
+        /* Start over to read the modem with the whole buffer. */
+        pPrefetch->readIndex = 0;
+    }
+    else
+    {
+        pPrefetch->readIndex = ( pPrefetch->readIndex + copyLength ) % pPrefetch->bufferLength;
+    }
+
+    return copyLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularError_t _socketSendCoalesceFlush( CellularContext_t * pContext,
+                                                 CellularSocketHandle_t socketHandle,
+                                                 CellularSocketSendFunc_t sendFunc )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketSendCoalesce_t * pCoalesce = &( socketHandle->sendCoalesce );
+    uint32_t sendLength = 0;
+    uint32_t sentLength = 0;
+    bool modemFull = false;
+
+    while( ( cellularStatus == CELLULAR_SUCCESS ) && ( modemFull == false ) &&
+           ( pCoalesce->dataLength > 0U ) )
+    {
+        sendLength = pCoalesce->dataLength;
+
+        if( sendLength > CELLULAR_MAX_SEND_DATA_LEN )
+        {
+            sendLength = CELLULAR_MAX_SEND_DATA_LEN;
+        }
+
+        sentLength = 0;
+        cellularStatus = _socketModemSend( pContext, socketHandle, pCoalesce->pBuffer, sendLength, &sentLength, sendFunc );
+
+        if( cellularStatus != CELLULAR_SUCCESS )
+        {
+            LogError( ( "_Cellular_SocketSendFlush: Send %u buffered bytes failed %d",
+                        ( unsigned int ) pCoalesce->dataLength, cellularStatus ) );
+        }
+        else if( sentLength > sendLength )
+        {
+            LogError( ( "_Cellular_SocketSendFlush: Sent length %u is larger than %u",
+                        ( unsigned int ) sentLength, ( unsigned int ) sendLength ) );
+            cellularStatus = CELLULAR_INTERNAL_FAILURE;
+        }
+        else if( sentLength == 0U )
+        {
+            /* The modem does not accept data now. Send again in the next call. */
+            modemFull = true;
+        }
+        else
+        {
+            /* Keep the data not accepted by the modem at the start of the buffer. */
+            pCoalesce->dataLength = pCoalesce->dataLength - sentLength;
+            ( void ) memmove( pCoalesce->pBuffer, &( pCoalesce->pBuffer[ sentLength ] ), pCoalesce->dataLength );
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static bool _socketSendCoalesceExpired( const CellularSocketSendCoalesce_t * pCoalesce )
+{
+    bool expired = false;
+
+    if( pCoalesce->flushDelayMs != 0U )
+    {
+        /* The time is allowed to wrap around. */
+        if( ( CELLULAR_CONFIG_GET_TIME_MS() - pCoalesce->firstDataTimeMs ) >= pCoalesce->flushDelayMs )
+        {
+            expired = true;
+        }
+    }
+
+    return expired;
+}
+
+/*-----------------------------------------------------------*/
+
+static void _socketSendCoalescePush( CellularContext_t * pContext,
+                                     CellularSocketHandle_t socketHandle )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketSendCoalesce_t * pCoalesce = &( socketHandle->sendCoalesce );
+
+    /* The application waits for the peer. Send the data it is waiting for. */
+    if( ( pContext->socketSendFunc != NULL ) && ( pCoalesce->pBuffer != NULL ) &&
+        ( pCoalesce->dataLength > 0U ) && ( pCoalesce->pendingError == CELLULAR_SUCCESS ) )
+    {
+        cellularStatus = _socketSendCoalesceFlush( pContext, socketHandle, pContext->socketSendFunc );
+
+        /* Returned by the next _Cellular_SocketSendCoalesce call. */
+        pCoalesce->pendingError = cellularStatus;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
 /* Checks whether Cellular Library is opened. */
 CellularError_t _Cellular_CheckLibraryStatus( CellularContext_t * pContext )
 {
@@ -530,25 +830,28 @@ CellularError_t _Cellular_CreateSocketData( CellularContext_t * pContext,
     CellularSocketContext_t * pSocketData = NULL;
     uint8_t socketId = 0;
 
-    for( socketId = 0; socketId < CELLULAR_NUM_SOCKET_MAX; socketId++ )
+    /* The socket table is set in _Cellular_LibInitWithSocketTable. */
+    for( socketId = 0; socketId < pContext->numSocketMax; socketId++ )
     {
         if( pContext->pSocketData[ socketId ] == NULL )
         {
-            #if ( CELLULAR_CONFIG_STATIC_SOCKET_CONTEXT_ALLOCATION == 1 )
+            if( pContext->pSocketSlab != NULL )
             {
-                pSocketData = &( cellularStaticSocketDataTable[ socketId ] );
+                pSocketData = &( pContext->pSocketSlab[ socketId ] );
             }
-            #else
+            else
             {
-                pSocketData = ( CellularSocketContext_t * ) Platform_Malloc( sizeof( CellularSocketContext_t ) );
+                pSocketData = ( CellularSocketContext_t * ) _Cellular_Malloc( sizeof( CellularSocketContext_t ), CELLULAR_HEAP_SITE_SOCKET_DATA );
             }
-            #endif
 
             if( pSocketData != NULL )
             {
                 createSocketSetSocketData( contextId, socketId, socketDomain,
                                            socketType, socketProtocol, pSocketData );
                 pContext->pSocketData[ socketId ] = pSocketData;
+
+                /* The socket is not bound to a modem socket ID until the module port
+                 * calls _Cellular_SetSocketModemId. */
                 *pSocketHandle = ( CellularSocketHandle_t ) pSocketData;
             }
             else
@@ -564,7 +867,7 @@ CellularError_t _Cellular_CreateSocketData( CellularContext_t * pContext,
     {
         LogError( ( "_Cellular_CreateSocket, Out of memory" ) );
     }
-    else if( socketId >= CELLULAR_NUM_SOCKET_MAX )
+    else if( ( cellularStatus == CELLULAR_SUCCESS ) && ( socketId >= pContext->numSocketMax ) )
     {
         LogError( ( "_Cellular_CreateSocket, No free socket slots are available" ) );
         cellularStatus = CELLULAR_NO_MEMORY;
@@ -594,26 +897,28 @@ CellularError_t _Cellular_RemoveSocketData( CellularContext_t * pContext,
 
     if( pContext != NULL )
     {
-        for( socketId = 0; socketId < CELLULAR_NUM_SOCKET_MAX; socketId++ )
+        for( socketId = 0; socketId < pContext->numSocketMax; socketId++ )
         {
             if( pContext->pSocketData[ socketId ] == socketHandle )
             {
                 pContext->pSocketData[ socketId ] = NULL;
+                _socketModemIdUnbind( pContext, socketHandle );
                 break;
             }
         }
 
-        if( socketId == CELLULAR_NUM_SOCKET_MAX )
+        if( socketId == pContext->numSocketMax )
         {
             cellularStatus = CELLULAR_BAD_PARAMETER;
         }
-
-        #if ( CELLULAR_CONFIG_STATIC_SOCKET_CONTEXT_ALLOCATION == 0 )
-            else
-            {
-                Platform_Free( socketHandle );
-            }
-        #endif
+        else if( pContext->pSocketSlab == NULL )
+        {
+            _Cellular_Free( socketHandle );
+        }
+        else
+        {
+            /* Empty else MISRA 15.7 */
+        }
     }
     else
     {
@@ -638,7 +943,7 @@ CellularError_t _Cellular_IsValidSocket( const CellularContext_t * pContext,
     }
     else
     {
-        if( ( sockIndex >= CELLULAR_NUM_SOCKET_MAX ) || ( pContext->pSocketData[ sockIndex ] == NULL ) )
+        if( ( sockIndex >= pContext->numSocketMax ) || ( pContext->pSocketData[ sockIndex ] == NULL ) )
         {
             LogError( ( "_Cellular_IsValidSocket, invalid socket handle %u", ( unsigned int ) sockIndex ) );
             cellularStatus = CELLULAR_BAD_PARAMETER;
@@ -902,7 +1207,7 @@ CellularSocketContext_t * _Cellular_GetSocketData( const CellularContext_t * pCo
     }
     else
     {
-        if( ( sockIndex >= CELLULAR_NUM_SOCKET_MAX ) || ( pContext->pSocketData[ sockIndex ] == NULL ) )
+        if( ( sockIndex >= pContext->numSocketMax ) || ( pContext->pSocketData[ sockIndex ] == NULL ) )
         {
             LogError( ( "_Cellular_GetSocketData, invalid socket handle %u", ( unsigned int ) sockIndex ) );
         }
@@ -920,6 +1225,17 @@ CellularSocketContext_t * _Cellular_GetSocketData( const CellularContext_t * pCo
 CellularError_t _Cellular_LibInit( CellularHandle_t * pCellularHandle,
                                    const CellularCommInterface_t * pCommInterface,
                                    const CellularTokenTable_t * pTokenTable )
+{
+    /* Parameters are checked in this function. */
+    return _Cellular_LibInitWithSocketTable( pCellularHandle, pCommInterface, pTokenTable, NULL );
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_LibInitWithSocketTable( CellularHandle_t * pCellularHandle,
+                                                  const CellularCommInterface_t * pCommInterface,
+                                                  const CellularTokenTable_t * pTokenTable,
+                                                  const CellularSocketTable_t * pSocketTable )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t * pContext = NULL;
@@ -927,6 +1243,7 @@ CellularError_t _Cellular_LibInit( CellularHandle_t * pCellularHandle,
     bool bAtDataMutexCreateSuccess = false;
     bool bPktRequestMutexCreateSuccess = false;
     bool bPktResponseMutexCreateSuccess = false;
+    bool bSocketPollEventCreateSuccess = false;
 
     cellularStatus = checkInitParameter( pCellularHandle, pCommInterface, pTokenTable );
 
@@ -1006,6 +1323,26 @@ CellularError_t _Cellular_LibInit( CellularHandle_t * pCellularHandle,
         }
     }
 
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        if( _Cellular_CreateSocketPollEvent( pContext ) != true )
+        {
+            LogError( ( "Could not create CELLULAR socket poll event " ) );
+            cellularStatus = CELLULAR_RESOURCE_CREATION_FAIL;
+        }
+        else
+        {
+            bSocketPollEventCreateSuccess = true;
+        }
+    }
+
+    /* The socket table provided by the caller is set before libOpen allocates
+     * the default socket table. */
+    if( ( cellularStatus == CELLULAR_SUCCESS ) && ( pSocketTable != NULL ) )
+    {
+        cellularStatus = _Cellular_SetSocketTable( pContext, pSocketTable );
+    }
+
     /* Configure the library. */
     if( cellularStatus == CELLULAR_SUCCESS )
     {
@@ -1014,6 +1351,11 @@ CellularError_t _Cellular_LibInit( CellularHandle_t * pCellularHandle,
 
     if( cellularStatus != CELLULAR_SUCCESS )
     {
+        if( bSocketPollEventCreateSuccess == true )
+        {
+            _Cellular_DestroySocketPollEvent( pContext );
+        }
+
         if( bPktResponseMutexCreateSuccess == true )
         {
             _Cellular_DestroyPktResponseMutex( pContext );
@@ -1036,6 +1378,7 @@ CellularError_t _Cellular_LibInit( CellularHandle_t * pCellularHandle,
 
         if( pContext != NULL )
         {
+            _Cellular_FreeSocketTable( pContext );
             _Cellular_FreeContext( pContext );
         }
     }
@@ -1066,6 +1409,8 @@ CellularError_t _Cellular_LibCleanup( CellularHandle_t cellularHandle )
         _Cellular_DestroyAtDataMutex( pContext );
         _Cellular_DestroyPktRequestMutex( pContext );
         _Cellular_DestroyPktResponseMutex( pContext );
+        _Cellular_DestroySocketPollEvent( pContext );
+        _Cellular_FreeSocketTable( pContext );
         _Cellular_FreeContext( pContext );
     }
 
@@ -1159,3 +1504,972 @@ CellularError_t _Cellular_RegisterInputBufferCallback( CellularContext_t * pCont
 }
 
 /*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_GetPktioBufferStats( const CellularContext_t * pContext,
+                                               CellularPktioBufferStats_t * pStats )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_GetPktioBufferStats: invalid context." ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else if( pStats == NULL )
+    {
+        LogError( ( "_Cellular_GetPktioBufferStats: invalid stats pointer." ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else
+    {
+        /* The statistics are updated in pktio thread. */
+        taskENTER_CRITICAL();
+        ( void ) memcpy( pStats, &pContext->pktioBufferStats, sizeof( CellularPktioBufferStats_t ) );
+        taskEXIT_CRITICAL();
+
+        pStats->bufferSize = PKTIO_READ_BUFFER_SIZE;
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_ResetPktioBufferStats( CellularContext_t * pContext )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_ResetPktioBufferStats: invalid context." ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else
+    {
+        taskENTER_CRITICAL();
+        ( void ) memset( &pContext->pktioBufferStats, 0, sizeof( CellularPktioBufferStats_t ) );
+        taskEXIT_CRITICAL();
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_RegisterPktioBufferCallback( CellularContext_t * pContext,
+                                                       CellularPktioBufferCallback_t pktioBufferCallback,
+                                                       void * pCallbackContext )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_RegisterPktioBufferCallback: invalid context." ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else
+    {
+        /* pktioBufferCallback can be set to NULL to unregister the callback. */
+        taskENTER_CRITICAL();
+        pContext->pktioBufferCallback = pktioBufferCallback;
+
+        if( pContext->pktioBufferCallback != NULL )
+        {
+            pContext->pPktioBufferCallbackContext = pCallbackContext;
+        }
+        else
+        {
+            pContext->pPktioBufferCallbackContext = NULL;
+        }
+
+        taskEXIT_CRITICAL();
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_RegisterSocketDataFunc( CellularContext_t * pContext,
+                                                  CellularSocketSendFunc_t sendFunc,
+                                                  CellularSocketRecvFunc_t recvFunc )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_RegisterSocketDataFunc: invalid context." ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else
+    {
+        pContext->socketSendFunc = sendFunc;
+        pContext->socketRecvFunc = recvFunc;
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+void _Cellular_SocketDataReady( CellularContext_t * pContext,
+                                CellularSocketHandle_t socketHandle )
+{
+    if( ( pContext != NULL ) && ( socketHandle != NULL ) )
+    {
+        taskENTER_CRITICAL();
+        socketHandle->recvPrefetch.dataReady = true;
+
+        #if ( CELLULAR_CONFIG_SOCKET_STATS == 1 )
+            if( socketHandle->dataReadyPending == false )
+            {
+                socketHandle->dataReadyTimeMs = CELLULAR_CONFIG_GET_TIME_MS();
+                socketHandle->dataReadyPending = true;
+            }
+        #endif
+
+        taskEXIT_CRITICAL();
+
+        _Cellular_SocketPollSignal( pContext, socketHandle, CELLULAR_SOCKET_POLL_READABLE );
+
+        if( socketHandle->dataReadyCallback != NULL )
+        {
+            socketHandle->dataReadyCallback( socketHandle, socketHandle->pDataReadyCallbackContext );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_SocketRecvPrefetch( CellularContext_t * pContext,
+                                              CellularSocketHandle_t socketHandle,
+                                              uint8_t * pBuffer,
+                                              uint32_t bufferLength,
+                                              uint32_t * pReceivedDataLength,
+                                              CellularSocketRecvFunc_t recvFunc )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketRecvPrefetch_t * pPrefetch = NULL;
+    uint32_t readLength = bufferLength;
+
+    if( ( pContext == NULL ) || ( socketHandle == NULL ) )
+    {
+        LogError( ( "_Cellular_SocketRecvPrefetch: invalid handle." ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else if( ( pBuffer == NULL ) || ( bufferLength == 0U ) ||
+             ( pReceivedDataLength == NULL ) || ( recvFunc == NULL ) )
+    {
+        LogError( ( "_Cellular_SocketRecvPrefetch: Invalid parameter." ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( socketHandle->recvPrefetch.pBuffer == NULL )
+    {
+        _socketSendCoalescePush( pContext, socketHandle );
+
+        /* No prefetch buffer. Read the modem into the application buffer. */
+        if( readLength > CELLULAR_MAX_RECV_DATA_LEN )
+        {
+            readLength = CELLULAR_MAX_RECV_DATA_LEN;
+        }
+
+        cellularStatus = _socketModemRecv( pContext, socketHandle, pBuffer, readLength, pReceivedDataLength, recvFunc );
+        _socketStatsRecv( socketHandle, cellularStatus, pReceivedDataLength );
+    }
+    else
+    {
+        _socketSendCoalescePush( pContext, socketHandle );
+        pPrefetch = &( socketHandle->recvPrefetch );
+
+        if( pPrefetch->pendingError != CELLULAR_SUCCESS )
+        {
+            /* Return the read error of the previous call. */
+            cellularStatus = pPrefetch->pendingError;
+            pPrefetch->pendingError = CELLULAR_SUCCESS;
+        }
+        else
+        {
+            if( ( pPrefetch->dataLength == 0U ) || ( pPrefetch->dataReady == true ) )
+            {
+                cellularStatus = _socketRecvPrefetchFill( pContext, socketHandle, recvFunc );
+            }
+
+            if( pPrefetch->dataLength > 0U )
+            {
+                /* The buffered data is received. The read error is returned by the next call. */
+                pPrefetch->pendingError = cellularStatus;
+                *pReceivedDataLength = _socketRecvPrefetchCopy( pPrefetch, pBuffer, bufferLength );
+                cellularStatus = CELLULAR_SUCCESS;
+            }
+            else if( cellularStatus == CELLULAR_SUCCESS )
+            {
+                *pReceivedDataLength = 0;
+            }
+            else
+            {
+                /* Empty else MISRA 15.7 */
+            }
+        }
+
+        _socketStatsRecv( socketHandle, cellularStatus, pReceivedDataLength );
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_SocketSendCoalesce( CellularContext_t * pContext,
+                                              CellularSocketHandle_t socketHandle,
+                                              const uint8_t * pData,
+                                              uint32_t dataLength,
+                                              uint32_t * pSentDataLength,
+                                              CellularSocketSendFunc_t sendFunc )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketSendCoalesce_t * pCoalesce = NULL;
+    uint32_t flushLength = CELLULAR_MAX_SEND_DATA_LEN;
+    uint32_t sendLength = dataLength;
+
+    if( ( pContext == NULL ) || ( socketHandle == NULL ) )
+    {
+        LogError( ( "_Cellular_SocketSendCoalesce: invalid handle." ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else if( ( ( pData == NULL ) && ( dataLength > 0U ) ) ||
+             ( pSentDataLength == NULL ) || ( sendFunc == NULL ) )
+    {
+        LogError( ( "_Cellular_SocketSendCoalesce: Invalid parameter." ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( socketHandle->sendCoalesce.pBuffer == NULL )
+    {
+        _socketStatsSend( socketHandle, dataLength );
+
+        /* No coalescing buffer. Send the application data directly. */
+        if( sendLength > CELLULAR_MAX_SEND_DATA_LEN )
+        {
+            sendLength = CELLULAR_MAX_SEND_DATA_LEN;
+        }
+
+        cellularStatus = _socketModemSend( pContext, socketHandle, pData, sendLength, pSentDataLength, sendFunc );
+    }
+    else
+    {
+        _socketStatsSend( socketHandle, dataLength );
+        pCoalesce = &( socketHandle->sendCoalesce );
+        *pSentDataLength = 0;
+
+        if( flushLength > pCoalesce->bufferLength )
+        {
+            flushLength = pCoalesce->bufferLength;
+        }
+
+        if( pCoalesce->pendingError != CELLULAR_SUCCESS )
+        {
+            /* Return the send error of the previous flush. */
+            cellularStatus = pCoalesce->pendingError;
+            pCoalesce->pendingError = CELLULAR_SUCCESS;
+        }
+        else if( dataLength > ( flushLength - pCoalesce->dataLength ) )
+        {
+            /* The data does not fit. Send the buffered data first. */
+            cellularStatus = _socketSendCoalesceFlush( pContext, socketHandle, sendFunc );
+        }
+        else
+        {
+            /* Empty else MISRA 15.7 */
+        }
+
+        if( cellularStatus != CELLULAR_SUCCESS )
+        {
+            /* The buffered data is sent again in the next call. */
+        }
+        else if( dataLength <= ( flushLength - pCoalesce->dataLength ) )
+        {
+            if( ( pCoalesce->dataLength == 0U ) && ( dataLength > 0U ) )
+            {
+                pCoalesce->firstDataTimeMs = CELLULAR_CONFIG_GET_TIME_MS();
+            }
+
+            if( dataLength > 0U )
+            {
+                ( void ) memcpy( &( pCoalesce->pBuffer[ pCoalesce->dataLength ] ), pData, dataLength );
+                pCoalesce->dataLength = pCoalesce->dataLength + dataLength;
+            }
+
+            *pSentDataLength = dataLength;
+        }
+        else if( pCoalesce->dataLength == 0U )
+        {
+            /* Large write. Send it directly after the buffered data. */
+            if( sendLength > CELLULAR_MAX_SEND_DATA_LEN )
+            {
+                sendLength = CELLULAR_MAX_SEND_DATA_LEN;
+            }
+
+            cellularStatus = _socketModemSend( pContext, socketHandle, pData, sendLength, pSentDataLength, sendFunc );
+        }
+        else
+        {
+            /* The modem did not accept all the buffered data. Nothing is sent. */
+        }
+
+        if( ( cellularStatus == CELLULAR_SUCCESS ) && ( pCoalesce->dataLength > 0U ) &&
+            ( ( pCoalesce->dataLength == flushLength ) || ( dataLength == 0U ) ||
+              ( _socketSendCoalesceExpired( pCoalesce ) == true ) ) )
+        {
+            cellularStatus = _socketSendCoalesceFlush( pContext, socketHandle, sendFunc );
+
+            if( ( cellularStatus != CELLULAR_SUCCESS ) && ( *pSentDataLength > 0U ) )
+            {
+                /* The application data is buffered. Return the error with the next call. */
+                pCoalesce->pendingError = cellularStatus;
+                cellularStatus = CELLULAR_SUCCESS;
+            }
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_SocketSendFlush( CellularContext_t * pContext,
+                                           CellularSocketHandle_t socketHandle,
+                                           CellularSocketSendFunc_t sendFunc )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    if( ( pContext == NULL ) || ( socketHandle == NULL ) )
+    {
+        LogError( ( "_Cellular_SocketSendFlush: invalid handle." ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else if( sendFunc == NULL )
+    {
+        LogError( ( "_Cellular_SocketSendFlush: Invalid parameter." ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( socketHandle->sendCoalesce.pBuffer != NULL )
+    {
+        /* A send error of a previous flush is not reported again. */
+        socketHandle->sendCoalesce.pendingError = CELLULAR_SUCCESS;
+        cellularStatus = _socketSendCoalesceFlush( pContext, socketHandle, sendFunc );
+    }
+    else
+    {
+        /* Empty else MISRA 15.7 */
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularError_t _socketPollCheckParams( const CellularContext_t * pContext,
+                                               const CellularSocketPollFd_t * pPollFds,
+                                               uint8_t numPollFds,
+                                               const uint8_t * pNumReady )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketHandle_t socketHandle = NULL;
+    uint8_t i = 0;
+
+    if( pContext == NULL )
+    {
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else if( ( pPollFds == NULL ) || ( pNumReady == NULL ) ||
+             ( numPollFds == 0U ) || ( numPollFds > pContext->numSocketMax ) )
+    {
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else
+    {
+        for( i = 0; ( i < numPollFds ) && ( cellularStatus == CELLULAR_SUCCESS ); i++ )
+        {
+            socketHandle = pPollFds[ i ].socketHandle;
+
+            if( ( socketHandle == NULL ) || ( socketHandle->socketId >= pContext->numSocketMax ) ||
+                ( pContext->pSocketData[ socketHandle->socketId ] != socketHandle ) )
+            {
+                LogError( ( "_Cellular_SocketPoll, invalid socket handle at %u", ( unsigned int ) i ) );
+                cellularStatus = CELLULAR_BAD_PARAMETER;
+            }
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+/* This function is called in critical section. */
+static bool _socketPollIsValid( const CellularContext_t * pContext,
+                                CellularSocketHandle_t socketHandle )
+{
+    bool isValid = false;
+    uint32_t socketId = 0;
+
+    /* The handle is not dereferenced. It may be freed by a concurrent close. */
+    for( socketId = 0; ( socketId < pContext->numSocketMax ) && ( isValid == false ); socketId++ )
+    {
+        if( pContext->pSocketData[ socketId ] == socketHandle )
+        {
+            isValid = true;
+        }
+    }
+
+    return isValid;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t _socketPollCollect( const CellularContext_t * pContext,
+                                   CellularSocketPollFd_t * pPollFds,
+                                   uint8_t numPollFds )
+{
+    CellularSocketHandle_t socketHandle = NULL;
+    uint8_t revents = 0;
+    uint8_t numReady = 0;
+    uint8_t i = 0;
+
+    /* Sockets are removed from the socket table in critical section. */
+    taskENTER_CRITICAL();
+
+    for( i = 0; i < numPollFds; i++ )
+    {
+        socketHandle = pPollFds[ i ].socketHandle;
+
+        if( _socketPollIsValid( pContext, socketHandle ) == false )
+        {
+            /* The socket is closed during the poll. */
+            revents = ( uint8_t ) CELLULAR_SOCKET_POLL_CLOSED;
+        }
+        else
+        {
+            /* Report and clear the requested events. */
+            revents = socketHandle->pollEvents & pPollFds[ i ].events;
+            socketHandle->pollEvents = socketHandle->pollEvents & ( uint8_t ) ( ~revents );
+
+            /* Buffered data in the prefetch buffer can still be received. */
+            if( socketHandle->recvPrefetch.dataLength > 0U )
+            {
+                revents = revents | ( pPollFds[ i ].events & ( uint8_t ) CELLULAR_SOCKET_POLL_READABLE );
+            }
+        }
+
+        pPollFds[ i ].revents = revents;
+
+        if( revents != 0U )
+        {
+            numReady++;
+        }
+    }
+
+    taskEXIT_CRITICAL();
+
+    return numReady;
+}
+
+/*-----------------------------------------------------------*/
+
+void _Cellular_SocketPollSignal( CellularContext_t * pContext,
+                                 CellularSocketHandle_t socketHandle,
+                                 uint8_t events )
+{
+    if( ( pContext != NULL ) && ( socketHandle != NULL ) )
+    {
+        taskENTER_CRITICAL();
+        socketHandle->pollEvents = socketHandle->pollEvents | events;
+        taskEXIT_CRITICAL();
+
+        if( pContext->pSocketPollEvent != NULL )
+        {
+            ( void ) PlatformEventGroup_SetBits( ( PlatformEventGroupHandle_t ) pContext->pSocketPollEvent,
+                                                 ( PlatformEventBits_t ) SOCKET_POLL_EVT_MASK );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_SocketPoll( CellularContext_t * pContext,
+                                      CellularSocketPollFd_t * pPollFds,
+                                      uint8_t numPollFds,
+                                      uint32_t timeoutMs,
+                                      uint8_t * pNumReady )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    PlatformEventBits_t uxBits = 0;
+    PlatformTickType_t startTick = 0;
+    PlatformTickType_t elapsedTicks = 0;
+    PlatformTickType_t timeoutTicks = 0;
+    uint8_t numReady = 0;
+    uint8_t i = 0;
+
+    cellularStatus = _socketPollCheckParams( pContext, pPollFds, numPollFds, pNumReady );
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        /* The peer does not respond to data held in the coalescing buffer. */
+        for( i = 0; i < numPollFds; i++ )
+        {
+            _socketSendCoalescePush( pContext, pPollFds[ i ].socketHandle );
+        }
+
+        /* The deadline is kept when events of other sockets wake up the wait. */
+        startTick = PlatformTask_GetTickCount();
+        timeoutTicks = pdMS_TO_TICKS( timeoutMs );
+        numReady = _socketPollCollect( pContext, pPollFds, numPollFds );
+
+        while( ( numReady == 0U ) && ( cellularStatus == CELLULAR_SUCCESS ) )
+        {
+            /* The tick count is allowed to wrap around. */
+            elapsedTicks = ( PlatformTickType_t ) ( PlatformTask_GetTickCount() - startTick );
+
+            if( elapsedTicks >= timeoutTicks )
+            {
+                cellularStatus = CELLULAR_TIMEOUT;
+            }
+            else
+            {
+                /* The event bit set after the last collect is still set. The
+                 * wait returns immediately in this case. */
+                uxBits = ( PlatformEventBits_t ) PlatformEventGroup_WaitBits( ( PlatformEventGroupHandle_t ) pContext->pSocketPollEvent,
+                                                                              ( PlatformEventBits_t ) SOCKET_POLL_EVT_MASK,
+                                                                              platformTRUE,
+                                                                              platformFALSE,
+                                                                              timeoutTicks - elapsedTicks );
+
+                if( ( uxBits & ( PlatformEventBits_t ) SOCKET_POLL_EVT_MASK ) == 0U )
+                {
+                    cellularStatus = CELLULAR_TIMEOUT;
+                }
+                else
+                {
+                    numReady = _socketPollCollect( pContext, pPollFds, numPollFds );
+                }
+            }
+        }
+
+        *pNumReady = numReady;
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+/* This function is called in critical section. */
+static void _socketModemIdUnbind( CellularContext_t * pContext,
+                                  CellularSocketContext_t * pSocketData )
+{
+    uint32_t modemSocketId = pSocketData->modemSocketId;
+
+    if( ( modemSocketId < CELLULAR_MODEM_SOCKET_ID_MAX ) &&
+        ( pContext->pModemSocketData[ modemSocketId ] == pSocketData ) )
+    {
+        pContext->pModemSocketData[ modemSocketId ] = NULL;
+    }
+
+    pSocketData->modemSocketId = CELLULAR_INVALID_MODEM_SOCKET_ID;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_SetSocketModemId( CellularContext_t * pContext,
+                                            CellularSocketHandle_t socketHandle,
+                                            uint32_t modemSocketId )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketContext_t * pPrevSocketData = NULL;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_SetSocketModemId: Invalid context" ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else if( ( socketHandle == NULL ) || ( socketHandle->socketId >= pContext->numSocketMax ) ||
+             ( pContext->pSocketData[ socketHandle->socketId ] != socketHandle ) )
+    {
+        LogError( ( "_Cellular_SetSocketModemId: Invalid socket handle" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( ( modemSocketId >= CELLULAR_MODEM_SOCKET_ID_MAX ) && ( modemSocketId != CELLULAR_INVALID_MODEM_SOCKET_ID ) )
+    {
+        LogError( ( "_Cellular_SetSocketModemId: Invalid modem socket ID %u", ( unsigned int ) modemSocketId ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else
+    {
+        taskENTER_CRITICAL();
+
+        _socketModemIdUnbind( pContext, socketHandle );
+
+        if( modemSocketId != CELLULAR_INVALID_MODEM_SOCKET_ID )
+        {
+            /* The modem reuses the ID. The socket bound before is stale. */
+            pPrevSocketData = pContext->pModemSocketData[ modemSocketId ];
+
+            if( pPrevSocketData != NULL )
+            {
+                pPrevSocketData->modemSocketId = CELLULAR_INVALID_MODEM_SOCKET_ID;
+            }
+
+            pContext->pModemSocketData[ modemSocketId ] = socketHandle;
+            socketHandle->modemSocketId = modemSocketId;
+        }
+
+        taskEXIT_CRITICAL();
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularSocketContext_t * _Cellular_GetSocketDataByModemId( const CellularContext_t * pContext,
+                                                            uint32_t modemSocketId )
+{
+    CellularSocketContext_t * pSocketData = NULL;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "Invalid context" ) );
+    }
+    else if( ( modemSocketId >= CELLULAR_MODEM_SOCKET_ID_MAX ) || ( pContext->pModemSocketData[ modemSocketId ] == NULL ) )
+    {
+        LogWarn( ( "_Cellular_GetSocketDataByModemId, no socket for modem socket ID %u", ( unsigned int ) modemSocketId ) );
+    }
+    else
+    {
+        pSocketData = pContext->pModemSocketData[ modemSocketId ];
+    }
+
+    return pSocketData;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularError_t _Cellular_AllocSocketTable( CellularContext_t * pContext )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    #if ( CELLULAR_CONFIG_STATIC_ALLOCATION_CONTEXT == 1 ) || ( CELLULAR_CONFIG_STATIC_SOCKET_CONTEXT_ALLOCATION == 1 )
+        uint8_t i = 0;
+
+        /* The static socket tables are owned by the context of the same index. */
+        for( i = 0; i < CELLULAR_CONTEXT_MAX; i++ )
+        {
+            if( cellularContextTable[ i ] == pContext )
+            {
+                break;
+            }
+        }
+
+        if( i == CELLULAR_CONTEXT_MAX )
+        {
+            cellularStatus = CELLULAR_INVALID_HANDLE;
+        }
+    #endif /* if ( CELLULAR_CONFIG_STATIC_ALLOCATION_CONTEXT == 1 ) || ( CELLULAR_CONFIG_STATIC_SOCKET_CONTEXT_ALLOCATION == 1 ) */
+
+    if( cellularStatus == CELLULAR_SUCCESS )
+    {
+        #if ( CELLULAR_CONFIG_STATIC_ALLOCATION_CONTEXT == 1 )
+        {
+            pContext->pSocketData = cellularStaticSocketTable[ i ];
+        }
+        #else
+        {
+            pContext->pSocketData = ( CellularSocketContext_t ** ) _Cellular_Malloc( sizeof( CellularSocketContext_t * ) * CELLULAR_NUM_SOCKET_MAX,
+                                                                                     CELLULAR_HEAP_SITE_SOCKET_TABLE );
+        }
+        #endif
+
+        #if ( CELLULAR_CONFIG_STATIC_SOCKET_CONTEXT_ALLOCATION == 1 )
+        {
+            pContext->pSocketSlab = cellularStaticSocketDataTable[ i ];
+        }
+        #else
+        {
+            pContext->pSocketSlab = NULL;
+        }
+        #endif
+
+        if( pContext->pSocketData == NULL )
+        {
+            LogError( ( "_Cellular_AllocSocketTable, Out of memory" ) );
+            pContext->bSocketTableAllocated = false;
+            cellularStatus = CELLULAR_NO_MEMORY;
+        }
+        else
+        {
+            ( void ) memset( pContext->pSocketData, 0, sizeof( CellularSocketContext_t * ) * CELLULAR_NUM_SOCKET_MAX );
+            pContext->numSocketMax = ( uint8_t ) CELLULAR_NUM_SOCKET_MAX;
+            pContext->bSocketTableAllocated = true;
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static void _Cellular_FreeSocketTable( CellularContext_t * pContext )
+{
+    #if ( CELLULAR_CONFIG_STATIC_ALLOCATION_CONTEXT == 0 )
+        if( pContext->bSocketTableAllocated == true )
+        {
+            _Cellular_Free( pContext->pSocketData );
+        }
+    #endif
+
+    pContext->pSocketData = NULL;
+    pContext->pSocketSlab = NULL;
+    pContext->numSocketMax = 0;
+    pContext->bSocketTableAllocated = false;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_SetSocketTable( CellularContext_t * pContext,
+                                          const CellularSocketTable_t * pSocketTable )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    uint8_t i = 0;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_SetSocketTable: Invalid context" ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else if( ( pSocketTable == NULL ) || ( pSocketTable->pSocketData == NULL ) || ( pSocketTable->numSockets == 0U ) )
+    {
+        LogError( ( "_Cellular_SetSocketTable: Invalid socket table" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else
+    {
+        PlatformMutex_Lock( &( pContext->libStatusMutex ) );
+
+        /* Only the default socket table of the library can be replaced and only
+         * before the first socket is created. */
+        for( i = 0; ( pContext->bSocketTableAllocated == true ) && ( i < pContext->numSocketMax ); i++ )
+        {
+            if( pContext->pSocketData[ i ] != NULL )
+            {
+                break;
+            }
+        }
+
+        if( ( pContext->numSocketMax != 0U ) &&
+            ( ( pContext->bSocketTableAllocated == false ) || ( i < pContext->numSocketMax ) ) )
+        {
+            LogError( ( "_Cellular_SetSocketTable: Socket table is already in use" ) );
+            cellularStatus = CELLULAR_NOT_ALLOWED;
+        }
+        else
+        {
+            _Cellular_FreeSocketTable( pContext );
+            ( void ) memset( pSocketTable->pSocketData, 0, sizeof( CellularSocketContext_t * ) * pSocketTable->numSockets );
+            pContext->pSocketData = pSocketTable->pSocketData;
+            pContext->pSocketSlab = pSocketTable->pSocketSlab;
+            pContext->numSocketMax = pSocketTable->numSockets;
+            pContext->bSocketTableAllocated = false;
+        }
+
+        PlatformMutex_Unlock( &( pContext->libStatusMutex ) );
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularError_t _socketModemSend( CellularContext_t * pContext,
+                                         CellularSocketHandle_t socketHandle,
+                                         const uint8_t * pData,
+                                         uint32_t dataLength,
+                                         uint32_t * pSentDataLength,
+                                         CellularSocketSendFunc_t sendFunc )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    #if ( CELLULAR_CONFIG_SOCKET_STATS == 1 )
+        CellularSocketStats_t * pStats = &( socketHandle->stats );
+        uint32_t startTimeMs = CELLULAR_CONFIG_GET_TIME_MS();
+    #endif
+
+    cellularStatus = sendFunc( pContext, socketHandle, pData, dataLength, pSentDataLength );
+
+    #if ( CELLULAR_CONFIG_SOCKET_STATS == 1 )
+    {
+        /* The time is allowed to wrap around. */
+        pStats->sendLatencyMs = CELLULAR_CONFIG_GET_TIME_MS() - startTimeMs;
+
+        if( pStats->sendLatencyMs > pStats->sendLatencyMaxMs )
+        {
+            pStats->sendLatencyMaxMs = pStats->sendLatencyMs;
+        }
+
+        pStats->modemSendCount++;
+
+        if( cellularStatus != CELLULAR_SUCCESS )
+        {
+            pStats->modemErrorCount++;
+        }
+        else
+        {
+            pStats->bytesSent = pStats->bytesSent + *pSentDataLength;
+
+            if( *pSentDataLength < dataLength )
+            {
+                pStats->partialSendCount++;
+            }
+        }
+    }
+    #endif /* if ( CELLULAR_CONFIG_SOCKET_STATS == 1 ) */
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularError_t _socketModemRecv( CellularContext_t * pContext,
+                                         CellularSocketHandle_t socketHandle,
+                                         uint8_t * pBuffer,
+                                         uint32_t bufferLength,
+                                         uint32_t * pReceivedDataLength,
+                                         CellularSocketRecvFunc_t recvFunc )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    cellularStatus = recvFunc( pContext, socketHandle, pBuffer, bufferLength, pReceivedDataLength );
+
+    #if ( CELLULAR_CONFIG_SOCKET_STATS == 1 )
+    {
+        socketHandle->stats.modemRecvCount++;
+
+        if( cellularStatus != CELLULAR_SUCCESS )
+        {
+            socketHandle->stats.modemErrorCount++;
+        }
+        else
+        {
+            socketHandle->stats.bytesReceived = socketHandle->stats.bytesReceived + *pReceivedDataLength;
+        }
+    }
+    #endif
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static void _socketStatsSend( CellularSocketHandle_t socketHandle,
+                              uint32_t dataLength )
+{
+    #if ( CELLULAR_CONFIG_SOCKET_STATS == 1 )
+    {
+        /* A call with dataLength 0 only sends the buffered data. */
+        if( dataLength > 0U )
+        {
+            socketHandle->stats.sendCount++;
+        }
+    }
+    #else
+    {
+        ( void ) socketHandle;
+        ( void ) dataLength;
+    }
+    #endif
+}
+
+/*-----------------------------------------------------------*/
+
+static void _socketStatsRecv( CellularSocketHandle_t socketHandle,
+                              CellularError_t cellularStatus,
+                              const uint32_t * pReceivedDataLength )
+{
+    #if ( CELLULAR_CONFIG_SOCKET_STATS == 1 )
+    {
+        CellularSocketStats_t * pStats = &( socketHandle->stats );
+
+        pStats->recvCount++;
+
+        /* The data ready latency ends when the application receives data. */
+        if( ( cellularStatus == CELLULAR_SUCCESS ) && ( *pReceivedDataLength > 0U ) )
+        {
+            taskENTER_CRITICAL();
+
+            if( socketHandle->dataReadyPending == true )
+            {
+                /* The time is allowed to wrap around. */
+                pStats->dataReadyLatencyMs = CELLULAR_CONFIG_GET_TIME_MS() - socketHandle->dataReadyTimeMs;
+
+                if( pStats->dataReadyLatencyMs > pStats->dataReadyLatencyMaxMs )
+                {
+                    pStats->dataReadyLatencyMaxMs = pStats->dataReadyLatencyMs;
+                }
+
+                socketHandle->dataReadyPending = false;
+            }
+
+            taskEXIT_CRITICAL();
+        }
+    }
+    #else /* if ( CELLULAR_CONFIG_SOCKET_STATS == 1 ) */
+    {
+        ( void ) socketHandle;
+        ( void ) cellularStatus;
+        ( void ) pReceivedDataLength;
+    }
+    #endif /* if ( CELLULAR_CONFIG_SOCKET_STATS == 1 ) */
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t _Cellular_SocketGetStats( const CellularContext_t * pContext,
+                                          CellularSocketHandle_t socketHandle,
+                                          CellularSocketStats_t * pStats )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_SocketGetStats: Invalid context" ) );
+        cellularStatus = CELLULAR_INVALID_HANDLE;
+    }
+    else if( ( socketHandle == NULL ) || ( socketHandle->socketId >= pContext->numSocketMax ) ||
+             ( pContext->pSocketData[ socketHandle->socketId ] != socketHandle ) || ( pStats == NULL ) )
+    {
+        LogError( ( "_Cellular_SocketGetStats: Invalid parameter" ) );
+        cellularStatus = CELLULAR_BAD_PARAMETER;
+    }
+    else if( ( pContext->socketSendFunc == NULL ) || ( pContext->socketRecvFunc == NULL ) )
+    {
+        /* The statistics are recorded only by the common socket data helpers. */
+        LogError( ( "_Cellular_SocketGetStats: Socket data is not sent and received with the common helpers" ) );
+        cellularStatus = CELLULAR_UNSUPPORTED;
+    }
+    else
+    {
+        #if ( CELLULAR_CONFIG_SOCKET_STATS == 1 )
+        {
+            taskENTER_CRITICAL();
+            ( void ) memcpy( pStats, &( socketHandle->stats ), sizeof( CellularSocketStats_t ) );
+            taskEXIT_CRITICAL();
+        }
+        #else
+        {
+            cellularStatus = CELLULAR_UNSUPPORTED;
+        }
+        #endif
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
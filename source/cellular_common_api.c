@@ -53,15 +53,151 @@
 
 /*-----------------------------------------------------------*/
 
-static CellularError_t _socketSetSockOptLevelTransport( CellularSocketOption_t option,
+static CellularError_t _socketSetSockOptLevelTransport( const CellularContext_t * pContext,
+                                                        CellularSocketOption_t option,
                                                         CellularSocketHandle_t socketHandle,
                                                         const uint8_t * pOptionValue,
                                                         uint32_t optionValueLength );
+static CellularError_t _socketSetRecvPrefetch( const CellularContext_t * pContext,
+                                               CellularSocketHandle_t socketHandle,
+                                               const uint8_t * pOptionValue,
+                                               uint32_t optionValueLength );
+static CellularError_t _socketSetSendCoalesce( const CellularContext_t * pContext,
+                                               CellularSocketHandle_t socketHandle,
+                                               const uint8_t * pOptionValue,
+                                               uint32_t optionValueLength );
+
+/*-----------------------------------------------------------*/
+
+/* Internal function of _socketSetSockOptLevelTransport to reduce complexity. */
+static CellularError_t _socketSetRecvPrefetch( const CellularContext_t * pContext,
+                                               CellularSocketHandle_t socketHandle,
+                                               const uint8_t * pOptionValue,
+                                               uint32_t optionValueLength )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketRecvPrefetchBuffer_t prefetchBuffer = { 0 };
+
+    if( optionValueLength != sizeof( CellularSocketRecvPrefetchBuffer_t ) )
+    {
+        LogError( ( "Cellular_SocketSetSockOpt: Receive prefetch length %u is invalid.",
+                    ( unsigned int ) optionValueLength ) );
+        cellularStatus = CELLULAR_INTERNAL_FAILURE;
+    }
+    else if( socketHandle->recvPrefetch.dataLength > 0U )
+    {
+        LogError( ( "Cellular_SocketSetSockOpt: Cannot change the receive prefetch buffer with %u bytes buffered.",
+                    ( unsigned int ) socketHandle->recvPrefetch.dataLength ) );
+        cellularStatus = CELLULAR_INTERNAL_FAILURE;
+    }
+    else
+    {
+        ( void ) memcpy( &prefetchBuffer, pOptionValue, sizeof( CellularSocketRecvPrefetchBuffer_t ) );
+
+        if( ( prefetchBuffer.pBuffer != NULL ) && ( prefetchBuffer.bufferLength == 0U ) )
+        {
+            LogError( ( "Cellular_SocketSetSockOpt: Receive prefetch buffer length is 0." ) );
+            cellularStatus = CELLULAR_BAD_PARAMETER;
+        }
+        else if( prefetchBuffer.pBuffer == NULL )
+        {
+            /* Disable the receive prefetch. */
+            socketHandle->recvPrefetch.pBuffer = NULL;
+            socketHandle->recvPrefetch.bufferLength = 0;
+            socketHandle->recvPrefetch.readIndex = 0;
+            socketHandle->recvPrefetch.pendingError = CELLULAR_SUCCESS;
+        }
+        else if( pContext->socketRecvFunc == NULL )
+        {
+            /* The module port does not receive socket data with _Cellular_SocketRecvPrefetch. */
+            LogError( ( "Cellular_SocketSetSockOpt: Receive prefetch is not supported by the module." ) );
+            cellularStatus = CELLULAR_UNSUPPORTED;
+        }
+        else
+        {
+            socketHandle->recvPrefetch.pBuffer = prefetchBuffer.pBuffer;
+            socketHandle->recvPrefetch.bufferLength = prefetchBuffer.bufferLength;
+            socketHandle->recvPrefetch.readIndex = 0;
+            socketHandle->recvPrefetch.pendingError = CELLULAR_SUCCESS;
+        }
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Internal function of _socketSetSockOptLevelTransport to reduce complexity. */
+static CellularError_t _socketSetSendCoalesce( const CellularContext_t * pContext,
+                                               CellularSocketHandle_t socketHandle,
+                                               const uint8_t * pOptionValue,
+                                               uint32_t optionValueLength )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketSendCoalesceBuffer_t coalesceBuffer = { 0 };
+
+    if( optionValueLength != sizeof( CellularSocketSendCoalesceBuffer_t ) )
+    {
+        LogError( ( "Cellular_SocketSetSockOpt: Send coalesce length %u is invalid.",
+                    ( unsigned int ) optionValueLength ) );
+        cellularStatus = CELLULAR_INTERNAL_FAILURE;
+    }
+    else if( socketHandle->socketType != CELLULAR_SOCKET_TYPE_STREAM )
+    {
+        LogError( ( "Cellular_SocketSetSockOpt: Send coalesce is only supported on stream sockets." ) );
+        cellularStatus = CELLULAR_UNSUPPORTED;
+    }
+    else if( socketHandle->sendCoalesce.dataLength > 0U )
+    {
+        LogError( ( "Cellular_SocketSetSockOpt: Cannot change the send coalesce buffer with %u bytes buffered.",
+                    ( unsigned int ) socketHandle->sendCoalesce.dataLength ) );
+        cellularStatus = CELLULAR_INTERNAL_FAILURE;
+    }
+    else
+    {
+        ( void ) memcpy( &coalesceBuffer, pOptionValue, sizeof( CellularSocketSendCoalesceBuffer_t ) );
+
+        if( ( coalesceBuffer.pBuffer != NULL ) && ( coalesceBuffer.bufferLength == 0U ) )
+        {
+            LogError( ( "Cellular_SocketSetSockOpt: Send coalesce buffer length is 0." ) );
+            cellularStatus = CELLULAR_BAD_PARAMETER;
+        }
+        else if( coalesceBuffer.pBuffer == NULL )
+        {
+            /* Disable the send coalescing. */
+            socketHandle->sendCoalesce.pBuffer = NULL;
+            socketHandle->sendCoalesce.bufferLength = 0;
+            socketHandle->sendCoalesce.flushDelayMs = 0;
+            socketHandle->sendCoalesce.pendingError = CELLULAR_SUCCESS;
+        }
+        else if( pContext->socketSendFunc == NULL )
+        {
+            LogError( ( "Cellular_SocketSetSockOpt: Send coalesce is not supported by the module." ) );
+            cellularStatus = CELLULAR_UNSUPPORTED;
+        }
+        else if( ( coalesceBuffer.flushDelayMs != 0U ) && ( CELLULAR_TIME_SOURCE_AVAILABLE == 0 ) )
+        {
+            /* The flush delay never elapses without a time source. */
+            LogError( ( "Cellular_SocketSetSockOpt: Send coalesce flush delay requires CELLULAR_CONFIG_GET_TIME_MS." ) );
+            cellularStatus = CELLULAR_UNSUPPORTED;
+        }
+        else
+        {
+            socketHandle->sendCoalesce.pendingError = CELLULAR_SUCCESS;
+            socketHandle->sendCoalesce.pBuffer = coalesceBuffer.pBuffer;
+            socketHandle->sendCoalesce.bufferLength = coalesceBuffer.bufferLength;
+            socketHandle->sendCoalesce.flushDelayMs = coalesceBuffer.flushDelayMs;
+        }
+    }
+
+    return cellularStatus;
+}
 
 /*-----------------------------------------------------------*/
 
 /* Internal function of Cellular_SocketSetSockOpt to reduce complexity. */
-static CellularError_t _socketSetSockOptLevelTransport( CellularSocketOption_t option,
+static CellularError_t _socketSetSockOptLevelTransport( const CellularContext_t * pContext,
+                                                        CellularSocketOption_t option,
                                                         CellularSocketHandle_t socketHandle,
                                                         const uint8_t * pOptionValue,
                                                         uint32_t optionValueLength )
@@ -116,6 +252,14 @@ static CellularError_t _socketSetSockOptLevelTransport( CellularSocketOption_t o
             cellularStatus = CELLULAR_INTERNAL_FAILURE;
         }
     }
+    else if( option == CELLULAR_SOCKET_OPTION_RECV_PREFETCH )
+    {
+        cellularStatus = _socketSetRecvPrefetch( pContext, socketHandle, pOptionValue, optionValueLength );
+    }
+    else if( option == CELLULAR_SOCKET_OPTION_SEND_COALESCE )
+    {
+        cellularStatus = _socketSetSendCoalesce( pContext, socketHandle, pOptionValue, optionValueLength );
+    }
     else
     {
         LogError( ( "Cellular_SocketSetSockOpt: Option not supported" ) );
@@ -130,6 +274,17 @@ static CellularError_t _socketSetSockOptLevelTransport( CellularSocketOption_t o
 CellularError_t Cellular_CommonInit( CellularHandle_t * pCellularHandle,
                                      const CellularCommInterface_t * pCommInterface,
                                      const CellularTokenTable_t * pTokenTable )
+{
+    /* Parameters are checked in this function. */
+    return Cellular_CommonInitWithSocketTable( pCellularHandle, pCommInterface, pTokenTable, NULL );
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CommonInitWithSocketTable( CellularHandle_t * pCellularHandle,
+                                                    const CellularCommInterface_t * pCommInterface,
+                                                    const CellularTokenTable_t * pTokenTable,
+                                                    const CellularSocketTable_t * pSocketTable )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t * pContext = NULL;
@@ -152,7 +307,7 @@ CellularError_t Cellular_CommonInit( CellularHandle_t * pCellularHandle,
     else
     {
         /* Init the common library. */
-        cellularStatus = _Cellular_LibInit( pCellularHandle, pCommInterface, pTokenTable );
+        cellularStatus = _Cellular_LibInitWithSocketTable( pCellularHandle, pCommInterface, pTokenTable, pSocketTable );
 
         if( cellularStatus == CELLULAR_SUCCESS )
         {
@@ -181,8 +336,8 @@ CellularError_t Cellular_CommonInit( CellularHandle_t * pCellularHandle,
             if( cellularStatus != CELLULAR_SUCCESS )
             {
                 /* Clean up the resource in cellular common library if any of the
-                 * module port function returns error. Error returned by _Cellular_LibInit
-                 * is already handled in the implementation. */
+                 * module port function returns error. Error returned by
+                 * _Cellular_LibInitWithSocketTable is already handled in the implementation. */
                 ( void ) _Cellular_LibCleanup( pContext );
             }
         }
@@ -466,7 +621,7 @@ CellularError_t Cellular_CommonSocketSetSockOpt( CellularHandle_t cellularHandle
         }
         else /* optionLevel CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT. */
         {
-            cellularStatus = _socketSetSockOptLevelTransport( option, socketHandle, pOptionValue, optionValueLength );
+            cellularStatus = _socketSetSockOptLevelTransport( pContext, option, socketHandle, pOptionValue, optionValueLength );
         }
     }
 
@@ -564,3 +719,55 @@ CellularError_t Cellular_CommonSocketRegisterClosedCallback( CellularHandle_t ce
 }
 
 /*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CommonSocketPoll( CellularHandle_t cellularHandle,
+                                           CellularSocketPollFd_t * pPollFds,
+                                           uint8_t numPollFds,
+                                           uint32_t timeoutMs,
+                                           uint8_t * pNumReady )
+{
+    CellularContext_t * pContext = ( CellularContext_t * ) cellularHandle;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    /* pContext is checked in _Cellular_CheckLibraryStatus function. */
+    cellularStatus = _Cellular_CheckLibraryStatus( pContext );
+
+    if( cellularStatus != CELLULAR_SUCCESS )
+    {
+        LogDebug( ( "_Cellular_CheckLibraryStatus failed" ) );
+    }
+    else
+    {
+        /* Parameters are checked in this function. */
+        cellularStatus = _Cellular_SocketPoll( pContext, pPollFds, numPollFds, timeoutMs, pNumReady );
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularError_t Cellular_CommonSocketGetStats( CellularHandle_t cellularHandle,
+                                               CellularSocketHandle_t socketHandle,
+                                               CellularSocketStats_t * pStats )
+{
+    CellularContext_t * pContext = ( CellularContext_t * ) cellularHandle;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    /* pContext is checked in _Cellular_CheckLibraryStatus function. */
+    cellularStatus = _Cellular_CheckLibraryStatus( pContext );
+
+    if( cellularStatus != CELLULAR_SUCCESS )
+    {
+        LogDebug( ( "_Cellular_CheckLibraryStatus failed" ) );
+    }
+    else
+    {
+        /* Parameters are checked in this function. */
+        cellularStatus = _Cellular_SocketGetStats( pContext, socketHandle, pStats );
+    }
+
+    return cellularStatus;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,251 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @brief FreeRTOS Cellular Library heap usage accounting.
+ */
+
+/* The config header is always included first. */
+
+#ifndef CELLULAR_DO_NOT_USE_CUSTOM_CONFIG
+    /* Include custom config file before other headers. */
+    #include "cellular_config.h"
+#endif
+#include "cellular_config_defaults.h"
+
+/* Standard includes. */
+#include <string.h>
+
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_api.h"
+#include "cellular_internal.h"
+#include "cellular_heap.h"
+
+/*-----------------------------------------------------------*/
+
+#if ( CELLULAR_CONFIG_HEAP_STATS == 1 )
+
+/**
+ * @brief The window used to measure the allocation rate.
+ */
+    #define HEAP_STATS_RATE_WINDOW_MS    ( 1000U )
+
+/**
+ * @brief Accounting header stored in front of each allocation.
+ *
+ * The union keeps the user memory aligned as the platform allocator does.
+ */
+    typedef union cellularHeapHeader
+    {
+        struct
+        {
+            size_t size;             /**<  Total size of the allocation including this header. */
+            CellularHeapSite_t site; /**<  The allocation site. */
+        } info;                      /**<  The accounting information. */
+        void * pAlignPointer;        /**<  Pointer alignment. */
+        uint64_t alignInteger;       /**<  Integer alignment. */
+        double alignFloat;           /**<  Floating point alignment. */
+    } cellularHeapHeader_t;
+
+/*-----------------------------------------------------------*/
+
+    static void _updateAllocRate( uint32_t newAllocs );
+
+/*-----------------------------------------------------------*/
+
+    static CellularHeapStats_t cellularHeapStats = { 0 };
+    static uint32_t rateWindowStartMs = 0U;
+    static uint32_t rateWindowAllocs = 0U;
+
+/*-----------------------------------------------------------*/
+
+/* This function must be called in critical section. */
+    static void _updateAllocRate( uint32_t newAllocs )
+    {
+        uint32_t currentTimeMs = CELLULAR_CONFIG_GET_TIME_MS();
+        uint32_t elapsedMs = currentTimeMs - rateWindowStartMs;
+
+        if( elapsedMs >= HEAP_STATS_RATE_WINDOW_MS )
+        {
+            /* The window is complete. Rescale the count to one second. The
+             * window is restarted even if the time source has been stalled for
+             * more than one window so that the rate drops to zero. */
+            if( elapsedMs < ( 2U * HEAP_STATS_RATE_WINDOW_MS ) )
+            {
+                cellularHeapStats.allocRatePerSecond = ( uint32_t ) ( ( ( uint64_t ) rateWindowAllocs * 1000U ) / elapsedMs );
+            }
+            else
+            {
+                cellularHeapStats.allocRatePerSecond = 0U;
+            }
+
+            rateWindowStartMs = currentTimeMs;
+            rateWindowAllocs = 0U;
+        }
+
+        rateWindowAllocs = rateWindowAllocs + newAllocs;
+    }
+
+/*-----------------------------------------------------------*/
+
+    void * _Cellular_Malloc( size_t size,
+                             CellularHeapSite_t site )
+    {
+        cellularHeapHeader_t * pHeader = NULL;
+        CellularHeapSiteStats_t * pSiteStats = NULL;
+        void * pMem = NULL;
+        size_t totalSize = size + sizeof( cellularHeapHeader_t );
+
+        CELLULAR_CONFIG_ASSERT( ( site < CELLULAR_HEAP_SITE_MAX ) );
+
+        /* Check for size overflow before allocating. */
+        if( totalSize > size )
+        {
+            pHeader = ( cellularHeapHeader_t * ) Platform_Malloc( totalSize );
+        }
+
+        pSiteStats = &cellularHeapStats.sites[ site ];
+
+        taskENTER_CRITICAL();
+
+        if( pHeader == NULL )
+        {
+            cellularHeapStats.failCount++;
+            pSiteStats->failCount++;
+        }
+        else
+        {
+            pHeader->info.size = totalSize;
+            pHeader->info.site = site;
+            pMem = ( void * ) &pHeader[ 1 ];
+
+            cellularHeapStats.allocCount++;
+            cellularHeapStats.currentBytes = cellularHeapStats.currentBytes + totalSize;
+
+            if( cellularHeapStats.currentBytes > cellularHeapStats.peakBytes )
+            {
+                cellularHeapStats.peakBytes = cellularHeapStats.currentBytes;
+            }
+
+            pSiteStats->allocCount++;
+            pSiteStats->currentBytes = pSiteStats->currentBytes + totalSize;
+
+            if( pSiteStats->currentBytes > pSiteStats->peakBytes )
+            {
+                pSiteStats->peakBytes = pSiteStats->currentBytes;
+            }
+
+            _updateAllocRate( 1U );
+        }
+
+        taskEXIT_CRITICAL();
+
+        return pMem;
+    }
+
+/*-----------------------------------------------------------*/
+
+    void _Cellular_Free( void * pMem )
+    {
+        cellularHeapHeader_t * pHeader = NULL;
+        CellularHeapSiteStats_t * pSiteStats = NULL;
+
+        if( pMem != NULL )
+        {
+            pHeader = &( ( cellularHeapHeader_t * ) pMem )[ -1 ];
+            CELLULAR_CONFIG_ASSERT( ( pHeader->info.site < CELLULAR_HEAP_SITE_MAX ) );
+            pSiteStats = &cellularHeapStats.sites[ pHeader->info.site ];
+
+            taskENTER_CRITICAL();
+
+            cellularHeapStats.freeCount++;
+            cellularHeapStats.currentBytes = cellularHeapStats.currentBytes - pHeader->info.size;
+            pSiteStats->freeCount++;
+            pSiteStats->currentBytes = pSiteStats->currentBytes - pHeader->info.size;
+
+            taskEXIT_CRITICAL();
+
+            Platform_Free( pHeader );
+        }
+    }
+
+/*-----------------------------------------------------------*/
+
+    CellularError_t Cellular_HeapGetStats( CellularHeapStats_t * pStats )
+    {
+        CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+        if( pStats == NULL )
+        {
+            LogError( ( "Cellular_HeapGetStats : Bad parameter" ) );
+            cellularStatus = CELLULAR_BAD_PARAMETER;
+        }
+        else
+        {
+            taskENTER_CRITICAL();
+            _updateAllocRate( 0U );
+            ( void ) memcpy( pStats, &cellularHeapStats, sizeof( CellularHeapStats_t ) );
+            taskEXIT_CRITICAL();
+        }
+
+        return cellularStatus;
+    }
+
+/*-----------------------------------------------------------*/
+
+    CellularError_t Cellular_HeapResetStats( void )
+    {
+        uint8_t i = 0;
+
+        taskENTER_CRITICAL();
+
+        cellularHeapStats.peakBytes = cellularHeapStats.currentBytes;
+        cellularHeapStats.allocCount = 0U;
+        cellularHeapStats.freeCount = 0U;
+        cellularHeapStats.failCount = 0U;
+        cellularHeapStats.allocRatePerSecond = 0U;
+
+        for( i = 0; i < ( uint8_t ) CELLULAR_HEAP_SITE_MAX; i++ )
+        {
+            cellularHeapStats.sites[ i ].peakBytes = cellularHeapStats.sites[ i ].currentBytes;
+            cellularHeapStats.sites[ i ].allocCount = 0U;
+            cellularHeapStats.sites[ i ].freeCount = 0U;
+            cellularHeapStats.sites[ i ].failCount = 0U;
+        }
+
+        rateWindowStartMs = CELLULAR_CONFIG_GET_TIME_MS();
+        rateWindowAllocs = 0U;
+
+        taskEXIT_CRITICAL();
+
+        return CELLULAR_SUCCESS;
+    }
+
+#endif /* if ( CELLULAR_CONFIG_HEAP_STATS == 1 ) */
+
+/*-----------------------------------------------------------*/
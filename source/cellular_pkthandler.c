@@ -45,6 +45,7 @@
 #include "cellular_pktio_internal.h"
 #include "cellular_types.h"
 #include "cellular_common_internal.h"
+#include "cellular_heap.h"
 
 /*-----------------------------------------------------------*/
 
@@ -57,6 +58,13 @@
     #define strtok_r    strtok_s
 #endif
 
+/* FNV-1a hash parameters used to hash AT command class and URC token. */
+#define AT_CMD_CLASS_HASH_OFFSET      ( 2166136261UL )
+#define AT_CMD_CLASS_HASH_PRIME       ( 16777619UL )
+
+/* Maximum timeout backoff after consecutive timeouts. */
+#define AT_CMD_LATENCY_BACKOFF_MAX    ( 4U )
+
 /*-----------------------------------------------------------*/
 
 static CellularPktStatus_t _convertAndQueueRespPacket( CellularContext_t * pContext,
@@ -69,18 +77,39 @@ static CellularPktStatus_t _Cellular_AtcmdRequestTimeoutWithCallbackRaw( Cellula
 static CellularPktStatus_t _Cellular_DataSendWithTimeoutDelayRaw( CellularContext_t * pContext,
                                                                   CellularAtDataReq_t dataReq,
                                                                   uint32_t timeoutMs );
+static bool _Cellular_DataSegmentsValid( const CellularAtDataReq_t * pDataReq );
+static CellularPktStatus_t _Cellular_DataSendSegmentsRaw( CellularContext_t * pContext,
+                                                          CellularAtDataReq_t dataReq );
+static CellularPktStatus_t _Cellular_AtcmdDataSendRaw( CellularContext_t * pContext,
+                                                        CellularAtReq_t atReq,
+                                                        CellularAtDataReq_t dataReq,
+                                                        CellularATCommandDataSendPrefixCallback_t pktDataSendPrefixCallback,
+                                                        void * pCallbackContext,
+                                                        uint32_t atTimeoutMS,
+                                                        uint32_t dataTimeoutMS,
+                                                        uint32_t interDelayMS );
 static void _Cellular_PktHandlerAcquirePktRequestMutex( CellularContext_t * pContext );
 static void _Cellular_PktHandlerReleasePktRequestMutex( CellularContext_t * pContext );
 static int _searchCompareFunc( const void * pInputToken,
                                const void * pBase );
 static int32_t _sortCompareFunc( const void * pElem1Ptr,
                                  const void * pElem2Ptr );
+static uint32_t _urcTokenHash( const char * pToken,
+                               size_t tokenLength,
+                               uint32_t seed );
+static const CellularAtParseTokenMap_t * _urcTokenLookup( const CellularTokenTable_t * pTokenTable,
+                                                          const char * pTokenPtr );
 static CellularPktStatus_t _atParseGetHandler( CellularContext_t * pContext,
                                                const char * pTokenPtr,
                                                char * pSavePtr );
 static CellularPktStatus_t _handleUndefinedMessage( CellularContext_t * pContext,
                                                     const char * pLine );
 
+#if ( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT == 1 )
+    static CellularAtCmdLatency_t * _getAtCmdLatency( CellularContext_t * pContext,
+                                                      const char * pAtCmd );
+#endif
+
 /*-----------------------------------------------------------*/
 
 static CellularPktStatus_t _convertAndQueueRespPacket( CellularContext_t * pContext,
@@ -190,13 +219,37 @@ static CellularPktStatus_t _processUrcPacket( CellularContext_t * pContext,
         }
 
         /* Free the allocated pInputLine. */
-        Platform_Free( pInputLine );
+        _Cellular_Free( pInputLine );
     }
 
     return pktStatus;
 }
 
 /*-----------------------------------------------------------*/
+
+#if ( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT == 1 )
+
+/* This function must be called with pktRequestMutex held. */
+    static CellularAtCmdLatency_t * _getAtCmdLatency( CellularContext_t * pContext,
+                                                      const char * pAtCmd )
+    {
+        uint32_t cmdHash = _Cellular_AtCmdClassHash( pAtCmd );
+        CellularAtCmdLatency_t * pLatency = &pContext->atCmdLatency[ cmdHash % CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_CLASS_NUM ];
+
+        if( ( pLatency->sampleCount == 0U ) || ( pLatency->cmdHash != cmdHash ) )
+        {
+            /* Another AT command class mapped to this entry. Restart the estimate. */
+            ( void ) memset( pLatency, 0, sizeof( CellularAtCmdLatency_t ) );
+            pLatency->cmdHash = cmdHash;
+        }
+
+        return pLatency;
+    }
+
+#endif /* if ( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT == 1 ) */
+
+/*-----------------------------------------------------------*/
+
 static CellularPktStatus_t _Cellular_AtcmdRequestTimeoutWithCallbackRaw( CellularContext_t * pContext,
                                                                          CellularAtReq_t atReq,
                                                                          uint32_t timeoutMS )
@@ -204,6 +257,12 @@ static CellularPktStatus_t _Cellular_AtcmdRequestTimeoutWithCallbackRaw( Cellula
     CellularPktStatus_t respCode = CELLULAR_PKT_STATUS_OK;
     CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
     PlatformBaseType_t qRet = platformFALSE;
+    uint32_t waitTimeoutMS = timeoutMS;
+
+    #if ( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT == 1 )
+        CellularAtCmdLatency_t * pLatency = NULL;
+        uint32_t sendTimeMs = 0;
+    #endif
 
     if( atReq.pAtCmd == NULL )
     {
@@ -222,6 +281,14 @@ static CellularPktStatus_t _Cellular_AtcmdRequestTimeoutWithCallbackRaw( Cellula
         pContext->pCurrentCmd = atReq.pAtCmd;
         PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
 
+        #if ( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT == 1 )
+        {
+            pLatency = _getAtCmdLatency( pContext, atReq.pAtCmd );
+            waitTimeoutMS = _Cellular_AtCmdLatencyGetTimeout( pLatency, timeoutMS );
+            sendTimeMs = CELLULAR_CONFIG_GET_TIME_MS();
+        }
+        #endif
+
         pktStatus = _Cellular_PktioSendAtCmd( pContext, atReq.pAtCmd, atReq.atCmdType, atReq.pAtRspPrefix );
 
         if( pktStatus != CELLULAR_PKT_STATUS_OK )
@@ -231,7 +298,21 @@ static CellularPktStatus_t _Cellular_AtcmdRequestTimeoutWithCallbackRaw( Cellula
         else
         {
             /* Wait for a response. */
-            qRet = PlatformQueue_Receive( pContext->pktRespQueue, &respCode, pdMS_TO_TICKS( timeoutMS ) );
+            qRet = PlatformQueue_Receive( pContext->pktRespQueue, &respCode, pdMS_TO_TICKS( waitTimeoutMS ) );
+
+            #if ( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT == 1 )
+            {
+                if( qRet == platformTRUE )
+                {
+                    _Cellular_AtCmdLatencyUpdate( pLatency, CELLULAR_CONFIG_GET_TIME_MS() - sendTimeMs );
+                }
+                else
+                {
+                    LogWarn( ( "AT cmd %s adaptive timeout %u ms expired", atReq.pAtCmd, ( unsigned int ) waitTimeoutMS ) );
+                    _Cellular_AtCmdLatencyBackoff( pLatency );
+                }
+            }
+            #endif
 
             if( qRet == platformTRUE )
             {
@@ -272,12 +353,20 @@ static CellularPktStatus_t _Cellular_DataSendWithTimeoutDelayRaw( CellularContex
     CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
     PlatformBaseType_t qStatus = platformFALSE;
     uint32_t sendEndPatternLen = 0U;
+    CellularDataSegment_t dataSegment = { 0 };
+    bool sendAsync = false;
+    uint32_t respTimeoutMs = timeoutMs;
 
-    if( ( dataReq.pData == NULL ) || ( dataReq.pSentDataLength == NULL ) )
+    if( ( ( dataReq.pData == NULL ) && ( dataReq.pSegments == NULL ) ) || ( dataReq.pSentDataLength == NULL ) )
     {
         LogError( ( "_Cellular_DataSendWithTimeoutDelayRaw, null input" ) );
         pktStatus = CELLULAR_PKT_STATUS_BAD_REQUEST;
     }
+    else if( ( dataReq.pSegments != NULL ) && ( _Cellular_DataSegmentsValid( &dataReq ) == false ) )
+    {
+        LogError( ( "_Cellular_DataSendWithTimeoutDelayRaw, invalid data segments" ) );
+        pktStatus = CELLULAR_PKT_STATUS_BAD_REQUEST;
+    }
     else
     {
         LogDebug( ( ">>>>>Start sending Data <<<<<" ) );
@@ -288,17 +377,58 @@ static CellularPktStatus_t _Cellular_DataSendWithTimeoutDelayRaw( CellularContex
         pContext->PktioAtCmdType = CELLULAR_AT_NO_RESULT;
         PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
 
-        *dataReq.pSentDataLength = _Cellular_PktioSendData( pContext, dataReq.pData, dataReq.dataLen );
+        if( ( dataReq.pSegments == NULL ) && ( dataReq.pEndPattern != NULL ) &&
+            ( pContext->pCommIntf != NULL ) && ( pContext->pCommIntf->sendv != NULL ) )
+        {
+            /* The comm interface sends the data and the end pattern in one call. */
+            dataSegment.pData = dataReq.pData;
+            dataSegment.dataLength = dataReq.dataLen;
+            dataReq.pSegments = &dataSegment;
+            dataReq.segmentCount = 1U;
+        }
 
-        if( *dataReq.pSentDataLength != dataReq.dataLen )
+        if( dataReq.pSegments != NULL )
         {
-            LogError( ( "_Cellular_DataSendWithTimeoutDelayRaw, incomplete data transfer" ) );
-            pktStatus = CELLULAR_PKT_STATUS_SEND_ERROR;
+            /* The end pattern is sent with the segments. */
+            pktStatus = _Cellular_DataSendSegmentsRaw( pContext, dataReq );
+        }
+        else if( ( dataReq.pEndPattern == NULL ) && ( pContext->pCommIntf != NULL ) &&
+                 ( pContext->pCommIntf->sendAsync != NULL ) )
+        {
+            /* Wait for the response while the comm interface is sending the data.
+             * The response wait also covers the transfer time. */
+            pktStatus = _Cellular_PktioSendDataAsync( pContext, dataReq.pData, dataReq.dataLen );
+
+            if( pktStatus == CELLULAR_PKT_STATUS_OK )
+            {
+                sendAsync = true;
+
+                if( respTimeoutMs <= ( UINT32_MAX - CELLULAR_COMM_IF_SEND_TIMEOUT_MS ) )
+                {
+                    respTimeoutMs = respTimeoutMs + CELLULAR_COMM_IF_SEND_TIMEOUT_MS;
+                }
+            }
+            else
+            {
+                LogError( ( "_Cellular_DataSendWithTimeoutDelayRaw, failed to start data transfer" ) );
+                *dataReq.pSentDataLength = 0U;
+                pktStatus = CELLULAR_PKT_STATUS_SEND_ERROR;
+            }
+        }
+        else
+        {
+            *dataReq.pSentDataLength = _Cellular_PktioSendData( pContext, dataReq.pData, dataReq.dataLen );
+
+            if( *dataReq.pSentDataLength != dataReq.dataLen )
+            {
+                LogError( ( "_Cellular_DataSendWithTimeoutDelayRaw, incomplete data transfer" ) );
+                pktStatus = CELLULAR_PKT_STATUS_SEND_ERROR;
+            }
         }
     }
 
     /* End pattern for specific modem. */
-    if( ( pktStatus == CELLULAR_PKT_STATUS_OK ) && ( dataReq.pEndPattern != NULL ) )
+    if( ( pktStatus == CELLULAR_PKT_STATUS_OK ) && ( dataReq.pSegments == NULL ) && ( dataReq.pEndPattern != NULL ) )
     {
         sendEndPatternLen = _Cellular_PktioSendData( pContext, dataReq.pEndPattern, dataReq.endPatternLen );
 
@@ -312,7 +442,7 @@ static CellularPktStatus_t _Cellular_DataSendWithTimeoutDelayRaw( CellularContex
     /* Wait for a response. */
     if( pktStatus == CELLULAR_PKT_STATUS_OK )
     {
-        qStatus = PlatformQueue_Receive( pContext->pktRespQueue, &respCode, pdMS_TO_TICKS( timeoutMs ) );
+        qStatus = PlatformQueue_Receive( pContext->pktRespQueue, &respCode, pdMS_TO_TICKS( respTimeoutMs ) );
 
         if( qStatus == platformTRUE )
         {
@@ -341,11 +471,146 @@ static CellularPktStatus_t _Cellular_DataSendWithTimeoutDelayRaw( CellularContex
         LogDebug( ( "<<<<<Exit sending data ret[%d]>>>>>", pktStatus ) );
     }
 
+    /* The data is returned to the caller after the comm interface completes the transfer. */
+    if( sendAsync == true )
+    {
+        *dataReq.pSentDataLength = _Cellular_PktioSendDataWait( pContext, CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+
+        if( ( *dataReq.pSentDataLength != dataReq.dataLen ) && ( pktStatus == CELLULAR_PKT_STATUS_OK ) )
+        {
+            LogError( ( "_Cellular_DataSendWithTimeoutDelayRaw, incomplete data transfer" ) );
+            pktStatus = CELLULAR_PKT_STATUS_SEND_ERROR;
+        }
+    }
+
+    return pktStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+static bool _Cellular_DataSegmentsValid( const CellularAtDataReq_t * pDataReq )
+{
+    bool segmentsValid = true;
+    uint32_t totalLength = 0U;
+    uint32_t i = 0U;
+
+    if( ( pDataReq->segmentCount == 0U ) || ( pDataReq->segmentCount > CELLULAR_MAX_SEND_DATA_SEGMENTS ) )
+    {
+        segmentsValid = false;
+    }
+    else
+    {
+        for( i = 0U; ( i < pDataReq->segmentCount ) && ( segmentsValid == true ); i++ )
+        {
+            /* Check against the remaining length so that the sum cannot wrap. */
+            if( ( pDataReq->pSegments[ i ].pData == NULL ) ||
+                ( pDataReq->pSegments[ i ].dataLength > ( pDataReq->dataLen - totalLength ) ) )
+            {
+                segmentsValid = false;
+            }
+            else
+            {
+                totalLength = totalLength + pDataReq->pSegments[ i ].dataLength;
+            }
+        }
+
+        if( totalLength != pDataReq->dataLen )
+        {
+            segmentsValid = false;
+        }
+    }
+
+    return segmentsValid;
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularPktStatus_t _Cellular_DataSendSegmentsRaw( CellularContext_t * pContext,
+                                                          CellularAtDataReq_t dataReq )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularDataSegment_t segments[ CELLULAR_MAX_SEND_DATA_SEGMENTS + 1U ];
+    uint32_t segmentCount = dataReq.segmentCount;
+    uint32_t sendLength = dataReq.dataLen;
+    uint32_t sentLength = 0U;
+
+    /* Only the segment descriptors are copied. The end pattern is sent as the
+     * last segment. */
+    ( void ) memcpy( segments, dataReq.pSegments, sizeof( CellularDataSegment_t ) * segmentCount );
+
+    if( dataReq.pEndPattern != NULL )
+    {
+        segments[ segmentCount ].pData = dataReq.pEndPattern;
+        segments[ segmentCount ].dataLength = dataReq.endPatternLen;
+        segmentCount++;
+        sendLength = sendLength + dataReq.endPatternLen;
+    }
+
+    sentLength = _Cellular_PktioSendDatav( pContext, segments, segmentCount );
+
+    if( sentLength < dataReq.dataLen )
+    {
+        *dataReq.pSentDataLength = sentLength;
+        LogError( ( "_Cellular_DataSendWithTimeoutDelayRaw, incomplete data transfer" ) );
+        pktStatus = CELLULAR_PKT_STATUS_SEND_ERROR;
+    }
+    else
+    {
+        *dataReq.pSentDataLength = dataReq.dataLen;
+
+        if( sentLength != sendLength )
+        {
+            LogError( ( "_Cellular_DataSendWithTimeoutDelayRaw, incomplete endpattern transfer" ) );
+            pktStatus = CELLULAR_PKT_STATUS_SEND_ERROR;
+        }
+    }
+
     return pktStatus;
 }
 
 /*-----------------------------------------------------------*/
 
+/* This function must be called with pktRequestMutex held. */
+static CellularPktStatus_t _Cellular_AtcmdDataSendRaw( CellularContext_t * pContext,
+                                                        CellularAtReq_t atReq,
+                                                        CellularAtDataReq_t dataReq,
+                                                        CellularATCommandDataSendPrefixCallback_t pktDataSendPrefixCallback,
+                                                        void * pCallbackContext,
+                                                        uint32_t atTimeoutMS,
+                                                        uint32_t dataTimeoutMS,
+                                                        uint32_t interDelayMS )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+
+    /* Set the data send prefix callback. */
+    PlatformMutex_Lock( &( pContext->PktRespMutex ) );
+    pContext->pktDataSendPrefixCB = pktDataSendPrefixCallback;
+    pContext->pDataSendPrefixCBContext = pCallbackContext;
+    PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+
+    pktStatus = _Cellular_AtcmdRequestTimeoutWithCallbackRaw( pContext, atReq, atTimeoutMS );
+
+    /* Clear the data send prefix callback. */
+    PlatformMutex_Lock( &( pContext->PktRespMutex ) );
+    pContext->pDataSendPrefixCBContext = NULL;
+    pContext->pktDataSendPrefixCB = NULL;
+    PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+
+    if( pktStatus == CELLULAR_PKT_STATUS_OK )
+    {
+        if( interDelayMS > 0U )
+        {
+            /* Cellular modem may require a minimum delay before sending data. */
+            Platform_Delay( interDelayMS );
+        }
+
+        pktStatus = _Cellular_DataSendWithTimeoutDelayRaw( pContext, dataReq, dataTimeoutMS );
+    }
+
+    return pktStatus;
+}
+/*-----------------------------------------------------------*/
+
 static void _Cellular_PktHandlerAcquirePktRequestMutex( CellularContext_t * pContext )
 {
     PlatformMutex_Lock( &( pContext->pktRequestMutex ) );
@@ -430,6 +695,51 @@ static int32_t _sortCompareFunc( const void * pElem1Ptr,
 
 /*-----------------------------------------------------------*/
 
+static uint32_t _urcTokenHash( const char * pToken,
+                               size_t tokenLength,
+                               uint32_t seed )
+{
+    uint32_t tokenHash = AT_CMD_CLASS_HASH_OFFSET ^ seed;
+    size_t i = 0;
+
+    for( i = 0; i < tokenLength; i++ )
+    {
+        tokenHash = ( tokenHash ^ ( uint32_t ) ( uint8_t ) pToken[ i ] ) * AT_CMD_CLASS_HASH_PRIME;
+    }
+
+    return tokenHash;
+}
+
+/*-----------------------------------------------------------*/
+
+static const CellularAtParseTokenMap_t * _urcTokenLookup( const CellularTokenTable_t * pTokenTable,
+                                                          const char * pTokenPtr )
+{
+    const CellularTokenLookup_t * pLookup = pTokenTable->pTokenLookup;
+    const CellularAtParseTokenMap_t * pElementPtr = NULL;
+    size_t tokenLength = strlen( pTokenPtr );
+    uint32_t tokenHash = _urcTokenHash( pTokenPtr, tokenLength, pLookup->urcHashSeed );
+    uint32_t tokenIndex = pLookup->pUrcHashSlots[ tokenHash & pLookup->urcHashSlotMask ];
+
+    /* The slot stores the table index plus one. The generator makes the hash
+     * collision free, so a single slot is checked. */
+    if( ( tokenIndex > 0U ) && ( tokenIndex <= pTokenTable->cellularPrefixToParserMapSize ) )
+    {
+        tokenIndex = tokenIndex - 1U;
+
+        if( ( ( size_t ) pLookup->pUrcTokenLength[ tokenIndex ] == tokenLength ) &&
+            ( pLookup->pUrcTokenHash[ tokenIndex ] == tokenHash ) &&
+            ( memcmp( pTokenTable->pCellularUrcHandlerTable[ tokenIndex ].pStrValue, pTokenPtr, tokenLength ) == 0 ) )
+        {
+            pElementPtr = &( pTokenTable->pCellularUrcHandlerTable[ tokenIndex ] );
+        }
+    }
+
+    return pElementPtr;
+}
+
+/*-----------------------------------------------------------*/
+
 static CellularPktStatus_t _atParseGetHandler( CellularContext_t * pContext,
                                                const char * pTokenPtr,
                                                char * pSavePtr )
@@ -440,14 +750,21 @@ static CellularPktStatus_t _atParseGetHandler( CellularContext_t * pContext,
     const CellularAtParseTokenMap_t * pTokenMap = pContext->tokenTable.pCellularUrcHandlerTable;
     uint32_t tokenMapSize = pContext->tokenTable.cellularPrefixToParserMapSize;
 
-    /* MISRA Ref 21.9.1 [Use of bsearch] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-219 */
-    /* coverity[misra_c_2012_rule_21_9_violation] */
-    pElementPtr = ( CellularAtParseTokenMap_t * ) bsearch( ( const void * ) pTokenPtr,
-                                                           ( const void * ) pTokenMap,
-                                                           tokenMapSize,
-                                                           sizeof( CellularAtParseTokenMap_t ),
-                                                           &_searchCompareFunc );
+    if( pContext->tokenTable.pTokenLookup != NULL )
+    {
+        pElementPtr = _urcTokenLookup( &( pContext->tokenTable ), pTokenPtr );
+    }
+    else
+    {
+        /* MISRA Ref 21.9.1 [Use of bsearch] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Cellular-Interface/blob/main/MISRA.md#rule-219 */
+        /* coverity[misra_c_2012_rule_21_9_violation] */
+        pElementPtr = ( CellularAtParseTokenMap_t * ) bsearch( ( const void * ) pTokenPtr,
+                                                               ( const void * ) pTokenMap,
+                                                               tokenMapSize,
+                                                               sizeof( CellularAtParseTokenMap_t ),
+                                                               &_searchCompareFunc );
+    }
 
     if( pElementPtr != NULL )
     {
@@ -691,29 +1008,82 @@ CellularPktStatus_t _Cellular_AtcmdDataSend( CellularContext_t * pContext,
     {
         _Cellular_PktHandlerAcquirePktRequestMutex( pContext );
 
-        /* Set the data send prefix callback. */
-        PlatformMutex_Lock( &( pContext->PktRespMutex ) );
-        pContext->pktDataSendPrefixCB = pktDataSendPrefixCallback;
-        pContext->pDataSendPrefixCBContext = pCallbackContext;
-        PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+        pktStatus = _Cellular_AtcmdDataSendRaw( pContext, atReq, dataReq, pktDataSendPrefixCallback,
+                                                pCallbackContext, atTimeoutMS, dataTimeoutMS, interDelayMS );
 
-        pktStatus = _Cellular_AtcmdRequestTimeoutWithCallbackRaw( pContext, atReq, atTimeoutMS );
+        _Cellular_PktHandlerReleasePktRequestMutex( pContext );
+    }
 
-        /* Clear the data send prefix callback. */
-        PlatformMutex_Lock( &( pContext->PktRespMutex ) );
-        pContext->pDataSendPrefixCBContext = NULL;
-        pContext->pktDataSendPrefixCB = NULL;
-        PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+    return pktStatus;
+}
 
-        if( pktStatus == CELLULAR_PKT_STATUS_OK )
+/*-----------------------------------------------------------*/
+
+CellularPktStatus_t _Cellular_AtcmdDataSendBulk( CellularContext_t * pContext,
+                                                 CellularAtDataReq_t dataReq,
+                                                 CellularATCommandDataSendChunkCallback_t pktDataSendChunkCallback,
+                                                 CellularATCommandDataSendPrefixCallback_t pktDataSendPrefixCallback,
+                                                 void * pCallbackContext,
+                                                 uint32_t atTimeoutMS,
+                                                 uint32_t dataTimeoutMS,
+                                                 uint32_t interDelayMS )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularAtReq_t atReq = { 0 };
+    CellularAtDataReq_t chunkReq = dataReq;
+    uint32_t sentLength = 0U;
+    uint32_t chunkSentLength = 0U;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_AtcmdDataSendBulk : Invalid cellular context" ) );
+        pktStatus = CELLULAR_PKT_STATUS_INVALID_HANDLE;
+    }
+    else if( ( dataReq.pData == NULL ) || ( dataReq.pSentDataLength == NULL ) ||
+             ( dataReq.pSegments != NULL ) || ( pktDataSendChunkCallback == NULL ) )
+    {
+        LogError( ( "_Cellular_AtcmdDataSendBulk : Invalid parameter" ) );
+        pktStatus = CELLULAR_PKT_STATUS_BAD_PARAM;
+    }
+    else
+    {
+        *dataReq.pSentDataLength = 0U;
+        chunkReq.pSentDataLength = &chunkSentLength;
+
+        /* Hold the request mutex for all the chunks. Other AT commands are not
+         * sent between the chunks. */
+        _Cellular_PktHandlerAcquirePktRequestMutex( pContext );
+
+        while( ( pktStatus == CELLULAR_PKT_STATUS_OK ) && ( sentLength < dataReq.dataLen ) )
         {
-            if( interDelayMS > 0U )
+            chunkReq.pData = &dataReq.pData[ sentLength ];
+            chunkReq.dataLen = dataReq.dataLen - sentLength;
+
+            if( chunkReq.dataLen > CELLULAR_MAX_SEND_DATA_LEN )
             {
-                /* Cellular modem may require a minimum delay before sending data. */
-                Platform_Delay( interDelayMS );
+                chunkReq.dataLen = CELLULAR_MAX_SEND_DATA_LEN;
             }
 
-            pktStatus = _Cellular_DataSendWithTimeoutDelayRaw( pContext, dataReq, dataTimeoutMS );
+            chunkSentLength = 0U;
+            pktStatus = pktDataSendChunkCallback( pCallbackContext, chunkReq.dataLen, &atReq );
+
+            if( pktStatus == CELLULAR_PKT_STATUS_OK )
+            {
+                pktStatus = _Cellular_AtcmdDataSendRaw( pContext, atReq, chunkReq, pktDataSendPrefixCallback,
+                                                        pCallbackContext, atTimeoutMS, dataTimeoutMS, interDelayMS );
+            }
+
+            if( pktStatus == CELLULAR_PKT_STATUS_OK )
+            {
+                /* Only the chunks acknowledged by the modem are counted. */
+                sentLength = sentLength + chunkReq.dataLen;
+                *dataReq.pSentDataLength = sentLength;
+            }
+            else
+            {
+                LogError( ( "_Cellular_AtcmdDataSendBulk : send stopped at %u of %u bytes, pktStatus %d",
+                            ( unsigned int ) sentLength, ( unsigned int ) dataReq.dataLen, pktStatus ) );
+            }
         }
 
         _Cellular_PktHandlerReleasePktRequestMutex( pContext );
@@ -820,16 +1190,20 @@ CellularPktStatus_t _Cellular_AtParseInit( const CellularContext_t * pContext )
         pTokenMap = pContext->tokenTable.pCellularUrcHandlerTable;
         tokenMapSize = pContext->tokenTable.cellularPrefixToParserMapSize;
 
-        /* Check order of the sorted Map. */
-        for( i = 0; i < ( tokenMapSize - 1U ); i++ )
+        /* Generated tables are sorted and checked when they are generated. */
+        if( pContext->tokenTable.pTokenLookup == NULL )
         {
-            result = _sortCompareFunc( &( pTokenMap[ i ] ), &( pTokenMap[ i + 1U ] ) );
-
-            if( result >= 0 )
+            /* Check order of the sorted Map. */
+            for( i = 0; i < ( tokenMapSize - 1U ); i++ )
             {
-                LogError( ( "AtParseFail for %u: %d %s %s", ( unsigned int ) i, ( int ) result,
-                            pTokenMap[ i ].pStrValue, pTokenMap[ i + 1U ].pStrValue ) );
-                finit = false;
+                result = _sortCompareFunc( &( pTokenMap[ i ] ), &( pTokenMap[ i + 1U ] ) );
+
+                if( result >= 0 )
+                {
+                    LogError( ( "AtParseFail for %u: %d %s %s", ( unsigned int ) i, ( int ) result,
+                                pTokenMap[ i ].pStrValue, pTokenMap[ i + 1U ].pStrValue ) );
+                    finit = false;
+                }
             }
         }
 
@@ -901,3 +1275,122 @@ void _Cellular_DestroyPktResponseMutex( CellularContext_t * pContext )
 }
 
 /*-----------------------------------------------------------*/
+
+uint32_t _Cellular_AtCmdClassHash( const char * pAtCmd )
+{
+    uint32_t cmdHash = AT_CMD_CLASS_HASH_OFFSET;
+    const char * pChar = pAtCmd;
+
+    if( pChar != NULL )
+    {
+        while( ( *pChar != '\0' ) && ( *pChar != '=' ) && ( *pChar != '?' ) )
+        {
+            cmdHash = ( cmdHash ^ ( uint32_t ) ( uint8_t ) *pChar ) * AT_CMD_CLASS_HASH_PRIME;
+            pChar++;
+        }
+
+        /* Include the "=", "?" or "=?" suffix so that the set, read and test
+         * forms of a command are tracked separately. Parameters are excluded. */
+        if( *pChar == '=' )
+        {
+            cmdHash = ( cmdHash ^ ( uint32_t ) ( uint8_t ) *pChar ) * AT_CMD_CLASS_HASH_PRIME;
+            pChar++;
+        }
+
+        if( *pChar == '?' )
+        {
+            cmdHash = ( cmdHash ^ ( uint32_t ) ( uint8_t ) *pChar ) * AT_CMD_CLASS_HASH_PRIME;
+        }
+    }
+
+    return cmdHash;
+}
+
+/*-----------------------------------------------------------*/
+
+void _Cellular_AtCmdLatencyUpdate( CellularAtCmdLatency_t * pLatency,
+                                   uint32_t latencyMs )
+{
+    int32_t delta = 0;
+
+    if( pLatency != NULL )
+    {
+        if( pLatency->sampleCount == 0U )
+        {
+            /* First sample. SRTT = R, RTTVAR = R / 2. */
+            pLatency->srttScaled = latencyMs << 3;
+            pLatency->rttVarScaled = latencyMs << 1;
+        }
+        else
+        {
+            /* Jacobson/Karels. SRTT += ( R - SRTT ) / 8, RTTVAR += ( | R - SRTT | - RTTVAR ) / 4. */
+            delta = ( int32_t ) latencyMs - ( int32_t ) ( pLatency->srttScaled >> 3 );
+            pLatency->srttScaled = ( uint32_t ) ( ( int32_t ) pLatency->srttScaled + delta );
+
+            if( delta < 0 )
+            {
+                delta = -delta;
+            }
+
+            delta = delta - ( int32_t ) ( pLatency->rttVarScaled >> 2 );
+            pLatency->rttVarScaled = ( uint32_t ) ( ( int32_t ) pLatency->rttVarScaled + delta );
+        }
+
+        if( pLatency->sampleCount < UINT16_MAX )
+        {
+            pLatency->sampleCount++;
+        }
+
+        pLatency->backoffShift = 0U;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+void _Cellular_AtCmdLatencyBackoff( CellularAtCmdLatency_t * pLatency )
+{
+    if( ( pLatency != NULL ) && ( pLatency->backoffShift < AT_CMD_LATENCY_BACKOFF_MAX ) )
+    {
+        pLatency->backoffShift++;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+uint32_t _Cellular_AtCmdLatencyGetTimeout( const CellularAtCmdLatency_t * pLatency,
+                                           uint32_t timeoutMS )
+{
+    uint32_t effectiveTimeoutMS = timeoutMS;
+    uint32_t rtoMs = 0;
+
+    if( ( pLatency != NULL ) && ( pLatency->sampleCount >= CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_MIN_SAMPLES ) )
+    {
+        /* RTO = SRTT + 4 * RTTVAR, doubled for each consecutive timeout. */
+        rtoMs = ( pLatency->srttScaled >> 3 ) + pLatency->rttVarScaled;
+
+        /* The caller timeout is the upper bound. Compare before shifting to
+         * avoid overflow. */
+        if( rtoMs > ( timeoutMS >> pLatency->backoffShift ) )
+        {
+            effectiveTimeoutMS = timeoutMS;
+        }
+        else
+        {
+            effectiveTimeoutMS = rtoMs << pLatency->backoffShift;
+        }
+
+        if( effectiveTimeoutMS < CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_MIN_MS )
+        {
+            effectiveTimeoutMS = CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_MIN_MS;
+        }
+
+        if( effectiveTimeoutMS > timeoutMS )
+        {
+            effectiveTimeoutMS = timeoutMS;
+        }
+    }
+
+    return effectiveTimeoutMS;
+}
+
+/*-----------------------------------------------------------*/
@@ -45,6 +45,7 @@
 #include "cellular_internal.h"
 #include "cellular_pktio_internal.h"
 #include "cellular_common_internal.h"
+#include "cellular_heap.h"
 
 /*-----------------------------------------------------------*/
 
@@ -52,16 +53,42 @@
 #define PKTIO_EVT_MASK_ABORT      ( 0x0002UL )
 #define PKTIO_EVT_MASK_ABORTED    ( 0x0004UL )
 #define PKTIO_EVT_MASK_RX_DATA    ( 0x0008UL )
+#define PKTIO_EVT_MASK_TX_DONE    ( 0x0010UL )
+#define PKTIO_EVT_MASK_ESCAPED    ( 0x0020UL )
 #define PKTIO_EVT_MASK_ALL_EVENTS \
     ( PKTIO_EVT_MASK_STARTED      \
       | PKTIO_EVT_MASK_ABORT      \
       | PKTIO_EVT_MASK_ABORTED    \
-      | PKTIO_EVT_MASK_RX_DATA )
+      | PKTIO_EVT_MASK_RX_DATA    \
+      | PKTIO_EVT_MASK_TX_DONE    \
+      | PKTIO_EVT_MASK_ESCAPED )
 
 #define FREE_AT_RESPONSE_AND_SET_NULL( pResp )    { ( _Cellular_AtResponseFree( ( pResp ) ) ); ( ( pResp ) = NULL ); }
 
 #define PKTIO_SHUTDOWN_WAIT_INTERVAL_MS    ( 10U )
 
+/* The result code reported by the modem when it leaves data mode. */
+#define PKTIO_DATA_MODE_NO_CARRIER         "\r\nNO CARRIER\r"
+#define PKTIO_DATA_MODE_NO_CARRIER_LEN     ( sizeof( PKTIO_DATA_MODE_NO_CARRIER ) - 1U )
+
+/* The result code reported by the modem when it accepts the escape sequence. */
+#define PKTIO_DATA_MODE_OK                 "\r\nOK\r"
+#define PKTIO_DATA_MODE_OK_LEN             ( sizeof( PKTIO_DATA_MODE_OK ) - 1U )
+
+/* The length of the beginning shared by the result codes above. */
+#define PKTIO_DATA_MODE_RESULT_PREFIX_LEN  ( 2U )
+
+/* The result code of the dial command which enters data mode. */
+#define PKTIO_DATA_MODE_CONNECT            "CONNECT"
+#define PKTIO_DATA_MODE_CONNECT_LEN        ( sizeof( PKTIO_DATA_MODE_CONNECT ) - 1U )
+
+/* The time to wait for OK after the guard time following the escape sequence. */
+#define PKTIO_DATA_MODE_ESCAPE_TIMEOUT_MS  ( 1000U )
+
+/* The escape sequence to switch the modem from data mode to command mode. */
+#define PKTIO_DATA_MODE_ESCAPE             "+++"
+#define PKTIO_DATA_MODE_ESCAPE_LEN         ( sizeof( PKTIO_DATA_MODE_ESCAPE ) - 1U )
+
 #ifdef CELLULAR_DO_NOT_USE_CUSTOM_CONFIG
     #define LOOP_FOREVER()    true
 #endif
@@ -74,24 +101,33 @@ static void _saveRawData( char * pLine,
                           CellularATCommandResponse_t * pResp,
                           uint32_t dataLen );
 static void _saveATData( char * pLine,
+                         uint32_t lineLength,
                          CellularATCommandResponse_t * pResp );
 static CellularPktStatus_t _processIntermediateResponse( char * pLine,
+                                                         uint32_t lineLength,
                                                          CellularATCommandResponse_t * pResp,
                                                          CellularATCommandType_t atType );
 static CellularATCommandResponse_t * _Cellular_AtResponseNew( void );
 static void _Cellular_AtResponseFree( CellularATCommandResponse_t * pResp );
 static CellularPktStatus_t _Cellular_ProcessLine( CellularContext_t * pContext,
                                                   char * pLine,
+                                                  uint32_t lineLength,
                                                   CellularATCommandResponse_t * pResp,
                                                   CellularATCommandType_t atType,
                                                   const char * pRespPrefix );
 static bool _checkUrcTokenWoPrefix( const CellularContext_t * pContext,
                                     const char * pLine );
 static _atRespType_t _getMsgType( CellularContext_t * pContext,
-                                  const char * pLine,
+                                  char * pLine,
+                                  uint32_t lineLength,
                                   const char * pRespPrefix );
+static CellularCommInterfaceError_t _Cellular_PktioSetEventFromISR( const CellularContext_t * pContext,
+                                                                    PlatformEventBits_t eventBits );
 static CellularCommInterfaceError_t _Cellular_PktRxCallBack( void * pUserData,
                                                              CellularCommInterfaceHandle_t commInterfaceHandle );
+static CellularCommInterfaceError_t _Cellular_PktTxDoneCallBack( void * pUserData,
+                                                                 CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                                 uint32_t dataSentLength );
 static char * _handleLeftoverBuffer( CellularContext_t * pContext );
 static char * _Cellular_ReadLine( CellularContext_t * pContext,
                                   uint32_t * pBytesRead,
@@ -102,14 +138,30 @@ static CellularPktStatus_t _handleData( char * pStartOfData,
                                         char ** ppLine,
                                         uint32_t bytesRead,
                                         uint32_t * pBytesLeft );
+static bool _isBorrowedPointer( const char * pPtr,
+                                const char * pBuffer,
+                                uint32_t bufferLength );
+static void _keepBorrowedLeftover( CellularContext_t * pContext,
+                                   char * pBuffer,
+                                   uint32_t bufferLength );
+static uint32_t _handleBorrowedData( CellularContext_t * pContext );
 static CellularPktStatus_t _handleMsgType( CellularContext_t * pContext,
                                            CellularATCommandResponse_t ** ppAtResp,
-                                           char * pLine );
+                                           char * pLine,
+                                           uint32_t lineLength,
+                                           uint32_t bytesInBuffer );
 static void _handleAllReceived( CellularContext_t * pContext,
                                 CellularATCommandResponse_t ** ppAtResp,
                                 char * pData,
                                 uint32_t bytesInBuffer );
 static uint32_t _handleRxDataEvent( CellularContext_t * pContext );
+static uint32_t _handleDataModeData( CellularContext_t * pContext,
+                                     const uint8_t * pData,
+                                     uint32_t dataLength );
+static void _handleDataModeLeftover( CellularContext_t * pContext,
+                                     const uint8_t * pData,
+                                     uint32_t dataLength );
+static uint32_t _handleDataModeRxEvent( CellularContext_t * pContext );
 static void _pktioReadThread( void * pUserData );
 static void _PktioInitProcessReadThreadStatus( CellularContext_t * pContext );
 static bool _getNextLine( CellularContext_t * pContext,
@@ -124,6 +176,11 @@ static bool _handleCallbackResult( CellularContext_t * pContext,
 static bool _preprocessInputBuffer( CellularContext_t * pContext,
                                     char ** pLine,
                                     uint32_t * pBytesRead );
+static void _updatePktioBufferStats( CellularContext_t * pContext,
+                                     CellularPktioBufferEvent_t event,
+                                     uint32_t bufferBytes );
+static void _resetReadBuffer( CellularContext_t * pContext,
+                              uint32_t bytesDropped );
 static CellularPktStatus_t _setPrefixByAtCommandType( CellularContext_t * pContext,
                                                       CellularATCommandType_t atType,
                                                       const char * pAtRspPrefix );
@@ -150,7 +207,7 @@ static void _saveData( char * pLine,
 
     LogDebug( ( "_saveData : Save data %p with length %u", pLine, ( unsigned int ) dataLen ) );
 
-    pNew = ( CellularATCommandLine_t * ) Platform_Malloc( sizeof( CellularATCommandLine_t ) );
+    pNew = ( CellularATCommandLine_t * ) _Cellular_Malloc( sizeof( CellularATCommandLine_t ), CELLULAR_HEAP_SITE_AT_LINE );
     CELLULAR_CONFIG_ASSERT( ( pNew != NULL ) );
 
     /* Reuse the pktio buffer instead of allocate. */
@@ -187,15 +244,17 @@ static void _saveRawData( char * pLine,
 /*-----------------------------------------------------------*/
 
 static void _saveATData( char * pLine,
+                         uint32_t lineLength,
                          CellularATCommandResponse_t * pResp )
 {
-    LogDebug( ( "Save [%s] %u AT data to pResp", pLine, ( unsigned int ) strlen( pLine ) ) );
-    _saveData( pLine, pResp, ( uint32_t ) ( strlen( pLine ) + 1U ) );
+    LogDebug( ( "Save [%s] %u AT data to pResp", pLine, ( unsigned int ) lineLength ) );
+    _saveData( pLine, pResp, lineLength + 1U );
 }
 
 /*-----------------------------------------------------------*/
 
 static CellularPktStatus_t _processIntermediateResponse( char * pLine,
+                                                         uint32_t lineLength,
                                                          CellularATCommandResponse_t * pResp,
                                                          CellularATCommandType_t atType )
 {
@@ -207,7 +266,7 @@ static CellularPktStatus_t _processIntermediateResponse( char * pLine,
 
             if( pResp->pItm == NULL )
             {
-                _saveATData( pLine, pResp );
+                _saveATData( pLine, lineLength, pResp );
             }
             else
             {
@@ -226,7 +285,7 @@ static CellularPktStatus_t _processIntermediateResponse( char * pLine,
                 /* The removed code which demonstrate the existence of the prefix has been done in
                  * function _getMsgType(), so the failure condition here won't be touched.
                  */
-                _saveATData( pLine, pResp );
+                _saveATData( pLine, lineLength, pResp );
             }
             else
             {
@@ -243,23 +302,23 @@ static CellularPktStatus_t _processIntermediateResponse( char * pLine,
             /* The removed code which demonstrate the existence of the prefix has been done in
              * function _getMsgType(), so the failure condition here won't be touched.
              */
-            _saveATData( pLine, pResp );
+            _saveATData( pLine, lineLength, pResp );
 
             break;
 
         case CELLULAR_AT_MULTI_WO_PREFIX:
-            _saveATData( pLine, pResp );
+            _saveATData( pLine, lineLength, pResp );
             break;
 
         case CELLULAR_AT_MULTI_DATA_WO_PREFIX:
-            _saveATData( pLine, pResp );
+            _saveATData( pLine, lineLength, pResp );
             pkStatus = CELLULAR_PKT_STATUS_PENDING_BUFFER;
             break;
 
         case CELLULAR_AT_WO_PREFIX_NO_RESULT_CODE:
         case CELLULAR_AT_WITH_PREFIX_NO_RESULT_CODE:
             /* Save the line in the response. */
-            _saveATData( pLine, pResp );
+            _saveATData( pLine, lineLength, pResp );
 
             /* Returns CELLULAR_PKT_STATUS_OK to indicate that the response of the
              * command is received. No success result code is expected. Set the response
@@ -286,7 +345,7 @@ static CellularATCommandResponse_t * _Cellular_AtResponseNew( void )
 {
     CellularATCommandResponse_t * pNew = NULL;
 
-    pNew = ( CellularATCommandResponse_t * ) Platform_Malloc( sizeof( CellularATCommandResponse_t ) );
+    pNew = ( CellularATCommandResponse_t * ) _Cellular_Malloc( sizeof( CellularATCommandResponse_t ), CELLULAR_HEAP_SITE_AT_RESPONSE );
     CELLULAR_CONFIG_ASSERT( ( pNew != NULL ) );
 
     ( void ) memset( ( void * ) pNew, 0, sizeof( CellularATCommandResponse_t ) );
@@ -317,10 +376,10 @@ static void _Cellular_AtResponseFree( CellularATCommandResponse_t * pResp )
             pCurrLine = pCurrLine->pNext;
 
             /* Reuse the packet io buffer. No need to free pToFree->pLine here. */
-            Platform_Free( pToFree );
+            _Cellular_Free( pToFree );
         }
 
-        Platform_Free( pResp );
+        _Cellular_Free( pResp );
     }
 }
 
@@ -328,6 +387,7 @@ static void _Cellular_AtResponseFree( CellularATCommandResponse_t * pResp )
 
 static CellularPktStatus_t _Cellular_ProcessLine( CellularContext_t * pContext,
                                                   char * pLine,
+                                                  uint32_t lineLength,
                                                   CellularATCommandResponse_t * pResp,
                                                   CellularATCommandType_t atType,
                                                   const char * pRespPrefix )
@@ -340,10 +400,26 @@ static CellularPktStatus_t _Cellular_ProcessLine( CellularContext_t * pContext,
     uint32_t tokenSuccessTableSize = 0;
     uint32_t tokenErrorTableSize = 0;
     uint32_t tokenExtraTableSize = 0;
+    uint8_t tokenClass = CELLULAR_TOKEN_CLASS_SUCCESS | CELLULAR_TOKEN_CLASS_ERROR;
+    CellularATStrView_t lineView = { 0 };
 
     /* This variable is used in warning message. */
     ( void ) pRespPrefix;
 
+    /* The line length is known from the stream. Lines longer than
+     * CELLULAR_AT_MAX_STRING_SIZE are left as an invalid view. */
+    if( lineLength <= CELLULAR_AT_MAX_STRING_SIZE )
+    {
+        ( void ) Cellular_ATStrViewInit( &lineView, pLine, ( uint16_t ) lineLength );
+    }
+
+    /* The generated first byte classifier tells which token tables could
+     * match the line. */
+    if( pContext->tokenTable.pTokenLookup != NULL )
+    {
+        tokenClass = pContext->tokenTable.pTokenLookup->pFirstByteClass[ ( uint8_t ) pLine[ 0 ] ];
+    }
+
     /* Lock the response mutex when processing the input line. */
     PlatformMutex_Lock( &( pContext->PktRespMutex ) );
 
@@ -360,8 +436,8 @@ static CellularPktStatus_t _Cellular_ProcessLine( CellularContext_t * pContext,
         /* pResp has been checked while allocating memory, so we don't
          * need to demonstrate it here.
          */
-        ( void ) Cellular_ATcheckErrorCode( pLine, pTokenExtraTable,
-                                            tokenExtraTableSize, &result );
+        ( void ) Cellular_ATStrViewCheckErrorCode( &lineView, pTokenExtraTable,
+                                                   tokenExtraTableSize, &result );
 
         if( result == true )
         {
@@ -369,10 +445,10 @@ static CellularPktStatus_t _Cellular_ProcessLine( CellularContext_t * pContext,
             pkStatus = CELLULAR_PKT_STATUS_OK;
             LogDebug( ( "Final AT response is SUCCESS [%s] in extra table", pLine ) );
         }
-        else
+        else if( ( tokenClass & CELLULAR_TOKEN_CLASS_SUCCESS ) != 0U )
         {
-            ( void ) Cellular_ATcheckErrorCode( pLine, pTokenSuccessTable,
-                                                tokenSuccessTableSize, &result );
+            ( void ) Cellular_ATStrViewCheckErrorCode( &lineView, pTokenSuccessTable,
+                                                       tokenSuccessTableSize, &result );
 
             if( result == true )
             {
@@ -381,11 +457,15 @@ static CellularPktStatus_t _Cellular_ProcessLine( CellularContext_t * pContext,
                 LogDebug( ( "Final AT response is SUCCESS [%s]", pLine ) );
             }
         }
+        else
+        {
+            /* Empty else MISRA 15.7 */
+        }
 
-        if( result != true )
+        if( ( result != true ) && ( ( tokenClass & CELLULAR_TOKEN_CLASS_ERROR ) != 0U ) )
         {
-            ( void ) Cellular_ATcheckErrorCode( pLine, pTokenErrorTable,
-                                                tokenErrorTableSize, &result );
+            ( void ) Cellular_ATStrViewCheckErrorCode( &lineView, pTokenErrorTable,
+                                                       tokenErrorTableSize, &result );
 
             if( result == true )
             {
@@ -396,7 +476,7 @@ static CellularPktStatus_t _Cellular_ProcessLine( CellularContext_t * pContext,
 
         if( result != true )
         {
-            pkStatus = _processIntermediateResponse( pLine, pResp, atType );
+            pkStatus = _processIntermediateResponse( pLine, lineLength, pResp, atType );
         }
     }
 
@@ -427,6 +507,13 @@ static bool _checkUrcTokenWoPrefix( const CellularContext_t * pContext,
     {
         ret = false;
     }
+    else if( ( pContext->tokenTable.pTokenLookup != NULL ) &&
+             ( ( pContext->tokenTable.pTokenLookup->pFirstByteClass[ ( uint8_t ) pLine[ 0 ] ] &
+                 CELLULAR_TOKEN_CLASS_URC_WO_PREFIX ) == 0U ) )
+    {
+        /* No URC token without prefix starts with this byte. */
+        ret = false;
+    }
     else
     {
         for( i = 0; i < urcTokenTableSize; i++ )
@@ -445,13 +532,20 @@ static bool _checkUrcTokenWoPrefix( const CellularContext_t * pContext,
 /*-----------------------------------------------------------*/
 
 static _atRespType_t _getMsgType( CellularContext_t * pContext,
-                                  const char * pLine,
+                                  char * pLine,
+                                  uint32_t lineLength,
                                   const char * pRespPrefix )
 {
     _atRespType_t atRespType = AT_UNDEFINED;
     CellularATError_t atStatus = CELLULAR_AT_SUCCESS;
     bool inputWithPrefix = false;
     bool inputWithSrcPrefix = false;
+    CellularATStrView_t lineView = { 0 };
+
+    if( lineLength <= CELLULAR_AT_MAX_STRING_SIZE )
+    {
+        ( void ) Cellular_ATStrViewInit( &lineView, pLine, ( uint16_t ) lineLength );
+    }
 
     /* Lock the response mutex when deciding message type. */
     PlatformMutex_Lock( &( pContext->PktRespMutex ) );
@@ -463,12 +557,12 @@ static _atRespType_t _getMsgType( CellularContext_t * pContext,
     else
     {
         /* Check if prefix exist in pLine. */
-        ( void ) Cellular_ATIsPrefixPresent( pLine, &inputWithPrefix );
+        ( void ) Cellular_ATStrViewIsPrefixPresent( &lineView, &inputWithPrefix );
 
         if( ( inputWithPrefix == true ) && ( pRespPrefix != NULL ) )
         {
             /* Check if this line contains prefix expected in AT command response. */
-            atStatus = Cellular_ATStrStartWith( pLine, pRespPrefix, &inputWithSrcPrefix );
+            atStatus = Cellular_ATStrViewStartWith( &lineView, pRespPrefix, &inputWithSrcPrefix );
         }
     }
 
@@ -516,15 +610,12 @@ static _atRespType_t _getMsgType( CellularContext_t * pContext,
 
 /*-----------------------------------------------------------*/
 
-static CellularCommInterfaceError_t _Cellular_PktRxCallBack( void * pUserData,
-                                                             CellularCommInterfaceHandle_t commInterfaceHandle )
+static CellularCommInterfaceError_t _Cellular_PktioSetEventFromISR( const CellularContext_t * pContext,
+                                                                    PlatformEventBits_t eventBits )
 {
-    const CellularContext_t * pContext = ( CellularContext_t * ) pUserData;
     PlatformBaseType_t xHigherPriorityTaskWoken = platformFALSE, xResult = platformFALSE;
     CellularCommInterfaceError_t retComm = IOT_COMM_INTERFACE_SUCCESS;
 
-    ( void ) commInterfaceHandle; /* Comm if is not used in this function. */
-
     /* The context of this function is a ISR. */
     if( pContext->pPktioCommEvent == NULL )
     {
@@ -533,7 +624,7 @@ static CellularCommInterfaceError_t _Cellular_PktRxCallBack( void * pUserData,
     else
     {
         xResult = PlatformEventGroup_SetBitsFromISR( ( PlatformEventGroupHandle_t ) pContext->pPktioCommEvent,
-                                                     ( PlatformEventBits_t ) PKTIO_EVT_MASK_RX_DATA,
+                                                     eventBits,
                                                      &xHigherPriorityTaskWoken );
 
         if( xResult == platformPASS )
@@ -558,6 +649,53 @@ static CellularCommInterfaceError_t _Cellular_PktRxCallBack( void * pUserData,
 
 /*-----------------------------------------------------------*/
 
+static CellularCommInterfaceError_t _Cellular_PktRxCallBack( void * pUserData,
+                                                             CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    const CellularContext_t * pContext = ( CellularContext_t * ) pUserData;
+
+    ( void ) commInterfaceHandle; /* Comm if is not used in this function. */
+
+    return _Cellular_PktioSetEventFromISR( pContext, ( PlatformEventBits_t ) PKTIO_EVT_MASK_RX_DATA );
+}
+
+/*-----------------------------------------------------------*/
+
+static CellularCommInterfaceError_t _Cellular_PktTxDoneCallBack( void * pUserData,
+                                                                 CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                                 uint32_t dataSentLength )
+{
+    const CellularPktioSendTag_t * pTag = ( const CellularPktioSendTag_t * ) pUserData;
+    CellularContext_t * pContext = pTag->pContext;
+    CellularCommInterfaceError_t retComm = IOT_COMM_INTERFACE_SUCCESS;
+
+    ( void ) commInterfaceHandle; /* Comm if is not used in this function. */
+
+    if( pTag->sequence != pContext->pktioSendAsyncSequence )
+    {
+        /* The completion of a send no longer waited for. The event of the
+         * current send must not be set. */
+        LogWarn( ( "_Cellular_PktTxDoneCallBack : stale send completion %u ignored",
+                   ( unsigned int ) pTag->sequence ) );
+
+        /* No task is woken up. */
+        retComm = IOT_COMM_INTERFACE_BUSY;
+    }
+    else
+    {
+        /* The length is read by the sending task after the event is set. The
+         * event is set later in the timer task. The sending task checks the
+         * sequence in case another send is started before that. */
+        pContext->pktioSendAsyncLength = dataSentLength;
+        pContext->pktioSendAsyncDoneSequence = pTag->sequence;
+        retComm = _Cellular_PktioSetEventFromISR( pContext, ( PlatformEventBits_t ) PKTIO_EVT_MASK_TX_DONE );
+    }
+
+    return retComm;
+}
+
+/*-----------------------------------------------------------*/
+
 static char * _handleLeftoverBuffer( CellularContext_t * pContext )
 {
     char * pRead = NULL; /* Pointer to first empty space in pContext->pktioReadBuf. */
@@ -580,6 +718,64 @@ static char * _handleLeftoverBuffer( CellularContext_t * pContext )
 
 /*-----------------------------------------------------------*/
 
+/* bufferBytes : the buffer occupancy for high-water mark event or the bytes
+ * dropped for overflow and resync events. */
+static void _updatePktioBufferStats( CellularContext_t * pContext,
+                                     CellularPktioBufferEvent_t event,
+                                     uint32_t bufferBytes )
+{
+    CellularPktioBufferStats_t stats = { 0 };
+    CellularPktioBufferCallback_t pktioBufferCallback = NULL;
+    void * pCallbackContext = NULL;
+
+    taskENTER_CRITICAL();
+
+    if( event == CELLULAR_PKTIO_BUFFER_EVENT_HIGH_WATER_MARK )
+    {
+        pContext->pktioBufferStats.highWaterMark = bufferBytes;
+    }
+    else
+    {
+        if( event == CELLULAR_PKTIO_BUFFER_EVENT_OVERFLOW )
+        {
+            pContext->pktioBufferStats.overflowCount++;
+            pContext->pktioBufferStats.highWaterMark = PKTIO_READ_BUFFER_SIZE;
+        }
+        else
+        {
+            pContext->pktioBufferStats.resyncCount++;
+        }
+
+        pContext->pktioBufferStats.bytesDropped += bufferBytes;
+    }
+
+    stats = pContext->pktioBufferStats;
+    pktioBufferCallback = pContext->pktioBufferCallback;
+    pCallbackContext = pContext->pPktioBufferCallbackContext;
+    taskEXIT_CRITICAL();
+
+    if( pktioBufferCallback != NULL )
+    {
+        stats.bufferSize = PKTIO_READ_BUFFER_SIZE;
+        pktioBufferCallback( pCallbackContext, event, &stats );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void _resetReadBuffer( CellularContext_t * pContext,
+                              uint32_t bytesDropped )
+{
+    /* Clean the read buffer and read pointer. */
+    ( void ) memset( pContext->pktioReadBuf, 0, PKTIO_READ_BUFFER_SIZE + 1U );
+    pContext->pPktioReadPtr = NULL;
+    pContext->partialDataRcvdLen = 0;
+
+    _updatePktioBufferStats( pContext, CELLULAR_PKTIO_BUFFER_EVENT_RESYNC, bytesDropped );
+}
+
+/*-----------------------------------------------------------*/
+
 /* pBytesRead : bytes read from comm interface. */
 /* partialData : leftover bytes in the pktioreadbuf. Not enough to be a command. */
 static char * _Cellular_ReadLine( CellularContext_t * pContext,
@@ -591,6 +787,7 @@ static char * _Cellular_ReadLine( CellularContext_t * pContext,
     uint32_t bytesRead = 0;
     uint32_t partialDataRead = pContext->partialDataRcvdLen;
     int32_t bufferEmptyLength = ( int32_t ) PKTIO_READ_BUFFER_SIZE;
+    uint32_t bufferOccupancy = 0;
 
     pAtBuf = pContext->pktioReadBuf;
     pRead = pContext->pktioReadBuf;
@@ -640,6 +837,14 @@ static char * _Cellular_ReadLine( CellularContext_t * pContext,
             /* Set the pBytesRead only when actual bytes read from comm interface. */
             *pBytesRead = bytesRead + partialDataRead;
 
+            /* The buffer occupancy is the data from the start of the buffer to the end of this read. */
+            bufferOccupancy = _convertCharPtrDistance( pRead, pContext->pktioReadBuf ) + bytesRead;
+
+            if( bufferOccupancy > pContext->pktioBufferStats.highWaterMark )
+            {
+                _updatePktioBufferStats( pContext, CELLULAR_PKTIO_BUFFER_EVENT_HIGH_WATER_MARK, bufferOccupancy );
+            }
+
             /* Clean the partial data and read pointer. */
             pContext->partialDataRcvdLen = 0;
         }
@@ -652,6 +857,7 @@ static char * _Cellular_ReadLine( CellularContext_t * pContext,
     else
     {
         LogError( ( "No empty space from comm if to handle incoming data, reset all parameter for next incoming data." ) );
+        _updatePktioBufferStats( pContext, CELLULAR_PKTIO_BUFFER_EVENT_OVERFLOW, pContext->partialDataRcvdLen );
         *pBytesRead = 0;
         pContext->partialDataRcvdLen = 0;
         pContext->pPktioReadPtr = NULL;
@@ -662,6 +868,150 @@ static char * _Cellular_ReadLine( CellularContext_t * pContext,
 
 /*-----------------------------------------------------------*/
 
+static bool _isBorrowedPointer( const char * pPtr,
+                                const char * pBuffer,
+                                uint32_t bufferLength )
+{
+    bool isBorrowed = false;
+
+    /* The pointer after the last byte is also in the borrowed buffer. */
+    if( ( pPtr != NULL ) &&
+        ( ( uintptr_t ) pPtr >= ( uintptr_t ) pBuffer ) &&
+        ( ( uintptr_t ) pPtr <= ( ( uintptr_t ) pBuffer + bufferLength ) ) )
+    {
+        isBorrowed = true;
+    }
+
+    return isBorrowed;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Copy the bytes in the borrowed buffer still referenced by the parser to the
+ * pktioReadBuf before the borrowed buffer is released. */
+static void _keepBorrowedLeftover( CellularContext_t * pContext,
+                                   char * pBuffer,
+                                   uint32_t bufferLength )
+{
+    CellularATCommandLine_t * pTemp = NULL;
+    char * pKeepStart = NULL;
+    uint32_t keepOffset = 0;
+    uint32_t keepLength = 0;
+    bool pending = false;
+
+    pending = ( ( pContext->partialDataRcvdLen != 0U ) || ( pContext->dataLength != 0U ) ||
+                ( pContext->pAtCmdResp != NULL ) );
+
+    if( _isBorrowedPointer( pContext->pPktioReadPtr, pBuffer, bufferLength ) == true )
+    {
+        if( pending == true )
+        {
+            pKeepStart = pContext->pPktioReadPtr;
+        }
+        else
+        {
+            /* The borrowed buffer is parsed completely. */
+            pContext->pPktioReadPtr = NULL;
+        }
+    }
+
+    /* The pending AT command response lines are stored in the borrowed buffer. */
+    if( pContext->pAtCmdResp != NULL )
+    {
+        for( pTemp = pContext->pAtCmdResp->pItm; pTemp != NULL; pTemp = pTemp->pNext )
+        {
+            if( ( _isBorrowedPointer( pTemp->pLine, pBuffer, bufferLength ) == true ) &&
+                ( ( pKeepStart == NULL ) || ( ( uintptr_t ) pTemp->pLine < ( uintptr_t ) pKeepStart ) ) )
+            {
+                pKeepStart = pTemp->pLine;
+            }
+        }
+    }
+
+    if( pKeepStart != NULL )
+    {
+        keepOffset = _convertCharPtrDistance( pKeepStart, pBuffer );
+        keepLength = bufferLength - keepOffset;
+
+        LogDebug( ( "Copy %u bytes from the borrowed buffer %p", ( unsigned int ) keepLength, pKeepStart ) );
+
+        ( void ) memcpy( pContext->pktioReadBuf, pKeepStart, keepLength );
+        pContext->pktioReadBuf[ keepLength ] = '\0';
+
+        /* Rebase the pointers to the pktioReadBuf. */
+        if( _isBorrowedPointer( pContext->pPktioReadPtr, pBuffer, bufferLength ) == true )
+        {
+            pContext->pPktioReadPtr = &( pContext->pktioReadBuf[ _convertCharPtrDistance( pContext->pPktioReadPtr, pKeepStart ) ] );
+        }
+
+        if( pContext->pAtCmdResp != NULL )
+        {
+            for( pTemp = pContext->pAtCmdResp->pItm; pTemp != NULL; pTemp = pTemp->pNext )
+            {
+                if( _isBorrowedPointer( pTemp->pLine, pBuffer, bufferLength ) == true )
+                {
+                    pTemp->pLine = &( pContext->pktioReadBuf[ _convertCharPtrDistance( pTemp->pLine, pKeepStart ) ] );
+                }
+            }
+        }
+
+        if( keepLength > pContext->pktioBufferStats.highWaterMark )
+        {
+            _updatePktioBufferStats( pContext, CELLULAR_PKTIO_BUFFER_EVENT_HIGH_WATER_MARK, keepLength );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Parse the received data in the buffer borrowed from the comm interface. This
+ * function is called only when no data is pending in the pktioReadBuf. */
+static uint32_t _handleBorrowedData( CellularContext_t * pContext )
+{
+    uint8_t * pBuffer = NULL;
+    uint32_t bytesRead = 0;
+    CellularCommInterfaceError_t commIntfRet = IOT_COMM_INTERFACE_SUCCESS;
+
+    commIntfRet = pContext->pCommIntf->recvBorrow( pContext->hPktioCommIntf, &pBuffer,
+                                                   PKTIO_READ_BUFFER_SIZE,
+                                                   CELLULAR_COMM_IF_RECV_TIMEOUT_MS, &bytesRead );
+
+    if( ( commIntfRet != IOT_COMM_INTERFACE_SUCCESS ) || ( pBuffer == NULL ) )
+    {
+        bytesRead = 0U;
+    }
+    else if( bytesRead > 0U )
+    {
+        if( bytesRead > PKTIO_READ_BUFFER_SIZE )
+        {
+            LogError( ( "Borrowed %u bytes exceeds the read buffer size.", ( unsigned int ) bytesRead ) );
+            _updatePktioBufferStats( pContext, CELLULAR_PKTIO_BUFFER_EVENT_OVERFLOW, bytesRead );
+        }
+        else
+        {
+            LogDebug( ( "AT Borrow %u bytes, data[%p]", ( unsigned int ) bytesRead, pBuffer ) );
+
+            /* Add a NULL after the bytesRead. This is required for further processing. */
+            pBuffer[ bytesRead ] = ( uint8_t ) '\0';
+            pContext->pPktioReadPtr = ( char * ) pBuffer;
+            pContext->partialDataRcvdLen = 0;
+
+            _handleAllReceived( pContext, &( pContext->pAtCmdResp ), ( char * ) pBuffer, bytesRead );
+            _keepBorrowedLeftover( pContext, ( char * ) pBuffer, bytesRead );
+        }
+
+        ( void ) pContext->pCommIntf->recvRelease( pContext->hPktioCommIntf, bytesRead );
+    }
+    else
+    {
+        /* Nothing is borrowed. */
+    }
+
+    return bytesRead;
+}
+
+/*-----------------------------------------------------------*/
+
 static CellularPktStatus_t _handleData( char * pStartOfData,
                                         CellularContext_t * pContext,
                                         CellularATCommandResponse_t * pAtResp,
@@ -718,7 +1068,9 @@ static CellularPktStatus_t _handleData( char * pStartOfData,
 
 static CellularPktStatus_t _handleMsgType( CellularContext_t * pContext,
                                            CellularATCommandResponse_t ** ppAtResp,
-                                           char * pLine )
+                                           char * pLine,
+                                           uint32_t lineLength,
+                                           uint32_t bytesInBuffer )
 {
     CellularPktStatus_t pkStatus = CELLULAR_PKT_STATUS_OK;
 
@@ -740,7 +1092,7 @@ static CellularPktStatus_t _handleMsgType( CellularContext_t * pContext,
         LogDebug( ( "AT solicited Resp[%s]", pLine ) );
 
         /* Process Line will store the Line data in AT response. */
-        pkStatus = _Cellular_ProcessLine( pContext, pLine, *ppAtResp, pContext->PktioAtCmdType, pContext->pRespPrefix );
+        pkStatus = _Cellular_ProcessLine( pContext, pLine, lineLength, *ppAtResp, pContext->PktioAtCmdType, pContext->pRespPrefix );
 
         if( pkStatus == CELLULAR_PKT_STATUS_OK )
         {
@@ -749,6 +1101,15 @@ static CellularPktStatus_t _handleMsgType( CellularContext_t * pContext,
             PlatformMutex_Lock( &( pContext->PktRespMutex ) );
             pContext->PktioAtCmdType = CELLULAR_AT_NO_COMMAND;
             pContext->pRespPrefix = NULL;
+
+            /* The modem is in data mode after the dial command succeeds with CONNECT.
+             * The data following the CONNECT line belongs to the data mode consumer. */
+            if( ( pContext->dataMode == PKTIO_DATA_MODE_DIALING ) && ( ( *ppAtResp )->status == true ) &&
+                ( strncmp( pLine, PKTIO_DATA_MODE_CONNECT, PKTIO_DATA_MODE_CONNECT_LEN ) == 0 ) )
+            {
+                pContext->dataMode = PKTIO_DATA_MODE_ON;
+            }
+
             PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
 
             /* This command is completed. Call the user callback to parse the result. */
@@ -802,9 +1163,7 @@ static CellularPktStatus_t _handleMsgType( CellularContext_t * pContext,
             PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
 
             /* Clean the read buffer and read pointer. */
-            ( void ) memset( pContext->pktioReadBuf, 0, PKTIO_READ_BUFFER_SIZE + 1U );
-            pContext->pPktioReadPtr = NULL;
-            pContext->partialDataRcvdLen = 0;
+            _resetReadBuffer( pContext, bytesInBuffer );
             FREE_AT_RESPONSE_AND_SET_NULL( *ppAtResp );
 
             /* Return invalid data error code. */
@@ -885,9 +1244,7 @@ static bool _handleCallbackResult( CellularContext_t * pContext,
         LogError( ( "Input buffer callback returns error %d. Clean the read buffer.", pktStatus ) );
 
         /* Clean the read buffer and read pointer. */
-        ( void ) memset( pContext->pktioReadBuf, 0, PKTIO_READ_BUFFER_SIZE + 1U );
-        pContext->pPktioReadPtr = NULL;
-        pContext->partialDataRcvdLen = 0;
+        _resetReadBuffer( pContext, *pBytesRead );
         keepProcess = false;
     }
     else
@@ -931,9 +1288,7 @@ static bool _preprocessInputBuffer( CellularContext_t * pContext,
                             ( unsigned int ) bufferLength, ( unsigned int ) *pBytesRead ) );
 
                 /* Clean the read buffer and read pointer. */
-                ( void ) memset( pContext->pktioReadBuf, 0, PKTIO_READ_BUFFER_SIZE + 1U );
-                pContext->pPktioReadPtr = NULL;
-                pContext->partialDataRcvdLen = 0;
+                _resetReadBuffer( pContext, *pBytesRead );
                 keepProcess = false;
             }
             else
@@ -1096,6 +1451,7 @@ static void _handleAllReceived( CellularContext_t * pContext,
     char * pStartOfData = NULL, * pTempLine = pData;
     uint32_t bytesRead = bytesInBuffer;
     uint32_t currentLineLength = 0U;
+    uint32_t handledLength = 0U;
     bool keepProcess = true;
 
     while( keepProcess == true )
@@ -1130,10 +1486,10 @@ static void _handleAllReceived( CellularContext_t * pContext,
         if( keepProcess == true )
         {
             /* A complete Line received. Get the message type. */
-            pContext->recvdMsgType = _getMsgType( pContext, pTempLine, pContext->pRespPrefix );
+            pContext->recvdMsgType = _getMsgType( pContext, pTempLine, currentLineLength, pContext->pRespPrefix );
 
             /* Handle the message according the received message type. */
-            pktStatus = _handleMsgType( pContext, ppAtResp, pTempLine );
+            pktStatus = _handleMsgType( pContext, ppAtResp, pTempLine, currentLineLength, bytesRead );
 
             if( pktStatus == CELLULAR_PKT_STATUS_PENDING_BUFFER )
             {
@@ -1151,6 +1507,38 @@ static void _handleAllReceived( CellularContext_t * pContext,
             {
                 /* Process AT response success. Get the next Line. */
                 keepProcess = _getNextLine( pContext, &pTempLine, &bytesRead, currentLineLength, pktStatus );
+
+                if( pContext->dataMode == PKTIO_DATA_MODE_ON )
+                {
+                    /* The CONNECT line is handled. Skip the rest of the line ending
+                     * and pass the remaining bytes to the data mode consumer. */
+                    while( ( bytesRead > 0U ) && ( ( *pTempLine == '\r' ) || ( *pTempLine == '\n' ) ) )
+                    {
+                        pTempLine++;
+                        bytesRead = bytesRead - 1U;
+                    }
+
+                    if( bytesRead > 0U )
+                    {
+                        handledLength = _handleDataModeData( pContext, ( const uint8_t * ) pTempLine, bytesRead );
+                        pTempLine = &( pTempLine[ handledLength ] );
+                        bytesRead = bytesRead - handledLength;
+                    }
+
+                    if( bytesRead > 0U )
+                    {
+                        /* Data mode is terminated by a result code in the same read.
+                         * Parse the bytes after it as AT command response. */
+                        pContext->pPktioReadPtr = pTempLine;
+                        pContext->partialDataRcvdLen = bytesRead;
+                    }
+                    else
+                    {
+                        pContext->pPktioReadPtr = NULL;
+                        pContext->partialDataRcvdLen = 0U;
+                        keepProcess = false;
+                    }
+                }
             }
             else
             {
@@ -1163,17 +1551,236 @@ static void _handleAllReceived( CellularContext_t * pContext,
 
 /*-----------------------------------------------------------*/
 
+/* Pass the data received in data mode to the consumer. The data is scanned for
+ * NO CARRIER, and for OK while the escape sequence is in progress. The result
+ * code may be split between receptions. The bytes matching the beginning of the
+ * result code at the end of the data are held back. They are the same as the
+ * beginning of the result code and are passed to the consumer from it if the
+ * following data doesn't match. Returns the number of bytes handled in data mode.
+ * The bytes after the result code are not handled. */
+static uint32_t _handleDataModeData( CellularContext_t * pContext,
+                                     const uint8_t * pData,
+                                     uint32_t dataLength )
+{
+    const uint8_t * pNoCarrier = ( const uint8_t * ) PKTIO_DATA_MODE_NO_CARRIER;
+    const uint8_t * pOk = ( const uint8_t * ) PKTIO_DATA_MODE_OK;
+    const uint8_t * pHeld = ( pContext->dataModeMatchOk == true ) ? pOk : pNoCarrier;
+    const uint8_t * pPattern = pHeld;
+    uint32_t patternLength = 0;
+    uint32_t heldLength = pContext->dataModeMatchLength;
+    uint32_t matchLength = heldLength;
+    uint32_t deliverLength = 0;
+    uint32_t i = 0;
+    bool escaping = ( pContext->dataMode == PKTIO_DATA_MODE_ESCAPING ) ? true : false;
+    bool resultCode = false;
+    bool carrierLost = false;
+    CellularDataModeReceiveCallback_t receiveCallback = NULL;
+    CellularDataModeExitCallback_t exitCallback = NULL;
+    void * pCallbackContext = NULL;
+
+    /* The result codes start with the only '\r' before their last byte. A mismatch
+     * restarts the match at the current byte. OK is only matched while escaping. */
+    for( i = 0; ( i < dataLength ) && ( resultCode == false ); i++ )
+    {
+        if( ( pData[ i ] == pPattern[ matchLength ] ) && ( ( pPattern != pOk ) || ( escaping == true ) ) )
+        {
+            matchLength++;
+        }
+        else if( ( escaping == true ) && ( matchLength == PKTIO_DATA_MODE_RESULT_PREFIX_LEN ) &&
+                 ( pData[ i ] == pOk[ matchLength ] ) )
+        {
+            pPattern = pOk;
+            matchLength++;
+        }
+        else if( pData[ i ] == pNoCarrier[ 0 ] )
+        {
+            pPattern = pNoCarrier;
+            matchLength = 1U;
+        }
+        else
+        {
+            pPattern = pNoCarrier;
+            matchLength = 0U;
+        }
+
+        patternLength = ( pPattern == pOk ) ? PKTIO_DATA_MODE_OK_LEN : PKTIO_DATA_MODE_NO_CARRIER_LEN;
+
+        if( matchLength == patternLength )
+        {
+            /* The bytes after the result code are the rest of the line. */
+            resultCode = true;
+            carrierLost = ( pPattern == pNoCarrier ) ? true : false;
+        }
+    }
+
+    /* The data to pass is the held bytes followed by the scanned bytes without
+     * the matched bytes. */
+    deliverLength = heldLength + i - matchLength;
+
+    PlatformMutex_Lock( &( pContext->PktRespMutex ) );
+    receiveCallback = pContext->dataModeRecvCB;
+    exitCallback = pContext->dataModeExitCB;
+    pCallbackContext = pContext->pDataModeCBContext;
+
+    if( resultCode == true )
+    {
+        pContext->dataMode = PKTIO_DATA_MODE_OFF;
+        pContext->pDataModeDialCmd = NULL;
+        pContext->dataModeRecvCB = NULL;
+        pContext->dataModeExitCB = NULL;
+        pContext->pDataModeCBContext = NULL;
+        pContext->dataModeMatchLength = 0U;
+        pContext->dataModeMatchOk = false;
+    }
+    else
+    {
+        pContext->dataModeMatchLength = ( uint8_t ) matchLength;
+        pContext->dataModeMatchOk = ( pPattern == pOk ) ? true : false;
+    }
+
+    PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+
+    if( receiveCallback != NULL )
+    {
+        if( deliverLength > heldLength )
+        {
+            if( heldLength > 0U )
+            {
+                receiveCallback( pHeld, heldLength, pCallbackContext );
+            }
+
+            receiveCallback( pData, deliverLength - heldLength, pCallbackContext );
+        }
+        else if( deliverLength > 0U )
+        {
+            receiveCallback( pHeld, deliverLength, pCallbackContext );
+        }
+        else
+        {
+            /* Empty else MISRA 15.7 */
+        }
+    }
+
+    if( carrierLost == true )
+    {
+        LogInfo( ( "Data mode is terminated by NO CARRIER" ) );
+
+        if( exitCallback != NULL )
+        {
+            exitCallback( pCallbackContext );
+        }
+    }
+
+    /* Wake up _Cellular_PktioDataModeEscape. */
+    if( ( resultCode == true ) && ( escaping == true ) )
+    {
+        ( void ) PlatformEventGroup_SetBits( ( PlatformEventGroupHandle_t ) pContext->pPktioCommEvent,
+                                             ( PlatformEventBits_t ) PKTIO_EVT_MASK_ESCAPED );
+    }
+
+    return i;
+}
+
+/*-----------------------------------------------------------*/
+
+/* The modem sends AT command responses and URCs right after the result code
+ * which terminates data mode. Copy the bytes after the result code to the start
+ * of the pktioReadBuf and parse them. pData may point into the pktioReadBuf. */
+static void _handleDataModeLeftover( CellularContext_t * pContext,
+                                     const uint8_t * pData,
+                                     uint32_t dataLength )
+{
+    if( dataLength > 0U )
+    {
+        LogDebug( ( "Parse %u bytes after the data mode result code", ( unsigned int ) dataLength ) );
+
+        ( void ) memmove( pContext->pktioReadBuf, pData, dataLength );
+        pContext->pktioReadBuf[ dataLength ] = '\0';
+        pContext->pPktioReadPtr = pContext->pktioReadBuf;
+        pContext->partialDataRcvdLen = 0U;
+
+        _handleAllReceived( pContext, &( pContext->pAtCmdResp ), pContext->pktioReadBuf, dataLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t _handleDataModeRxEvent( CellularContext_t * pContext )
+{
+    uint8_t * pBuffer = NULL;
+    uint32_t bytesRead = 0;
+    uint32_t handledLength = 0;
+    CellularCommInterfaceError_t commIntfRet = IOT_COMM_INTERFACE_SUCCESS;
+
+    /* The data is not parsed in data mode. Pass the borrowed buffer to the
+     * consumer directly if the comm interface supports it. */
+    if( ( pContext->pCommIntf->recvBorrow != NULL ) && ( pContext->pCommIntf->recvRelease != NULL ) )
+    {
+        commIntfRet = pContext->pCommIntf->recvBorrow( pContext->hPktioCommIntf, &pBuffer,
+                                                       PKTIO_READ_BUFFER_SIZE,
+                                                       CELLULAR_COMM_IF_RECV_TIMEOUT_MS, &bytesRead );
+
+        if( ( commIntfRet != IOT_COMM_INTERFACE_SUCCESS ) || ( pBuffer == NULL ) )
+        {
+            bytesRead = 0U;
+        }
+        else if( bytesRead > 0U )
+        {
+            handledLength = _handleDataModeData( pContext, pBuffer, bytesRead );
+            _handleDataModeLeftover( pContext, &( pBuffer[ handledLength ] ), bytesRead - handledLength );
+            ( void ) pContext->pCommIntf->recvRelease( pContext->hPktioCommIntf, bytesRead );
+        }
+        else
+        {
+            /* Nothing is borrowed. */
+        }
+    }
+    else
+    {
+        ( void ) pContext->pCommIntf->recv( pContext->hPktioCommIntf, ( uint8_t * ) pContext->pktioReadBuf,
+                                            PKTIO_READ_BUFFER_SIZE,
+                                            CELLULAR_COMM_IF_RECV_TIMEOUT_MS, &bytesRead );
+
+        if( bytesRead > 0U )
+        {
+            handledLength = _handleDataModeData( pContext, ( const uint8_t * ) pContext->pktioReadBuf, bytesRead );
+            _handleDataModeLeftover( pContext, ( const uint8_t * ) &( pContext->pktioReadBuf[ handledLength ] ),
+                                     bytesRead - handledLength );
+        }
+    }
+
+    return bytesRead;
+}
+
+/*-----------------------------------------------------------*/
+
 static uint32_t _handleRxDataEvent( CellularContext_t * pContext )
 {
     char * pLine = NULL;
     uint32_t bytesRead = 0;
     uint32_t bytesLeft = 0;
 
-    /* Return the first line, may be more lines in buffer. */
-    /* Start from pLine there are bytesRead bytes. */
-    pLine = _Cellular_ReadLine( pContext, &bytesRead, pContext->pAtCmdResp );
+    /* The received data is passed to the consumer in data mode. Otherwise, parse
+     * in the borrowed buffer of the comm interface if nothing is pending in the
+     * pktioReadBuf, or copy the received data after the pending data. */
+    if( ( pContext->dataMode == PKTIO_DATA_MODE_ON ) || ( pContext->dataMode == PKTIO_DATA_MODE_ESCAPING ) )
+    {
+        bytesRead = _handleDataModeRxEvent( pContext );
+    }
+    else if( ( pContext->pCommIntf->recvBorrow != NULL ) && ( pContext->pCommIntf->recvRelease != NULL ) &&
+             ( pContext->pAtCmdResp == NULL ) && ( pContext->partialDataRcvdLen == 0U ) &&
+             ( pContext->dataLength == 0U ) )
+    {
+        bytesRead = _handleBorrowedData( pContext );
+    }
+    else
+    {
+        /* Return the first line, may be more lines in buffer. */
+        /* Start from pLine there are bytesRead bytes. */
+        pLine = _Cellular_ReadLine( pContext, &bytesRead, pContext->pAtCmdResp );
+    }
 
-    if( bytesRead > 0U )
+    if( ( bytesRead > 0U ) && ( pLine != NULL ) )
     {
         if( pContext->dataLength != 0U )
         {
@@ -1425,6 +2032,8 @@ CellularPktStatus_t _Cellular_PktioSendAtCmd( CellularContext_t * pContext,
     uint32_t cmdLen = 0, newCmdLen = 0;
     uint32_t sentLen = 0;
     CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    const uint8_t cmdTerminator = ( uint8_t ) '\r';
+    CellularDataSegment_t cmdSegments[ 2 ];
 
     if( pContext == NULL )
     {
@@ -1441,6 +2050,11 @@ CellularPktStatus_t _Cellular_PktioSendAtCmd( CellularContext_t * pContext,
         LogError( ( "_Cellular_PktioSendAtCmd : invalid pAtCmd" ) );
         pktStatus = CELLULAR_PKT_STATUS_BAD_PARAM;
     }
+    else if( ( pContext->dataMode == PKTIO_DATA_MODE_ON ) || ( pContext->dataMode == PKTIO_DATA_MODE_ESCAPING ) )
+    {
+        LogError( ( "_Cellular_PktioSendAtCmd : AT command is not allowed in data mode" ) );
+        pktStatus = CELLULAR_PKT_STATUS_BAD_REQUEST;
+    }
     else
     {
         cmdLen = ( uint32_t ) strlen( pAtCmd );
@@ -1459,17 +2073,41 @@ CellularPktStatus_t _Cellular_PktioSendAtCmd( CellularContext_t * pContext,
             if( pktStatus == CELLULAR_PKT_STATUS_OK )
             {
                 pContext->PktioAtCmdType = atType;
-                newCmdLen = cmdLen;
-                newCmdLen += 1U; /* Include space for \r. */
 
-                ( void ) strncpy( pContext->pktioSendBuf, pAtCmd, cmdLen );
-                pContext->pktioSendBuf[ cmdLen ] = '\r';
+                /* pktRequestMutex is taken by the caller. Only the dial command
+                 * waits for CONNECT to enter data mode. */
+                if( ( pContext->dataMode == PKTIO_DATA_MODE_STARTING ) && ( pAtCmd == pContext->pDataModeDialCmd ) )
+                {
+                    pContext->dataMode = PKTIO_DATA_MODE_DIALING;
+                }
 
-                PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+                if( pContext->pCommIntf->sendv != NULL )
+                {
+                    PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+
+                    /* Send the command and \r in one comm interface call without copying. */
+                    cmdSegments[ 0 ].pData = ( const uint8_t * ) pAtCmd;
+                    cmdSegments[ 0 ].dataLength = cmdLen;
+                    cmdSegments[ 1 ].pData = &cmdTerminator;
+                    cmdSegments[ 1 ].dataLength = 1U;
+
+                    ( void ) pContext->pCommIntf->sendv( pContext->hPktioCommIntf, cmdSegments, 2U,
+                                                         CELLULAR_COMM_IF_SEND_TIMEOUT_MS, &sentLen );
+                }
+                else
+                {
+                    newCmdLen = cmdLen;
+                    newCmdLen += 1U; /* Include space for \r. */
+
+                    ( void ) strncpy( pContext->pktioSendBuf, pAtCmd, cmdLen );
+                    pContext->pktioSendBuf[ cmdLen ] = '\r';
+
+                    PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
 
-                ( void ) pContext->pCommIntf->send( pContext->hPktioCommIntf,
-                                                    ( const uint8_t * ) &( pContext->pktioSendBuf ), newCmdLen,
-                                                    CELLULAR_COMM_IF_SEND_TIMEOUT_MS, &sentLen );
+                    ( void ) pContext->pCommIntf->send( pContext->hPktioCommIntf,
+                                                        ( const uint8_t * ) &( pContext->pktioSendBuf ), newCmdLen,
+                                                        CELLULAR_COMM_IF_SEND_TIMEOUT_MS, &sentLen );
+                }
             }
             else
             {
@@ -1514,6 +2152,371 @@ uint32_t _Cellular_PktioSendData( CellularContext_t * pContext,
 
 /*-----------------------------------------------------------*/
 
+/* Sends data segments to the modem. */
+uint32_t _Cellular_PktioSendDatav( CellularContext_t * pContext,
+                                   const CellularDataSegment_t * pSegments,
+                                   uint32_t segmentCount )
+{
+    uint32_t totalSentLen = 0;
+    uint32_t sentLen = 0;
+    uint32_t sendCount = 0;
+    uint32_t i = 0;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_PktioSendDatav : invalid cellular context" ) );
+    }
+    else if( ( pContext->pCommIntf == NULL ) || ( pContext->hPktioCommIntf == NULL ) )
+    {
+        LogError( ( "_Cellular_PktioSendDatav : invalid comm interface handle" ) );
+    }
+    else if( pSegments == NULL )
+    {
+        LogError( ( "_Cellular_PktioSendDatav : invalid pSegments" ) );
+    }
+    else
+    {
+        /* Only the segments before the first invalid segment are sent. */
+        for( sendCount = 0; sendCount < segmentCount; sendCount++ )
+        {
+            if( pSegments[ sendCount ].pData == NULL )
+            {
+                LogError( ( "_Cellular_PktioSendDatav : invalid pData of segment %u", ( unsigned int ) sendCount ) );
+                break;
+            }
+        }
+    }
+
+    if( sendCount == 0U )
+    {
+        /* Nothing to send. */
+    }
+    else if( pContext->pCommIntf->sendv != NULL )
+    {
+        ( void ) pContext->pCommIntf->sendv( pContext->hPktioCommIntf, pSegments, sendCount,
+                                             CELLULAR_COMM_IF_SEND_TIMEOUT_MS, &totalSentLen );
+    }
+    else
+    {
+        /* The comm interface sends the segments one by one. */
+        for( i = 0; i < sendCount; i++ )
+        {
+            sentLen = 0;
+            ( void ) pContext->pCommIntf->send( pContext->hPktioCommIntf, pSegments[ i ].pData,
+                                                pSegments[ i ].dataLength, CELLULAR_COMM_IF_SEND_TIMEOUT_MS, &sentLen );
+            totalSentLen = totalSentLen + sentLen;
+
+            if( sentLen != pSegments[ i ].dataLength )
+            {
+                break;
+            }
+        }
+    }
+
+    LogDebug( ( "PktioSendDatav sent %u bytes", ( unsigned int ) totalSentLen ) );
+    return totalSentLen;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Starts sending data to the modem. PKTIO_EVT_MASK_TX_DONE is set when the transfer completes. */
+CellularPktStatus_t _Cellular_PktioSendDataAsync( CellularContext_t * pContext,
+                                                  const uint8_t * pData,
+                                                  uint32_t dataLen )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularCommInterfaceError_t commIntfRet = IOT_COMM_INTERFACE_SUCCESS;
+    CellularPktioSendTag_t * pTag = NULL;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_PktioSendDataAsync : invalid cellular context" ) );
+        pktStatus = CELLULAR_PKT_STATUS_INVALID_HANDLE;
+    }
+    else if( ( pContext->pCommIntf == NULL ) || ( pContext->hPktioCommIntf == NULL ) ||
+             ( pContext->pCommIntf->sendAsync == NULL ) || ( pContext->pPktioCommEvent == NULL ) )
+    {
+        LogError( ( "_Cellular_PktioSendDataAsync : invalid comm interface handle" ) );
+        pktStatus = CELLULAR_PKT_STATUS_INVALID_HANDLE;
+    }
+    else if( pData == NULL )
+    {
+        LogError( ( "_Cellular_PktioSendDataAsync : invalid pData" ) );
+        pktStatus = CELLULAR_PKT_STATUS_BAD_PARAM;
+    }
+    else
+    {
+        /* A late completion of the previous send keeps the tag of the previous
+         * send and is ignored by the callback. */
+        pContext->pktioSendTagIndex = ( uint8_t ) ( ( pContext->pktioSendTagIndex + 1U ) % PKTIO_SEND_TAG_NUM );
+        pTag = &( pContext->pktioSendTag[ pContext->pktioSendTagIndex ] );
+
+        taskENTER_CRITICAL();
+        pContext->pktioSendAsyncSequence++;
+        pTag->pContext = pContext;
+        pTag->sequence = pContext->pktioSendAsyncSequence;
+        pContext->pktioSendAsyncLength = 0U;
+        taskEXIT_CRITICAL();
+
+        ( void ) PlatformEventGroup_ClearBits( ( PlatformEventGroupHandle_t ) pContext->pPktioCommEvent,
+                                               ( PlatformEventBits_t ) PKTIO_EVT_MASK_TX_DONE );
+
+        commIntfRet = pContext->pCommIntf->sendAsync( pContext->hPktioCommIntf, pData, dataLen,
+                                                      CELLULAR_COMM_IF_SEND_TIMEOUT_MS,
+                                                      _Cellular_PktTxDoneCallBack, pTag );
+
+        if( commIntfRet != IOT_COMM_INTERFACE_SUCCESS )
+        {
+            LogError( ( "_Cellular_PktioSendDataAsync : comm interface send failed %d", commIntfRet ) );
+            pktStatus = CELLULAR_PKT_STATUS_SEND_ERROR;
+        }
+    }
+
+    return pktStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+uint32_t _Cellular_PktioSendDataWait( CellularContext_t * pContext,
+                                      uint32_t timeoutMs )
+{
+    PlatformEventBits_t uxBits = 0;
+    PlatformTickType_t startTick = 0;
+    PlatformTickType_t elapsedTicks = 0;
+    PlatformTickType_t timeoutTicks = 0;
+    PlatformTickType_t waitTicks = 0;
+    uint32_t sentLen = 0;
+    bool sendDone = false;
+    bool timedOut = false;
+
+    if( ( pContext == NULL ) || ( pContext->pPktioCommEvent == NULL ) )
+    {
+        LogError( ( "_Cellular_PktioSendDataWait : invalid cellular context" ) );
+    }
+    else
+    {
+        startTick = PlatformTask_GetTickCount();
+        timeoutTicks = pdMS_TO_TICKS( timeoutMs );
+        waitTicks = timeoutTicks;
+
+        while( ( sendDone == false ) && ( timedOut == false ) )
+        {
+            uxBits = PlatformEventGroup_WaitBits( ( PlatformEventGroupHandle_t ) pContext->pPktioCommEvent,
+                                                  ( PlatformEventBits_t ) PKTIO_EVT_MASK_TX_DONE,
+                                                  platformTRUE,
+                                                  platformFALSE,
+                                                  waitTicks );
+
+            if( ( uxBits & ( PlatformEventBits_t ) PKTIO_EVT_MASK_TX_DONE ) == 0U )
+            {
+                timedOut = true;
+            }
+            else
+            {
+                taskENTER_CRITICAL();
+
+                if( pContext->pktioSendAsyncDoneSequence == pContext->pktioSendAsyncSequence )
+                {
+                    sentLen = pContext->pktioSendAsyncLength;
+                    sendDone = true;
+                }
+
+                taskEXIT_CRITICAL();
+            }
+
+            if( ( sendDone == false ) && ( timedOut == false ) )
+            {
+                /* The event is set by a deferred completion of the previous
+                 * send. Wait for the rest of the timeout. The tick count is
+                 * allowed to wrap around. */
+                LogDebug( ( "_Cellular_PktioSendDataWait : stale send completion ignored" ) );
+                elapsedTicks = ( PlatformTickType_t ) ( PlatformTask_GetTickCount() - startTick );
+
+                if( elapsedTicks >= timeoutTicks )
+                {
+                    timedOut = true;
+                }
+                else
+                {
+                    waitTicks = timeoutTicks - elapsedTicks;
+                }
+            }
+        }
+
+        if( timedOut == true )
+        {
+            LogError( ( "_Cellular_PktioSendDataWait : send is not completed in %u ms", ( unsigned int ) timeoutMs ) );
+
+            /* The completion after the timeout is ignored. */
+            taskENTER_CRITICAL();
+            pContext->pktioSendAsyncSequence++;
+            taskEXIT_CRITICAL();
+        }
+    }
+
+    LogDebug( ( "PktioSendDataWait sent %u bytes", ( unsigned int ) sentLen ) );
+    return sentLen;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularPktStatus_t _Cellular_PktioDataModeStart( CellularContext_t * pContext,
+                                                  const char * pDialCmd,
+                                                  CellularDataModeReceiveCallback_t receiveCallback,
+                                                  CellularDataModeExitCallback_t exitCallback,
+                                                  void * pCallbackContext )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+
+    if( pContext == NULL )
+    {
+        LogError( ( "_Cellular_PktioDataModeStart : invalid cellular context" ) );
+        pktStatus = CELLULAR_PKT_STATUS_INVALID_HANDLE;
+    }
+    else if( ( pDialCmd == NULL ) || ( receiveCallback == NULL ) )
+    {
+        LogError( ( "_Cellular_PktioDataModeStart : invalid pDialCmd or receiveCallback" ) );
+        pktStatus = CELLULAR_PKT_STATUS_BAD_PARAM;
+    }
+    else
+    {
+        PlatformMutex_Lock( &( pContext->PktRespMutex ) );
+
+        if( pContext->dataMode != PKTIO_DATA_MODE_OFF )
+        {
+            LogError( ( "_Cellular_PktioDataModeStart : data mode is already started" ) );
+            pktStatus = CELLULAR_PKT_STATUS_BAD_REQUEST;
+        }
+        else
+        {
+            /* The state changes to dialing when the dial command is sent with
+             * pktRequestMutex taken. */
+            pContext->dataMode = PKTIO_DATA_MODE_STARTING;
+            pContext->pDataModeDialCmd = pDialCmd;
+            pContext->dataModeRecvCB = receiveCallback;
+            pContext->dataModeExitCB = exitCallback;
+            pContext->pDataModeCBContext = pCallbackContext;
+            pContext->dataModeMatchLength = 0U;
+            pContext->dataModeMatchOk = false;
+        }
+
+        PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+    }
+
+    return pktStatus;
+}
+
+/*-----------------------------------------------------------*/
+
+void _Cellular_PktioDataModeStop( CellularContext_t * pContext )
+{
+    if( pContext != NULL )
+    {
+        PlatformMutex_Lock( &( pContext->PktRespMutex ) );
+        pContext->dataMode = PKTIO_DATA_MODE_OFF;
+        pContext->pDataModeDialCmd = NULL;
+        pContext->dataModeRecvCB = NULL;
+        pContext->dataModeExitCB = NULL;
+        pContext->pDataModeCBContext = NULL;
+        pContext->dataModeMatchLength = 0U;
+        pContext->dataModeMatchOk = false;
+        PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+bool _Cellular_PktioDataModeIsActive( const CellularContext_t * pContext )
+{
+    bool dataModeActive = false;
+
+    if( ( pContext != NULL ) && ( pContext->dataMode == PKTIO_DATA_MODE_ON ) )
+    {
+        dataModeActive = true;
+    }
+
+    return dataModeActive;
+}
+
+/*-----------------------------------------------------------*/
+
+CellularPktStatus_t _Cellular_PktioDataModeEscape( CellularContext_t * pContext )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint32_t sentLen = 0;
+
+    if( ( pContext == NULL ) || ( pContext->pPktioCommEvent == NULL ) )
+    {
+        LogError( ( "_Cellular_PktioDataModeEscape : invalid cellular context" ) );
+        pktStatus = CELLULAR_PKT_STATUS_INVALID_HANDLE;
+    }
+    else
+    {
+        PlatformMutex_Lock( &( pContext->PktRespMutex ) );
+
+        if( pContext->dataMode != PKTIO_DATA_MODE_ON )
+        {
+            LogError( ( "_Cellular_PktioDataModeEscape : not in data mode" ) );
+            pktStatus = CELLULAR_PKT_STATUS_BAD_REQUEST;
+        }
+        else
+        {
+            /* The data mode consumer can't send during the guard time from now on. */
+            pContext->dataMode = PKTIO_DATA_MODE_ESCAPING;
+        }
+
+        PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+    }
+
+    if( pktStatus == CELLULAR_PKT_STATUS_OK )
+    {
+        ( void ) PlatformEventGroup_ClearBits( ( PlatformEventGroupHandle_t ) pContext->pPktioCommEvent,
+                                               ( PlatformEventBits_t ) PKTIO_EVT_MASK_ESCAPED );
+
+        /* The modem only recognizes the escape sequence with the guard time
+         * before and after it. It responds OK after the guard time. */
+        Platform_Delay( CELLULAR_CONFIG_DATA_MODE_GUARD_TIME_MS );
+        sentLen = _Cellular_PktioSendData( pContext, ( const uint8_t * ) PKTIO_DATA_MODE_ESCAPE,
+                                           PKTIO_DATA_MODE_ESCAPE_LEN );
+
+        if( sentLen != PKTIO_DATA_MODE_ESCAPE_LEN )
+        {
+            LogError( ( "_Cellular_PktioDataModeEscape : failed to send the escape sequence" ) );
+            pktStatus = CELLULAR_PKT_STATUS_SEND_ERROR;
+        }
+        else
+        {
+            ( void ) PlatformEventGroup_WaitBits( ( PlatformEventGroupHandle_t ) pContext->pPktioCommEvent,
+                                                  ( PlatformEventBits_t ) PKTIO_EVT_MASK_ESCAPED,
+                                                  platformTRUE,
+                                                  platformFALSE,
+                                                  pdMS_TO_TICKS( CELLULAR_CONFIG_DATA_MODE_GUARD_TIME_MS +
+                                                                 PKTIO_DATA_MODE_ESCAPE_TIMEOUT_MS ) );
+        }
+
+        /* The packet IO thread leaves data mode on OK or NO CARRIER. Otherwise
+         * the modem is still in data mode. */
+        PlatformMutex_Lock( &( pContext->PktRespMutex ) );
+
+        if( pContext->dataMode == PKTIO_DATA_MODE_ESCAPING )
+        {
+            pContext->dataMode = PKTIO_DATA_MODE_ON;
+
+            if( pktStatus == CELLULAR_PKT_STATUS_OK )
+            {
+                LogError( ( "_Cellular_PktioDataModeEscape : no response to the escape sequence" ) );
+                pktStatus = CELLULAR_PKT_STATUS_TIMED_OUT;
+            }
+        }
+
+        PlatformMutex_Unlock( &( pContext->PktRespMutex ) );
+    }
+
+    return pktStatus;
+}
+
+/*-----------------------------------------------------------*/
+
 void _Cellular_PktioShutdown( CellularContext_t * pContext )
 {
     PlatformEventBits_t uxBits = 0;
@@ -48,6 +48,12 @@
 #define CELLULAR_LIBRARY_VERSION    "v1.4.1+"
 /** @endcond */
 
+#ifndef CELLULAR_DO_NOT_USE_CUSTOM_CONFIG
+    /* Include custom config file before other headers. */
+    #include "cellular_config.h"
+#endif
+#include "cellular_config_defaults.h"
+
 /* IoT Cellular data types. */
 #include "cellular_types.h"
 
@@ -513,6 +519,12 @@ CellularError_t Cellular_SocketConnect( CellularHandle_t cellularHandle,
  * data sent. Note that it may be less than the dataLength in case complete data
  * could not be sent.
  *
+ * If the CELLULAR_SOCKET_OPTION_SEND_COALESCE socket option is set, the data
+ * reported in pSentDataLength may still be held in the coalescing buffer. Call
+ * with dataLength 0 to send the buffered data. pData can be NULL in this case.
+ * An error sending the buffered data after the data of a call is buffered is
+ * returned by the next call with pSentDataLength 0.
+ *
  * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
  * code indicating the cause of the error.
  */
@@ -522,6 +534,31 @@ CellularError_t Cellular_SocketSend( CellularHandle_t cellularHandle,
                                      uint32_t dataLength,
                                      uint32_t * pSentDataLength );
 
+/**
+ * @brief Send data from several buffers to the connected remote socket.
+ *
+ * The segments are sent in order as one data send. They are passed to the comm
+ * interface without copying them into one buffer first. For example, a protocol
+ * header and its payload can be sent from different buffers.
+ *
+ * @param[in] cellularHandle The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle returned from the Cellular_CreateSocket call.
+ * @param[in] pSegments The segments of the data to be sent.
+ * @param[in] segmentCount The number of segments in pSegments. It is not larger
+ * than CELLULAR_MAX_SEND_DATA_SEGMENTS.
+ * @param[out] pSentDataLength Out parameter to provide the length of the actual
+ * data sent. Note that it may be less than the total length of the segments in
+ * case complete data could not be sent.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t Cellular_SocketSendv( CellularHandle_t cellularHandle,
+                                      CellularSocketHandle_t socketHandle,
+                                      const CellularDataSegment_t * pSegments,
+                                      uint32_t segmentCount,
+                                      uint32_t * pSentDataLength );
+
 /**
  * @brief Receive data on a connected socket.
  *
@@ -649,6 +686,145 @@ CellularError_t Cellular_SocketRegisterClosedCallback( CellularHandle_t cellular
                                                        CellularSocketClosedCallback_t closedCallback,
                                                        void * pCallbackContext );
 
+/**
+ * @brief Wait for readiness events on several sockets.
+ *
+ * The calling task blocks until an event in pPollFds[ i ].events occurs on
+ * any of the sockets or until timeoutMs expires. CELLULAR_SOCKET_POLL_READABLE
+ * is reported again while received data is buffered in the receive prefetch
+ * buffer of the socket. The other events are reported once. Only one task
+ * should call this function at a time.
+ *
+ * If a socket is closed by another task during the poll, CELLULAR_SOCKET_POLL_CLOSED
+ * is reported for it even if it is not requested. The handle must not be used
+ * after it is closed.
+ *
+ * @param[in] cellularHandle The opaque cellular context pointer created by Cellular_Init.
+ * @param[in,out] pPollFds The sockets and the events to wait for. The occurred
+ * events are returned in pPollFds[ i ].revents.
+ * @param[in] numPollFds The number of entries in pPollFds. It is not larger
+ * than the number of sockets of the cellular context.
+ * @param[in] timeoutMs The timeout in milliseconds to wait for the events.
+ * @param[out] pNumReady The number of sockets with occurred events.
+ *
+ * @return CELLULAR_SUCCESS if an event occurred, CELLULAR_TIMEOUT if no event
+ * occurred before the timeout, otherwise an error code indicating the cause
+ * of the error.
+ */
+CellularError_t Cellular_SocketPoll( CellularHandle_t cellularHandle,
+                                     CellularSocketPollFd_t * pPollFds,
+                                     uint8_t numPollFds,
+                                     uint32_t timeoutMs,
+                                     uint8_t * pNumReady );
+
+/**
+ * @brief Get the traffic and latency statistics of a socket.
+ *
+ * The statistics are recorded when CELLULAR_CONFIG_SOCKET_STATS is enabled.
+ * A slow modem shows as a high send latency and many partial sends, a slow
+ * application as a high data ready latency, and poor radio conditions as
+ * modem errors.
+ *
+ * @param[in] cellularHandle The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle returned from the Cellular_CreateSocket call.
+ * @param[out] pStats The statistics of the socket.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, CELLULAR_UNSUPPORTED
+ * if CELLULAR_CONFIG_SOCKET_STATS is not enabled or the module port does not
+ * maintain the statistics, otherwise an error code indicating the cause of the
+ * error.
+ */
+CellularError_t Cellular_SocketGetStats( CellularHandle_t cellularHandle,
+                                         CellularSocketHandle_t socketHandle,
+                                         CellularSocketStats_t * pStats );
+
+#if ( CELLULAR_CONFIG_HEAP_STATS == 1 )
+
+/**
+ * @brief Get the heap usage statistics of the cellular library.
+ *
+ * The statistics are available when CELLULAR_CONFIG_HEAP_STATS is enabled.
+ *
+ * @param[out] pStats The statistics are copied to this structure.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+    CellularError_t Cellular_HeapGetStats( CellularHeapStats_t * pStats );
+
+/**
+ * @brief Reset the heap usage statistics of the cellular library.
+ *
+ * The counters and the allocation rate are cleared. The peak values are reset
+ * to the current values since the outstanding allocations are still accounted.
+ *
+ * @return CELLULAR_SUCCESS.
+ */
+    CellularError_t Cellular_HeapResetStats( void );
+
+#endif /* if ( CELLULAR_CONFIG_HEAP_STATS == 1 ) */
+
+/**
+ * @brief Switch the modem to data mode for a raw byte stream consumer like PPP.
+ *
+ * The PDN context should be configured and the modem registered to the network
+ * before calling this function. The modem is dialed with ATD*99***<contextId>#.
+ * After CONNECT, the packet IO stops parsing AT responses and passes the data
+ * received from the modem to receiveCallback. Data is sent with
+ * Cellular_DataModeSend. AT commands are not allowed in data mode. URCs are not
+ * received in data mode unless the modem is multiplexed with CMUX and the AT
+ * commands use a different channel. In that case, the byte stream consumer
+ * should use another CMUX channel instead of data mode.
+ *
+ * @param[in] cellularHandle The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] contextId The PDN context ID to dial.
+ * @param[in] receiveCallback The callback to receive the data in data mode.
+ * @param[in] exitCallback The callback invoked when the modem leaves data mode
+ * with NO CARRIER. It can be NULL.
+ * @param[in] pCallbackContext The context to be passed to the callback functions.
+ *
+ * @return CELLULAR_SUCCESS if the modem is in data mode, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t Cellular_DataModeEnter( CellularHandle_t cellularHandle,
+                                        uint8_t contextId,
+                                        CellularDataModeReceiveCallback_t receiveCallback,
+                                        CellularDataModeExitCallback_t exitCallback,
+                                        void * pCallbackContext );
+
+/**
+ * @brief Send data to the modem in data mode.
+ *
+ * @param[in] cellularHandle The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] pData The data to send.
+ * @param[in] dataLength The length of pData.
+ * @param[out] pSentDataLength Out parameter to provide the length of the
+ * actual data sent.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, CELLULAR_NOT_ALLOWED
+ * if the modem is not in data mode, otherwise an error code indicating the
+ * cause of the error.
+ */
+CellularError_t Cellular_DataModeSend( CellularHandle_t cellularHandle,
+                                       const uint8_t * pData,
+                                       uint32_t dataLength,
+                                       uint32_t * pSentDataLength );
+
+/**
+ * @brief Switch the modem back to command mode and hang up the data call.
+ *
+ * The escape sequence "+++" is sent with CELLULAR_CONFIG_DATA_MODE_GUARD_TIME_MS
+ * of silence before and after it. The data received during the guard time is
+ * still passed to the receive callback. The exit callback is not invoked.
+ *
+ * @param[in] cellularHandle The opaque cellular context pointer created by Cellular_Init.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, CELLULAR_NOT_ALLOWED
+ * if the modem is not in data mode, otherwise an error code indicating the
+ * cause of the error.
+ */
+CellularError_t Cellular_DataModeExit( CellularHandle_t cellularHandle );
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
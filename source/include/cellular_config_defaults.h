@@ -206,13 +206,30 @@
 /**
  * @brief Cellular module number of socket max size.<br>
  *
- * <b>Possible values:</b>`Any positive integer`<br>
+ * The size of the default socket table of a cellular context. Module ports
+ * size the socket table at init with Cellular_CommonInitWithSocketTable.
+ *
+ * <b>Possible values:</b>`Any positive integer up to 255`<br>
  * <b>Default value (if undefined):</b> 12
  */
 #ifndef CELLULAR_NUM_SOCKET_MAX
     #define CELLULAR_NUM_SOCKET_MAX    ( 12U )
 #endif
 
+/**
+ * @brief Cellular module socket ID range.<br>
+ *
+ * The socket IDs used by the modem in AT commands and URCs are from 0 to
+ * CELLULAR_MODEM_SOCKET_ID_MAX - 1. Set it to the modem ID range when it is
+ * larger than the number of sockets.
+ *
+ * <b>Possible values:</b>`Any positive integer`<br>
+ * <b>Default value (if undefined):</b> CELLULAR_NUM_SOCKET_MAX
+ */
+#ifndef CELLULAR_MODEM_SOCKET_ID_MAX
+    #define CELLULAR_MODEM_SOCKET_ID_MAX    CELLULAR_NUM_SOCKET_MAX
+#endif
+
 /**
  * @brief Cellular module manufacture ID max size.<br>
  *
@@ -283,6 +300,19 @@
     #define CELLULAR_MAX_SEND_DATA_LEN    ( 1460U )
 #endif
 
+/**
+ * @brief Cellular socket max data segments of one data send.<br>
+ *
+ * The maximum segmentCount of Cellular_SocketSendv and of the pSegments of
+ * CellularAtDataReq_t.
+ *
+ * <b>Possible values:</b>`Any positive integer`<br>
+ * <b>Default value (if undefined):</b> 4
+ */
+#ifndef CELLULAR_MAX_SEND_DATA_SEGMENTS
+    #define CELLULAR_MAX_SEND_DATA_SEGMENTS    ( 4U )
+#endif
+
 /**
  * @brief Cellular socket max receive data length.<br>
  *
@@ -356,6 +386,9 @@
 /**
  * @brief Cellular comm interface use static socket context.<br>
  *
+ * The default socket table of each cellular context uses a static table of
+ * CELLULAR_NUM_SOCKET_MAX socket contexts.
+ *
  * <b>Possible values:</b>`0 or 1`<br>
  * <b>Default value (if undefined):</b> 0
  */
@@ -389,6 +422,66 @@
     #define CELLULAR_AT_COMMAND_RAW_TIMEOUT_MS    ( 5000U )
 #endif
 
+/**
+ * @brief Enable adaptive AT command timeout.<br>
+ *
+ * The response latency of each AT command class is tracked with a smoothed
+ * estimate and its variance. The AT command timeout is derived from the
+ * estimate like TCP retransmission timeout. The timeout value passed by the
+ * caller, like CELLULAR_COMMON_AT_COMMAND_TIMEOUT_MS, is the upper bound, so a
+ * hung modem is detected sooner for command classes that normally respond
+ * quickly. The timeout is doubled after each timeout of a command class, up to
+ * the caller timeout, and restored by the next response.
+ * CELLULAR_CONFIG_GET_TIME_MS must be provided to use this feature.
+ *
+ * <b>Possible values:</b>`0 or 1`<br>
+ * <b>Default value (if undefined):</b> 0
+ */
+#ifndef CELLULAR_CONFIG_ADAPTIVE_TIMEOUT
+    #define CELLULAR_CONFIG_ADAPTIVE_TIMEOUT    ( 0 )
+#endif
+
+/**
+ * @brief Lower bound of the latency estimate of adaptive AT command timeout.<br>
+ *
+ * The effective timeout is not lower than this value unless the timeout passed
+ * by the caller is lower.
+ *
+ * <b>Possible values:</b>`Any positive integer`<br>
+ * <b>Default value (if undefined):</b> 500
+ */
+#ifndef CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_MIN_MS
+    #define CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_MIN_MS    ( 500U )
+#endif
+
+/**
+ * @brief Number of latency samples before the adaptive timeout is applied.<br>
+ *
+ * The timeout value passed by the caller is used until the number of samples
+ * of an AT command class is reached.
+ *
+ * <b>Possible values:</b>`Any positive integer`<br>
+ * <b>Default value (if undefined):</b> 4
+ */
+#ifndef CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_MIN_SAMPLES
+    #define CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_MIN_SAMPLES    ( 4U )
+#endif
+
+/**
+ * @brief Number of AT command classes tracked for adaptive timeout.<br>
+ *
+ * The AT command class is the command name and its "=", "?" or "=?" suffix
+ * without parameters, like "AT+CGDCONT?" or "AT+CGDCONT=".
+ * Classes are mapped to the table by hash. A class replaces another class
+ * mapped to the same entry.
+ *
+ * <b>Possible values:</b>`Any positive integer`<br>
+ * <b>Default value (if undefined):</b> 16
+ */
+#ifndef CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_CLASS_NUM
+    #define CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_CLASS_NUM    ( 16U )
+#endif
+
 /**
  * @brief Cellular AT command response prefix string length.<br>
  *
@@ -452,6 +545,21 @@
     #define CELLULAR_AT_MAX_STRING_SIZE    ( 256U )
 #endif
 
+/**
+ * @brief Decode AT numeric fields four digits at a time.<br>
+ *
+ * Cellular_ATDecodeDec, Cellular_ATDecodeHex and Cellular_ATDecodeBin validate and
+ * convert four digits in one 32 bits word when enabled. Fixed width fields, like the
+ * cell ID in +CEREG and the timer strings in +CPSMS, are decoded in one or two steps.
+ * Set to 0 to use the one digit at a time decoder only.
+ *
+ * <b>Possible values:</b>`0 or 1`<br>
+ * <b>Default value (if undefined):</b> 1
+ */
+#ifndef CELLULAR_CONFIG_AT_SWAR_DECODE
+    #define CELLULAR_CONFIG_AT_SWAR_DECODE    ( 1 )
+#endif
+
 /**
  * @brief Use AT+CCID command for Integrated Circuit Card ID( ICCID ) information.<br>
  *
@@ -488,21 +596,29 @@
 #endif
 
 #if CELLULAR_CONFIG_PLATFORM_FREERTOS
-    #define PlatformQueueHandle_t    QueueHandle_t
-    #define PlatformEventBits_t      EventBits_t
-    #define PlatformBaseType_t       BaseType_t
-    #define PlatformTickType_t       TickType_t
-    #define platformTRUE             pdTRUE
-    #define platformFALSE            pdFALSE
-    #define platformPASS             pdPASS
-    #define platformFAIL             pdFAIL
-    #define platformMAX_DELAY        portMAX_DELAY
-    #define PlatformQueue_Create     xQueueCreate
-    #define PlatformQueue_Send       xQueueSend
-    #define PlatformQueue_Receive    xQueueReceive
-    #define PlatformQueue_Delete     vQueueDelete
+    #define PlatformQueueHandle_t        QueueHandle_t
+    #define PlatformEventBits_t          EventBits_t
+    #define PlatformBaseType_t           BaseType_t
+    #define PlatformTickType_t           TickType_t
+    #define platformTRUE                 pdTRUE
+    #define platformFALSE                pdFALSE
+    #define platformPASS                 pdPASS
+    #define platformFAIL                 pdFAIL
+    #define platformMAX_DELAY            portMAX_DELAY
+    #define PlatformQueue_Create         xQueueCreate
+    #define PlatformQueue_Send           xQueueSend
+    #define PlatformQueue_Receive        xQueueReceive
+    #define PlatformQueue_Delete         vQueueDelete
+    #define PlatformTask_GetTickCount    xTaskGetTickCount
 #endif /* if CELLULAR_CONFIG_PLATFORM_FREERTOS */
 
+/*
+ * PlatformTask_GetTickCount returns the current tick count in PlatformTickType_t.
+ * There is no portable default. Platforms other than FreeRTOS must provide it in
+ * cellular_platform.h with the other Platform* functions. This file can be
+ * included before cellular_platform.h, so it is checked in cellular_common_internal.h.
+ */
+
 /**
  * @brief Pktio read buffer size.
  *
@@ -516,6 +632,114 @@
     #define CELLULAR_CONFIG_PKTIO_READ_BUFFER_SIZE    1600U
 #endif
 
+/**
+ * @brief Monotonic millisecond time source for cellular interface.<br>
+ *
+ * Used by the optional statistics features to compute rates and latencies. The
+ * value is allowed to wrap around. Statistics derived from time are reported as
+ * zero when this macro is not provided.
+ *
+ * <b>Possible values:</b>`Function or macro returning uint32_t milliseconds`<br>
+ * <b>Default value (if undefined):</b> 0
+ */
+#ifndef CELLULAR_CONFIG_GET_TIME_MS
+    #if ( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT == 1 )
+        #error "CELLULAR_CONFIG_ADAPTIVE_TIMEOUT requires CELLULAR_CONFIG_GET_TIME_MS."
+    #endif
+    #define CELLULAR_CONFIG_GET_TIME_MS()    ( 0U )
+    /* Features depending on the elapsed time are not available. */
+    #define CELLULAR_TIME_SOURCE_AVAILABLE    ( 0 )
+#else
+    #define CELLULAR_TIME_SOURCE_AVAILABLE    ( 1 )
+#endif
+
+/**
+ * @brief Enable heap usage accounting for cellular interface.<br>
+ *
+ * The internal allocations of the library are done through _Cellular_Malloc and
+ * _Cellular_Free. When enabled, each allocation is prefixed with a small header
+ * to record the allocation size and site. The statistics can be queried with
+ * Cellular_HeapGetStats. When disabled, the wrappers map to Platform_Malloc and
+ * Platform_Free directly. The string returned by Cellular_ATStrDup should be
+ * freed with _Cellular_Free.
+ *
+ * <b>Possible values:</b>`0 or 1`<br>
+ * <b>Default value (if undefined):</b> 0
+ */
+#ifndef CELLULAR_CONFIG_HEAP_STATS
+    #define CELLULAR_CONFIG_HEAP_STATS    ( 0 )
+#endif
+
+/**
+ * @brief Enable per socket traffic and latency statistics.<br>
+ *
+ * When enabled, _Cellular_SocketSendCoalesce, _Cellular_SocketRecvPrefetch and
+ * _Cellular_SocketDataReady record the statistics of the socket. The statistics
+ * can be queried with Cellular_SocketGetStats if the module port registers both
+ * socket data functions with _Cellular_RegisterSocketDataFunc. The latencies
+ * require CELLULAR_CONFIG_GET_TIME_MS.
+ *
+ * <b>Possible values:</b>`0 or 1`<br>
+ * <b>Default value (if undefined):</b> 0
+ */
+#ifndef CELLULAR_CONFIG_SOCKET_STATS
+    #define CELLULAR_CONFIG_SOCKET_STATS    ( 0 )
+#endif
+
+/**
+ * @brief Number of CMUX channels.<br>
+ *
+ * The number of DLCIs, starting from DLCI 1, that can be opened with the
+ * comm interfaces returned by Cellular_CmuxGetChannel.
+ *
+ * <b>Possible values:</b>`1 to 4`<br>
+ * <b>Default value (if undefined):</b> 2
+ */
+#ifndef CELLULAR_CONFIG_CMUX_MAX_CHANNELS
+    #define CELLULAR_CONFIG_CMUX_MAX_CHANNELS    ( 2U )
+#endif
+
+/**
+ * @brief Maximum information field size of a CMUX frame.<br>
+ *
+ * This is the N1 parameter of 3GPP TS 27.010. It should match the frame size
+ * set with AT+CMUX on the modem.
+ *
+ * <b>Possible values:</b>`1 to 32767`<br>
+ * <b>Default value (if undefined):</b> 127
+ */
+#ifndef CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE
+    #define CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE    ( 127U )
+#endif
+
+/**
+ * @brief Receive buffer size of each CMUX channel.<br>
+ *
+ * Data received for a channel is kept in its buffer until the channel reads it.
+ * The modem is asked to stop sending on the channel when the buffer can't take
+ * another frame of CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE bytes.
+ *
+ * <b>Possible values:</b>`Any positive integer`<br>
+ * <b>Default value (if undefined):</b> 1600
+ */
+#ifndef CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE
+    #define CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE    ( 1600U )
+#endif
+
+/**
+ * @brief Guard time in milliseconds before and after the data mode escape sequence.<br>
+ *
+ * The modem only recognizes "+++" as the escape sequence when no data is sent
+ * for the guard time before and after it. It should not be shorter than the
+ * guard time configured in the modem with ATS12.
+ *
+ * <b>Possible values:</b>`Any positive integer`<br>
+ * <b>Default value (if undefined):</b> 1000
+ */
+#ifndef CELLULAR_CONFIG_DATA_MODE_GUARD_TIME_MS
+    #define CELLULAR_CONFIG_DATA_MODE_GUARD_TIME_MS    ( 1000U )
+#endif
+
 /**
  * @brief Macro that is called in the cellular library for logging "Error" level
  * messages.
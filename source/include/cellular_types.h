@@ -54,6 +54,15 @@
  */
 #define CELLULAR_INVALID_SIGNAL_BAR_VALUE    ( 0xFFU )
 
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Socket readiness events of Cellular_SocketPoll.
+ */
+#define CELLULAR_SOCKET_POLL_READABLE       ( 0x01U ) /**< Data is ready to be received on the socket. */
+#define CELLULAR_SOCKET_POLL_CLOSED         ( 0x02U ) /**< The socket is closed by the remote end. */
+#define CELLULAR_SOCKET_POLL_OPENED         ( 0x04U ) /**< The socket open is completed. */
+#define CELLULAR_SOCKET_POLL_OPEN_FAILED    ( 0x08U ) /**< The socket open is failed. */
+
 struct CellularContext;
 
 /**
@@ -323,7 +332,9 @@ typedef enum CellularSocketOption
     CELLULAR_SOCKET_OPTION_SEND_TIMEOUT,       /**< Set send timeout (in milliseconds). */
     CELLULAR_SOCKET_OPTION_RECV_TIMEOUT,       /**< Set receive timeout (in milliseconds). */
     CELLULAR_SOCKET_OPTION_PDN_CONTEXT_ID,     /**< Set PDN Context ID to use for the socket. */
-    CELLULAR_SOCKET_OPTION_SET_LOCAL_PORT      /**< Set local port. */
+    CELLULAR_SOCKET_OPTION_SET_LOCAL_PORT,     /**< Set local port. */
+    CELLULAR_SOCKET_OPTION_RECV_PREFETCH,      /**< Set receive prefetch buffer (CellularSocketRecvPrefetchBuffer_t). */
+    CELLULAR_SOCKET_OPTION_SEND_COALESCE       /**< Set send coalescing buffer (CellularSocketSendCoalesceBuffer_t). */
 } CellularSocketOption_t;
 
 /**
@@ -706,6 +717,131 @@ typedef struct CellularSocketAddress
     uint16_t port;                 /**< Port number. */
 } CellularSocketAddress_t;
 
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Receive prefetch buffer of a socket.
+ *
+ * Set with the CELLULAR_SOCKET_OPTION_RECV_PREFETCH socket option. Received data
+ * is read from the modem into this buffer in reads of up to CELLULAR_MAX_RECV_DATA_LEN
+ * bytes and Cellular_SocketRecv is served from the buffer. The buffer must be valid
+ * until the socket is closed or the option is set with a NULL pBuffer. The option
+ * returns CELLULAR_UNSUPPORTED if the module port does not implement it.
+ */
+typedef struct CellularSocketRecvPrefetchBuffer
+{
+    uint8_t * pBuffer;     /**< The prefetch buffer. NULL to disable the prefetch. */
+    uint32_t bufferLength; /**< The length of pBuffer. */
+} CellularSocketRecvPrefetchBuffer_t;
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Send coalescing buffer of a stream socket.
+ *
+ * Set with the CELLULAR_SOCKET_OPTION_SEND_COALESCE socket option. Small writes
+ * with Cellular_SocketSend are merged in this buffer and sent with one data send
+ * AT command when the buffered data reaches the buffer length or
+ * CELLULAR_MAX_SEND_DATA_LEN, when flushDelayMs has elapsed since the first
+ * buffered write at the next Cellular_SocketSend, when Cellular_SocketSend is
+ * called with dataLength 0, or when Cellular_SocketRecv or Cellular_SocketPoll is
+ * called on the socket. The buffer must be valid until the socket is closed or
+ * the option is set with a NULL pBuffer. With the buffer set, the socket must be
+ * sent, received and polled in one task.
+ *
+ * The option returns CELLULAR_UNSUPPORTED if the module port does not implement
+ * it, or if flushDelayMs is not 0 and CELLULAR_CONFIG_GET_TIME_MS is not provided.
+ */
+typedef struct CellularSocketSendCoalesceBuffer
+{
+    uint8_t * pBuffer;     /**< The coalescing buffer. NULL to disable the coalescing. */
+    uint32_t bufferLength; /**< The length of pBuffer. */
+    uint32_t flushDelayMs; /**< Maximum time in milliseconds to hold buffered data. 0 to flush by size only. */
+} CellularSocketSendCoalesceBuffer_t;
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Socket and the readiness events to wait for in Cellular_SocketPoll.
+ */
+typedef struct CellularSocketPollFd
+{
+    CellularSocketHandle_t socketHandle; /**< Socket handle returned from the Cellular_CreateSocket call. */
+    uint8_t events;                      /**< CELLULAR_SOCKET_POLL_* events to wait for. */
+    uint8_t revents;                     /**< CELLULAR_SOCKET_POLL_* events occurred on the socket. */
+} CellularSocketPollFd_t;
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Traffic and latency statistics of a socket.
+ */
+typedef struct CellularSocketStats
+{
+    uint32_t bytesSent;             /**< Bytes accepted by the modem. */
+    uint32_t bytesReceived;         /**< Bytes read from the modem. */
+    uint32_t sendCount;             /**< Number of Cellular_SocketSend calls with data. */
+    uint32_t recvCount;             /**< Number of Cellular_SocketRecv calls. */
+    uint32_t modemSendCount;        /**< Number of data send AT commands. */
+    uint32_t modemRecvCount;        /**< Number of data receive AT commands. */
+    uint32_t partialSendCount;      /**< Data send AT commands accepting less data than requested. */
+    uint32_t modemErrorCount;       /**< Data send and receive AT commands returning an error. */
+    uint32_t dataReadyLatencyMs;    /**< Time from the last data ready URC to the application receiving the data. */
+    uint32_t dataReadyLatencyMaxMs; /**< Largest dataReadyLatencyMs. */
+    uint32_t sendLatencyMs;         /**< Time of the last data send AT command, from the command to the result. */
+    uint32_t sendLatencyMaxMs;      /**< Largest sendLatencyMs. */
+} CellularSocketStats_t;
+
+/**
+ * @ingroup cellular_datatypes_enums
+ * @brief Allocation sites of the cellular library.
+ */
+typedef enum CellularHeapSite
+{
+    CELLULAR_HEAP_SITE_CONTEXT = 0,   /**<  Cellular context allocated in _Cellular_AllocContext. */
+    CELLULAR_HEAP_SITE_SOCKET_DATA,   /**<  Socket context allocated in _Cellular_CreateSocketData. */
+    CELLULAR_HEAP_SITE_SOCKET_TABLE,  /**<  Default socket table allocated in _Cellular_CreateSocketData. */
+    CELLULAR_HEAP_SITE_AT_RESPONSE,   /**<  AT command response allocated in _Cellular_AtResponseNew. */
+    CELLULAR_HEAP_SITE_AT_LINE,       /**<  AT command response line allocated in _saveData. */
+    CELLULAR_HEAP_SITE_OPERATOR_INFO, /**<  Operator information allocated in Cellular_CommonGetRegisteredNetwork. */
+    CELLULAR_HEAP_SITE_AT_STRING,     /**<  String duplicated in Cellular_ATStrDup. */
+    CELLULAR_HEAP_SITE_MAX            /**<  Number of allocation sites. */
+} CellularHeapSite_t;
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Heap usage statistics of one allocation site.
+ */
+typedef struct CellularHeapSiteStats
+{
+    uint32_t allocCount; /**<  Number of successful allocations. */
+    uint32_t freeCount;  /**<  Number of frees. */
+    uint32_t failCount;  /**<  Number of failed allocations. */
+    size_t currentBytes; /**<  Bytes currently allocated, including the accounting header. */
+    size_t peakBytes;    /**<  Highest value of currentBytes. */
+} CellularHeapSiteStats_t;
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Heap usage statistics of the cellular library.
+ */
+typedef struct CellularHeapStats
+{
+    size_t currentBytes;                                     /**<  Bytes currently allocated, including the accounting header. */
+    size_t peakBytes;                                        /**<  Highest value of currentBytes. */
+    uint32_t allocCount;                                     /**<  Number of successful allocations. */
+    uint32_t freeCount;                                      /**<  Number of frees. */
+    uint32_t failCount;                                      /**<  Number of failed allocations. */
+    uint32_t allocRatePerSecond;                             /**<  Allocations per second measured over the last complete window. */
+    CellularHeapSiteStats_t sites[ CELLULAR_HEAP_SITE_MAX ]; /**<  Statistics of each allocation site. */
+} CellularHeapStats_t;
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief A segment of the data sent with Cellular_SocketSendv.
+ */
+typedef struct CellularDataSegment
+{
+    const uint8_t * pData; /**< The data of the segment. */
+    uint32_t dataLength;   /**< The length of pData. */
+} CellularDataSegment_t;
+
 /**
  * @ingroup cellular_datatypes_functionpointers
  * @brief Callback used to inform about the response of an AT command sent
@@ -822,6 +958,32 @@ typedef void ( * CellularSocketDataReadyCallback_t )( CellularSocketHandle_t soc
 typedef void ( * CellularSocketClosedCallback_t )( CellularSocketHandle_t socketHandle,
                                                    void * pCallbackContext );
 
+/**
+ * @ingroup cellular_datatypes_functionpointers
+ * @brief Callback used to pass the data received in data mode to the byte
+ * stream consumer.
+ *
+ * This callback is invoked in the packet IO thread. pData is only valid in the
+ * callback.
+ *
+ * @param[in] pData The data received from the modem.
+ * @param[in] dataLength The length of pData.
+ * @param[in] pCallbackContext pCallbackContext parameter in
+ * Cellular_DataModeEnter function.
+ */
+typedef void ( * CellularDataModeReceiveCallback_t )( const uint8_t * pData,
+                                                      uint32_t dataLength,
+                                                      void * pCallbackContext );
+
+/**
+ * @ingroup cellular_datatypes_functionpointers
+ * @brief Callback used to inform that the modem left data mode with NO CARRIER.
+ *
+ * @param[in] pCallbackContext pCallbackContext parameter in
+ * Cellular_DataModeEnter function.
+ */
+typedef void ( * CellularDataModeExitCallback_t )( void * pCallbackContext );
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
@@ -59,6 +59,41 @@
  */
 #define ARRAY_SIZE( x )    ( sizeof( x ) / sizeof( x[ 0 ] ) )
 
+/**
+ * @brief The field may be empty or missing in Cellular_ATDecodeFields.
+ */
+#define CELLULAR_AT_FIELD_FLAG_OPTIONAL    ( 0x01U )
+
+/**
+ * @brief Maximum number of fields decoded by Cellular_ATDecodeFields.
+ */
+#define CELLULAR_AT_MAX_DECODE_FIELDS      ( 32U )
+
+/**
+ * @brief Remove all leading white spaces in Cellular_ATNormalize.
+ */
+#define CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES     ( 0x01U )
+
+/**
+ * @brief Remove trailing white spaces in Cellular_ATNormalize.
+ */
+#define CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES    ( 0x02U )
+
+/**
+ * @brief Remove all white spaces in Cellular_ATNormalize.
+ */
+#define CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES         ( 0x04U )
+
+/**
+ * @brief Remove outermost double quotes in Cellular_ATNormalize.
+ */
+#define CELLULAR_AT_NORMALIZE_OUTERMOST_DOUBLE_QUOTE   ( 0x08U )
+
+/**
+ * @brief Remove all double quotes in Cellular_ATNormalize.
+ */
+#define CELLULAR_AT_NORMALIZE_ALL_DOUBLE_QUOTE         ( 0x10U )
+
 /*-----------------------------------------------------------*/
 
 /**
@@ -75,6 +110,102 @@ typedef enum CellularATError
     CELLULAR_AT_UNKNOWN        /**< Any other error other than the above mentioned ones. */
 } CellularATError_t;
 
+/**
+ * @brief Token cursor to iterate the fields in an AT response.
+ *
+ * The cursor keeps all the iteration state. It does not modify the AT response
+ * so that different tasks can iterate different responses at the same time.
+ */
+typedef struct CellularATTokenCursor
+{
+    const char * pNext; /**< The start of the next field. */
+    const char * pEnd;  /**< One past the last character of the AT response. */
+    char delimiter;     /**< The field delimiter. */
+    bool done;          /**< All the fields are returned. */
+} CellularATTokenCursor_t;
+
+/**
+ * @brief A field returned by the token cursor.
+ *
+ * The token is not NULL terminated. It points into the AT response.
+ */
+typedef struct CellularATToken
+{
+    const char * pToken;  /**< The start of the field. */
+    uint16_t tokenLength; /**< The length of the field. */
+    bool quoted;          /**< The field is enclosed in double quotes. The quotes are not included in the token. */
+} CellularATToken_t;
+
+/**
+ * @brief Field types decoded by Cellular_ATDecodeFields.
+ */
+typedef enum CellularATFieldType
+{
+    CELLULAR_AT_FIELD_SKIP = 0, /**< The field is not decoded. */
+    CELLULAR_AT_FIELD_INT,      /**< Integer in the base of the field descriptor. */
+    CELLULAR_AT_FIELD_HEX,      /**< Hex string decoded to bytes. */
+    CELLULAR_AT_FIELD_STRING,   /**< String copied with NULL terminator. */
+    CELLULAR_AT_FIELD_BITS      /**< Bit string of '0' and '1', most significant bit first, decoded to an integer. */
+} CellularATFieldType_t;
+
+/**
+ * @brief Field descriptor for Cellular_ATDecodeFields.
+ *
+ * The descriptor at index i describes the i-th comma separated field in the AT
+ * response. The decoded value is written to the destination at offset.
+ */
+typedef struct CellularATFieldDesc
+{
+    CellularATFieldType_t type; /**< The field type. */
+    uint8_t base;               /**< The base of CELLULAR_AT_FIELD_INT field. 2, 8, 10 or 16. The number of bits of CELLULAR_AT_FIELD_BITS field, up to 31. */
+    uint8_t flags;              /**< CELLULAR_AT_FIELD_FLAG_* flags. */
+    uint16_t offset;            /**< The offset of the destination. Use offsetof to set this value. */
+    uint16_t size;              /**< The size of the destination. 1, 2 or 4 for CELLULAR_AT_FIELD_INT and CELLULAR_AT_FIELD_BITS. Buffer size for other types. */
+    int32_t minValue;           /**< The minimum value of CELLULAR_AT_FIELD_INT and CELLULAR_AT_FIELD_BITS field. */
+    int32_t maxValue;           /**< The maximum value of CELLULAR_AT_FIELD_INT and CELLULAR_AT_FIELD_BITS field. */
+} CellularATFieldDesc_t;
+
+/**
+ * @brief Hex decoder state for hex strings split across multiple chunks.
+ *
+ * A byte may be split across two chunks. The high nibble is kept in the
+ * decoder until the next chunk is decoded.
+ */
+typedef struct CellularATHexDecoder
+{
+    uint8_t highNibble; /**< The high nibble of the byte split across chunks. */
+    bool nibblePending; /**< highNibble is waiting for the low nibble. */
+} CellularATHexDecoder_t;
+
+/**
+ * @brief A string view with known length in an AT response.
+ *
+ * The string is not required to be NULL terminated. The Cellular_ATStrView*
+ * functions only access the characters within the length. Functions which modify
+ * the string in place update the length but don't write NULL terminator.
+ */
+typedef struct CellularATStrView
+{
+    char * pStr;     /**< The start of the string. */
+    uint16_t length; /**< The length of the string excluding NULL terminator. */
+} CellularATStrView_t;
+
+/**
+ * @brief AT command builder writing into a caller provided buffer.
+ *
+ * The command is built with the Cellular_ATCmdAppend* functions without printf
+ * style formatting. The command in the buffer is always NULL terminated. The
+ * first error is kept in the builder. Later appends are ignored and the error
+ * is returned by Cellular_ATCmdBuilderFinish.
+ */
+typedef struct CellularATCmdBuilder
+{
+    char * pBuf;              /**< The command buffer. */
+    uint32_t bufSize;         /**< The size of the command buffer including NULL terminator. */
+    uint32_t length;          /**< The length of the command excluding NULL terminator. */
+    CellularATError_t status; /**< The first error of the appends. */
+} CellularATCmdBuilder_t;
+
 /*-----------------------------------------------------------*/
 
 /**
@@ -281,6 +412,79 @@ CellularATError_t Cellular_ATGetSpecificNextTok( char ** ppString,
                                                  const char * pDelimiter,
                                                  char ** ppTokOutput );
 
+/**
+ * @brief Initialize a token cursor to iterate the fields in an AT response.
+ *
+ * The AT response is scanned once by the following Cellular_ATTokenCursorNext
+ * calls. It is not required to be NULL terminated and is not modified. For
+ * example, "1,\"a,b\",,2" has four fields: "1", "a,b", "" and "2".
+ *
+ * @param[out] pCursor The token cursor to initialize.
+ * @param[in] pString The AT response to iterate.
+ * @param[in] stringLength The length of the AT response.
+ * @param[in] delimiter The field delimiter.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATTokenCursorInit( CellularATTokenCursor_t * pCursor,
+                                              const char * pString,
+                                              uint16_t stringLength,
+                                              char delimiter );
+
+/**
+ * @brief Get the next field from a token cursor.
+ *
+ * Delimiters between double quotes do not split fields. Empty fields, including
+ * an empty field after a trailing delimiter, are returned with zero length.
+ *
+ * @param[in,out] pCursor The token cursor initialized by Cellular_ATTokenCursorInit.
+ * @param[out] pToken The next field in the AT response.
+ *
+ * @return CELLULAR_AT_SUCCESS if a field is returned. CELLULAR_AT_ERROR if there
+ * is no more field. CELLULAR_AT_BAD_PARAMETER if the parameters are invalid or
+ * the field has an unterminated double quote.
+ */
+CellularATError_t Cellular_ATTokenCursorNext( CellularATTokenCursor_t * pCursor,
+                                              CellularATToken_t * pToken );
+
+/**
+ * @brief Decode the comma separated fields in an AT response with field descriptors.
+ *
+ * The AT response is scanned once. Whitespaces and double quotes around each field
+ * are removed. Each field is converted and range checked according to its
+ * descriptor and written to pDest only if it is valid. Fields after the last
+ * descriptor are ignored. For example, "+CEDRXS: 4,\"0010\"" after prefix removal
+ * can be decoded with the following descriptors.
+ *
+ * @code{c}
+ * static const CellularATFieldDesc_t eidrxFields[] =
+ * {
+ *     { CELLULAR_AT_FIELD_INT, 10, 0, offsetof( CellularEidrxSettings_t, rat ), 1, 0, UINT8_MAX },
+ *     { CELLULAR_AT_FIELD_INT, 2, 0, offsetof( CellularEidrxSettings_t, requestedEdrxValue ), 1, 0, UINT8_MAX }
+ * };
+ * @endcode
+ *
+ * @param[in] pString The AT response without prefix. It is not required to be
+ * NULL terminated and is not modified.
+ * @param[in] stringLength The length of the AT response.
+ * @param[in] pFields The field descriptors.
+ * @param[in] fieldCount The number of field descriptors. Up to CELLULAR_AT_MAX_DECODE_FIELDS.
+ * @param[out] pDest The destination structure of the decoded fields.
+ * @param[out] pDecodedFields Bitfield of the decoded fields. Bit i is set if the
+ * i-th field is written to pDest. Can be NULL.
+ *
+ * @return CELLULAR_AT_SUCCESS if all the fields are decoded or skipped.
+ * CELLULAR_AT_ERROR if any field is invalid or missing. The other fields are
+ * still decoded. Otherwise an error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATDecodeFields( const char * pString,
+                                           uint16_t stringLength,
+                                           const CellularATFieldDesc_t * pFields,
+                                           uint8_t fieldCount,
+                                           void * pDest,
+                                           uint32_t * pDecodedFields );
+
 /**
  * @brief Convert HEX string to HEX.
  *
@@ -315,6 +519,89 @@ CellularATError_t Cellular_ATHexStrToHex( const char * pString,
                                           uint8_t * pHexData,
                                           uint16_t hexDataLen );
 
+/**
+ * @brief Strictly convert a hex string to bytes.
+ *
+ * The hex string doesn't need to be NULL terminated. Every character must be
+ * a hex digit and the length must be even.
+ *
+ * @param[in] pHexStr The hex string to convert.
+ * @param[in] hexStrLength The length of the hex string.
+ * @param[out] pData The buffer to return the converted bytes into.
+ * @param[in] dataLength The length of the buffer.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful. CELLULAR_AT_ERROR
+ * if the length is odd or there is a character which is not a hex digit. The
+ * content of pData is undefined in this case. Otherwise an error code indicating
+ * the cause of the error.
+ */
+CellularATError_t Cellular_ATHexDecode( const char * pHexStr,
+                                        uint16_t hexStrLength,
+                                        uint8_t * pData,
+                                        uint16_t dataLength );
+
+/**
+ * @brief Initialize a hex decoder for Cellular_ATHexDecodeChunk.
+ *
+ * @param[out] pDecoder The hex decoder to initialize.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATHexDecoderInit( CellularATHexDecoder_t * pDecoder );
+
+/**
+ * @brief Convert a chunk of a hex string to bytes.
+ *
+ * The hex string may be split at any character, for example by the size of
+ * the pktio read buffer. A byte split across two chunks is written when the
+ * next chunk is decoded.
+ *
+ * @param[in,out] pDecoder The hex decoder initialized by Cellular_ATHexDecoderInit.
+ * @param[in] pChunk The chunk of the hex string.
+ * @param[in] chunkLength The length of the chunk.
+ * @param[out] pData The buffer to return the converted bytes into.
+ * @param[in] dataLength The length of the buffer. ( chunkLength + 1 ) / 2 is enough.
+ * @param[out] pDataDecoded The number of bytes written to pData.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful. CELLULAR_AT_ERROR
+ * if there is a character which is not a hex digit. The decoder must be initialized
+ * again in this case. Otherwise an error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATHexDecodeChunk( CellularATHexDecoder_t * pDecoder,
+                                             const char * pChunk,
+                                             uint16_t chunkLength,
+                                             uint8_t * pData,
+                                             uint16_t dataLength,
+                                             uint16_t * pDataDecoded );
+
+/**
+ * @brief Check that the whole hex string is decoded by the hex decoder.
+ *
+ * @param[in] pDecoder The hex decoder.
+ *
+ * @return CELLULAR_AT_SUCCESS if all the bytes are decoded. CELLULAR_AT_ERROR
+ * if the hex string has odd length. Otherwise an error code indicating the cause
+ * of the error.
+ */
+CellularATError_t Cellular_ATHexDecoderFinish( const CellularATHexDecoder_t * pDecoder );
+
+/**
+ * @brief Convert bytes to an upper case hex string.
+ *
+ * @param[in] pData The bytes to convert.
+ * @param[in] dataLength The number of bytes to convert.
+ * @param[out] pHexStr The buffer to return the NULL terminated hex string into.
+ * @param[in] hexStrLength The length of the buffer. Must be larger than dataLength * 2.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATHexEncode( const uint8_t * pData,
+                                        uint16_t dataLength,
+                                        char * pHexStr,
+                                        uint16_t hexStrLength );
+
 /**
  * @brief Check if a string is numeric.
  *
@@ -350,6 +637,9 @@ CellularATError_t Cellular_ATIsPrefixPresent( const char * pString,
  * @param[in] pSrc: input string to be copied
  * @param[out] ppDst: destination pointer
  *
+ * @note The duplicated string is allocated with _Cellular_Malloc and should be
+ * freed with _Cellular_Free.
+ *
  * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
  * error code indicating the cause of the error.
  */
@@ -390,17 +680,402 @@ CellularATError_t Cellular_ATcheckErrorCode( const char * pInputBuf,
  * @brief Convert string to int32_t.
  *
  * @param[in] pStr: the input string buffer.
- * @param[in] base: Numerical base (radix) of pStr.
+ * @param[in] base: Numerical base (radix) of pStr. Base 2 to 16 are supported.
  * Input string should not contain leading space or zero.
  * @param[out] pResult: converted int32_t result.
  *  *
  * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
- * error code indicating the cause of the error.
+ * error code indicating the cause of the error. CELLULAR_AT_ERROR is returned
+ * if there is no digit or the value is out of the range of int32_t.
  */
 CellularATError_t Cellular_ATStrtoi( const char * pStr,
                                      int32_t base,
                                      int32_t * pResult );
 
+/**
+ * @brief Decode a decimal number with optional sign from a string buffer.
+ *
+ * The string doesn't need to be NULL terminated. Decoding stops at the first
+ * character which is not a digit.
+ *
+ * @param[in] pStr: the input string buffer.
+ * @param[in] strLength: the length of the input string buffer.
+ * @param[out] pResult: the decoded int32_t value.
+ * @param[out] pConsumed: the number of characters decoded. Can be NULL.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful. CELLULAR_AT_ERROR
+ * if there is no digit or the value is out of the range of int32_t. Otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATDecodeDec( const char * pStr,
+                                        uint16_t strLength,
+                                        int32_t * pResult,
+                                        uint16_t * pConsumed );
+
+/**
+ * @brief Decode a hexadecimal number from a string buffer.
+ *
+ * The string doesn't need to be NULL terminated. Decoding stops at the first
+ * character which is not a hexadecimal digit. Prefix "0x" is not supported.
+ *
+ * @param[in] pStr: the input string buffer.
+ * @param[in] strLength: the length of the input string buffer.
+ * @param[out] pResult: the decoded uint32_t value.
+ * @param[out] pConsumed: the number of characters decoded. Can be NULL.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful. CELLULAR_AT_ERROR
+ * if there is no digit or the value is out of the range of uint32_t. Otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATDecodeHex( const char * pStr,
+                                        uint16_t strLength,
+                                        uint32_t * pResult,
+                                        uint16_t * pConsumed );
+
+/**
+ * @brief Decode a binary number from a string buffer.
+ *
+ * The string doesn't need to be NULL terminated. Decoding stops at the first
+ * character which is not '0' or '1'.
+ *
+ * @param[in] pStr: the input string buffer.
+ * @param[in] strLength: the length of the input string buffer.
+ * @param[out] pResult: the decoded uint32_t value.
+ * @param[out] pConsumed: the number of characters decoded. Can be NULL.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful. CELLULAR_AT_ERROR
+ * if there is no digit or the value is out of the range of uint32_t. Otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATDecodeBin( const char * pStr,
+                                        uint16_t strLength,
+                                        uint32_t * pResult,
+                                        uint16_t * pConsumed );
+
+/**
+ * @brief Initialize a string view with a string buffer and length.
+ *
+ * @param[out] pView The string view to initialize.
+ * @param[in] pStr The string buffer. It doesn't need to be NULL terminated.
+ * @param[in] strLength The length of the string. Must not be larger than
+ * CELLULAR_AT_MAX_STRING_SIZE.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewInit( CellularATStrView_t * pView,
+                                          char * pStr,
+                                          uint16_t strLength );
+
+/**
+ * @brief Check if a string view has prefix by determine present of ':'.
+ *
+ * String view version of Cellular_ATIsPrefixPresent.
+ *
+ * @param[in] pView The input string view.
+ * @param[out] pResult Return true if the string has prefix, else false.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewIsPrefixPresent( const CellularATStrView_t * pView,
+                                                     bool * pResult );
+
+/**
+ * @brief Check if a string view starts with certain prefix.
+ *
+ * String view version of Cellular_ATStrStartWith.
+ *
+ * @param[in] pView The input string view.
+ * @param[in] pPrefix The NULL terminated prefix.
+ * @param[out] pResult Return true if prefix is at start of the string, else false.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewStartWith( const CellularATStrView_t * pView,
+                                               const char * pPrefix,
+                                               bool * pResult );
+
+/**
+ * @brief Check if any key in the key list is at the start of a string view.
+ *
+ * String view version of Cellular_ATcheckErrorCode.
+ *
+ * @param[in] pView The input string view.
+ * @param[in] ppKeyList List of NULL terminated keys.
+ * @param[in] keyListLen Size of the key list.
+ * @param[out] pResult Return true if any key is at the start of the string, else false.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewCheckErrorCode( const CellularATStrView_t * pView,
+                                                    const char * const * const ppKeyList,
+                                                    size_t keyListLen,
+                                                    bool * pResult );
+
+/**
+ * @brief Check if all the characters in a string view are digits.
+ *
+ * String view version of Cellular_ATIsStrDigit.
+ *
+ * @param[in] pView The input string view.
+ * @param[out] pResult Return true if the string is numeric, else false.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewIsStrDigit( const CellularATStrView_t * pView,
+                                                bool * pResult );
+
+/**
+ * @brief Remove prefix and the colon from a string view.
+ *
+ * String view version of Cellular_ATRemovePrefix.
+ *
+ * @param[in,out] pView The string view to update.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewRemovePrefix( CellularATStrView_t * pView );
+
+/**
+ * @brief Remove all leading white spaces from a string view.
+ *
+ * String view version of Cellular_ATRemoveLeadingWhiteSpaces.
+ *
+ * @param[in,out] pView The string view to update.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewRemoveLeadingWhiteSpaces( CellularATStrView_t * pView );
+
+/**
+ * @brief Remove all trailing white spaces from a string view.
+ *
+ * String view version of Cellular_ATRemoveTrailingWhiteSpaces. The string is
+ * not changed if its length is not greater than 2.
+ *
+ * @param[in,out] pView The string view to update.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewRemoveTrailingWhiteSpaces( CellularATStrView_t * pView );
+
+/**
+ * @brief Remove all white spaces from a string view in place.
+ *
+ * String view version of Cellular_ATRemoveAllWhiteSpaces.
+ *
+ * @param[in,out] pView The string view to update.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewRemoveAllWhiteSpaces( CellularATStrView_t * pView );
+
+/**
+ * @brief Remove outermost double quotes from a string view.
+ *
+ * String view version of Cellular_ATRemoveOutermostDoubleQuote. The string is
+ * not changed if its length is not greater than 2.
+ *
+ * @param[in,out] pView The string view to update.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewRemoveOutermostDoubleQuote( CellularATStrView_t * pView );
+
+/**
+ * @brief Remove all double quotes from a string view in place.
+ *
+ * String view version of Cellular_ATRemoveAllDoubleQuote.
+ *
+ * @param[in,out] pView The string view to update.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewRemoveAllDoubleQuote( CellularATStrView_t * pView );
+
+/**
+ * @brief Extract the next token based on comma (',') as delimiter.
+ *
+ * String view version of Cellular_ATGetNextTok.
+ *
+ * @param[in,out] pView The string view. It is updated to the string after the
+ * delimiter.
+ * @param[out] pToken The token. The delimiter is not replaced by NULL terminator.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewGetNextTok( CellularATStrView_t * pView,
+                                                CellularATStrView_t * pToken );
+
+/**
+ * @brief Extract the next token based on the provided delimiter.
+ *
+ * String view version of Cellular_ATGetSpecificNextTok.
+ *
+ * @param[in,out] pView The string view. It is updated to the string after the
+ * delimiter.
+ * @param[in] pDelimiter The NULL terminated delimiters.
+ * @param[out] pToken The token. The delimiter is not replaced by NULL terminator.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewGetSpecificNextTok( CellularATStrView_t * pView,
+                                                        const char * pDelimiter,
+                                                        CellularATStrView_t * pToken );
+
+/**
+ * @brief Remove white spaces and double quotes from a string view in one pass.
+ *
+ * String view version of Cellular_ATNormalize.
+ *
+ * @param[in,out] pView The string view to update.
+ * @param[in] flags CELLULAR_AT_NORMALIZE_* flags.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATStrViewNormalize( CellularATStrView_t * pView,
+                                               uint8_t flags );
+
+/**
+ * @brief Remove white spaces and double quotes from an AT response in one pass.
+ *
+ * The result is the same as calling the following functions in order for the
+ * flags set, but the string is validated and scanned only once.
+ * - CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES: Cellular_ATRemoveLeadingWhiteSpaces
+ * - CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES: Cellular_ATRemoveTrailingWhiteSpaces
+ * - CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES: Cellular_ATRemoveAllWhiteSpaces
+ * - CELLULAR_AT_NORMALIZE_OUTERMOST_DOUBLE_QUOTE: Cellular_ATRemoveOutermostDoubleQuote
+ * - CELLULAR_AT_NORMALIZE_ALL_DOUBLE_QUOTE: Cellular_ATRemoveAllDoubleQuote
+ *
+ * The string may become empty. It is not an error.
+ *
+ * @param[in,out] ppString The AT response to normalize in place. The pointer
+ * is moved past the removed leading characters.
+ * @param[in] flags CELLULAR_AT_NORMALIZE_* flags.
+ * @param[out] pLength The length of the normalized string. Can be NULL.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATNormalize( char ** ppString,
+                                        uint8_t flags,
+                                        uint16_t * pLength );
+
+/**
+ * @brief Initialize an AT command builder with an empty command.
+ *
+ * @param[out] pBuilder The builder to initialize.
+ * @param[in] pBuf The buffer to build the command into.
+ * @param[in] bufSize The size of the buffer including NULL terminator.
+ *
+ * @return CELLULAR_AT_SUCCESS if the operation is successful, otherwise an
+ * error code indicating the cause of the error.
+ */
+CellularATError_t Cellular_ATCmdBuilderInit( CellularATCmdBuilder_t * pBuilder,
+                                             char * pBuf,
+                                             uint32_t bufSize );
+
+/**
+ * @brief Append a string to the AT command.
+ *
+ * @param[in,out] pBuilder The builder initialized by Cellular_ATCmdBuilderInit.
+ * @param[in] pString The NULL terminated string to append.
+ *
+ * @return The status of the builder after the append.
+ */
+CellularATError_t Cellular_ATCmdAppendStr( CellularATCmdBuilder_t * pBuilder,
+                                           const char * pString );
+
+/**
+ * @brief Append a string enclosed in double quotes to the AT command.
+ *
+ * The string is not escaped.
+ *
+ * @param[in,out] pBuilder The builder initialized by Cellular_ATCmdBuilderInit.
+ * @param[in] pString The NULL terminated string to append.
+ *
+ * @return The status of the builder after the append.
+ */
+CellularATError_t Cellular_ATCmdAppendQuotedStr( CellularATCmdBuilder_t * pBuilder,
+                                                 const char * pString );
+
+/**
+ * @brief Append a character to the AT command.
+ *
+ * @param[in,out] pBuilder The builder initialized by Cellular_ATCmdBuilderInit.
+ * @param[in] c The character to append. Must not be NULL character.
+ *
+ * @return The status of the builder after the append.
+ */
+CellularATError_t Cellular_ATCmdAppendChar( CellularATCmdBuilder_t * pBuilder,
+                                            char c );
+
+/**
+ * @brief Append an unsigned integer in decimal to the AT command.
+ *
+ * @param[in,out] pBuilder The builder initialized by Cellular_ATCmdBuilderInit.
+ * @param[in] value The value to append.
+ *
+ * @return The status of the builder after the append.
+ */
+CellularATError_t Cellular_ATCmdAppendUint( CellularATCmdBuilder_t * pBuilder,
+                                            uint32_t value );
+
+/**
+ * @brief Append the lowest bits of a value as a binary pattern to the AT command.
+ *
+ * The most significant bit is appended first. For example, value 5 with
+ * bitCount 4 is appended as "0101".
+ *
+ * @param[in,out] pBuilder The builder initialized by Cellular_ATCmdBuilderInit.
+ * @param[in] value The value to append.
+ * @param[in] bitCount The number of bits to append. 1 to 32.
+ *
+ * @return The status of the builder after the append.
+ */
+CellularATError_t Cellular_ATCmdAppendBinary( CellularATCmdBuilder_t * pBuilder,
+                                              uint32_t value,
+                                              uint8_t bitCount );
+
+/**
+ * @brief Append bytes as an upper case hex string to the AT command.
+ *
+ * @param[in,out] pBuilder The builder initialized by Cellular_ATCmdBuilderInit.
+ * @param[in] pData The bytes to append.
+ * @param[in] dataLength The number of bytes to append.
+ *
+ * @return The status of the builder after the append.
+ */
+CellularATError_t Cellular_ATCmdAppendHex( CellularATCmdBuilder_t * pBuilder,
+                                           const uint8_t * pData,
+                                           uint16_t dataLength );
+
+/**
+ * @brief Get the status and the length of the AT command.
+ *
+ * @param[in] pBuilder The builder initialized by Cellular_ATCmdBuilderInit.
+ * @param[out] pLength The length of the command excluding NULL terminator. Can be NULL.
+ *
+ * @return CELLULAR_AT_SUCCESS if all the appends are successful. CELLULAR_AT_NO_MEMORY
+ * if the command doesn't fit in the buffer. Otherwise an error code indicating
+ * the cause of the error.
+ */
+CellularATError_t Cellular_ATCmdBuilderFinish( const CellularATCmdBuilder_t * pBuilder,
+                                               uint32_t * pLength );
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
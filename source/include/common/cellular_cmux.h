@@ -0,0 +1,112 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @file cellular_cmux.h
+ */
+
+#ifndef __CELLULAR_CMUX_H__
+#define __CELLULAR_CMUX_H__
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Cellular includes. */
+#include "cellular_types.h"
+#include "cellular_comm_interface.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The maximum number of CMUX channels supported by the multiplexer.
+ *
+ * Channel n is mapped to DLCI n. DLCI 0 is the multiplexer control channel and
+ * is managed internally.
+ */
+#define CELLULAR_CMUX_MAX_SUPPORTED_CHANNELS    ( 4U )
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize the 3GPP TS 27.010 basic mode multiplexer.
+ *
+ * The modem should already be switched to multiplexer mode with AT+CMUX on
+ * pCommInterface before any channel is opened. The comm interface of each
+ * channel can be obtained with Cellular_CmuxGetChannel. The physical comm
+ * interface is opened with the first channel and closed with the last channel.
+ * Only one multiplexer instance is supported.
+ *
+ * @param[in] pCommInterface The comm interface of the physical link to the modem.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t Cellular_CmuxInit( const CellularCommInterface_t * pCommInterface );
+
+/**
+ * @brief Get the comm interface of a CMUX channel.
+ *
+ * The channel is established with SABM when the returned comm interface is
+ * opened and released with DISC when it is closed. The returned comm interface
+ * can be passed to Cellular_Init or used directly by another consumer.
+ *
+ * The receive callback of the channel is only called from the receive callback
+ * of the physical comm interface, in the same context. A recv on the channel
+ * waits for the recv of another channel on the physical link to complete. The
+ * modem is asked to stop sending on the DLCI with an MSC when the receive buffer
+ * of the channel can't take another frame.
+ *
+ * @param[in] dlci The DLCI of the channel, from 1 to CELLULAR_CONFIG_CMUX_MAX_CHANNELS.
+ * @param[out] ppChannelCommInterface The comm interface of the channel.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t Cellular_CmuxGetChannel( uint8_t dlci,
+                                         const CellularCommInterface_t ** ppChannelCommInterface );
+
+/**
+ * @brief Deinitialize the multiplexer.
+ *
+ * The comm interfaces of all the channels should be closed before calling this
+ * function.
+ */
+void Cellular_CmuxDeinit( void );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* __CELLULAR_CMUX_H__ */
@@ -0,0 +1,184 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @file cellular_comm_capture.h
+ */
+
+#ifndef __CELLULAR_COMM_CAPTURE_H__
+#define __CELLULAR_COMM_CAPTURE_H__
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Cellular includes. */
+#include "cellular_types.h"
+#include "cellular_comm_interface.h"
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Magic of the capture dump produced by Cellular_CommCaptureDump.
+ */
+#define CELLULAR_COMM_CAPTURE_MAGIC    "CCAP"
+
+/**
+ * @brief Version of the capture dump format.
+ */
+#define CELLULAR_COMM_CAPTURE_VERSION    ( 1U )
+
+/**
+ * @brief Size of the capture dump file header.
+ *
+ * The file header is the 4 bytes magic, 1 byte version and 3 reserved bytes.
+ */
+#define CELLULAR_COMM_CAPTURE_FILE_HDR_SIZE    ( 8U )
+
+/**
+ * @brief Size of the capture record header.
+ *
+ * Each record is 1 byte record type, 4 bytes little endian timestamp in
+ * milliseconds, 2 bytes little endian payload length followed by the payload.
+ */
+#define CELLULAR_COMM_CAPTURE_REC_HDR_SIZE    ( 7U )
+
+/**
+ * @brief Record type flag to indicate the payload is truncated.
+ */
+#define CELLULAR_COMM_CAPTURE_FLAG_TRUNCATED    ( 0x80U )
+
+/**
+ * @ingroup cellular_datatypes_enums
+ * @brief Capture record types.
+ */
+typedef enum CellularCommCaptureRecordType
+{
+    CELLULAR_COMM_CAPTURE_RECORD_SEND = 0, /**<  Data sent to the modem. */
+    CELLULAR_COMM_CAPTURE_RECORD_RECV,     /**<  Data received from the modem. */
+    CELLULAR_COMM_CAPTURE_RECORD_OPEN,     /**<  Comm interface opened. No payload. */
+    CELLULAR_COMM_CAPTURE_RECORD_CLOSE     /**<  Comm interface closed. No payload. */
+} CellularCommCaptureRecordType_t;
+
+/**
+ * @ingroup cellular_datatypes_functionpointers
+ * @brief Capture sink called for each record.
+ *
+ * The sink is called in the context of the comm interface send or recv. It
+ * should not block for a long time.
+ *
+ * @param[in] pRecordHeader The record header of CELLULAR_COMM_CAPTURE_REC_HDR_SIZE bytes.
+ * @param[in] pPayload The record payload.
+ * @param[in] payloadLength The length of the record payload.
+ * @param[in] pSinkContext pSinkContext parameter in Cellular_CommCaptureInit.
+ */
+typedef void ( * CellularCommCaptureSink_t )( const uint8_t * pRecordHeader,
+                                              const uint8_t * pPayload,
+                                              uint16_t payloadLength,
+                                              void * pSinkContext );
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Capture recorder configuration.
+ */
+typedef struct CellularCommCaptureConfig
+{
+    const CellularCommInterface_t * pCommInterface; /**<  The comm interface to be captured. */
+    uint8_t * pRingBuffer;                          /**<  RAM ring to keep the latest records. NULL if not used. */
+    uint32_t ringBufferSize;                        /**<  The size of pRingBuffer. */
+    CellularCommCaptureSink_t sink;                 /**<  User sink called for each record. NULL if not used. */
+    void * pSinkContext;                            /**<  The context passed to sink. */
+} CellularCommCaptureConfig_t;
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Initialize the comm interface capture recorder.
+ *
+ * The returned comm interface wraps pConfig->pCommInterface and records every
+ * chunk sent and received. It should be passed to Cellular_Init in place of
+ * the original comm interface. Only one recorder instance is supported.
+ *
+ * @param[in] pConfig The capture recorder configuration.
+ * @param[out] ppCaptureCommInterface The comm interface to use with Cellular_Init.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t Cellular_CommCaptureInit( const CellularCommCaptureConfig_t * pConfig,
+                                          const CellularCommInterface_t ** ppCaptureCommInterface );
+
+/**
+ * @brief Deinitialize the comm interface capture recorder.
+ *
+ * The comm interface returned by Cellular_CommCaptureInit should be closed
+ * before calling this function.
+ */
+void Cellular_CommCaptureDeinit( void );
+
+/**
+ * @brief Enable or disable recording.
+ *
+ * @param[in] enable Recording is enabled if true. Enabled after init.
+ */
+void Cellular_CommCaptureEnable( bool enable );
+
+/**
+ * @brief Dump the records in the RAM ring, oldest first.
+ *
+ * The dump starts with the file header and can be decoded with the host side
+ * tool tools/comm_capture/cellular_capture_decode.py. Records that don't fit
+ * in pBuffer are not copied.
+ *
+ * @param[out] pBuffer The buffer to copy the dump to.
+ * @param[in] bufferLength The length of pBuffer.
+ * @param[out] pDumpLength The length of the dump copied to pBuffer.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t Cellular_CommCaptureDump( uint8_t * pBuffer,
+                                          uint32_t bufferLength,
+                                          uint32_t * pDumpLength );
+
+/**
+ * @brief Discard the records in the RAM ring.
+ */
+void Cellular_CommCaptureClear( void );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* __CELLULAR_COMM_CAPTURE_H__ */
@@ -54,6 +54,11 @@
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Modem socket ID of a socket not bound to a modem socket.
+ */
+#define CELLULAR_INVALID_MODEM_SOCKET_ID    ( 0xFFFFFFFFUL )
+
 /**
  * @ingroup cellular_datatypes_paramstructs
  * @brief The AT command request structure.
@@ -74,14 +79,18 @@ typedef struct CellularAtReq
  */
 typedef struct CellularAtDataReq
 {
-    const uint8_t * pData;       /**< Data to send. */
-    uint32_t dataLen;            /**< Data length to send. */
-    uint32_t * pSentDataLength;  /**< Data actually sent. */
-    const uint8_t * pEndPattern; /**< End pattern after pData is sent completely.
-                                  * Set NULL if not required. Cellular modem uses
-                                  * end pattern instead of length in AT command
-                                  * can make use of this variable. */
-    uint32_t endPatternLen;      /**< End pattern length. */
+    const uint8_t * pData;                   /**< Data to send. */
+    uint32_t dataLen;                        /**< Data length to send. */
+    uint32_t * pSentDataLength;              /**< Data actually sent. */
+    const uint8_t * pEndPattern;             /**< End pattern after pData is sent completely.
+                                              * Set NULL if not required. Cellular modem uses
+                                              * end pattern instead of length in AT command
+                                              * can make use of this variable. */
+    uint32_t endPatternLen;                  /**< End pattern length. */
+    const CellularDataSegment_t * pSegments; /**< Segments to send instead of pData. Set NULL
+                                              * to send pData. dataLen is the total length
+                                              * of the segments. */
+    uint32_t segmentCount;                   /**< Number of segments in pSegments. */
 } CellularAtDataReq_t;
 
 /**
@@ -115,6 +124,34 @@ typedef enum CellularSocketState
     SOCKETSTATE_DISCONNECTED   /**< Socket is disconnected by remote peer or due to network error. */
 } CellularSocketState_t;
 
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Receive prefetch ring buffer of a socket.
+ */
+typedef struct CellularSocketRecvPrefetch
+{
+    uint8_t * pBuffer;     /**< Ring buffer set with CELLULAR_SOCKET_OPTION_RECV_PREFETCH. NULL if not set. */
+    uint32_t bufferLength; /**< The length of pBuffer. */
+    uint32_t readIndex;    /**< Index of the first buffered byte. */
+    uint32_t dataLength;          /**< Number of buffered bytes. */
+    bool dataReady;               /**< The modem informed data ready after the last modem read. */
+    CellularError_t pendingError; /**< Modem read error returned by the next _Cellular_SocketRecvPrefetch call. */
+} CellularSocketRecvPrefetch_t;
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Send coalescing buffer of a socket.
+ */
+typedef struct CellularSocketSendCoalesce
+{
+    uint8_t * pBuffer;            /**< Buffer set with CELLULAR_SOCKET_OPTION_SEND_COALESCE. NULL if not set. */
+    uint32_t bufferLength;        /**< The length of pBuffer. */
+    uint32_t dataLength;          /**< Number of buffered bytes. */
+    uint32_t flushDelayMs;        /**< Maximum time to hold buffered data. 0 to flush by size only. */
+    uint32_t firstDataTimeMs;     /**< CELLULAR_CONFIG_GET_TIME_MS when the first buffered byte is written. */
+    CellularError_t pendingError; /**< Modem send error returned by the next _Cellular_SocketSendCoalesce call. */
+} CellularSocketSendCoalesce_t;
+
 /**
  * @ingroup cellular_datatypes_paramstructs
  * @brief Parameters involved in sending/receiving data through sockets.
@@ -123,6 +160,7 @@ typedef struct CellularSocketContext
 {
     uint8_t contextId;                       /**< PDN context ID on which this socket exists. */
     uint32_t socketId;                       /**< Socket ID of this socket. */
+    uint32_t modemSocketId;                  /**< Socket or connect ID used by the modem. */
     CellularSocketState_t socketState;       /**< State of the socket, Allocated, Free etc. */
     CellularSocketType_t socketType;         /**< Type of socket, DGRAM or STREAM. */
     CellularSocketDomain_t socketDomain;     /**< Socket domain, IPV4 or V6. */
@@ -135,6 +173,22 @@ typedef struct CellularSocketContext
     uint32_t sendTimeoutMs; /**< Send timeout value in milliseconds. */
     uint32_t recvTimeoutMs; /**< Receive timeout value in milliseconds. */
 
+    /* Receive prefetch buffer. */
+    CellularSocketRecvPrefetch_t recvPrefetch; /**< Data read from the modem and not yet received. */
+
+    /* Send coalescing buffer. */
+    CellularSocketSendCoalesce_t sendCoalesce; /**< Data written by the application and not yet sent. */
+
+    /* Readiness events. */
+    uint8_t pollEvents; /**< CELLULAR_SOCKET_POLL_* events not yet reported by Cellular_SocketPoll. */
+
+    #if ( CELLULAR_CONFIG_SOCKET_STATS == 1 )
+        /* Traffic and latency statistics. */
+        CellularSocketStats_t stats; /**< Statistics reported by Cellular_SocketGetStats. */
+        uint32_t dataReadyTimeMs;    /**< Time of the first data ready URC not yet received by the application. */
+        bool dataReadyPending;       /**< dataReadyTimeMs is valid. */
+    #endif
+
     /* Set during socket connect. */
     CellularSocketAddress_t remoteSocketAddress; /**< Remote IP address and port. */
 
@@ -150,6 +204,49 @@ typedef struct CellularSocketContext
     void * pModemData; /**< Modem specific data. */
 } CellularSocketContext_t;
 
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Socket table of a cellular context provided by the caller.
+ *
+ * The memory must be valid until Cellular_Cleanup returns.
+ */
+typedef struct CellularSocketTable
+{
+    CellularSocketContext_t ** pSocketData; /**< Socket table with numSockets entries. */
+    CellularSocketContext_t * pSocketSlab;  /**< Socket contexts with numSockets entries. NULL to allocate the socket
+                                             * contexts with _Cellular_Malloc when the sockets are created. */
+    uint8_t numSockets;                     /**< Maximum number of sockets of the cellular context. */
+} CellularSocketTable_t;
+
+/**
+ * @brief Token class bits in #CellularTokenLookup_t.pFirstByteClass.
+ *
+ * A bit is set for a first byte if any token of the class starts with the byte.
+ * The extra success token table is set for each AT command and has no class.
+ */
+#define CELLULAR_TOKEN_CLASS_SUCCESS          ( 0x01U )
+#define CELLULAR_TOKEN_CLASS_ERROR            ( 0x02U )
+#define CELLULAR_TOKEN_CLASS_URC_WO_PREFIX    ( 0x04U )
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Precomputed lookup data for the token tables.
+ *
+ * The lookup is generated by tools/token_table/cellular_token_table_gen.py
+ * together with the token tables. The URC handler table is indexed with a
+ * seeded FNV-1a hash of the URC token. The hash has no collision in the
+ * slot table.
+ */
+typedef struct CellularTokenLookup
+{
+    uint32_t urcHashSeed;             /**< Seed XORed into the FNV-1a offset basis. */
+    uint32_t urcHashSlotMask;         /**< Slot table size minus one. The size is a power of two. */
+    const uint16_t * pUrcHashSlots;   /**< URC handler table index plus one for each slot. 0 for empty slot. */
+    const uint32_t * pUrcTokenHash;   /**< Hash of each URC token in the URC handler table. */
+    const uint16_t * pUrcTokenLength; /**< Length of each URC token in the URC handler table. */
+    const uint8_t * pFirstByteClass;  /**< 256 entries of CELLULAR_TOKEN_CLASS bits indexed by the first byte of a line. */
+} CellularTokenLookup_t;
+
 /**
  * @ingroup cellular_datatypes_paramstructs
  * @brief Parameters to setup pktio and pkthandler token tables.
@@ -173,6 +270,9 @@ typedef struct CellularTokenTable
     /* Extra success token for specific AT command. */
     const char ** pCellularSrcExtraTokenSuccessTable; /**< Extra token success table. */
     uint32_t cellularSrcExtraTokenSuccessTableSize;   /**< Extra token success table size. */
+
+    /* Generated lookup for the tables above. NULL to search the tables. */
+    const CellularTokenLookup_t * pTokenLookup; /**< Precomputed token lookup. */
 } CellularTokenTable_t;
 
 /**
@@ -210,6 +310,21 @@ typedef CellularPktStatus_t ( * CellularATCommandDataSendPrefixCallback_t ) ( vo
                                                                               char * pLine,
                                                                               uint32_t * pBytesRead );
 
+/**
+ * @ingroup cellular_common_datatypes_functionpointers
+ * @brief Callback used to prepare the AT command of a data chunk in bulk data send.
+ *
+ * @param[in] pCallbackContext The pCallbackContext passed to _Cellular_AtcmdDataSendBulk.
+ * @param[in] chunkLength The length of the data chunk to be sent after the AT command.
+ * @param[out] pAtReq The AT command request to send before the data chunk.
+ *
+ * @return CELLULAR_PKT_STATUS_OK if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+typedef CellularPktStatus_t ( * CellularATCommandDataSendChunkCallback_t ) ( void * pCallbackContext,
+                                                                               uint32_t chunkLength,
+                                                                               CellularAtReq_t * pAtReq );
+
 /**
  * @ingroup cellular_common_datatypes_functionpointers
  * @brief Undefined response callback function.
@@ -242,6 +357,83 @@ typedef CellularPktStatus_t ( * CellularInputBufferCallback_t ) ( void * pInputB
                                                                   uint32_t bufferLength,
                                                                   uint32_t * pBufferLengthHandled );
 
+/**
+ * @ingroup cellular_common_datatypes_enums
+ * @brief Packet IO read buffer events.
+ */
+typedef enum CellularPktioBufferEvent
+{
+    CELLULAR_PKTIO_BUFFER_EVENT_HIGH_WATER_MARK = 0, /**< The read buffer occupancy reaches a new high-water mark. */
+    CELLULAR_PKTIO_BUFFER_EVENT_OVERFLOW,            /**< The read buffer is full and the buffered data is discarded. */
+    CELLULAR_PKTIO_BUFFER_EVENT_RESYNC               /**< Unexpected data is received and the read buffer is cleaned. */
+} CellularPktioBufferEvent_t;
+
+/**
+ * @ingroup cellular_datatypes_paramstructs
+ * @brief Packet IO read buffer statistics.
+ */
+typedef struct CellularPktioBufferStats
+{
+    uint32_t bufferSize;    /**< The size of the read buffer. CELLULAR_CONFIG_PKTIO_READ_BUFFER_SIZE. */
+    uint32_t highWaterMark; /**< The maximum number of bytes buffered in the read buffer. */
+    uint32_t overflowCount; /**< Number of times the read buffer is full and data is discarded. */
+    uint32_t resyncCount;   /**< Number of times the read buffer is cleaned due to unexpected data. */
+    uint32_t bytesDropped;  /**< Total bytes discarded by overflow and resync events. */
+} CellularPktioBufferStats_t;
+
+/**
+ * @ingroup cellular_common_datatypes_functionpointers
+ * @brief Callback used to inform packet IO read buffer events.
+ *
+ * This callback is called in the packet IO thread. It should not block or send
+ * AT commands.
+ *
+ * @param[in] pCallbackContext The pCallbackContext in _Cellular_RegisterPktioBufferCallback.
+ * @param[in] event The read buffer event.
+ * @param[in] pStats The read buffer statistics after the event.
+ */
+typedef void ( * CellularPktioBufferCallback_t )( void * pCallbackContext,
+                                                  CellularPktioBufferEvent_t event,
+                                                  const CellularPktioBufferStats_t * pStats );
+
+/**
+ * @ingroup cellular_common_datatypes_functionpointers
+ * @brief Module function to read socket data from the modem with one AT command.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle to read data from.
+ * @param[out] pBuffer The buffer to store the data read from the modem.
+ * @param[in] bufferLength The length of pBuffer. It is not larger than CELLULAR_MAX_RECV_DATA_LEN.
+ * @param[out] pReceivedDataLength The length of the data read from the modem.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+typedef CellularError_t ( * CellularSocketRecvFunc_t )( CellularContext_t * pContext,
+                                                        CellularSocketHandle_t socketHandle,
+                                                        uint8_t * pBuffer,
+                                                        uint32_t bufferLength,
+                                                        uint32_t * pReceivedDataLength );
+
+/**
+ * @ingroup cellular_common_datatypes_functionpointers
+ * @brief Module function to send socket data to the modem with one data send AT command.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle to send data on.
+ * @param[in] pData The data to send.
+ * @param[in] dataLength The length of pData. It is not larger than CELLULAR_MAX_SEND_DATA_LEN.
+ * @param[out] pSentDataLength The length of the data accepted by the modem.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+typedef CellularError_t ( * CellularSocketSendFunc_t )( CellularContext_t * pContext,
+                                                        CellularSocketHandle_t socketHandle,
+                                                        const uint8_t * pData,
+                                                        uint32_t dataLength,
+                                                        uint32_t * pSentDataLength );
+
 /*-----------------------------------------------------------*/
 
 /**
@@ -261,6 +453,27 @@ CellularError_t _Cellular_LibInit( CellularHandle_t * pCellularHandle,
                                    const CellularCommInterface_t * pCommInterface,
                                    const CellularTokenTable_t * pTokenTable );
 
+/**
+ * @brief One time initialization function with the socket table provided by the caller.
+ *
+ * The socket table is set before the library is opened. If pSocketTable is NULL,
+ * a socket table of CELLULAR_NUM_SOCKET_MAX sockets is allocated. Out of memory
+ * is reported by this function.
+ *
+ * @param[in,out] pCellularHandle The handle pointer to store the cellular handle.
+ * @param[in] pCommInterface Comm interface for communicating with the module.
+ * @param[in] pTokenTable Token tables for pkthandler and pktio.
+ * @param[in] pSocketTable The socket table provided by the caller. NULL to use
+ * the default socket table.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t _Cellular_LibInitWithSocketTable( CellularHandle_t * pCellularHandle,
+                                                  const CellularCommInterface_t * pCommInterface,
+                                                  const CellularTokenTable_t * pTokenTable,
+                                                  const CellularSocketTable_t * pSocketTable );
+
 /**
  * @brief One time deinitialization function.
  *
@@ -602,6 +815,38 @@ CellularPktStatus_t _Cellular_AtcmdDataSend( CellularContext_t * pContext,
                                              uint32_t dataTimeoutMS,
                                              uint32_t interDelayMS );
 
+/**
+ * @brief Send data larger than CELLULAR_MAX_SEND_DATA_LEN to cellular modem.
+ *
+ * The data is split into chunks of at most CELLULAR_MAX_SEND_DATA_LEN bytes. Each
+ * chunk is sent with the AT command prepared by pktDataSendChunkCallback, the
+ * same way as _Cellular_AtcmdDataSend. The request mutex is held until all the
+ * chunks are sent. Other AT commands are not interleaved between the chunks.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] dataReq The data to send. pEndPattern is sent after each chunk.
+ * *dataReq.pSentDataLength is the length of the chunks acknowledged by the modem.
+ * pSegments is not supported and must be NULL.
+ * @param[in] pktDataSendChunkCallback The callback function to prepare the AT command of each chunk.
+ * @param[in] pktDataSendPrefixCallback The callback function to indicate the data sending start.
+ * @param[in] pCallbackContext The callback context pass to pktDataSendChunkCallback
+ * and pktDataSendPrefixCallback functions.
+ * @param[in] atTimeoutMS The timeout value to wait for the AT command response from cellular modem.
+ * @param[in] dataTimeoutMS The timeout value to wait for the data command response of each chunk.
+ * @param[in] interDelayMS The delay between AT command and data send.
+ *
+ * @return CELLULAR_PKT_STATUS_OK if all the data is sent, otherwise an error
+ * code indicating the cause of the error of the first failed chunk.
+ */
+CellularPktStatus_t _Cellular_AtcmdDataSendBulk( CellularContext_t * pContext,
+                                                 CellularAtDataReq_t dataReq,
+                                                 CellularATCommandDataSendChunkCallback_t pktDataSendChunkCallback,
+                                                 CellularATCommandDataSendPrefixCallback_t pktDataSendPrefixCallback,
+                                                 void * pCallbackContext,
+                                                 uint32_t atTimeoutMS,
+                                                 uint32_t dataTimeoutMS,
+                                                 uint32_t interDelayMS );
+
 /**
  * @brief Send the AT command to cellular modem with send data and extra success token table
  *
@@ -660,6 +905,275 @@ CellularError_t _Cellular_RegisterInputBufferCallback( CellularContext_t * pCont
                                                        CellularInputBufferCallback_t inputBufferCallback,
                                                        void * pInputBufferCallbackContext );
 
+/**
+ * @brief Get packet IO read buffer statistics.
+ *
+ * The statistics can be used to size CELLULAR_CONFIG_PKTIO_READ_BUFFER_SIZE for
+ * a product from data observed in the field.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[out] pStats The read buffer statistics.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error code
+ * indicating the cause of the error.
+ */
+CellularError_t _Cellular_GetPktioBufferStats( const CellularContext_t * pContext,
+                                               CellularPktioBufferStats_t * pStats );
+
+/**
+ * @brief Reset packet IO read buffer statistics.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error code
+ * indicating the cause of the error.
+ */
+CellularError_t _Cellular_ResetPktioBufferStats( CellularContext_t * pContext );
+
+/**
+ * @brief Register packet IO read buffer event callback.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] pktioBufferCallback The callback function to inform read buffer events.
+ * NULL to unregister the callback.
+ * @param[in] pCallbackContext The pCallbackContext passed to the pktioBufferCallback
+ * callback function if pktioBufferCallback is not NULL.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error code
+ * indicating the cause of the error.
+ */
+CellularError_t _Cellular_RegisterPktioBufferCallback( CellularContext_t * pContext,
+                                                       CellularPktioBufferCallback_t pktioBufferCallback,
+                                                       void * pCallbackContext );
+
+/**
+ * @brief Register the module functions to send and receive socket data.
+ *
+ * Module ports implementing Cellular_SocketRecv with _Cellular_SocketRecvPrefetch
+ * register recvFunc. Module ports implementing Cellular_SocketSend with
+ * _Cellular_SocketSendCoalesce register sendFunc. The functions must be the same
+ * as the functions passed to the helpers. The CELLULAR_SOCKET_OPTION_RECV_PREFETCH
+ * and CELLULAR_SOCKET_OPTION_SEND_COALESCE socket options return CELLULAR_UNSUPPORTED
+ * if the function is not registered.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] sendFunc The module function to send data to the modem. NULL if
+ * _Cellular_SocketSendCoalesce is not used.
+ * @param[in] recvFunc The module function to read data from the modem. NULL if
+ * _Cellular_SocketRecvPrefetch is not used.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error code
+ * indicating the cause of the error.
+ */
+CellularError_t _Cellular_RegisterSocketDataFunc( CellularContext_t * pContext,
+                                                  CellularSocketSendFunc_t sendFunc,
+                                                  CellularSocketRecvFunc_t recvFunc );
+
+/**
+ * @brief Inform data ready on a socket.
+ *
+ * Module URC handlers call this function when the modem informs data ready on
+ * the socket. The next _Cellular_SocketRecvPrefetch call reads the data from the
+ * modem even if the prefetch buffer is not empty. CELLULAR_SOCKET_POLL_READABLE
+ * is signaled to _Cellular_SocketPoll and the data ready callback of the socket
+ * is called.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle The socket handle on which data is ready.
+ */
+void _Cellular_SocketDataReady( CellularContext_t * pContext,
+                                CellularSocketHandle_t socketHandle );
+
+/**
+ * @brief Receive socket data through the receive prefetch buffer.
+ *
+ * Module ports implement Cellular_SocketRecv with this function. If the socket
+ * has no prefetch buffer, recvFunc is called once with the application buffer.
+ * Otherwise the data is read from the modem into the prefetch buffer with reads
+ * of up to CELLULAR_MAX_RECV_DATA_LEN bytes until the buffer is full or the modem
+ * has no more data, and the application buffer is filled from the prefetch buffer.
+ * The modem is read only if the prefetch buffer is empty or data ready is informed
+ * with _Cellular_SocketDataReady.
+ *
+ * If reading the modem fails after data is buffered, the buffered data is received
+ * and the error is returned by the next call. The buffered data can still be
+ * received by the calls after it.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle to receive data from.
+ * @param[out] pBuffer The application buffer to store the received data.
+ * @param[in] bufferLength The length of pBuffer.
+ * @param[out] pReceivedDataLength The length of the data stored in pBuffer.
+ * @param[in] recvFunc The module function to read data from the modem.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t _Cellular_SocketRecvPrefetch( CellularContext_t * pContext,
+                                              CellularSocketHandle_t socketHandle,
+                                              uint8_t * pBuffer,
+                                              uint32_t bufferLength,
+                                              uint32_t * pReceivedDataLength,
+                                              CellularSocketRecvFunc_t recvFunc );
+
+/**
+ * @brief Send socket data through the send coalescing buffer.
+ *
+ * Module ports implement Cellular_SocketSend with this function. If the socket
+ * has no coalescing buffer, sendFunc is called once with the application data.
+ * Otherwise the data is copied to the coalescing buffer and the buffer is sent
+ * with sendFunc when the next write does not fit, when the buffer is full, when
+ * the flush delay of the socket has elapsed, or when dataLength is 0. Data which
+ * does not fit in an empty buffer is sent directly.
+ *
+ * The data copied to the coalescing buffer is reported in pSentDataLength. If
+ * sending the buffer fails after the data is copied, CELLULAR_SUCCESS is returned
+ * and the error is returned by the next call with pSentDataLength 0. The buffered
+ * data is sent again by the call after it.
+ *
+ * _Cellular_SocketRecvPrefetch and _Cellular_SocketPoll send the buffered data
+ * with the sendFunc registered with _Cellular_RegisterSocketDataFunc, since the
+ * peer does not respond to data held in the buffer. A send error is returned by
+ * the next call of this function. With a coalescing buffer, the socket must be
+ * sent, received and polled in one task.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle to send data on.
+ * @param[in] pData The data to send. Can be NULL if dataLength is 0.
+ * @param[in] dataLength The length of pData. 0 to send the buffered data.
+ * @param[out] pSentDataLength The length of the data sent or buffered.
+ * @param[in] sendFunc The module function to send data to the modem.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t _Cellular_SocketSendCoalesce( CellularContext_t * pContext,
+                                              CellularSocketHandle_t socketHandle,
+                                              const uint8_t * pData,
+                                              uint32_t dataLength,
+                                              uint32_t * pSentDataLength,
+                                              CellularSocketSendFunc_t sendFunc );
+
+/**
+ * @brief Send the data in the send coalescing buffer.
+ *
+ * Module ports call this function before closing a socket with a coalescing
+ * buffer. It must be called in the task sending data on the socket.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle to send data on.
+ * @param[in] sendFunc The module function to send data to the modem.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t _Cellular_SocketSendFlush( CellularContext_t * pContext,
+                                           CellularSocketHandle_t socketHandle,
+                                           CellularSocketSendFunc_t sendFunc );
+
+/**
+ * @brief Inform socket readiness events to Cellular_SocketPoll.
+ *
+ * Module URC handlers call this function when the modem informs socket open
+ * result or socket closed. Data ready is signaled by _Cellular_SocketDataReady.
+ * The events are kept in the socket context until they are reported by
+ * _Cellular_SocketPoll.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle The socket handle on which the events occurred.
+ * @param[in] events The CELLULAR_SOCKET_POLL_* events occurred on the socket.
+ */
+void _Cellular_SocketPollSignal( CellularContext_t * pContext,
+                                 CellularSocketHandle_t socketHandle,
+                                 uint8_t events );
+
+/**
+ * @brief Wait for readiness events on several sockets.
+ *
+ * Reference Cellular_SocketPoll in cellular_api.h for definition.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in,out] pPollFds The sockets and the events to wait for.
+ * @param[in] numPollFds The number of entries in pPollFds.
+ * @param[in] timeoutMs The timeout in milliseconds to wait for the events.
+ * @param[out] pNumReady The number of sockets with occurred events.
+ *
+ * @return CELLULAR_SUCCESS if an event occurred, CELLULAR_TIMEOUT if no event
+ * occurred before the timeout, otherwise an error code indicating the cause
+ * of the error.
+ */
+CellularError_t _Cellular_SocketPoll( CellularContext_t * pContext,
+                                      CellularSocketPollFd_t * pPollFds,
+                                      uint8_t numPollFds,
+                                      uint32_t timeoutMs,
+                                      uint8_t * pNumReady );
+
+/**
+ * @brief Set the socket table of the cellular context.
+ *
+ * The socket table replaces the default socket table of CELLULAR_NUM_SOCKET_MAX
+ * sockets allocated in _Cellular_LibInit. It must be set before the first
+ * socket is created. Prefer _Cellular_LibInitWithSocketTable, which does not
+ * allocate the default socket table.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] pSocketTable The socket table provided by the caller.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t _Cellular_SetSocketTable( CellularContext_t * pContext,
+                                          const CellularSocketTable_t * pSocketTable );
+
+/**
+ * @brief Get the traffic and latency statistics of a socket.
+ *
+ * Reference Cellular_SocketGetStats in cellular_api.h for definition.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle returned from the Cellular_CreateSocket call.
+ * @param[out] pStats The statistics of the socket.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, CELLULAR_UNSUPPORTED
+ * if CELLULAR_CONFIG_SOCKET_STATS is not enabled, otherwise an error code
+ * indicating the cause of the error.
+ */
+CellularError_t _Cellular_SocketGetStats( const CellularContext_t * pContext,
+                                          CellularSocketHandle_t socketHandle,
+                                          CellularSocketStats_t * pStats );
+
+/**
+ * @brief Bind a socket to the socket ID used by the modem.
+ *
+ * A socket created by _Cellular_CreateSocketData is not bound to a modem socket
+ * ID. Module ports call this function when the modem socket ID is known, either
+ * the ID returned by the modem or the connect ID chosen by the port. A modem
+ * socket ID bound to another socket is moved to this socket.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] socketHandle Socket handle returned from the Cellular_CreateSocket call.
+ * @param[in] modemSocketId The socket ID used by the modem. CELLULAR_INVALID_MODEM_SOCKET_ID
+ * to unbind the socket.
+ *
+ * @return CELLULAR_SUCCESS if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularError_t _Cellular_SetSocketModemId( CellularContext_t * pContext,
+                                            CellularSocketHandle_t socketHandle,
+                                            uint32_t modemSocketId );
+
+/**
+ * @brief Get the socket data structure with the socket ID used by the modem.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] modemSocketId Socket ID returned from cellular modem in URC.
+ *
+ * @return The socket data pointer if a socket is bound to the modem socket ID,
+ * otherwise NULL is returned.
+ */
+CellularSocketContext_t * _Cellular_GetSocketDataByModemId( const CellularContext_t * pContext,
+                                                            uint32_t modemSocketId );
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
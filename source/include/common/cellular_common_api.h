@@ -52,6 +52,19 @@ CellularError_t Cellular_CommonInit( CellularHandle_t * pCellularHandle,
                                      const CellularCommInterface_t * pCommInterface,
                                      const CellularTokenTable_t * pTokenTable );
 
+/**
+ * @brief Cellular_CommonInit with the socket table provided by the caller.
+ *
+ * Module ports call this function in Cellular_Init to size the socket table
+ * of the cellular context. Reference #CellularSocketTable_t for the socket
+ * table. Cellular_CommonInit uses a socket table of CELLULAR_NUM_SOCKET_MAX
+ * sockets.
+ */
+CellularError_t Cellular_CommonInitWithSocketTable( CellularHandle_t * pCellularHandle,
+                                                    const CellularCommInterface_t * pCommInterface,
+                                                    const CellularTokenTable_t * pTokenTable,
+                                                    const CellularSocketTable_t * pSocketTable );
+
 /**
  * @brief This function is the common implementation of FreeRTOS Cellular Library API.
  * Reference Cellular_Cleanup in cellular_api.h for definition.
@@ -159,6 +172,49 @@ CellularError_t Cellular_CommonSocketRegisterClosedCallback( CellularHandle_t ce
                                                              CellularSocketClosedCallback_t closedCallback,
                                                              void * pCallbackContext );
 
+/**
+ * @brief This function is the common implementation of FreeRTOS Cellular Library API.
+ * Reference Cellular_SocketPoll in cellular_api.h for definition.
+ */
+CellularError_t Cellular_CommonSocketPoll( CellularHandle_t cellularHandle,
+                                           CellularSocketPollFd_t * pPollFds,
+                                           uint8_t numPollFds,
+                                           uint32_t timeoutMs,
+                                           uint8_t * pNumReady );
+
+/**
+ * @brief This function is the common implementation of FreeRTOS Cellular Library API.
+ * Reference Cellular_SocketGetStats in cellular_api.h for definition.
+ */
+CellularError_t Cellular_CommonSocketGetStats( CellularHandle_t cellularHandle,
+                                               CellularSocketHandle_t socketHandle,
+                                               CellularSocketStats_t * pStats );
+
+/**
+ * @brief This function is the common implementation of FreeRTOS Cellular Library API.
+ * Reference Cellular_DataModeEnter in cellular_api.h for definition.
+ */
+CellularError_t Cellular_CommonDataModeEnter( CellularHandle_t cellularHandle,
+                                              uint8_t contextId,
+                                              CellularDataModeReceiveCallback_t receiveCallback,
+                                              CellularDataModeExitCallback_t exitCallback,
+                                              void * pCallbackContext );
+
+/**
+ * @brief This function is the common implementation of FreeRTOS Cellular Library API.
+ * Reference Cellular_DataModeSend in cellular_api.h for definition.
+ */
+CellularError_t Cellular_CommonDataModeSend( CellularHandle_t cellularHandle,
+                                             const uint8_t * pData,
+                                             uint32_t dataLength,
+                                             uint32_t * pSentDataLength );
+
+/**
+ * @brief This function is the common implementation of FreeRTOS Cellular Library API.
+ * Reference Cellular_DataModeExit in cellular_api.h for definition.
+ */
+CellularError_t Cellular_CommonDataModeExit( CellularHandle_t cellularHandle );
+
 /**
  * @brief This function is the common implementation of FreeRTOS Cellular Library API.
  * Reference Cellular_RfOn in cellular_api.h for definition.
@@ -0,0 +1,91 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @file cellular_heap.h
+ */
+
+#ifndef __CELLULAR_HEAP_H__
+#define __CELLULAR_HEAP_H__
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Standard includes. */
+#include <stddef.h>
+#include <stdint.h>
+
+/* Cellular includes. */
+#include "cellular_platform.h"
+#ifndef CELLULAR_DO_NOT_USE_CUSTOM_CONFIG
+    /* Include custom config file before other headers. */
+    #include "cellular_config.h"
+#endif
+#include "cellular_config_defaults.h"
+#include "cellular_types.h"
+
+/*-----------------------------------------------------------*/
+
+#if ( CELLULAR_CONFIG_HEAP_STATS == 1 )
+
+/**
+ * @brief Allocate memory for the cellular library.
+ *
+ * The allocation is accounted to the allocation site.
+ *
+ * @param[in] size The number of bytes to allocate.
+ * @param[in] site The allocation site.
+ *
+ * @return Pointer to the allocated memory or NULL if the allocation failed.
+ */
+    void * _Cellular_Malloc( size_t size,
+                             CellularHeapSite_t site );
+
+/**
+ * @brief Free memory allocated with _Cellular_Malloc.
+ *
+ * @param[in] pMem The memory to free. NULL is ignored.
+ */
+    void _Cellular_Free( void * pMem );
+
+#else /* if ( CELLULAR_CONFIG_HEAP_STATS == 1 ) */
+
+    #define _Cellular_Malloc( size, site )    Platform_Malloc( size )
+    #define _Cellular_Free( pMem )            Platform_Free( pMem )
+
+#endif /* if ( CELLULAR_CONFIG_HEAP_STATS == 1 ) */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* __CELLULAR_HEAP_H__ */
@@ -48,9 +48,18 @@
 
 /*-----------------------------------------------------------*/
 
+/* The deadline of Cellular_SocketPoll and of the asynchronous send is kept in
+ * ticks across wake-ups. */
+#ifndef PlatformTask_GetTickCount
+    #error "PlatformTask_GetTickCount must be defined in cellular_platform.h when CELLULAR_CONFIG_PLATFORM_FREERTOS is 0."
+#endif
+
 #define PKTIO_READ_BUFFER_SIZE     ( CELLULAR_CONFIG_PKTIO_READ_BUFFER_SIZE )
 #define PKTIO_WRITE_BUFFER_SIZE    ( CELLULAR_AT_CMD_MAX_SIZE )
 
+/* The transfer being waited for and the transfer before it. */
+#define PKTIO_SEND_TAG_NUM         ( 2U )
+
 /*-----------------------------------------------------------*/
 
 /**
@@ -103,6 +112,16 @@ typedef struct cellularAtData
     uint16_t tac;                                    /**<  Registered network operator Tracking Area Code. */
 } cellularAtData_t;
 
+/**
+ * @ingroup cellular_datatypes_structs
+ * @brief Identifies an asynchronous send in the send callback of the comm interface.
+ */
+typedef struct CellularPktioSendTag
+{
+    struct CellularContext * pContext; /**<  The context of the send. */
+    uint32_t sequence;                 /**<  The sequence number of the send. */
+} CellularPktioSendTag_t;
+
 /**
  * @ingroup cellular_datatypes_structs
  * @brief Parameters involved in maintaining the context for the modem.
@@ -134,6 +153,9 @@ struct CellularContext
     void * pPktUsrData;                                            /**<  The pData passed to CellularATCommandResponseReceivedCallback_t. */
     uint16_t PktUsrDataLen;                                        /**<  The dataLen passed to CellularATCommandResponseReceivedCallback_t. */
     const char * pCurrentCmd;                                      /**<  Debug purpose. */
+    #if ( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT == 1 )
+        CellularAtCmdLatency_t atCmdLatency[ CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_CLASS_NUM ]; /**<  Latency estimates for adaptive AT command timeout. */
+    #endif
 
     /* Packet IO. */
     bool bPktioUp;                                                     /**<  A flag to indicate if packet IO up. */
@@ -153,14 +175,36 @@ struct CellularContext
     CellularInputBufferCallback_t inputBufferCallback;                 /**<  URC data preprocess callback function. */
     void * pInputBufferCallbackContext;                                /**<  The callback context passed to inputBufferCallback. */
     CellularATCommandResponse_t * pAtCmdResp;                          /**<  The AT command response pointer. */
+    CellularPktioBufferStats_t pktioBufferStats;                       /**<  Read buffer occupancy and overflow statistics. */
+    CellularPktioBufferCallback_t pktioBufferCallback;                 /**<  Read buffer event callback function. */
+    void * pPktioBufferCallbackContext;                                /**<  The callback context passed to pktioBufferCallback. */
+    uint32_t pktioSendAsyncLength;                                     /**<  The data length sent by the asynchronous send. */
+    uint32_t pktioSendAsyncSequence;                                   /**<  The sequence number of the asynchronous send waited for. */
+    uint32_t pktioSendAsyncDoneSequence;                               /**<  The sequence number of the send reported with pktioSendAsyncLength. */
+    uint8_t pktioSendTagIndex;                                         /**<  The entry of pktioSendTag used by the last send. */
+    CellularPktioSendTag_t pktioSendTag[ PKTIO_SEND_TAG_NUM ];         /**<  The pUserData of the send callback. */
+    _pktioDataMode_t dataMode;                                         /**<  The data mode state of packet IO. */
+    CellularDataModeReceiveCallback_t dataModeRecvCB;                  /**<  Callback used to pass the data received in data mode. */
+    CellularDataModeExitCallback_t dataModeExitCB;                     /**<  Callback used to inform NO CARRIER in data mode. */
+    void * pDataModeCBContext;                                         /**<  The pCallbackContext passed to the data mode callbacks. */
+    uint8_t dataModeMatchLength;                                       /**<  The length of the result code matched in the data mode stream. */
+    bool dataModeMatchOk;                                              /**<  The matched result code is OK instead of NO CARRIER. */
+    const char * pDataModeDialCmd;                                     /**<  The dial command which enters data mode with CONNECT. */
 
     /* PktIo data handling. */
-    uint32_t dataLength;                                              /**<  The data length in pLine. */
-    uint32_t partialDataRcvdLen;                                      /**<  The valid data length need to be handled. */
+    uint32_t dataLength;                                                        /**<  The data length in pLine. */
+    uint32_t partialDataRcvdLen;                                                /**<  The valid data length need to be handled. */
 
-    CellularSocketContext_t * pSocketData[ CELLULAR_NUM_SOCKET_MAX ]; /**<  All socket related information. */
+    CellularSocketContext_t ** pSocketData;                                     /**<  All socket related information. numSocketMax entries. */
+    CellularSocketContext_t * pSocketSlab;                                      /**<  Socket contexts of the socket table. NULL if allocated on create. */
+    uint8_t numSocketMax;                                                       /**<  Number of entries in pSocketData. 0 before the socket table is set. */
+    bool bSocketTableAllocated;                                                 /**<  pSocketData is the default socket table of the library. */
+    CellularSocketContext_t * pModemSocketData[ CELLULAR_MODEM_SOCKET_ID_MAX ]; /**<  Sockets indexed by modem socket ID. */
+    PlatformEventGroupHandle_t pSocketPollEvent;                                /**<  Event group to wake up Cellular_SocketPoll. */
+    CellularSocketSendFunc_t socketSendFunc;                                    /**<  Module function to send socket data. NULL if not registered. */
+    CellularSocketRecvFunc_t socketRecvFunc;                                    /**<  Module function to receive socket data. NULL if not registered. */
 
-    void * pModuleContext;                                            /**<  Module Context. */
+    void * pModuleContext;                                                      /**<  Module Context. */
 };
 
 /*-----------------------------------------------------------*/
@@ -50,6 +50,21 @@
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @ingroup cellular_datatypes_structs
+ * @brief Response latency estimate of an AT command class for adaptive timeout.
+ */
+typedef struct CellularAtCmdLatency
+{
+    uint32_t cmdHash;      /**<  Hash of the AT command class. */
+    uint32_t srttScaled;   /**<  Smoothed latency in 1/8 milliseconds. */
+    uint32_t rttVarScaled; /**<  Latency mean deviation in 1/4 milliseconds. */
+    uint16_t sampleCount;  /**<  Number of latency samples. */
+    uint8_t backoffShift;  /**<  Timeout backoff after consecutive timeouts. */
+} CellularAtCmdLatency_t;
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Create the packet request mutex.
  *
@@ -150,6 +165,49 @@ CellularPktStatus_t _Cellular_PktHandler_AtcmdRequestWithCallback( CellularConte
                                                                    CellularAtReq_t atReq,
                                                                    uint32_t timeoutMS );
 
+/**
+ * @brief Hash the class of an AT command.
+ *
+ * The AT command class is the command name with the "=", "?" or "=?" suffix,
+ * without parameters. The set, read and test forms of a command are different
+ * classes.
+ *
+ * @param[in] pAtCmd The AT command string.
+ *
+ * @return The hash of the AT command class.
+ */
+uint32_t _Cellular_AtCmdClassHash( const char * pAtCmd );
+
+/**
+ * @brief Update the latency estimate with a new latency sample.
+ *
+ * @param[in,out] pLatency The latency estimate of the AT command class.
+ * @param[in] latencyMs The measured response latency in milliseconds.
+ */
+void _Cellular_AtCmdLatencyUpdate( CellularAtCmdLatency_t * pLatency,
+                                   uint32_t latencyMs );
+
+/**
+ * @brief Back off the adaptive timeout after an AT command timed out.
+ *
+ * The backoff is reset by the next latency sample.
+ *
+ * @param[in,out] pLatency The latency estimate of the AT command class.
+ */
+void _Cellular_AtCmdLatencyBackoff( CellularAtCmdLatency_t * pLatency );
+
+/**
+ * @brief Get the effective timeout of an AT command class.
+ *
+ * @param[in] pLatency The latency estimate of the AT command class.
+ * @param[in] timeoutMS The timeout value passed by the caller. It is the
+ * upper bound of the effective timeout.
+ *
+ * @return The effective timeout in milliseconds.
+ */
+uint32_t _Cellular_AtCmdLatencyGetTimeout( const CellularAtCmdLatency_t * pLatency,
+                                           uint32_t timeoutMS );
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
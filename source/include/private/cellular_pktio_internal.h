@@ -54,6 +54,18 @@ typedef enum _atRespType
     AT_UNDEFINED
 } _atRespType_t;
 
+/**
+ * @brief The data mode state of packet IO.
+ */
+typedef enum _pktioDataMode
+{
+    PKTIO_DATA_MODE_OFF = 0,  /**< AT responses are parsed. */
+    PKTIO_DATA_MODE_STARTING, /**< The callbacks are set. The dial command is not sent yet. */
+    PKTIO_DATA_MODE_DIALING,  /**< The dial command is sent. Data mode starts after CONNECT. */
+    PKTIO_DATA_MODE_ON,       /**< The received data is passed to the data mode receive callback. */
+    PKTIO_DATA_MODE_ESCAPING  /**< The escape sequence is sent. Data mode stops after OK. */
+} _pktioDataMode_t;
+
 /**
  * @brief Callback used to inform packet received.
  *
@@ -135,6 +147,111 @@ uint32_t _Cellular_PktioSendData( CellularContext_t * pContext,
                                   const uint8_t * pData,
                                   uint32_t dataLen );
 
+/**
+ * @brief Send data segments function.
+ *
+ * This function sends the segments in order through the comm interface. It stops
+ * at the first segment which is not sent completely.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] pSegments The data segments to send.
+ * @param[in] segmentCount The number of segments in pSegments.
+ *
+ * @return The total data length actually send to the comm interface.
+ */
+uint32_t _Cellular_PktioSendDatav( CellularContext_t * pContext,
+                                   const CellularDataSegment_t * pSegments,
+                                   uint32_t segmentCount );
+
+/**
+ * @brief Start sending data function.
+ *
+ * This function starts sending the data with the asynchronous send of the comm
+ * interface. pData must not be modified until _Cellular_PktioSendDataWait returns.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] pData The data to send.
+ * @param[in] dataLen The data length of pData.
+ *
+ * @return CELLULAR_PKT_STATUS_OK if the transfer is started. Otherwise, an error
+ * code indicating the cause of the error.
+ */
+CellularPktStatus_t _Cellular_PktioSendDataAsync( CellularContext_t * pContext,
+                                                  const uint8_t * pData,
+                                                  uint32_t dataLen );
+
+/**
+ * @brief Wait for the data sent by _Cellular_PktioSendDataAsync.
+ *
+ * Each send is tagged with a sequence number passed in the pUserData of the send
+ * callback. A completion of a send that is no longer waited for is ignored. The
+ * comm interface must complete or abort the transfer before the wait times out.
+ * The data of a transfer which is not aborted by then may be overwritten.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] timeoutMs The timeout value to wait for the send completion.
+ *
+ * @return The data actually send to the comm interface. 0 if the send is not
+ * completed in timeoutMs.
+ */
+uint32_t _Cellular_PktioSendDataWait( CellularContext_t * pContext,
+                                      uint32_t timeoutMs );
+
+/**
+ * @brief Prepare packet IO to enter data mode.
+ *
+ * Packet IO waits for CONNECT when pDialCmd is sent with _Cellular_PktioSendAtCmd
+ * and enters data mode when the dial command succeeds with CONNECT. Other AT
+ * commands sent before the dial command don't change the data mode state.
+ * _Cellular_PktioDataModeStop should be called if the dial command fails.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ * @param[in] pDialCmd The dial command. The same pointer is passed to _Cellular_PktioSendAtCmd.
+ * @param[in] receiveCallback The callback to receive the data in data mode.
+ * @param[in] exitCallback The callback invoked when the modem reports NO CARRIER.
+ * @param[in] pCallbackContext The context passed to the callback functions.
+ *
+ * @return CELLULAR_PKT_STATUS_OK if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularPktStatus_t _Cellular_PktioDataModeStart( CellularContext_t * pContext,
+                                                  const char * pDialCmd,
+                                                  CellularDataModeReceiveCallback_t receiveCallback,
+                                                  CellularDataModeExitCallback_t exitCallback,
+                                                  void * pCallbackContext );
+
+/**
+ * @brief Leave data mode and resume parsing AT responses.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ */
+void _Cellular_PktioDataModeStop( CellularContext_t * pContext );
+
+/**
+ * @brief Check if packet IO is in data mode.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ *
+ * @return true if packet IO is in data mode and not leaving it with the escape
+ * sequence. Otherwise, false.
+ */
+bool _Cellular_PktioDataModeIsActive( const CellularContext_t * pContext );
+
+/**
+ * @brief Send the escape sequence to switch the modem back to command mode.
+ *
+ * Packet IO leaves data mode when the modem responds OK to the escape sequence,
+ * or reports NO CARRIER. Data can't be sent with Cellular_DataModeSend while the
+ * escape is in progress. Packet IO stays in data mode if the modem doesn't respond
+ * in time.
+ *
+ * @param[in] pContext The opaque cellular context pointer created by Cellular_Init.
+ *
+ * @return CELLULAR_PKT_STATUS_OK if the operation is successful, otherwise an error
+ * code indicating the cause of the error.
+ */
+CellularPktStatus_t _Cellular_PktioDataModeEscape( CellularContext_t * pContext );
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
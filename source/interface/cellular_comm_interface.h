@@ -117,6 +117,81 @@ typedef CellularCommInterfaceError_t ( * CellularCommInterfaceSend_t )( Cellular
                                                                         uint32_t timeoutMilliseconds,
                                                                         uint32_t * pDataSentLength );
 
+/**
+ * @brief Send data segments to the comm interface.
+ *
+ * The segments are sent in order as one transaction of the comm interface. For
+ * example, a DMA UART driver can send the segments with one scatter-gather
+ * transfer.
+ *
+ * @param[in] commInterfaceHandle Comm interface handle as returned from the
+ * CellularCommInterfaceOpen_t call.
+ * @param[in] pSegments The data segments to send.
+ * @param[in] segmentCount The number of segments in pSegments.
+ * @param[in] timeoutMilliseconds Timeout in milliseconds for the send operation.
+ * @param[out] pDataSentLength Out parameter to provide the total length of the
+ * actual data sent. Note that it may be less than the total length of the
+ * segments in case complete data could not be sent.
+ *
+ * @return IOT_COMM_INTERFACE_SUCCESS if the operation is successful, otherwise
+ * an error code indicating the cause of the error.
+ */
+typedef CellularCommInterfaceError_t ( * CellularCommInterfaceSendv_t )( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                                         const CellularDataSegment_t * pSegments,
+                                                                         uint32_t segmentCount,
+                                                                         uint32_t timeoutMilliseconds,
+                                                                         uint32_t * pDataSentLength );
+
+/**
+ * @brief Provide an asynchronous notification of send completion.
+ *
+ * A function of this signature is supplied in CellularCommInterfaceSendAsync_t and
+ * is used to notify that the comm interface completes or aborts sending the data.
+ *
+ * @param[in] pUserData Userdata to be provided in the callback.
+ * @param[in] commInterfaceHandle Handle corresponding to the comm interface.
+ * @param[in] dataSentLength The length of the actual data sent.
+ *
+ * @return IOT_COMM_INTERFACE_SUCCESS if the operation is successful, and need to yield from ISR
+ * IOT_COMM_INTERFACE_BUSY if the operation is successful,
+ * otherwise an error code indicating the cause of the error.
+ */
+typedef CellularCommInterfaceError_t ( * CellularCommInterfaceSendCallback_t )( void * pUserData,
+                                                                                CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                                                uint32_t dataSentLength );
+
+/**
+ * @brief Start sending data to the comm interface.
+ *
+ * The function returns after the transfer is started. The comm interface calls
+ * sendCallback once the transfer completes or is aborted. sendCallback can be
+ * called from an ISR. pData must not be modified until sendCallback is called.
+ *
+ * The cellular library waits for sendCallback up to timeoutMilliseconds. The comm
+ * interface must abort the transfer by then. pData may be reused by the library
+ * after the wait ends. sendCallback must be called with the pUserData of the
+ * transfer. A call for an earlier transfer is ignored.
+ *
+ * @param[in] commInterfaceHandle Comm interface handle as returned from the
+ * CellularCommInterfaceOpen_t call.
+ * @param[in] pData The data to send.
+ * @param[in] dataLength Length of the data to send.
+ * @param[in] timeoutMilliseconds The comm interface must complete or abort the
+ * transfer within timeoutMilliseconds.
+ * @param[in] sendCallback Callback to be invoked when the transfer completes.
+ * @param[in] pUserData Userdata to be provided in the callback.
+ *
+ * @return IOT_COMM_INTERFACE_SUCCESS if the transfer is started, otherwise
+ * an error code indicating the cause of the error. sendCallback is not called
+ * if the transfer is not started.
+ */
+typedef CellularCommInterfaceError_t ( * CellularCommInterfaceSendAsync_t )( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                                             const uint8_t * pData,
+                                                                             uint32_t dataLength,
+                                                                             uint32_t timeoutMilliseconds,
+                                                                             CellularCommInterfaceSendCallback_t sendCallback,
+                                                                             void * pUserData );
+
 /**
  * @brief Receive data from the comm interface.
  *
@@ -139,6 +214,50 @@ typedef CellularCommInterfaceError_t ( * CellularCommInterfaceRecv_t )( Cellular
                                                                         uint32_t timeoutMilliseconds,
                                                                         uint32_t * pDataReceivedLength );
 
+/**
+ * @brief Borrow the received data buffer of the comm interface.
+ *
+ * The comm interface returns a pointer to the received data in its own buffer
+ * instead of copying the data. For example, a DMA UART driver can lend the DMA
+ * receive buffer. The borrowed buffer must be writable and must have one more
+ * byte after the received data. pktio writes the NULL terminator and the line
+ * terminators in place. The buffer is valid until CellularCommInterfaceRecvRelease_t
+ * is called.
+ *
+ * @param[in] commInterfaceHandle Comm interface handle as returned from the
+ * CellularCommInterfaceOpen_t call.
+ * @param[out] ppBuffer Out parameter to provide the borrowed buffer.
+ * @param[in] bufferLength The maximum length of data to borrow.
+ * @param[in] timeoutMilliseconds Timeout in milliseconds for the receive
+ * operation.
+ * @param[out] pDataReceivedLength Out parameter to provide the length of the
+ * data in the borrowed buffer. Note that it may be less than the bufferLength.
+ *
+ * @return IOT_COMM_INTERFACE_SUCCESS if the operation is successful, otherwise
+ * an error code indicating the cause of the error.
+ */
+typedef CellularCommInterfaceError_t ( * CellularCommInterfaceRecvBorrow_t )( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                                              uint8_t ** ppBuffer,
+                                                                              uint32_t bufferLength,
+                                                                              uint32_t timeoutMilliseconds,
+                                                                              uint32_t * pDataReceivedLength );
+
+/**
+ * @brief Release the buffer borrowed with CellularCommInterfaceRecvBorrow_t.
+ *
+ * pktio calls this function once for each borrow returning data. pktio copies
+ * the data still referenced by the parser before releasing the buffer.
+ *
+ * @param[in] commInterfaceHandle Comm interface handle as returned from the
+ * CellularCommInterfaceOpen_t call.
+ * @param[in] bufferLength The length of the data returned by the borrow.
+ *
+ * @return IOT_COMM_INTERFACE_SUCCESS if the operation is successful, otherwise
+ * an error code indicating the cause of the error.
+ */
+typedef CellularCommInterfaceError_t ( * CellularCommInterfaceRecvRelease_t )( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                                               uint32_t bufferLength );
+
 /**
  * @brief Close the connection to the comm interface.
  *
@@ -159,10 +278,18 @@ typedef CellularCommInterfaceError_t ( * CellularCommInterfaceClose_t )( Cellula
  */
 typedef struct CellularCommInterface
 {
-    CellularCommInterfaceOpen_t open;   /**< Cellular communication open interface. */
-    CellularCommInterfaceSend_t send;   /**< Cellular communication send interface. */
-    CellularCommInterfaceRecv_t recv;   /**< Cellular communication recv interface. */
-    CellularCommInterfaceClose_t close; /**< Cellular communication close interface. */
+    CellularCommInterfaceOpen_t open;               /**< Cellular communication open interface. */
+    CellularCommInterfaceSend_t send;               /**< Cellular communication send interface. */
+    CellularCommInterfaceRecv_t recv;               /**< Cellular communication recv interface. */
+    CellularCommInterfaceClose_t close;             /**< Cellular communication close interface. */
+    CellularCommInterfaceSendv_t sendv;             /**< Cellular communication send segments interface.
+                                                     * Optional. Set NULL to send each segment with send. */
+    CellularCommInterfaceRecvBorrow_t recvBorrow;   /**< Cellular communication borrow received buffer interface.
+                                                     * Optional. Set NULL to receive with recv. */
+    CellularCommInterfaceRecvRelease_t recvRelease; /**< Cellular communication release borrowed buffer interface.
+                                                     * Optional. Required if recvBorrow is set. */
+    CellularCommInterfaceSendAsync_t sendAsync;     /**< Cellular communication asynchronous send interface.
+                                                     * Optional. Set NULL to send data with send. */
 } CellularCommInterface_t;
 
 /* *INDENT-OFF* */
@@ -74,6 +74,7 @@ typedef void * PVOID;
 #define xQueueSend                           MockxQueueSend
 #define xQueueReceive                        MockxQueueReceive
 #define xQueueCreate                         MockxQueueCreate
+#define xTaskGetTickCount                    MockxTaskGetTickCount
 
 #define PlatformMutex_Create                 MockPlatformMutex_Create
 #define PlatformMutex_Destroy                MockPlatformMutex_Destroy
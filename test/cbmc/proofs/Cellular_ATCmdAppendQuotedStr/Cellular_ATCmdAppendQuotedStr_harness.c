@@ -0,0 +1,85 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Cellular default config includes. */
+#include "cellular_config.h"
+#include "cellular_config_defaults.h"
+
+/* Cellular APIs includes. */
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_common_internal.h"
+#include "cellular_common_api.h"
+
+/* Extern the com interface in comm_if_windows.c */
+extern CellularCommInterface_t CellularCommInterface;
+
+/****************************************************************
+* The signature of the function under test.
+****************************************************************/
+
+CellularATError_t Cellular_ATCmdBuilderInit( CellularATCmdBuilder_t * pBuilder,
+                                             char * pBuf,
+                                             uint32_t bufSize );
+
+CellularATError_t Cellular_ATCmdAppendQuotedStr( CellularATCmdBuilder_t * pBuilder,
+                                                 const char * pString );
+
+/****************************************************************
+* The proof of Cellular_ATCmdAppendQuotedStr
+****************************************************************/
+void harness()
+{
+    CellularATCmdBuilder_t builder;
+    char * pString;
+    uint32_t bufSize;
+    uint32_t prefixLength;
+    uint32_t stringLength;
+
+    __CPROVER_assume( bufSize < CBMC_MAX_BUFSIZE );
+    __CPROVER_assume( stringLength > 0U && stringLength < CBMC_MAX_BUFSIZE );
+
+    /* Start from a builder which may already hold a part of the command. */
+    if( Cellular_ATCmdBuilderInit( &builder, ( char * ) safeMalloc( bufSize ), bufSize ) == CELLULAR_AT_SUCCESS )
+    {
+        __CPROVER_assume( prefixLength < bufSize );
+        builder.length = prefixLength;
+    }
+
+    /* The appended string is NULL terminated. */
+    pString = ( char * ) safeMalloc( stringLength );
+
+    if( pString != NULL )
+    {
+        pString[ stringLength - 1U ] = '\0';
+    }
+
+    Cellular_ATCmdAppendQuotedStr( nondet_bool() ? NULL : &builder, pString );
+}
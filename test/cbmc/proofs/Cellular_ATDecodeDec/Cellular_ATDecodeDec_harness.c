@@ -0,0 +1,77 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Cellular default config includes. */
+#include "cellular_config.h"
+#include "cellular_config_defaults.h"
+
+/* Cellular APIs includes. */
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_common_internal.h"
+#include "cellular_common_api.h"
+
+#define ensure_memory_is_valid( px, length )    ( px != NULL ) && ( length > 0 ) && __CPROVER_r_ok( ( px ), length )
+
+/****************************************************************
+* The signature of the function under test.
+****************************************************************/
+
+CellularATError_t Cellular_ATDecodeDec( const char * pStr,
+                                        uint16_t strLength,
+                                        int32_t * pResult,
+                                        uint16_t * pConsumed );
+
+/****************************************************************
+* The proof of Cellular_ATDecodeDec
+****************************************************************/
+void harness()
+{
+    uint16_t stringLength;
+    int32_t * pResult;
+    uint16_t * pConsumed;
+
+    __CPROVER_assume( stringLength < CBMC_MAX_BUFSIZE );
+
+    /* The input string is not NULL terminated. */
+    char * pString = ( char * ) safeMalloc( stringLength );
+
+    pResult = ( int32_t * ) safeMalloc( sizeof( int32_t ) );
+    pConsumed = ( uint16_t * ) safeMalloc( sizeof( uint16_t ) );
+
+    if( ( pString == NULL ) || ( stringLength == 0U ) || ensure_memory_is_valid( pString, stringLength ) )
+    {
+        if( ( Cellular_ATDecodeDec( pString, stringLength, pResult, pConsumed ) == CELLULAR_AT_SUCCESS ) &&
+            ( pConsumed != NULL ) )
+        {
+            __CPROVER_assert( ( *pConsumed > 0U ) && ( *pConsumed <= stringLength ), "Consumed length is in the input" );
+        }
+    }
+}
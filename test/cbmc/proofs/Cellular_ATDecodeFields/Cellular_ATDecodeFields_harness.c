@@ -0,0 +1,82 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Cellular default config includes. */
+#include "cellular_config.h"
+#include "cellular_config_defaults.h"
+
+/* Cellular APIs includes. */
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_common_internal.h"
+#include "cellular_common_api.h"
+
+#define ensure_memory_is_valid( px, length )    ( px != NULL ) && ( length > 0 ) && __CPROVER_r_ok( ( px ), length )
+
+/****************************************************************
+* The signature of the function under test.
+****************************************************************/
+
+CellularATError_t Cellular_ATDecodeFields( const char * pString,
+                                           uint16_t stringLength,
+                                           const CellularATFieldDesc_t * pFields,
+                                           uint8_t fieldCount,
+                                           void * pDest,
+                                           uint32_t * pDecodedFields );
+
+/****************************************************************
+* The proof of Cellular_ATDecodeFields
+****************************************************************/
+void harness()
+{
+    CellularATFieldDesc_t fields[ CBMC_MAX_FIELDS ];
+    uint8_t dest[ CBMC_MAX_DEST_SIZE ];
+    uint32_t decodedFields;
+    uint16_t stringLength;
+    uint8_t fieldCount;
+    uint8_t i;
+
+    __CPROVER_assume( stringLength > 0 && stringLength < CBMC_MAX_BUFSIZE );
+    __CPROVER_assume( fieldCount <= CBMC_MAX_FIELDS );
+
+    /* The field descriptors are defined at compile time and must fit in the destination. */
+    for( i = 0; i < CBMC_MAX_FIELDS; i++ )
+    {
+        __CPROVER_assume( ( ( uint32_t ) fields[ i ].offset + fields[ i ].size ) <= CBMC_MAX_DEST_SIZE );
+    }
+
+    char * pString = ( char * ) safeMalloc( stringLength );
+
+    if( ( pString != NULL ) && ensure_memory_is_valid( pString, stringLength ) )
+    {
+        Cellular_ATDecodeFields( pString, stringLength, fields, fieldCount, dest,
+                                 nondet_bool() ? &decodedFields : NULL );
+    }
+}
@@ -78,6 +78,11 @@ void harness()
             pString[ stringLength - 1 ] = '\0';
         }
 
+        if( pDelimiter != NULL )
+        {
+            ( ( char * ) pDelimiter )[ delLength - 1 ] = '\0';
+        }
+
         Cellular_ATGetSpecificNextTok( ppString, pDelimiter, ppTokOutput );
     }
 }
@@ -0,0 +1,83 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Cellular default config includes. */
+#include "cellular_config.h"
+#include "cellular_config_defaults.h"
+
+/* Cellular APIs includes. */
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_common_internal.h"
+#include "cellular_common_api.h"
+
+#define ensure_memory_is_valid( px, length )    ( px != NULL ) && ( length > 0 ) && __CPROVER_r_ok( ( px ), length )
+
+/****************************************************************
+* The signature of the function under test.
+****************************************************************/
+
+CellularATError_t Cellular_ATHexDecodeChunk( CellularATHexDecoder_t * pDecoder,
+                                             const char * pChunk,
+                                             uint16_t chunkLength,
+                                             uint8_t * pData,
+                                             uint16_t dataLength,
+                                             uint16_t * pDataDecoded );
+
+/****************************************************************
+* The proof of Cellular_ATHexDecodeChunk
+****************************************************************/
+void harness()
+{
+    CellularATHexDecoder_t * pDecoder;
+    uint16_t chunkLength;
+    uint16_t dataLength;
+    uint16_t * pDataDecoded;
+
+    __CPROVER_assume( chunkLength < CBMC_MAX_BUFSIZE );
+    __CPROVER_assume( dataLength < CBMC_MAX_BUFSIZE );
+
+    /* The chunk is not NULL terminated. */
+    char * pChunk = ( char * ) safeMalloc( chunkLength );
+    uint8_t * pData = ( uint8_t * ) safeMalloc( dataLength );
+
+    pDecoder = ( CellularATHexDecoder_t * ) safeMalloc( sizeof( CellularATHexDecoder_t ) );
+    pDataDecoded = ( uint16_t * ) safeMalloc( sizeof( uint16_t ) );
+
+    if( ( ( pChunk == NULL ) || ( chunkLength == 0U ) || ensure_memory_is_valid( pChunk, chunkLength ) ) &&
+        ( ( pData == NULL ) || ( dataLength == 0U ) || ensure_memory_is_valid( pData, dataLength ) ) )
+    {
+        if( ( Cellular_ATHexDecodeChunk( pDecoder, pChunk, chunkLength, pData, dataLength, pDataDecoded ) == CELLULAR_AT_SUCCESS ) &&
+            ( pDataDecoded != NULL ) )
+        {
+            __CPROVER_assert( *pDataDecoded <= dataLength, "Decoded bytes fit in the buffer" );
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Cellular default config includes. */
+#include "cellular_config.h"
+#include "cellular_config_defaults.h"
+
+/* Cellular APIs includes. */
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_common_internal.h"
+#include "cellular_common_api.h"
+
+/* Extern the com interface in comm_if_windows.c */
+extern CellularCommInterface_t CellularCommInterface;
+
+/****************************************************************
+* The signature of the function under test.
+****************************************************************/
+
+CellularATError_t Cellular_ATStrViewGetSpecificNextTok( CellularATStrView_t * pView,
+                                                        const char * pDelimiter,
+                                                        CellularATStrView_t * pToken );
+
+/****************************************************************
+* The proof of Cellular_ATStrViewGetSpecificNextTok
+****************************************************************/
+void harness()
+{
+    CellularATStrView_t view;
+    CellularATStrView_t * pToken;
+    const char * pDelimiter;
+    uint16_t stringLength;
+    uint16_t delLength;
+
+    __CPROVER_assume( stringLength < CBMC_MAX_BUFSIZE );
+    __CPROVER_assume( delLength > 0 && delLength < CBMC_MAX_BUFSIZE );
+
+    /* The string in the view is not NULL terminated. */
+    view.pStr = ( char * ) safeMalloc( stringLength );
+    view.length = stringLength;
+    pToken = ( CellularATStrView_t * ) safeMalloc( sizeof( CellularATStrView_t ) );
+    pDelimiter = ( char * ) safeMalloc( delLength );
+
+    if( pDelimiter != NULL )
+    {
+        ( ( char * ) pDelimiter )[ delLength - 1 ] = '\0';
+    }
+
+    Cellular_ATStrViewGetSpecificNextTok( nondet_bool() ? NULL : &view, pDelimiter, pToken );
+}
@@ -25,34 +25,43 @@
  * https://github.com/FreeRTOS
  */
 
-/**
- * @file strtol.c
- * @brief Creates a stub for strtol. This stub checks if, for the input copy
- * length, the destination and source are valid accessible memory.
- */
-
-#include <string.h>
+/* Standard includes. */
 #include <stdint.h>
 
-/* This is a clang macro not available on linux */
-#ifndef __has_builtin
-    #define __has_builtin( x )    0
-#endif
-
-#if __has_builtin( __builtin___strtol )
-    int32_t builtin - library - strtol( const char * nptr, char ** endptr, int32_t base )
-    {
-        int32_t ret = nondet_int();
-
-        return ( int64_t ) ret;
-    }
-#else
-    int64_t strtol( const char * nptr,
-                    char ** endptr,
-                    int32_t base )
-    {
-        int32_t ret = nondet_int();
-
-        return ( int64_t ) ret;
-    }
-#endif /* if __has_builtin( __builtin___strtol ) */
+/* Cellular default config includes. */
+#include "cellular_config.h"
+#include "cellular_config_defaults.h"
+
+/* Cellular APIs includes. */
+#include "cellular_platform.h"
+#include "cellular_types.h"
+#include "cellular_common_internal.h"
+#include "cellular_common_api.h"
+
+/* Extern the com interface in comm_if_windows.c */
+extern CellularCommInterface_t CellularCommInterface;
+
+/****************************************************************
+* The signature of the function under test.
+****************************************************************/
+
+CellularATError_t Cellular_ATStrViewNormalize( CellularATStrView_t * pView,
+                                               uint8_t flags );
+
+/****************************************************************
+* The proof of Cellular_ATStrViewNormalize
+****************************************************************/
+void harness()
+{
+    CellularATStrView_t view;
+    uint16_t stringLength;
+    uint8_t flags;
+
+    __CPROVER_assume( stringLength < CBMC_MAX_BUFSIZE );
+
+    /* The string in the view is not NULL terminated. */
+    view.pStr = ( char * ) safeMalloc( stringLength );
+    view.length = stringLength;
+
+    Cellular_ATStrViewNormalize( nondet_bool() ? NULL : &view, flags );
+}
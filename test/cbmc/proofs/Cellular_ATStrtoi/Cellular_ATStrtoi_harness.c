@@ -49,7 +49,7 @@ extern CellularCommInterface_t CellularCommInterface;
 
 CellularATError_t Cellular_ATStrtoi( const char * pStr,
                                      int32_t base,
-                                     long * pResult );
+                                     int32_t * pResult );
 
 /****************************************************************
 * The proof of Cellular_ATcheckErrorCode
@@ -62,7 +62,7 @@ void harness()
     __CPROVER_assume( stringLen < CBMC_MAX_BUFSIZE );
     __CPROVER_assume( stringLen > 0 );
     char * pInputBuf = ( char * ) safeMalloc( stringLen );
-    long * pResult = ( long * ) safeMalloc( sizeof( long * ) );
+    int32_t * pResult = ( int32_t * ) safeMalloc( sizeof( int32_t ) );
 
     if( ( pInputBuf == NULL ) || ( ( pInputBuf != NULL ) && ensure_memory_is_valid( pInputBuf, stringLen ) ) )
     {
@@ -40,10 +40,9 @@ void * memchr( void * ptr,
     /*to avoid unwind assertion on CBMC, use a constant loop time to enhance CBMC performance */
     int n = CBMC_MAX_BUFSIZE;
     char * p = ( char * ) ptr;
+    size_t remain = num;
 
-    ( void ) num;
-
-    while( n-- && p != NULL )
+    while( n-- && remain-- && p != NULL )
     {
         if( *p == ( char ) value )
         {
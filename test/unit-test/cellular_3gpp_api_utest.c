@@ -46,6 +46,7 @@
 
 #include "mock_cellular_common.h"
 #include "mock_cellular_at_core.h"
+#include "mock_cellular_pktio_internal.h"
 
 
 /**
@@ -99,21 +100,21 @@ static int cbCondition = 0;
 static int parseRegFailureCase = 0;
 static int parseNetworkTimeFailureCase = 0;
 static int parseNetworkNameFailureCase = 0;
-static int cpsms_pos_mode_error = 0;
 static int recvFuncGetHplmnCase = 0;
 static int parseHplmn_test = 0;
 static int simLockStateTestCase = 0;
 static int psmSettingsCheckTimerValue = 0;
 static int psmSettingsTimerIndex = -1;
-static int psmSettingsTimerError = 0;
 static int psmSettingsActiveTimerValue = 0;
-static int parseEidrxTokenOutOfRange = 0;
+static uint32_t psmDecodedFields = 0x1FU;
+static CellularATError_t psmDecodeFieldsReturn = CELLULAR_AT_SUCCESS;
 static int mallocAllocFail = 0;
-static int nullTokenFirst = 0;
+static int negativeTokenFirst = 0;
 static int checkCrsmReadStatusCase = 0;
 static int negativeNumberCase = 0;
 static int commonCase = 0;
 static int wrongDataLength = 0;
+static char firmwareVersionResult[ CELLULAR_FW_VERSION_MAX_SIZE + 1 ];
 
 /* ============================   UNITY FIXTURES ============================ */
 
@@ -124,17 +125,16 @@ void setUp()
     parseRegFailureCase = 0;
     parseNetworkTimeFailureCase = 0;
     parseNetworkNameFailureCase = 0;
-    cpsms_pos_mode_error = 0;
     recvFuncGetHplmnCase = 0;
     parseHplmn_test = 0;
     simLockStateTestCase = 0;
     psmSettingsCheckTimerValue = 0;
     psmSettingsTimerIndex = -1;
-    psmSettingsTimerError = 0;
     psmSettingsActiveTimerValue = 0;
-    parseEidrxTokenOutOfRange = 0;
+    psmDecodedFields = 0x1FU;
+    psmDecodeFieldsReturn = CELLULAR_AT_SUCCESS;
     mallocAllocFail = 0;
-    nullTokenFirst = 0;
+    negativeTokenFirst = 0;
     checkCrsmReadStatusCase = 0;
     negativeNumberCase = 0;
     commonCase = 0;
@@ -216,6 +216,17 @@ CellularPktStatus_t Mock_AtcmdRequestWithCallback( CellularContext_t * pContext,
     return CELLULAR_PKT_STATUS_OK;
 }
 
+static void _cmdBuilderIgnoreAndReturn( CellularATError_t finishStatus )
+{
+    Cellular_ATCmdBuilderInit_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATCmdAppendStr_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATCmdAppendQuotedStr_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATCmdAppendChar_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATCmdAppendUint_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATCmdAppendBinary_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATCmdBuilderFinish_IgnoreAndReturn( finishStatus );
+}
+
 static void _saveData( char * pLine,
                        CellularATCommandResponse_t * pResp,
                        uint32_t dataLen )
@@ -360,6 +371,48 @@ CellularPktStatus_t Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetNetworkTi
     return pktStatus;
 }
 
+/* Writes the +CPSMS fields selected by psmDecodedFields. The active time is in
+ * the T3324 timer unit psmSettingsTimerIndex. */
+CellularATError_t Mock_Cellular_ATDecodeFields( const char * pString,
+                                                uint16_t stringLength,
+                                                const CellularATFieldDesc_t * pFields,
+                                                uint8_t fieldCount,
+                                                void * pDest,
+                                                uint32_t * pDecodedFields,
+                                                int cmock_num_calls )
+{
+    uint8_t i = 0;
+    uint8_t value = 0;
+
+    ( void ) pString;
+    ( void ) stringLength;
+    ( void ) cmock_num_calls;
+
+    for( i = 0; i < fieldCount; i++ )
+    {
+        if( ( psmDecodedFields & ( 1U << i ) ) != 0U )
+        {
+            if( ( i == 4U ) && ( psmSettingsTimerIndex >= 0 ) )
+            {
+                value = ( uint8_t ) ( ( psmSettingsTimerIndex << 5U ) | psmSettingsActiveTimerValue );
+            }
+            else
+            {
+                value = 1U;
+            }
+
+            ( ( uint8_t * ) pDest )[ pFields[ i ].offset ] = value;
+        }
+    }
+
+    if( pDecodedFields != NULL )
+    {
+        *pDecodedFields = psmDecodedFields;
+    }
+
+    return psmDecodeFieldsReturn;
+}
+
 CellularATError_t Mock_Cellular_ATStrtoi( const char * pStr,
                                           int32_t base,
                                           int32_t * pResult,
@@ -509,10 +562,44 @@ CellularPktStatus_t Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGe
         _saveData( pLine, &atResp, strlen( pLine ) + 1 );
         pktStatus = atReq.respCallback( pContext, &atResp, pData, sizeof( pData ) );
     }
+    else if( cbCondition == 4 )
+    {
+        char pLine[] = " \t  ";
+
+        /* The firmware version response has only white spaces. */
+        memset( pData, 'X', sizeof( pData ) );
+        _saveData( pLine, &atResp, strlen( pLine ) + 1 );
+        pktStatus = atReq.respCallback( pContext, &atResp, pData, sizeof( pData ) );
+
+        if( cmock_num_calls == 0 )
+        {
+            ( void ) strncpy( firmwareVersionResult, pData, sizeof( firmwareVersionResult ) );
+        }
+    }
 
     return pktStatus;
 }
 
+CellularATError_t Mock_Cellular_ATNormalize_All_White_Spaces( char ** ppString,
+                                                              uint8_t flags,
+                                                              uint16_t * pLength,
+                                                              int cmock_num_calls )
+{
+    ( void ) cmock_num_calls;
+
+    /* The documented result of Cellular_ATNormalize for a string of white spaces.
+     * This is verified against the implementation in test_Cellular_ATNormalize_All_White_Spaces. */
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES | CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES, flags );
+    *ppString = &( ( *ppString )[ strlen( *ppString ) ] );
+
+    if( pLength != NULL )
+    {
+        *pLength = 0;
+    }
+
+    return CELLULAR_AT_SUCCESS;
+}
+
 CellularPktStatus_t Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGetImei( CellularContext_t * pContext,
                                                                                        CellularAtReq_t atReq,
                                                                                        int cmock_num_calls )
@@ -800,7 +887,14 @@ CellularPktStatus_t Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetPsmSettin
                 ulTimeValueSeconds = 0U;
             }
 
+            /* The fields not decoded are left unchanged. */
+            if( ( psmDecodedFields & ( 1U << 4 ) ) == 0U )
+            {
+                ulTimeValueSeconds = 0U;
+            }
+
             TEST_ASSERT_EQUAL_INT( ulTimeValueSeconds, cellularPsmSettings.activeTimeValue );
+            TEST_ASSERT_EQUAL( ( ( psmDecodedFields & 1U ) != 0U ) ? 1U : 0U, cellularPsmSettings.mode );
         }
     }
     else if( cbCondition == 4 )
@@ -1332,10 +1426,7 @@ CellularATError_t Mock_Cellular_ATGetNextTok_Calback( char ** ppString,
     CellularATError_t atCoreStatus = CELLULAR_AT_SUCCESS;
     char pFitNum[] = "1";
     char pBigNum[] = "32";
-    char pNumericNum[] = "123456";
     char pNegativeNum[] = "-3";
-    char pPositiveNum[] = "256";
-    int len = 10;
 
     ( void ) ppString;
 
@@ -1347,12 +1438,7 @@ CellularATError_t Mock_Cellular_ATGetNextTok_Calback( char ** ppString,
 
     if( cmock_num_calls == 0 )
     {
-        if( parseEidrxTokenOutOfRange == 1 )
-        {
-            *ppTokOutput = malloc( sizeof( pPositiveNum ) );
-            memcpy( *ppTokOutput, pPositiveNum, sizeof( pPositiveNum ) );
-        }
-        else if( parseEidrxTokenOutOfRange == 2 )
+        if( negativeTokenFirst == 1 )
         {
             *ppTokOutput = malloc( sizeof( pNegativeNum ) );
             memcpy( *ppTokOutput, pNegativeNum, sizeof( pNegativeNum ) );
@@ -1362,16 +1448,6 @@ CellularATError_t Mock_Cellular_ATGetNextTok_Calback( char ** ppString,
             *ppTokOutput = malloc( sizeof( pBigNum ) );
             memcpy( *ppTokOutput, pBigNum, sizeof( pBigNum ) );
         }
-        else if( cpsms_pos_mode_error == 1 )
-        {
-            *ppTokOutput = malloc( sizeof( pNumericNum ) );
-            memcpy( *ppTokOutput, pNumericNum, sizeof( pNumericNum ) );
-        }
-        else if( cpsms_pos_mode_error == 2 )
-        {
-            *ppTokOutput = malloc( sizeof( pNegativeNum ) );
-            memcpy( *ppTokOutput, pNegativeNum, sizeof( pNegativeNum ) );
-        }
         else
         {
             *ppTokOutput = malloc( sizeof( pFitNum ) );
@@ -1380,18 +1456,8 @@ CellularATError_t Mock_Cellular_ATGetNextTok_Calback( char ** ppString,
     }
     else if( cmock_num_calls == 1 )
     {
-        if( parseEidrxTokenOutOfRange == 1 )
-        {
-            *ppTokOutput = malloc( sizeof( pPositiveNum ) );
-            memcpy( *ppTokOutput, pPositiveNum, sizeof( pPositiveNum ) );
-        }
-        else if( parseEidrxTokenOutOfRange == 2 )
-        {
-            *ppTokOutput = malloc( sizeof( pNegativeNum ) );
-            memcpy( *ppTokOutput, pNegativeNum, sizeof( pNegativeNum ) );
-        }
         /* null data pointer. */
-        else if( parseNetworkTimeFailureCase == 1 )
+        if( parseNetworkTimeFailureCase == 1 )
         {
             *ppTokOutput = NULL;
         }
@@ -1415,72 +1481,17 @@ CellularATError_t Mock_Cellular_ATGetNextTok_Calback( char ** ppString,
             memcpy( *ppTokOutput, pFitNum, sizeof( pFitNum ) );
         }
     }
-    else if( cmock_num_calls == 2 )
-    {
-        if( parseEidrxTokenOutOfRange == 1 )
-        {
-            nullTokenFirst = 1;
-        }
-        else
-        {
-            *ppTokOutput = malloc( sizeof( pFitNum ) );
-            memcpy( *ppTokOutput, pFitNum, sizeof( pFitNum ) );
-        }
-    }
     else if( cmock_num_calls < 7 )
     {
-        if( cmock_num_calls == 3 )
-        {
-            if( psmSettingsTimerIndex >= 0 )
-            {
-                int t3412TimerInx = ( psmSettingsTimerIndex << 5U );
-
-                if( psmSettingsTimerError == 1 )
-                {
-                    t3412TimerInx = 0 - t3412TimerInx;
-                }
-
-                *ppTokOutput = malloc( len );
-                snprintf( *ppTokOutput, len, "%d", t3412TimerInx );
-            }
-            else
-            {
-                *ppTokOutput = malloc( sizeof( pFitNum ) );
-                memcpy( *ppTokOutput, pFitNum, sizeof( pFitNum ) );
-            }
-        }
-        else
-        {
-            if( ( cmock_num_calls == 4 ) && ( psmSettingsTimerIndex >= 0 ) )
-            {
-                int t3324TimerInx = ( psmSettingsTimerIndex << 5U );
-
-                if( psmSettingsTimerError == 1 )
-                {
-                    t3324TimerInx = 0 - t3324TimerInx;
-                }
-
-                *ppTokOutput = malloc( len );
-                snprintf( *ppTokOutput, len, "%d", t3324TimerInx | psmSettingsActiveTimerValue );
-            }
-            else
-            {
-                *ppTokOutput = malloc( sizeof( pFitNum ) );
-                memcpy( *ppTokOutput, pFitNum, sizeof( pFitNum ) );
-            }
-        }
+        *ppTokOutput = malloc( sizeof( pFitNum ) );
+        memcpy( *ppTokOutput, pFitNum, sizeof( pFitNum ) );
     }
     else
     {
         atCoreStatus = CELLULAR_AT_ERROR;
     }
 
-    if( nullTokenFirst == 1 )
-    {
-        *ppTokOutput = NULL;
-        atCoreStatus = CELLULAR_AT_SUCCESS;
-    }
-    else if( *ppTokOutput == NULL )
+    if( *ppTokOutput == NULL )
     {
         atCoreStatus = CELLULAR_AT_ERROR;
     }
@@ -1713,7 +1724,6 @@ void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_E
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_Cellular_RecvFuncGetEidrxSettings );
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_ERROR );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetEidrxSettings( cellularHandle, &eidrxSettingsList );
@@ -1739,9 +1749,7 @@ void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_I
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_Cellular_RecvFuncGetEidrxSettings );
 
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATDecodeFields_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     cellularStatus = Cellular_CommonGetEidrxSettings( cellularHandle, &eidrxSettingsList );
@@ -1749,10 +1757,10 @@ void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_I
 }
 
 /**
- * @brief Test that CELLULAR_CEDRXS_POS_ACT case in callback function Cellular_RecvFuncGetEidrxSettings
- * for Cellular_CommonGetEidrxSettings to return CELLULAR_INTERNAL_FAILURE.
+ * @brief Test that the fields failed to decode in callback function Cellular_RecvFuncGetEidrxSettings
+ * are ignored for Cellular_CommonGetEidrxSettings to return CELLULAR_SUCCESS.
  */
-void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_CEDRXS_POS_ACT_OutOfRange( void )
+void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_Decode_Fields_Error( void )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t context;
@@ -1767,21 +1775,18 @@ void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_C
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_Cellular_RecvFuncGetEidrxSettings );
 
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    parseEidrxTokenOutOfRange = 1;
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    Cellular_ATDecodeFields_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_SUCCESS, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_OK, CELLULAR_SUCCESS );
     cellularStatus = Cellular_CommonGetEidrxSettings( cellularHandle, &eidrxSettingsList );
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
 }
 
 /**
- * @brief Test that out of lower bound range case in callback function Cellular_RecvFuncGetEidrxSettings
- * for Cellular_CommonGetEidrxSettings to return CELLULAR_INTERNAL_FAILURE.
+ * @brief Test that Cellular_ATDecodeFields bad parameter case in callback function Cellular_RecvFuncGetEidrxSettings
+ * for Cellular_CommonGetEidrxSettings to return CELLULAR_BAD_PARAMETER.
  */
-void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_OutOfLowerBound_Range( void )
+void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_Decode_Fields_Bad_Parameter( void )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t context;
@@ -1796,41 +1801,11 @@ void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_O
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_Cellular_RecvFuncGetEidrxSettings );
 
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    parseEidrxTokenOutOfRange = 2;
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
-    cellularStatus = Cellular_CommonGetEidrxSettings( cellularHandle, &eidrxSettingsList );
-    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
-}
-
-/**
- * @brief Test that atoi failure case in parseEidrxToken called by callback function Cellular_RecvFuncGetEidrxSettings
- * for Cellular_CommonGetEidrxSettings to return CELLULAR_INTERNAL_FAILURE.
- */
-void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_Atoi_Failed_In_parseEidrxToken( void )
-{
-    CellularError_t cellularStatus = CELLULAR_SUCCESS;
-    CellularContext_t context;
-
-    memset( &context, 0, sizeof( CellularContext_t ) );
-    CellularHandle_t cellularHandle = &context;
-    CellularEidrxSettingsList_t eidrxSettingsList;
-
-    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
-    _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
-    cbCondition = 3;
-    _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_Cellular_RecvFuncGetEidrxSettings );
-    Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_IgnoreAndReturn( CELLULAR_AT_ERROR );
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    Cellular_ATDecodeFields_IgnoreAndReturn( CELLULAR_AT_BAD_PARAMETER );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_BAD_PARAMETER, CELLULAR_PKT_STATUS_BAD_PARAM );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_BAD_PARAM, CELLULAR_BAD_PARAMETER );
     cellularStatus = Cellular_CommonGetEidrxSettings( cellularHandle, &eidrxSettingsList );
-    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
 }
 
 /**
@@ -1851,9 +1826,7 @@ void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_H
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_Cellular_RecvFuncGetEidrxSettings );
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATDecodeFields_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     cellularStatus = Cellular_CommonGetEidrxSettings( cellularHandle, &eidrxSettingsList );
@@ -1881,9 +1854,7 @@ void test_Cellular_CommonGetEidrxSettings_Cb_Cellular_RecvFuncGetEidrxSettings_O
     cbCondition = 5;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_Cellular_RecvFuncGetEidrxSettings );
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATDecodeFields_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_SIZE_MISMATCH, CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetEidrxSettings( cellularHandle, &eidrxSettingsList );
@@ -1948,6 +1919,7 @@ void test_Cellular_CommonSetEidrxSettings_AtCmd_Failure( void )
     CellularHandle_t cellularHandle = &context;
     CellularEidrxSettings_t eidrxSettings;
 
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_TIMED_OUT );
     _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_TIMED_OUT, CELLULAR_TIMEOUT );
@@ -1968,6 +1940,7 @@ void test_Cellular_CommonSetEidrxSettings_Happy_Path( void )
     CellularEidrxSettings_t eidrxSettings;
 
     eidrxSettings.requestedEdrxValue = 0xF;
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     cellularStatus = Cellular_CommonSetEidrxSettings( cellularHandle, &eidrxSettings );
@@ -2514,7 +2487,7 @@ void test_Cellular_CommonGetRegisteredNetwork_Cb__Cellular_RecvFuncUpdateMccMnc_
     Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     Cellular_ATRemoveAllWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     /* _parseCops */
-    parseEidrxTokenOutOfRange = 2;
+    negativeTokenFirst = 1;
     Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
     Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
 
@@ -4942,7 +4915,7 @@ void test_Cellular_CommonGetModemInfo_Get_FW_Callback__Cellular_RecvFuncGetFirmw
     /* atReqGetFirmwareVersion */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGetFirmwareVersion );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_ERROR );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -4967,8 +4940,7 @@ void test_Cellular_CommonGetModemInfo_Get_FW_Callback__Cellular_RecvFuncGetFirmw
     /* atReqGetFirmwareVersion */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGetFirmwareVersion );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveTrailingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_ERROR );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -4993,14 +4965,40 @@ void test_Cellular_CommonGetModemInfo_Get_FW_Callback__Cellular_RecvFuncGetFirmw
     /* atReqGetFirmwareVersion */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGetFirmwareVersion );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveTrailingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
 }
 
+/**
+ * @brief Test that get firmware version callback function returns an empty firmware
+ * version for a response of white spaces in Cellular_CommonGetModemInfo.
+ */
+void test_Cellular_CommonGetModemInfo_Get_FW_Callback__Cellular_RecvFuncGetFirmwareVersion_All_White_Spaces( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+    CellularModemInfo_t modemInfo;
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+
+    /* atReqGetFirmwareVersion */
+    cbCondition = 4;
+    memset( firmwareVersionResult, 'X', sizeof( firmwareVersionResult ) );
+    _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGetFirmwareVersion );
+    Cellular_ATNormalize_StubWithCallback( Mock_Cellular_ATNormalize_All_White_Spaces );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_SUCCESS, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "", firmwareVersionResult );
+}
+
 /**
  * @brief Test that get imei version callback function null context failure
  * case Cellular_CommonGetModemInfo to return CELLULAR_INTERNAL_FAILURE.
@@ -5138,7 +5136,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetIme
     /* atReqGetImei */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGetImei );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_ERROR );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -5162,8 +5160,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetIme
     /* atReqGetImei */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGetImei );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_ERROR );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -5187,8 +5184,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetIme
     /* atReqGetImei */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular__Cellular_RecvFuncGetImei );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -5363,7 +5359,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetMod
     /* atReqGetModelId */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetModelId );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_ERROR );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -5387,8 +5383,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetMod
     /* atReqGetModelId */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetModelId );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveTrailingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_ERROR );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -5412,8 +5407,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetMod
     /* atReqGetModelId */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetModelId );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveTrailingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -5588,7 +5582,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetMan
     /* atReqGetManufactureId */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetManufactureId );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_ERROR );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -5612,8 +5606,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetMan
     /* atReqGetManufactureId */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetManufactureId );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveTrailingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_ERROR );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -5637,8 +5630,7 @@ void test_Cellular_CommonGetModemInfo_Get_Imei_Callback__Cellular_RecvFuncGetMan
     /* atReqGetManufactureId */
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetManufactureId );
-    Cellular_ATRemoveLeadingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveTrailingWhiteSpaces_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
+    Cellular_ATNormalize_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     cellularStatus = Cellular_CommonGetModemInfo( cellularHandle, &modemInfo );
@@ -6053,6 +6045,7 @@ void test_Cellular_CommonSetPdnConfig_Bad_Pdn_Context_Type( void )
     CellularPdnConfig_t pdnConfig;
 
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
 
@@ -6075,6 +6068,7 @@ void test_Cellular_CommonSetPdnConfig_AtCmd_Failure( void )
     pdnConfig.pdnContextType = CELLULAR_PDN_CONTEXT_IPV4;
 
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_BAD_PARAM );
     _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_BAD_PARAM, CELLULAR_INTERNAL_FAILURE );
@@ -6097,6 +6091,7 @@ void test_Cellular_CommonSetPdnConfig_IPV6_Happy_Path( void )
     pdnConfig.pdnContextType = CELLULAR_PDN_CONTEXT_IPV6;
 
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
 
@@ -6119,6 +6114,7 @@ void test_Cellular_CommonSetPdnConfig_IPV4V6_Happy_Path( void )
     pdnConfig.pdnContextType = CELLULAR_PDN_CONTEXT_IPV4V6;
 
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
 
@@ -6126,6 +6122,227 @@ void test_Cellular_CommonSetPdnConfig_IPV4V6_Happy_Path( void )
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
 }
 
+/**
+ * @brief Test that too long at command case Cellular_CommonSetPdnConfig to return CELLULAR_BAD_PARAMETER.
+ */
+void test_Cellular_CommonSetPdnConfig_AtCmd_Too_Long( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+    CellularPdnConfig_t pdnConfig;
+
+    pdnConfig.pdnContextType = CELLULAR_PDN_CONTEXT_IPV4;
+
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_NO_MEMORY );
+    _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+
+    cellularStatus = Cellular_CommonSetPdnConfig( cellularHandle, 0, &pdnConfig );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
+/* Data mode receive callback for the data mode tests. */
+static void _dataModeReceiveCallback( const uint8_t * pData,
+                                      uint32_t dataLength,
+                                      void * pCallbackContext )
+{
+    ( void ) pData;
+    ( void ) dataLength;
+    ( void ) pCallbackContext;
+}
+
+/* Data mode exit callback for the data mode tests. */
+static void _dataModeExitCallback( void * pCallbackContext )
+{
+    ( void ) pCallbackContext;
+}
+
+/**
+ * @brief Test that NULL receive callback case Cellular_CommonDataModeEnter to return CELLULAR_BAD_PARAMETER.
+ */
+void test_Cellular_CommonDataModeEnter_Bad_Parameter( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    cellularStatus = Cellular_CommonDataModeEnter( cellularHandle, 1, NULL, _dataModeExitCallback, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test that data mode already started case Cellular_CommonDataModeEnter to return error without dialing.
+ */
+void test_Cellular_CommonDataModeEnter_Already_Started( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_PktioDataModeStart_ExpectAndReturn( &context, "ATD*99***1#", _dataModeReceiveCallback, _dataModeExitCallback,
+                                                  NULL, CELLULAR_PKT_STATUS_BAD_REQUEST );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_BAD_REQUEST, CELLULAR_INTERNAL_FAILURE );
+
+    cellularStatus = Cellular_CommonDataModeEnter( cellularHandle, 1, _dataModeReceiveCallback, _dataModeExitCallback, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+}
+
+/**
+ * @brief Test that dial failure case Cellular_CommonDataModeEnter to stop the data mode.
+ */
+void test_Cellular_CommonDataModeEnter_Dial_Failure( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_PktioDataModeStart_ExpectAndReturn( &context, "ATD*99***1#", _dataModeReceiveCallback, _dataModeExitCallback,
+                                                  NULL, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_OK, CELLULAR_SUCCESS );
+    _Cellular_AtcmdRequestSuccessToken_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
+    _Cellular_PktioDataModeStop_Expect( &context );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_FAILURE, CELLULAR_INTERNAL_FAILURE );
+
+    cellularStatus = Cellular_CommonDataModeEnter( cellularHandle, 1, _dataModeReceiveCallback, _dataModeExitCallback, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+}
+
+/**
+ * @brief Test that happy path case Cellular_CommonDataModeEnter to return CELLULAR_SUCCESS.
+ */
+void test_Cellular_CommonDataModeEnter_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_PktioDataModeStart_ExpectAndReturn( &context, "ATD*99***1#", _dataModeReceiveCallback, _dataModeExitCallback,
+                                                  NULL, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_OK, CELLULAR_SUCCESS );
+    _Cellular_AtcmdRequestSuccessToken_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+
+    cellularStatus = Cellular_CommonDataModeEnter( cellularHandle, 1, _dataModeReceiveCallback, _dataModeExitCallback, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+}
+
+/**
+ * @brief Test that not in data mode case Cellular_CommonDataModeSend to return CELLULAR_NOT_ALLOWED.
+ */
+void test_Cellular_CommonDataModeSend_Not_In_Data_Mode( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    uint8_t data[] = { 0x7EU, 0xFFU, 0x03U };
+    uint32_t sentLength = 0;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_PktioDataModeIsActive_ExpectAndReturn( &context, false );
+
+    cellularStatus = Cellular_CommonDataModeSend( cellularHandle, data, sizeof( data ), &sentLength );
+    TEST_ASSERT_EQUAL( CELLULAR_NOT_ALLOWED, cellularStatus );
+}
+
+/**
+ * @brief Test that happy path case Cellular_CommonDataModeSend to return the sent length.
+ */
+void test_Cellular_CommonDataModeSend_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    uint8_t data[] = { 0x7EU, 0xFFU, 0x03U };
+    uint32_t sentLength = 0;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_PktioDataModeIsActive_ExpectAndReturn( &context, true );
+    _Cellular_PktioSendData_ExpectAndReturn( &context, data, sizeof( data ), sizeof( data ) );
+
+    cellularStatus = Cellular_CommonDataModeSend( cellularHandle, data, sizeof( data ), &sentLength );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( sizeof( data ), sentLength );
+}
+
+/**
+ * @brief Test that not in data mode case Cellular_CommonDataModeExit to return CELLULAR_NOT_ALLOWED.
+ */
+void test_Cellular_CommonDataModeExit_Not_In_Data_Mode( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_PktioDataModeIsActive_ExpectAndReturn( &context, false );
+
+    cellularStatus = Cellular_CommonDataModeExit( cellularHandle );
+    TEST_ASSERT_EQUAL( CELLULAR_NOT_ALLOWED, cellularStatus );
+}
+
+/**
+ * @brief Test that escape failure case Cellular_CommonDataModeExit doesn't hang up the call.
+ */
+void test_Cellular_CommonDataModeExit_Escape_Failure( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_PktioDataModeIsActive_ExpectAndReturn( &context, true );
+    _Cellular_PktioDataModeEscape_ExpectAndReturn( &context, CELLULAR_PKT_STATUS_SEND_ERROR );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_SEND_ERROR, CELLULAR_INTERNAL_FAILURE );
+
+    cellularStatus = Cellular_CommonDataModeExit( cellularHandle );
+    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+}
+
+/**
+ * @brief Test that happy path case Cellular_CommonDataModeExit to return CELLULAR_SUCCESS.
+ */
+void test_Cellular_CommonDataModeExit_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    CellularHandle_t cellularHandle = &context;
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_PktioDataModeIsActive_ExpectAndReturn( &context, true );
+    _Cellular_PktioDataModeEscape_ExpectAndReturn( &context, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_OK, CELLULAR_SUCCESS );
+    _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+
+    cellularStatus = Cellular_CommonDataModeExit( cellularHandle );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+}
+
 /**
  * @brief Test that NULL handler case Cellular_CommonGetSimCardLockStatus to return CELLULAR_INVALID_HANDLE.
  */
@@ -7860,6 +8077,7 @@ void test_Cellular_CommonSetPsmSettings_AtCmd_Failure( void )
     psmSettings.periodicTauValue = 0xfc;
     psmSettings.activeTimeValue = 0x1;
 
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
 
     _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_TIMED_OUT );
@@ -7885,6 +8103,7 @@ void test_Cellular_CommonSetPsmSettings_Happy_Path( void )
     psmSettings.gprsReadyTimer = 0x99;
     psmSettings.periodicTauValue = 0x4;
     psmSettings.activeTimeValue = 0x0;
+    _cmdBuilderIgnoreAndReturn( CELLULAR_AT_SUCCESS );
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     _Cellular_AtcmdRequestWithCallback_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
 
@@ -8089,8 +8308,8 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Null_
 }
 
 /**
- * @brief Test that Cellular_ATRemovePrefix error case in Cellular_CommonGetPsmSettings
- * for Cellular_CommonGetPsmSettings to return CELLULAR_INTERNAL_FAILURE.
+ * @brief Test that Cellular_ATRemovePrefix error case in callback function _Cellular_RecvFuncGetPsmSettings
+ * for Cellular_CommonGetPsmSettings to return CELLULAR_BAD_PARAMETER.
  */
 void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_AtCmd_Error_Path( void )
 {
@@ -8101,30 +8320,26 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_AtCmd
     CellularHandle_t cellularHandle = &context;
     CellularPsmSettings_t psmSettings;
 
-
     _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetPsmSettings );
 
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_BAD_PARAMETER );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    cpsms_pos_mode_error = 1;
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
 
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_BAD_PARAMETER, CELLULAR_PKT_STATUS_BAD_PARAM );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_BAD_PARAM, CELLULAR_BAD_PARAMETER );
 
     cellularStatus = Cellular_CommonGetPsmSettings( cellularHandle, &psmSettings );
-    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
 }
 
 /**
- * @brief Test that null token first error case in callback function _Cellular_RecvFuncGetPsmSettings
- * for Cellular_CommonGetPsmSettings to return CELLULAR_INTERNAL_FAILURE.
+ * @brief Test that the timers are omitted in the +CPSMS response in callback function
+ * _Cellular_RecvFuncGetPsmSettings. Only the mode is stored and Cellular_CommonGetPsmSettings
+ * returns CELLULAR_SUCCESS.
  */
-void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Null_Token_First( void )
+void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Mode_Only( void )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t context;
@@ -8137,25 +8352,26 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Null_
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetPsmSettings );
+    psmSettingsCheckTimerValue = 1;
+    psmSettingsTimerIndex = 1;
+    psmSettingsActiveTimerValue = 2;
+    psmDecodedFields = 0x01U;
 
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    nullTokenFirst = 1;
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_SUCCESS, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_OK, CELLULAR_SUCCESS );
 
     cellularStatus = Cellular_CommonGetPsmSettings( cellularHandle, &psmSettings );
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
 }
 
 /**
- * @brief Test that CPSMS_POS_MODE error case in callback function _Cellular_RecvFuncGetPsmSettings
- * for Cellular_CommonGetPsmSettings to return CELLULAR_INTERNAL_FAILURE.
+ * @brief Test that Cellular_ATDecodeFields bad parameter case in callback function _Cellular_RecvFuncGetPsmSettings
+ * for Cellular_CommonGetPsmSettings to return CELLULAR_BAD_PARAMETER.
  */
-void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_CPSMS_AtStrtoi_Error_Path( void )
+void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Decode_Fields_Bad_Parameter( void )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t context;
@@ -8168,25 +8384,24 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_CPSMS
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetPsmSettings );
+    psmDecodeFieldsReturn = CELLULAR_AT_BAD_PARAMETER;
 
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    cpsms_pos_mode_error = 1;
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_IgnoreAndReturn( CELLULAR_AT_ERROR );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_FAILURE );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_INTERNAL_FAILURE );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_BAD_PARAMETER, CELLULAR_PKT_STATUS_BAD_PARAM );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_BAD_PARAM, CELLULAR_BAD_PARAMETER );
 
     cellularStatus = Cellular_CommonGetPsmSettings( cellularHandle, &psmSettings );
-    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
 }
 
 /**
- * @brief Test that CPSMS_POS_MODE error case in callback function _Cellular_RecvFuncGetPsmSettings
- * for Cellular_CommonGetPsmSettings to return CELLULAR_INTERNAL_FAILURE.
+ * @brief Test that invalid mode case in callback function _Cellular_RecvFuncGetPsmSettings.
+ * The mode is left unchanged, the timers are stored and Cellular_CommonGetPsmSettings
+ * returns CELLULAR_SUCCESS.
  */
-void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_CPSMS_Error_Path( void )
+void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Decode_Fields_Mode_Error( void )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t context;
@@ -8199,25 +8414,27 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_CPSMS
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetPsmSettings );
+    psmSettingsCheckTimerValue = 1;
+    psmSettingsTimerIndex = 1;
+    psmSettingsActiveTimerValue = 2;
+    psmDecodedFields = 0x1EU;
+    psmDecodeFieldsReturn = CELLULAR_AT_ERROR;
 
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    cpsms_pos_mode_error = 1;
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_SUCCESS, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_OK, CELLULAR_SUCCESS );
 
     cellularStatus = Cellular_CommonGetPsmSettings( cellularHandle, &psmSettings );
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
 }
 
 /**
- * @brief Test that CPSMS_POS_MODE negative number error case in callback function _Cellular_RecvFuncGetPsmSettings
- * for Cellular_CommonGetPsmSettings to return CELLULAR_INTERNAL_FAILURE.
+ * @brief Test that invalid active time case in callback function _Cellular_RecvFuncGetPsmSettings.
+ * The active time is left unchanged and Cellular_CommonGetPsmSettings returns CELLULAR_SUCCESS.
  */
-void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_CPSMS_Negative_Number_Error_Path( void )
+void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Decode_Fields_Timer_Error( void )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t context;
@@ -8230,15 +8447,17 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_CPSMS
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetPsmSettings );
+    psmSettingsCheckTimerValue = 1;
+    psmSettingsTimerIndex = 1;
+    psmSettingsActiveTimerValue = 2;
+    psmDecodedFields = 0x0FU;
+    psmDecodeFieldsReturn = CELLULAR_AT_ERROR;
 
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    cpsms_pos_mode_error = 2;
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_SUCCESS, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_OK, CELLULAR_SUCCESS );
 
     cellularStatus = Cellular_CommonGetPsmSettings( cellularHandle, &psmSettings );
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
@@ -8265,9 +8484,7 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
     psmSettingsTimerIndex = 0;
     psmSettingsActiveTimerValue = 2;
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
@@ -8297,9 +8514,7 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
     psmSettingsTimerIndex = 1;
     psmSettingsActiveTimerValue = 2;
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
@@ -8329,9 +8544,7 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
     psmSettingsTimerIndex = 2;
     psmSettingsActiveTimerValue = 2;
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
@@ -8361,9 +8574,7 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
     psmSettingsTimerIndex = 3;
     psmSettingsActiveTimerValue = 2;
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
@@ -8393,9 +8604,7 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
     psmSettingsTimerIndex = 4;
     psmSettingsActiveTimerValue = 2;
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
@@ -8425,9 +8634,7 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
     psmSettingsTimerIndex = 5;
     psmSettingsActiveTimerValue = 2;
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
@@ -8457,9 +8664,7 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
     psmSettingsTimerIndex = 6;
     psmSettingsActiveTimerValue = 2;
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
@@ -8489,9 +8694,7 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
     psmSettingsTimerIndex = 7;
     psmSettingsActiveTimerValue = 2;
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
     _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
     _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
@@ -8501,10 +8704,10 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Happy
 }
 
 /**
- * @brief Test that timer error return case in callback function _Cellular_RecvFuncGetPsmSettings
- * for Cellular_CommonGetPsmSettings to return CELLULAR_SUCCESS.
+ * @brief Test that all timers invalid case in callback function _Cellular_RecvFuncGetPsmSettings.
+ * Only the mode is stored and Cellular_CommonGetPsmSettings returns CELLULAR_SUCCESS.
  */
-void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Timer_Error_Return( void )
+void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Decode_Fields_All_Timers_Error( void )
 {
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     CellularContext_t context;
@@ -8517,15 +8720,17 @@ void test_Cellular_CommonGetPsmSettings_Cb_Cellular_RecvFuncGetPsmSettings_Timer
     _Cellular_IsValidPdn_IgnoreAndReturn( CELLULAR_SUCCESS );
     cbCondition = 3;
     _Cellular_AtcmdRequestWithCallback_StubWithCallback( Mock_AtcmdRequestWithCallback__Cellular_RecvFuncGetPsmSettings );
-    psmSettingsTimerIndex = 2;
-    psmSettingsTimerError = 1;
+    psmSettingsCheckTimerValue = 1;
+    psmSettingsTimerIndex = 1;
+    psmSettingsActiveTimerValue = 2;
+    psmDecodedFields = 0x01U;
+    psmDecodeFieldsReturn = CELLULAR_AT_ERROR;
+
     Cellular_ATRemovePrefix_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATRemoveAllDoubleQuote_IgnoreAndReturn( CELLULAR_AT_SUCCESS );
-    Cellular_ATGetNextTok_StubWithCallback( Mock_Cellular_ATGetNextTok_Calback );
-    Cellular_ATStrtoi_StubWithCallback( Mock_Cellular_ATStrtoi );
+    Cellular_ATDecodeFields_StubWithCallback( Mock_Cellular_ATDecodeFields );
 
-    _Cellular_TranslateAtCoreStatus_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
-    _Cellular_TranslatePktStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_TranslateAtCoreStatus_ExpectAndReturn( CELLULAR_AT_SUCCESS, CELLULAR_PKT_STATUS_OK );
+    _Cellular_TranslatePktStatus_ExpectAndReturn( CELLULAR_PKT_STATUS_OK, CELLULAR_SUCCESS );
 
     cellularStatus = Cellular_CommonGetPsmSettings( cellularHandle, &psmSettings );
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
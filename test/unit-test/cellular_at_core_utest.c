@@ -30,6 +30,7 @@
  * @brief Unit tests for functions in cellular_at_core.h.
  */
 
+#include <stddef.h>
 #include <string.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -639,6 +640,358 @@ void test_Cellular_ATGetSpecificNextTok_Error_Path( void )
     TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
 }
 
+/**
+ * @brief Test Cellular_ATGetSpecificNextTok iterates empty fields and returns CELLULAR_AT_SUCCESS.
+ */
+void test_Cellular_ATGetSpecificNextTok_Happy_Path_Empty_Field( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    char pStringBuf[] = "a,,b,";
+    char * pString = pStringBuf;
+    char * pTokOutput = NULL;
+
+    cellularStatus = Cellular_ATGetSpecificNextTok( &pString, ",", &pTokOutput );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "a", pTokOutput );
+
+    cellularStatus = Cellular_ATGetSpecificNextTok( &pString, ",", &pTokOutput );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "", pTokOutput );
+
+    cellularStatus = Cellular_ATGetSpecificNextTok( &pString, ",", &pTokOutput );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "b", pTokOutput );
+
+    cellularStatus = Cellular_ATGetSpecificNextTok( &pString, ",", &pTokOutput );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test Cellular_ATGetSpecificNextTok skips leading delimiters other than the first delimiter.
+ */
+void test_Cellular_ATGetSpecificNextTok_Happy_Path_Delimiter_Set( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    char pStringBuf[] = ",:TOKEN1:TOKEN2";
+    char * pString = pStringBuf;
+    char * pTokOutput = NULL;
+
+    cellularStatus = Cellular_ATGetSpecificNextTok( &pString, ":,", &pTokOutput );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "TOKEN1", pTokOutput );
+    TEST_ASSERT_EQUAL_STRING( "TOKEN2", pString );
+}
+
+/**
+ * @brief Test Cellular_ATGetSpecificNextTok returns CELLULAR_AT_ERROR if the string only has delimiters.
+ */
+void test_Cellular_ATGetSpecificNextTok_Only_Delimiters( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    char pStringBuf[] = ",:";
+    char * pString = pStringBuf;
+    char * pTokOutput = NULL;
+
+    cellularStatus = Cellular_ATGetSpecificNextTok( &pString, ":,", &pTokOutput );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Test that invalid parameters cause Cellular_ATTokenCursorInit to return CELLULAR_AT_BAD_PARAMETER.
+ */
+void test_Cellular_ATTokenCursorInit_Invalid_Param( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATTokenCursor_t cursor;
+
+    cellularStatus = Cellular_ATTokenCursorInit( NULL, "1,2", 3, ',' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorInit( &cursor, NULL, 3, ',' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorInit( &cursor, "1,2", 3, '"' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorInit( &cursor, "1,2", 3, '\0' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorInit( &cursor, CELLULAR_SAMPLE_PREFIX_STRING_LARGE_INPUT,
+                                                 CELLULAR_AT_MAX_STRING_SIZE + 1U, ',' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test that Cellular_ATTokenCursorNext returns quoted and empty fields without modifying the string.
+ */
+void test_Cellular_ATTokenCursorNext_Happy_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    const char * pString = "1,\"a,b\",,\"\",";
+    CellularATTokenCursor_t cursor;
+    CellularATToken_t token;
+
+    cellularStatus = Cellular_ATTokenCursorInit( &cursor, pString, ( uint16_t ) strlen( pString ), ',' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, token.tokenLength );
+    TEST_ASSERT_EQUAL_PTR( pString, token.pToken );
+    TEST_ASSERT_EQUAL( false, token.quoted );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 3, token.tokenLength );
+    TEST_ASSERT_EQUAL( 0, strncmp( "a,b", token.pToken, token.tokenLength ) );
+    TEST_ASSERT_EQUAL( true, token.quoted );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, token.tokenLength );
+    TEST_ASSERT_EQUAL( false, token.quoted );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, token.tokenLength );
+    TEST_ASSERT_EQUAL( true, token.quoted );
+
+    /* Empty field after the trailing delimiter. */
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, token.tokenLength );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Test that Cellular_ATTokenCursorNext returns no field for an empty string.
+ */
+void test_Cellular_ATTokenCursorNext_Empty_String( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATTokenCursor_t cursor;
+    CellularATToken_t token;
+
+    cellularStatus = Cellular_ATTokenCursorInit( &cursor, "", 0, ',' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Test the error path for Cellular_ATTokenCursorNext to return CELLULAR_AT_BAD_PARAMETER.
+ */
+void test_Cellular_ATTokenCursorNext_Error_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    const char * pString = "1,\"a,b";
+    CellularATTokenCursor_t cursor;
+    CellularATToken_t token;
+
+    cellularStatus = Cellular_ATTokenCursorNext( NULL, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorInit( &cursor, pString, ( uint16_t ) strlen( pString ), ',' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    /* Unterminated double quote. */
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATTokenCursorNext( &cursor, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Destination structure for the Cellular_ATDecodeFields tests.
+ */
+typedef struct testDecodeFields
+{
+    uint8_t rat;
+    int16_t rssi;
+    int32_t cellId;
+    uint8_t hexValue[ 2 ];
+    char name[ 8 ];
+} testDecodeFields_t;
+
+/**
+ * @brief Field descriptors for the Cellular_ATDecodeFields tests.
+ */
+static const CellularATFieldDesc_t testDecodeFieldsDesc[] =
+{
+    { CELLULAR_AT_FIELD_INT,    10U, 0U,                              ( uint16_t ) offsetof( testDecodeFields_t, rat ),      ( uint16_t ) sizeof( uint8_t ),   0,                ( int32_t ) UINT8_MAX },
+    { CELLULAR_AT_FIELD_INT,    10U, 0U,                              ( uint16_t ) offsetof( testDecodeFields_t, rssi ),     ( uint16_t ) sizeof( int16_t ),   INT16_MIN,        INT16_MAX             },
+    { CELLULAR_AT_FIELD_INT,    16U, CELLULAR_AT_FIELD_FLAG_OPTIONAL, ( uint16_t ) offsetof( testDecodeFields_t, cellId ),   ( uint16_t ) sizeof( int32_t ),   INT32_MIN,        INT32_MAX             },
+    { CELLULAR_AT_FIELD_SKIP,   0U,  0U,                              0U,                                                    0U,                               0,                0                     },
+    { CELLULAR_AT_FIELD_HEX,    0U,  CELLULAR_AT_FIELD_FLAG_OPTIONAL, ( uint16_t ) offsetof( testDecodeFields_t, hexValue ), ( uint16_t ) 2U,                   0,                0                     },
+    { CELLULAR_AT_FIELD_STRING, 0U,  CELLULAR_AT_FIELD_FLAG_OPTIONAL, ( uint16_t ) offsetof( testDecodeFields_t, name ),     ( uint16_t ) 8U,                   0,                0                     }
+};
+
+/**
+ * @brief Test that invalid parameters cause Cellular_ATDecodeFields to return CELLULAR_AT_BAD_PARAMETER.
+ */
+void test_Cellular_ATDecodeFields_Invalid_Param( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    testDecodeFields_t result;
+    uint32_t decodedFields = 0xFFFFFFFFU;
+
+    cellularStatus = Cellular_ATDecodeFields( NULL, 3, testDecodeFieldsDesc, ARRAY_SIZE( testDecodeFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeFields( "1,2", 3, NULL, ARRAY_SIZE( testDecodeFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeFields( "1,2", 3, testDecodeFieldsDesc, ARRAY_SIZE( testDecodeFieldsDesc ), NULL, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeFields( "1,2", 3, testDecodeFieldsDesc, 0, &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeFields( "1,2", 3, testDecodeFieldsDesc, CELLULAR_AT_MAX_DECODE_FIELDS + 1U, &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+    TEST_ASSERT_EQUAL( 0xFFFFFFFFU, decodedFields );
+}
+
+/**
+ * @brief Test the happy path for Cellular_ATDecodeFields to return CELLULAR_AT_SUCCESS.
+ */
+void test_Cellular_ATDecodeFields_Happy_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    const char * pString = "7, -113,\"1A2B\",skip,BEEF,\"AB,C\"";
+    testDecodeFields_t result;
+    uint32_t decodedFields = 0;
+
+    memset( &result, 0, sizeof( result ) );
+    cellularStatus = Cellular_ATDecodeFields( pString, ( uint16_t ) strlen( pString ), testDecodeFieldsDesc,
+                                              ARRAY_SIZE( testDecodeFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x37U, decodedFields );
+    TEST_ASSERT_EQUAL( 7, result.rat );
+    TEST_ASSERT_EQUAL( -113, result.rssi );
+    TEST_ASSERT_EQUAL( 0x1A2B, result.cellId );
+    TEST_ASSERT_EQUAL( 0xBE, result.hexValue[ 0 ] );
+    TEST_ASSERT_EQUAL( 0xEF, result.hexValue[ 1 ] );
+    TEST_ASSERT_EQUAL_STRING( "AB,C", result.name );
+}
+
+/**
+ * @brief Test the optional and missing field cases for Cellular_ATDecodeFields.
+ */
+void test_Cellular_ATDecodeFields_Optional_Fields( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    const char * pOptionalString = "1,2,,x";
+    const char * pMissingString = "1";
+    testDecodeFields_t result;
+    uint32_t decodedFields = 0;
+
+    memset( &result, 0, sizeof( result ) );
+    cellularStatus = Cellular_ATDecodeFields( pOptionalString, ( uint16_t ) strlen( pOptionalString ), testDecodeFieldsDesc,
+                                              ARRAY_SIZE( testDecodeFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x03U, decodedFields );
+    TEST_ASSERT_EQUAL( 1, result.rat );
+    TEST_ASSERT_EQUAL( 2, result.rssi );
+
+    /* The mandatory rssi field is missing. */
+    memset( &result, 0, sizeof( result ) );
+    cellularStatus = Cellular_ATDecodeFields( pMissingString, ( uint16_t ) strlen( pMissingString ), testDecodeFieldsDesc,
+                                              ARRAY_SIZE( testDecodeFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x01U, decodedFields );
+    TEST_ASSERT_EQUAL( 1, result.rat );
+}
+
+/**
+ * @brief Test the invalid field value cases for Cellular_ATDecodeFields to return CELLULAR_AT_ERROR.
+ */
+void test_Cellular_ATDecodeFields_Invalid_Field( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    const char * pRangeString = "256,40000,7FFFFFFF";
+    const char * pOverflowString = "1,2,80000000,,ABC,TOOLONGNAME";
+    const char * pQuoteString = "1,2,\"3";
+    testDecodeFields_t result;
+    uint32_t decodedFields = 0;
+
+    /* Out of range integer fields. The remaining fields are still decoded. */
+    memset( &result, 0, sizeof( result ) );
+    cellularStatus = Cellular_ATDecodeFields( pRangeString, ( uint16_t ) strlen( pRangeString ), testDecodeFieldsDesc,
+                                              ARRAY_SIZE( testDecodeFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x04U, decodedFields );
+    TEST_ASSERT_EQUAL( 0, result.rat );
+    TEST_ASSERT_EQUAL( 0, result.rssi );
+    TEST_ASSERT_EQUAL( INT32_MAX, result.cellId );
+
+    /* Integer overflow, odd length hex and too long string. */
+    memset( &result, 0, sizeof( result ) );
+    cellularStatus = Cellular_ATDecodeFields( pOverflowString, ( uint16_t ) strlen( pOverflowString ), testDecodeFieldsDesc,
+                                              ARRAY_SIZE( testDecodeFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x03U, decodedFields );
+
+    /* Unterminated double quote. */
+    cellularStatus = Cellular_ATDecodeFields( pQuoteString, ( uint16_t ) strlen( pQuoteString ), testDecodeFieldsDesc,
+                                              ARRAY_SIZE( testDecodeFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x03U, decodedFields );
+}
+
+/**
+ * @brief Test the bit string fields for Cellular_ATDecodeFields.
+ */
+void test_Cellular_ATDecodeFields_Bits_Fields( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    const CellularATFieldDesc_t bitsFieldsDesc[] =
+    {
+        { CELLULAR_AT_FIELD_BITS, 8U,  0U,                              ( uint16_t ) offsetof( testDecodeFields_t, rat ),    ( uint16_t ) sizeof( uint8_t ), 0, ( int32_t ) UINT8_MAX },
+        { CELLULAR_AT_FIELD_BITS, 4U,  CELLULAR_AT_FIELD_FLAG_OPTIONAL, ( uint16_t ) offsetof( testDecodeFields_t, rssi ),   ( uint16_t ) sizeof( int16_t ), 0, 0x0E                  },
+        { CELLULAR_AT_FIELD_BITS, 32U, CELLULAR_AT_FIELD_FLAG_OPTIONAL, ( uint16_t ) offsetof( testDecodeFields_t, cellId ), ( uint16_t ) sizeof( int32_t ), 0, INT32_MAX             }
+    };
+    const char * pString = "\"01000011\",0010";
+    const char * pInvalidString = "0100001,1111,00000000000000000000000000000001";
+    const char * pInvalidCharString = "01000021,1,";
+    testDecodeFields_t result;
+    uint32_t decodedFields = 0;
+
+    memset( &result, 0, sizeof( result ) );
+    cellularStatus = Cellular_ATDecodeFields( pString, ( uint16_t ) strlen( pString ), bitsFieldsDesc,
+                                              ARRAY_SIZE( bitsFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x03U, decodedFields );
+    TEST_ASSERT_EQUAL( 0x43, result.rat );
+    TEST_ASSERT_EQUAL( 0x02, result.rssi );
+
+    /* Wrong number of bits, out of range value and more than 31 bits. */
+    memset( &result, 0, sizeof( result ) );
+    cellularStatus = Cellular_ATDecodeFields( pInvalidString, ( uint16_t ) strlen( pInvalidString ), bitsFieldsDesc,
+                                              ARRAY_SIZE( bitsFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x00U, decodedFields );
+    TEST_ASSERT_EQUAL( 0, result.rat );
+    TEST_ASSERT_EQUAL( 0, result.rssi );
+    TEST_ASSERT_EQUAL( 0, result.cellId );
+
+    /* Not a bit string. */
+    cellularStatus = Cellular_ATDecodeFields( pInvalidCharString, ( uint16_t ) strlen( pInvalidCharString ), bitsFieldsDesc,
+                                              ARRAY_SIZE( bitsFieldsDesc ), &result, &decodedFields );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 0x00U, decodedFields );
+}
+
 /**
  * @brief Test that any NULL parameter causes Cellular_ATHexStrToHex to return CELLULAR_AT_BAD_PARAMETER.
  */
@@ -719,6 +1072,184 @@ void test_Cellular_ATHexStrToHex_Error_Path( void )
     TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, cellularStatus );
 }
 
+/**
+ * @brief Test the long hex string case for Cellular_ATHexStrToHex with invalid characters in the middle.
+ */
+void test_Cellular_ATHexStrToHex_Long_Hex_String( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    char pString[] = "0123456789abcdefFEDCBA98G1234567890";
+    uint8_t expected[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFE, 0xDC, 0xBA, 0x98,
+                           0xFF, 0x23, 0x45, 0x67, 0x89 };
+    uint8_t hexData[ 20 ];
+
+    cellularStatus = Cellular_ATHexStrToHex( pString, hexData, sizeof( hexData ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_MEMORY( expected, hexData, sizeof( expected ) );
+}
+
+/**
+ * @brief Test Cellular_ATHexDecode for the happy path and the error path.
+ */
+void test_Cellular_ATHexDecode( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    const char * pString = "00ff7F80a5C3e1d2";
+    uint8_t expected[] = { 0x00, 0xFF, 0x7F, 0x80, 0xA5, 0xC3, 0xE1, 0xD2 };
+    uint8_t hexData[ 8 ];
+
+    cellularStatus = Cellular_ATHexDecode( NULL, 2, hexData, sizeof( hexData ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecode( pString, 2, NULL, sizeof( hexData ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecode( pString, 16, hexData, sizeof( hexData ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_MEMORY( expected, hexData, sizeof( expected ) );
+
+    cellularStatus = Cellular_ATHexDecode( pString, 0, hexData, sizeof( hexData ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecode( pString, 15, hexData, sizeof( hexData ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecode( pString, 16, hexData, 7 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecode( "00ff7F80a5C3e1dG", 16, hexData, sizeof( hexData ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecode( "0 ", 2, hexData, sizeof( hexData ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Test that a hex string split across chunks is decoded by Cellular_ATHexDecodeChunk.
+ */
+void test_Cellular_ATHexDecodeChunk_Happy_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    const char * pString = "0123456789ABCDEF0123";
+    uint8_t expected[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x01, 0x23 };
+    uint8_t hexData[ 10 ];
+    uint16_t dataLength = 0;
+    uint16_t dataDecoded = 0;
+    CellularATHexDecoder_t decoder;
+
+    cellularStatus = Cellular_ATHexDecoderInit( &decoder );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    /* Odd length chunks. */
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, pString, 3, &hexData[ dataLength ], 1, &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, dataDecoded );
+    dataLength = dataLength + dataDecoded;
+
+    cellularStatus = Cellular_ATHexDecoderFinish( &decoder );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, &pString[ 3 ], 0, &hexData[ dataLength ], 0, &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, dataDecoded );
+
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, &pString[ 3 ], 13, &hexData[ dataLength ], 7, &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 7, dataDecoded );
+    dataLength = dataLength + dataDecoded;
+
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, &pString[ 16 ], 4, &hexData[ dataLength ], 2, &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 2, dataDecoded );
+    dataLength = dataLength + dataDecoded;
+
+    cellularStatus = Cellular_ATHexDecoderFinish( &decoder );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( sizeof( expected ), dataLength );
+    TEST_ASSERT_EQUAL_MEMORY( expected, hexData, sizeof( expected ) );
+}
+
+/**
+ * @brief Test the error path for Cellular_ATHexDecodeChunk.
+ */
+void test_Cellular_ATHexDecodeChunk_Error_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    uint8_t hexData[ 4 ];
+    uint16_t dataDecoded = 0;
+    CellularATHexDecoder_t decoder;
+
+    cellularStatus = Cellular_ATHexDecoderInit( NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecoderFinish( NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    ( void ) Cellular_ATHexDecoderInit( &decoder );
+
+    cellularStatus = Cellular_ATHexDecodeChunk( NULL, "00", 2, hexData, sizeof( hexData ), &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, NULL, 2, hexData, sizeof( hexData ), &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, "00", 2, NULL, sizeof( hexData ), &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, "00", 2, hexData, sizeof( hexData ), NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, "0011", 4, hexData, 1, &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, cellularStatus );
+
+    /* Invalid character in the pairs. */
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, "00x1", 4, hexData, sizeof( hexData ), &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, dataDecoded );
+
+    /* Invalid pending nibble. */
+    ( void ) Cellular_ATHexDecoderInit( &decoder );
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, "001", 3, hexData, sizeof( hexData ), &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, "x1", 2, hexData, sizeof( hexData ), &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, dataDecoded );
+
+    /* Invalid last nibble. */
+    ( void ) Cellular_ATHexDecoderInit( &decoder );
+    cellularStatus = Cellular_ATHexDecodeChunk( &decoder, "00x", 3, hexData, sizeof( hexData ), &dataDecoded );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, dataDecoded );
+}
+
+/**
+ * @brief Test Cellular_ATHexEncode for the happy path and the error path.
+ */
+void test_Cellular_ATHexEncode( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    uint8_t data[] = { 0x00, 0x9A, 0xFF, 0x10 };
+    char hexStr[ 9 ];
+    uint8_t decoded[ 4 ];
+
+    cellularStatus = Cellular_ATHexEncode( NULL, sizeof( data ), hexStr, sizeof( hexStr ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexEncode( data, sizeof( data ), NULL, sizeof( hexStr ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATHexEncode( data, sizeof( data ), hexStr, 8 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, cellularStatus );
+
+    cellularStatus = Cellular_ATHexEncode( data, sizeof( data ), hexStr, sizeof( hexStr ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "009AFF10", hexStr );
+
+    cellularStatus = Cellular_ATHexDecode( hexStr, 8, decoded, sizeof( decoded ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_MEMORY( data, decoded, sizeof( data ) );
+}
+
 /**
  * @brief Test that any NULL parameter causes Cellular_ATIsStrDigit to return CELLULAR_AT_BAD_PARAMETER.
  */
@@ -952,23 +1483,220 @@ void test_Cellular_ATStrtoi_Error_Path( void )
 }
 
 /**
- * @brief Test that any NULL parameter causes Cellular_ATStrDup to return CELLULAR_AT_BAD_PARAMETER.
+ * @brief Test the base, white space and overflow cases for Cellular_ATStrtoi.
  */
-void test_Cellular_ATStrDup_Invalid_Param( void )
+void test_Cellular_ATStrtoi_Base_And_Range( void )
 {
     CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
-    char * pDst;
-    char pSrc[ sizeof( CELLULAR_SAMPLE_PREFIX_STRING_LARGE_INPUT ) ] = { 0 };
+    int32_t result = 0;
 
-    cellularStatus = Cellular_ATStrDup( NULL, NULL );
+    cellularStatus = Cellular_ATStrtoi( "10", 1, &result );
     TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
 
-    cellularStatus = Cellular_ATStrDup( &pDst, NULL );
+    cellularStatus = Cellular_ATStrtoi( "10", 17, &result );
     TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
 
-    strcpy( pSrc, CELLULAR_SAMPLE_PREFIX_STRING_LARGE_INPUT );
-    cellularStatus = Cellular_ATStrDup( &pDst, pSrc );
-    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+    cellularStatus = Cellular_ATStrtoi( " \t-42,1", 10, &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( -42, result );
+
+    cellularStatus = Cellular_ATStrtoi( "1a2B", 16, &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( 0x1A2B, result );
+
+    cellularStatus = Cellular_ATStrtoi( "01100", 2, &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( 12, result );
+
+    cellularStatus = Cellular_ATStrtoi( "80000000", 16, &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Test that any NULL parameter causes the numeric decoders to return CELLULAR_AT_BAD_PARAMETER.
+ */
+void test_Cellular_ATDecodeNumber_Invalid_Param( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    int32_t decValue = 0;
+    uint32_t value = 0;
+
+    cellularStatus = Cellular_ATDecodeDec( NULL, 1, &decValue, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeDec( "1", 1, NULL, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeHex( NULL, 1, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeHex( "1", 1, NULL, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeBin( NULL, 1, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeBin( "1", 1, NULL, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test happy path for Cellular_ATDecodeDec to return CELLULAR_AT_SUCCESS and got expected results.
+ */
+void test_Cellular_ATDecodeDec_Happy_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    int32_t value = 0;
+    uint16_t consumed = 0;
+
+    cellularStatus = Cellular_ATDecodeDec( "12345678,99", 11, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( 12345678, value );
+    TEST_ASSERT_EQUAL( 8, consumed );
+
+    cellularStatus = Cellular_ATDecodeDec( "-113", 4, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( -113, value );
+    TEST_ASSERT_EQUAL( 4, consumed );
+
+    cellularStatus = Cellular_ATDecodeDec( "2147483647", 10, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( INT32_MAX, value );
+
+    cellularStatus = Cellular_ATDecodeDec( "-2147483648", 11, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( INT32_MIN, value );
+
+    /* The length bounds the decoding. */
+    cellularStatus = Cellular_ATDecodeDec( "123456", 5, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( 12345, value );
+    TEST_ASSERT_EQUAL( 5, consumed );
+
+    /* Non digit inside the first four characters. */
+    cellularStatus = Cellular_ATDecodeDec( "12:45", 5, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_INT32( 12, value );
+    TEST_ASSERT_EQUAL( 2, consumed );
+}
+
+/**
+ * @brief Test the error path for Cellular_ATDecodeDec to return CELLULAR_AT_ERROR.
+ */
+void test_Cellular_ATDecodeDec_Error_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    int32_t value = 0;
+
+    cellularStatus = Cellular_ATDecodeDec( "", 0, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeDec( "-", 1, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeDec( "abc", 3, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeDec( "2147483648", 10, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeDec( "-2147483649", 11, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeDec( "99999999999", 11, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Test Cellular_ATDecodeHex for the happy path and the error path.
+ */
+void test_Cellular_ATDecodeHex( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    uint32_t value = 0;
+    uint16_t consumed = 0;
+
+    /* Cell ID in +CEREG. */
+    cellularStatus = Cellular_ATDecodeHex( "01A2b3C4\"", 9, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_HEX32( 0x01A2B3C4U, value );
+    TEST_ASSERT_EQUAL( 8, consumed );
+
+    cellularStatus = Cellular_ATDecodeHex( "FFFFFFFF", 8, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_HEX32( UINT32_MAX, value );
+
+    cellularStatus = Cellular_ATDecodeHex( "9aF0e", 5, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_HEX32( 0x9AF0EU, value );
+    TEST_ASSERT_EQUAL( 5, consumed );
+
+    /* Characters next to the digit ranges. */
+    cellularStatus = Cellular_ATDecodeHex( "1/2:@G`g", 8, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_HEX32( 0x1U, value );
+    TEST_ASSERT_EQUAL( 1, consumed );
+
+    cellularStatus = Cellular_ATDecodeHex( "100000000", 9, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeHex( "-1", 2, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Test Cellular_ATDecodeBin for the happy path and the error path.
+ */
+void test_Cellular_ATDecodeBin( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    uint32_t value = 0;
+    uint16_t consumed = 0;
+
+    /* Timer string in +CPSMS. */
+    cellularStatus = Cellular_ATDecodeBin( "00100001", 8, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_HEX32( 0x21U, value );
+    TEST_ASSERT_EQUAL( 8, consumed );
+
+    cellularStatus = Cellular_ATDecodeBin( "1011", 4, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_HEX32( 0xBU, value );
+
+    cellularStatus = Cellular_ATDecodeBin( "10121", 5, &value, &consumed );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_HEX32( 0x5U, value );
+    TEST_ASSERT_EQUAL( 3, consumed );
+
+    cellularStatus = Cellular_ATDecodeBin( "11111111111111111111111111111111", 32, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_HEX32( UINT32_MAX, value );
+
+    cellularStatus = Cellular_ATDecodeBin( "100000000000000000000000000000000", 33, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+
+    cellularStatus = Cellular_ATDecodeBin( "2", 1, &value, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_ERROR, cellularStatus );
+}
+
+/**
+ * @brief Test that any NULL parameter causes Cellular_ATStrDup to return CELLULAR_AT_BAD_PARAMETER.
+ */
+void test_Cellular_ATStrDup_Invalid_Param( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    char * pDst;
+    char pSrc[ sizeof( CELLULAR_SAMPLE_PREFIX_STRING_LARGE_INPUT ) ] = { 0 };
+
+    cellularStatus = Cellular_ATStrDup( NULL, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATStrDup( &pDst, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    strcpy( pSrc, CELLULAR_SAMPLE_PREFIX_STRING_LARGE_INPUT );
+    cellularStatus = Cellular_ATStrDup( &pDst, pSrc );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
 }
 
 /**
@@ -1088,3 +1816,426 @@ void test_Cellular_ATIsPrefixPresent_Invalid_Prefix_Char( void )
     TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
     TEST_ASSERT_EQUAL( false, Result );
 }
+
+/**
+ * @brief Test that any invalid parameter causes Cellular_ATStrViewInit to return CELLULAR_AT_BAD_PARAMETER.
+ */
+void test_Cellular_ATStrViewInit_Invalid_Param( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+    char pString[] = "+CPIN:READY";
+
+    cellularStatus = Cellular_ATStrViewInit( NULL, pString, 3 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewInit( &view, NULL, 3 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewInit( &view, pString, CELLULAR_AT_MAX_STRING_SIZE + 1U );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    /* Empty view is rejected by the string view functions. */
+    cellularStatus = Cellular_ATStrViewInit( &view, pString, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewRemovePrefix( &view );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test the string view functions only access the characters within the length.
+ */
+void test_Cellular_ATStrView_Not_Null_Terminated( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+    char pString[] = "+CPIN:READY+CSQ:1";
+    const char * pKeyList[] = { "ERROR", "+CPIN:READY+" };
+    bool result = false;
+
+    /* The view is "+CPIN:READY". */
+    cellularStatus = Cellular_ATStrViewInit( &view, pString, 11 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewIsPrefixPresent( &view, &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( true, result );
+
+    cellularStatus = Cellular_ATStrViewStartWith( &view, "+CPIN:READY", &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( true, result );
+
+    /* The prefix is longer than the view. */
+    cellularStatus = Cellular_ATStrViewStartWith( &view, "+CPIN:READY+", &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( false, result );
+
+    cellularStatus = Cellular_ATStrViewCheckErrorCode( &view, pKeyList, 2, &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( false, result );
+
+    cellularStatus = Cellular_ATStrViewRemovePrefix( &view );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 5, view.length );
+    TEST_ASSERT_EQUAL_STRING_LEN( "READY", view.pStr, view.length );
+
+    /* No colon within the length. */
+    cellularStatus = Cellular_ATStrViewRemovePrefix( &view );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewIsStrDigit( &view, &result );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( false, result );
+
+    /* The string is not modified. */
+    TEST_ASSERT_EQUAL_STRING( "+CPIN:READY+CSQ:1", pString );
+}
+
+/**
+ * @brief Test the string view functions which remove characters update the length.
+ */
+void test_Cellular_ATStrView_Remove_Characters( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+    char pString[] = "  \"1 2\"  \"X";
+
+    /* The view is "  \"1 2\"  ". */
+    cellularStatus = Cellular_ATStrViewInit( &view, pString, 9 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewRemoveLeadingWhiteSpaces( &view );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 7, view.length );
+
+    cellularStatus = Cellular_ATStrViewRemoveTrailingWhiteSpaces( &view );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING_LEN( "\"1 2\"", view.pStr, view.length );
+    TEST_ASSERT_EQUAL( 5, view.length );
+
+    cellularStatus = Cellular_ATStrViewRemoveOutermostDoubleQuote( &view );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 3, view.length );
+
+    cellularStatus = Cellular_ATStrViewRemoveAllWhiteSpaces( &view );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING_LEN( "12", view.pStr, view.length );
+    TEST_ASSERT_EQUAL( 2, view.length );
+
+    /* The characters after the view are not accessed. */
+    cellularStatus = Cellular_ATStrViewInit( &view, pString, 9 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewRemoveAllDoubleQuote( &view );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 7, view.length );
+    TEST_ASSERT_EQUAL( '\"', pString[ 9 ] );
+}
+
+/**
+ * @brief Test Cellular_ATStrViewGetSpecificNextTok splits the view without modifying the string.
+ */
+void test_Cellular_ATStrViewGetSpecificNextTok_Happy_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+    CellularATStrView_t token = { 0 };
+    char pString[] = ",1,23,,";
+
+    cellularStatus = Cellular_ATStrViewInit( &view, pString, 5 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    /* A delimiter at the start is an empty token. */
+    cellularStatus = Cellular_ATStrViewGetNextTok( &view, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, token.length );
+
+    cellularStatus = Cellular_ATStrViewGetNextTok( &view, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1", token.pStr, token.length );
+
+    /* The last token ends at the end of the view. */
+    cellularStatus = Cellular_ATStrViewGetSpecificNextTok( &view, ",", &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 2, token.length );
+    TEST_ASSERT_EQUAL_STRING_LEN( "23", token.pStr, token.length );
+    TEST_ASSERT_EQUAL( 0, view.length );
+
+    cellularStatus = Cellular_ATStrViewGetSpecificNextTok( &view, ",", &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewGetSpecificNextTok( &view, NULL, &token );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    TEST_ASSERT_EQUAL_STRING( ",1,23,,", pString );
+}
+
+/**
+ * @brief Test that any invalid parameter causes Cellular_ATNormalize to return CELLULAR_AT_BAD_PARAMETER.
+ */
+void test_Cellular_ATNormalize_Invalid_Param( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    char pString[] = " \"1\" ";
+    char * pStr = NULL;
+    CellularATStrView_t view = { 0 };
+
+    cellularStatus = Cellular_ATNormalize( NULL, CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATNormalize( &pStr, CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    /* Unknown flag. */
+    pStr = pString;
+    cellularStatus = Cellular_ATNormalize( &pStr, 0x80U, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    pStr = "";
+    cellularStatus = Cellular_ATNormalize( &pStr, CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewNormalize( &view, CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test Cellular_ATNormalize has the same result as calling the remove functions in order.
+ */
+void test_Cellular_ATNormalize_Happy_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    char pString[ 32 ] = { 0 };
+    char * pStr = pString;
+    uint16_t length = 0;
+
+    strcpy( pString, "  \"ab c\"  " );
+
+    /* Leading and trailing white spaces. */
+    cellularStatus = Cellular_ATNormalize( &pStr,
+                                           CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES |
+                                           CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES,
+                                           &length );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "\"ab c\"", pStr );
+    TEST_ASSERT_EQUAL( 6, length );
+
+    /* Outermost double quotes. */
+    cellularStatus = Cellular_ATNormalize( &pStr, CELLULAR_AT_NORMALIZE_OUTERMOST_DOUBLE_QUOTE, &length );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "ab c", pStr );
+    TEST_ASSERT_EQUAL( 4, length );
+
+    /* All white spaces and double quotes in one pass. */
+    strcpy( pString, " \"a\" , \"b c\" " );
+    pStr = pString;
+    cellularStatus = Cellular_ATNormalize( &pStr,
+                                           CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES |
+                                           CELLULAR_AT_NORMALIZE_ALL_DOUBLE_QUOTE,
+                                           &length );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "a,bc", pStr );
+    TEST_ASSERT_EQUAL( 4, length );
+
+    /* The result may be empty. */
+    strcpy( pString, " \"\" " );
+    pStr = pString;
+    cellularStatus = Cellular_ATNormalize( &pStr,
+                                           CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES |
+                                           CELLULAR_AT_NORMALIZE_ALL_DOUBLE_QUOTE,
+                                           NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "", pStr );
+}
+
+/**
+ * @brief Test Cellular_ATNormalize returns an empty string for a string of white spaces.
+ *
+ * Calling Cellular_ATRemoveTrailingWhiteSpaces after Cellular_ATRemoveLeadingWhiteSpaces
+ * fails for this input. The normalizer does not treat an empty result as an error.
+ */
+void test_Cellular_ATNormalize_All_White_Spaces( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    char pString[ 8 ] = { 0 };
+    char * pStr = pString;
+    uint16_t length = 1;
+
+    strcpy( pString, " \t  " );
+    cellularStatus = Cellular_ATNormalize( &pStr,
+                                           CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES |
+                                           CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES,
+                                           &length );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "", pStr );
+    TEST_ASSERT_EQUAL( 0, length );
+
+    strcpy( pString, " \t  " );
+    pStr = pString;
+    length = 1;
+    cellularStatus = Cellular_ATNormalize( &pStr,
+                                           CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES |
+                                           CELLULAR_AT_NORMALIZE_ALL_WHITE_SPACES,
+                                           &length );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "", pStr );
+    TEST_ASSERT_EQUAL( 0, length );
+
+    /* The remove functions report the empty intermediate result as an error. */
+    strcpy( pString, " \t  " );
+    pStr = pString;
+    cellularStatus = Cellular_ATRemoveLeadingWhiteSpaces( &pStr );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    cellularStatus = Cellular_ATRemoveTrailingWhiteSpaces( pStr );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test Cellular_ATStrViewNormalize only accesses the characters within the length.
+ */
+void test_Cellular_ATStrViewNormalize_Not_Null_Terminated( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATStrView_t view = { 0 };
+    char pString[] = " \"1 2\" ,X";
+
+    /* The view is " \"1 2\" ". */
+    cellularStatus = Cellular_ATStrViewInit( &view, pString, 7 );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    cellularStatus = Cellular_ATStrViewNormalize( &view,
+                                                  CELLULAR_AT_NORMALIZE_LEADING_WHITE_SPACES |
+                                                  CELLULAR_AT_NORMALIZE_TRAILING_WHITE_SPACES |
+                                                  CELLULAR_AT_NORMALIZE_OUTERMOST_DOUBLE_QUOTE );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 3, view.length );
+    TEST_ASSERT_EQUAL_STRING_LEN( "1 2", view.pStr, view.length );
+    TEST_ASSERT_EQUAL_STRING( " \"1 2\" ,X", pString );
+}
+
+/**
+ * @brief Test that any invalid parameter causes Cellular_ATCmdBuilder functions to return CELLULAR_AT_BAD_PARAMETER.
+ */
+void test_Cellular_ATCmdBuilder_Invalid_Param( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATCmdBuilder_t cmdBuilder = { 0 };
+    char cmdBuf[ 16 ] = { '\0' };
+    uint8_t data[ 1 ] = { 0 };
+
+    cellularStatus = Cellular_ATCmdBuilderInit( NULL, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendStr( NULL, "AT" ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendQuotedStr( NULL, "AT" ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendChar( NULL, 'A' ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendUint( NULL, 1U ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendBinary( NULL, 1U, 4U ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendHex( NULL, data, 1U ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdBuilderFinish( NULL, NULL ) );
+
+    /* Appends to a builder initialized with invalid buffer fail. */
+    cellularStatus = Cellular_ATCmdBuilderInit( &cmdBuilder, NULL, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendStr( &cmdBuilder, "AT" ) );
+
+    cellularStatus = Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, 0U );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, cellularStatus );
+
+    /* The first error is kept. */
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendBinary( &cmdBuilder, 1U, 0U ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendStr( &cmdBuilder, "AT" ) );
+    TEST_ASSERT_EQUAL_STRING( "", cmdBuf );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendBinary( &cmdBuilder, 1U, 33U ) );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendStr( &cmdBuilder, NULL ) );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendQuotedStr( &cmdBuilder, NULL ) );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendChar( &cmdBuilder, '\0' ) );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_BAD_PARAMETER, Cellular_ATCmdAppendHex( &cmdBuilder, NULL, 1U ) );
+}
+
+/**
+ * @brief Test that happy path case for Cellular_ATCmdBuilder functions.
+ */
+void test_Cellular_ATCmdBuilder_Happy_Path( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATCmdBuilder_t cmdBuilder = { 0 };
+    char cmdBuf[ 64 ] = { '\0' };
+    uint8_t data[ 3 ] = { 0x01, 0xAB, 0xF0 };
+    uint32_t cmdLength = 0;
+
+    cellularStatus = Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendStr( &cmdBuilder, "AT+CPSMS=" ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendUint( &cmdBuilder, 0U ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendChar( &cmdBuilder, ',' ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendUint( &cmdBuilder, 4294967295U ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendChar( &cmdBuilder, ',' ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendBinary( &cmdBuilder, 0x15U, 8U ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendChar( &cmdBuilder, ',' ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendQuotedStr( &cmdBuilder, "IPV6" ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendChar( &cmdBuilder, ',' ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, Cellular_ATCmdAppendHex( &cmdBuilder, data, sizeof( data ) ) );
+
+    cellularStatus = Cellular_ATCmdBuilderFinish( &cmdBuilder, &cmdLength );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "AT+CPSMS=0,4294967295,00010101,\"IPV6\",01ABF0", cmdBuf );
+    TEST_ASSERT_EQUAL( strlen( cmdBuf ), cmdLength );
+}
+
+/**
+ * @brief Test that Cellular_ATCmdBuilder functions return CELLULAR_AT_NO_MEMORY if the command doesn't fit.
+ *
+ * The command in the buffer is the command before the failed append.
+ */
+void test_Cellular_ATCmdBuilder_No_Memory( void )
+{
+    CellularATError_t cellularStatus = CELLULAR_AT_SUCCESS;
+    CellularATCmdBuilder_t cmdBuilder = { 0 };
+    char cmdBuf[ 8 ] = { '\0' };
+    uint32_t cmdLength = 0;
+
+    /* 7 characters and the NULL terminator fit. */
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    ( void ) Cellular_ATCmdAppendStr( &cmdBuilder, "AT+" );
+    cellularStatus = Cellular_ATCmdAppendStr( &cmdBuilder, "CFUN" );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "AT+CFUN", cmdBuf );
+
+    cellularStatus = Cellular_ATCmdAppendChar( &cmdBuilder, '=' );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, cellularStatus );
+    TEST_ASSERT_EQUAL_STRING( "AT+CFUN", cmdBuf );
+
+    cmdLength = 0;
+    cellularStatus = Cellular_ATCmdBuilderFinish( &cmdBuilder, &cmdLength );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, cmdLength );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    ( void ) Cellular_ATCmdAppendStr( &cmdBuilder, "AT+" );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, Cellular_ATCmdAppendQuotedStr( &cmdBuilder, "APN" ) );
+    TEST_ASSERT_EQUAL_STRING( "AT+\"APN", cmdBuf );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, Cellular_ATCmdAppendUint( &cmdBuilder, 12345678U ) );
+    TEST_ASSERT_EQUAL_STRING( "", cmdBuf );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, Cellular_ATCmdAppendBinary( &cmdBuilder, 0U, 8U ) );
+
+    ( void ) Cellular_ATCmdBuilderInit( &cmdBuilder, cmdBuf, sizeof( cmdBuf ) );
+    TEST_ASSERT_EQUAL( CELLULAR_AT_NO_MEMORY, Cellular_ATCmdAppendHex( &cmdBuilder, ( const uint8_t * ) "ABCD", 4U ) );
+}
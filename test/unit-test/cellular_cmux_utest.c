@@ -0,0 +1,545 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @file cellular_cmux_utest.c
+ * @brief Unit tests for functions in cellular_cmux.h.
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "unity.h"
+
+/* Include paths for public enums, structures, and macros. */
+#include "cellular_platform.h"
+
+#include "cellular_cmux.h"
+
+/**
+ * @brief Size of the buffers of the mock physical comm interface.
+ */
+#define CELLULAR_SAMPLE_PHY_BUFFER_SIZE    ( 2048U )
+
+/**
+ * @brief Frame type of SABM and UA frames with the poll / final bit.
+ */
+#define CELLULAR_SAMPLE_CTRL_SABM          ( 0x3FU )
+#define CELLULAR_SAMPLE_CTRL_UA            ( 0x73U )
+#define CELLULAR_SAMPLE_CTRL_DM            ( 0x1FU )
+
+/**
+ * @brief Frame type of UIH and UI frames without the poll / final bit.
+ */
+#define CELLULAR_SAMPLE_CTRL_UIH           ( 0xEFU )
+#define CELLULAR_SAMPLE_CTRL_UI            ( 0x03U )
+
+/**
+ * @brief Information field length of the frames to fill the channel buffer.
+ */
+#define CELLULAR_SAMPLE_FILL_INFO_LENGTH   ( 120U )
+
+/**
+ * @brief Value of rejectDlci if the modem accepts all the DLCIs.
+ */
+#define CELLULAR_SAMPLE_NO_REJECT_DLCI     ( 0xFFU )
+
+static uint8_t phyTxBuffer[ CELLULAR_SAMPLE_PHY_BUFFER_SIZE ];
+static uint32_t phyTxLength = 0;
+static uint8_t phyRxBuffer[ CELLULAR_SAMPLE_PHY_BUFFER_SIZE ];
+static uint32_t phyRxLength = 0;
+static uint32_t phyRxOffset = 0;
+static uint32_t phyCloseCount = 0;
+static uint8_t rejectDlci = CELLULAR_SAMPLE_NO_REJECT_DLCI;
+static CellularCommInterfaceReceiveCallback_t mockReceiveCallback = NULL;
+static void * pMockReceiveUserData = NULL;
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    phyTxLength = 0;
+    phyRxLength = 0;
+    phyRxOffset = 0;
+    phyCloseCount = 0;
+    rejectDlci = CELLULAR_SAMPLE_NO_REJECT_DLCI;
+    mockReceiveCallback = NULL;
+    pMockReceiveUserData = NULL;
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+    Cellular_CmuxDeinit();
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void * mock_malloc( size_t size )
+{
+    return malloc( size );
+}
+
+void dummyDelay( uint32_t milliseconds )
+{
+    ( void ) milliseconds;
+}
+
+bool MockPlatformMutex_Create( PlatformMutex_t * pNewMutex,
+                               bool recursive )
+{
+    ( void ) recursive;
+    pNewMutex->created = true;
+    return true;
+}
+
+void MockPlatformMutex_Destroy( PlatformMutex_t * pMutex )
+{
+    pMutex->created = false;
+}
+
+void MockPlatformMutex_Lock( PlatformMutex_t * pMutex )
+{
+    ( void ) pMutex;
+}
+
+bool MockPlatformMutex_TryLock( PlatformMutex_t * pMutex )
+{
+    ( void ) pMutex;
+    return true;
+}
+
+void MockPlatformMutex_Unlock( PlatformMutex_t * pMutex )
+{
+    ( void ) pMutex;
+}
+
+static uint8_t prvFcs( const uint8_t * pData,
+                       uint32_t length )
+{
+    uint8_t crc = 0xFFU;
+    uint32_t i = 0;
+    uint8_t bit = 0;
+
+    for( i = 0; i < length; i++ )
+    {
+        crc = crc ^ pData[ i ];
+
+        for( bit = 0; bit < 8U; bit++ )
+        {
+            crc = ( ( crc & 0x01U ) != 0U ) ? ( uint8_t ) ( ( crc >> 1 ) ^ 0xE0U ) : ( uint8_t ) ( crc >> 1 );
+        }
+    }
+
+    return ( uint8_t ) ( 0xFFU - crc );
+}
+
+/* Append a frame from the modem with a short length field to the physical receive buffer. */
+static void prvModemFrame( uint8_t dlci,
+                           uint8_t control,
+                           const char * pInfo )
+{
+    uint32_t infoLength = ( pInfo == NULL ) ? 0U : ( uint32_t ) strlen( pInfo );
+    uint8_t * pFrame = &phyRxBuffer[ phyRxLength ];
+
+    pFrame[ 0 ] = 0xF9U;
+    pFrame[ 1 ] = ( uint8_t ) ( ( dlci << 2 ) | 0x01U );
+    pFrame[ 2 ] = control;
+    pFrame[ 3 ] = ( uint8_t ) ( ( infoLength << 1 ) | 0x01U );
+
+    if( infoLength > 0U )
+    {
+        ( void ) memcpy( &pFrame[ 4 ], pInfo, infoLength );
+    }
+
+    /* The FCS of UI frames also covers the information field. */
+    pFrame[ 4U + infoLength ] = prvFcs( &pFrame[ 1 ], ( control == CELLULAR_SAMPLE_CTRL_UI ) ? ( 3U + infoLength ) : 3U );
+    pFrame[ 5U + infoLength ] = 0xF9U;
+    phyRxLength = phyRxLength + 6U + infoLength;
+}
+
+static CellularCommInterfaceError_t prvCommIntfOpen( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                     void * pUserData,
+                                                     CellularCommInterfaceHandle_t * pCommInterfaceHandle )
+{
+    mockReceiveCallback = receiveCallback;
+    pMockReceiveUserData = pUserData;
+    *pCommInterfaceHandle = ( CellularCommInterfaceHandle_t ) 1;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvCommIntfSend( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                     const uint8_t * pData,
+                                                     uint32_t dataLength,
+                                                     uint32_t timeoutMilliseconds,
+                                                     uint32_t * pDataSentLength )
+{
+    uint8_t dlci = pData[ 1 ] >> 2;
+
+    ( void ) commInterfaceHandle;
+    ( void ) timeoutMilliseconds;
+
+    ( void ) memcpy( &phyTxBuffer[ phyTxLength ], pData, dataLength );
+    phyTxLength = phyTxLength + dataLength;
+
+    /* The modem responds to SABM. */
+    if( pData[ 2 ] == CELLULAR_SAMPLE_CTRL_SABM )
+    {
+        prvModemFrame( dlci, ( dlci == rejectDlci ) ? CELLULAR_SAMPLE_CTRL_DM : CELLULAR_SAMPLE_CTRL_UA, NULL );
+    }
+
+    *pDataSentLength = dataLength;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvCommIntfRecv( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                     uint8_t * pBuffer,
+                                                     uint32_t bufferLength,
+                                                     uint32_t timeoutMilliseconds,
+                                                     uint32_t * pDataReceivedLength )
+{
+    uint32_t length = phyRxLength - phyRxOffset;
+
+    ( void ) commInterfaceHandle;
+    ( void ) timeoutMilliseconds;
+
+    if( length > bufferLength )
+    {
+        length = bufferLength;
+    }
+
+    ( void ) memcpy( pBuffer, &phyRxBuffer[ phyRxOffset ], length );
+    phyRxOffset = phyRxOffset + length;
+    *pDataReceivedLength = length;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvCommIntfClose( CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    ( void ) commInterfaceHandle;
+    phyCloseCount++;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvReceiveCallback( void * pUserData,
+                                                        CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    ( void ) commInterfaceHandle;
+    *( ( uint32_t * ) pUserData ) = *( ( uint32_t * ) pUserData ) + 1U;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterface_t mockCommInterface =
+{
+    prvCommIntfOpen,
+    prvCommIntfSend,
+    prvCommIntfRecv,
+    prvCommIntfClose
+};
+
+/* ========================================================================== */
+
+/**
+ * @brief Test that any invalid parameter causes the CMUX API to return CELLULAR_BAD_PARAMETER.
+ */
+void test_Cellular_CmuxInit_Invalid_Param( void )
+{
+    CellularCommInterface_t invalidCommInterface = { 0 };
+    const CellularCommInterface_t * pChannelCommInterface = NULL;
+
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, Cellular_CmuxInit( NULL ) );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, Cellular_CmuxInit( &invalidCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_NOT_ALLOWED, Cellular_CmuxGetChannel( 1, &pChannelCommInterface ) );
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxInit( &mockCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_NOT_ALLOWED, Cellular_CmuxInit( &mockCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, Cellular_CmuxGetChannel( 0, &pChannelCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER,
+                       Cellular_CmuxGetChannel( CELLULAR_CONFIG_CMUX_MAX_CHANNELS + 1U, &pChannelCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, Cellular_CmuxGetChannel( 1, NULL ) );
+}
+
+/**
+ * @brief Test that opening a channel establishes the control channel and the DLCI,
+ * and closing the last channel releases them and closes the physical link.
+ */
+void test_Cellular_Cmux_Open_Close( void )
+{
+    const CellularCommInterface_t * pChannelCommInterface = NULL;
+    CellularCommInterfaceHandle_t commInterfaceHandle = NULL;
+    uint32_t receiveCount = 0;
+    const uint8_t expectedOpen[] =
+    {
+        0xF9, 0x03, 0x3F, 0x01, 0x1C, 0xF9, /* SABM DLCI 0. */
+        0xF9, 0x07, 0x3F, 0x01, 0xDE, 0xF9  /* SABM DLCI 1. */
+    };
+    const uint8_t expectedClose[] =
+    {
+        0xF9, 0x07, 0x53, 0x01, 0x3F, 0xF9, /* DISC DLCI 1. */
+        0xF9, 0x03, 0x53, 0x01, 0xFD, 0xF9  /* DISC DLCI 0. */
+    };
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxInit( &mockCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 1, &pChannelCommInterface ) );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannelCommInterface->open( prvReceiveCallback, &receiveCount, &commInterfaceHandle ) );
+    TEST_ASSERT_EQUAL( sizeof( expectedOpen ), phyTxLength );
+    TEST_ASSERT_EQUAL_MEMORY( expectedOpen, phyTxBuffer, sizeof( expectedOpen ) );
+
+    /* The same channel can't be opened twice. */
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_FAILURE,
+                       pChannelCommInterface->open( prvReceiveCallback, &receiveCount, &commInterfaceHandle ) );
+
+    /* The physical receive event is forwarded to the opened channel. */
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, mockReceiveCallback( pMockReceiveUserData, ( CellularCommInterfaceHandle_t ) 1 ) );
+    TEST_ASSERT_EQUAL( 1, receiveCount );
+
+    phyTxLength = 0;
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, pChannelCommInterface->close( commInterfaceHandle ) );
+    TEST_ASSERT_EQUAL( sizeof( expectedClose ), phyTxLength );
+    TEST_ASSERT_EQUAL_MEMORY( expectedClose, phyTxBuffer, sizeof( expectedClose ) );
+    TEST_ASSERT_EQUAL( 1, phyCloseCount );
+}
+
+/**
+ * @brief Test that the DLCI rejected by the modem fails to open and the other channel is not affected.
+ */
+void test_Cellular_Cmux_Open_Rejected( void )
+{
+    const CellularCommInterface_t * pChannel1CommInterface = NULL;
+    const CellularCommInterface_t * pChannel2CommInterface = NULL;
+    CellularCommInterfaceHandle_t channel1Handle = NULL;
+    CellularCommInterfaceHandle_t channel2Handle = NULL;
+    uint32_t receiveCount = 0;
+
+    rejectDlci = 2;
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxInit( &mockCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 1, &pChannel1CommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 2, &pChannel2CommInterface ) );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel1CommInterface->open( prvReceiveCallback, &receiveCount, &channel1Handle ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_FAILURE,
+                       pChannel2CommInterface->open( prvReceiveCallback, &receiveCount, &channel2Handle ) );
+    TEST_ASSERT_EQUAL( 0, phyCloseCount );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, pChannel1CommInterface->close( channel1Handle ) );
+    TEST_ASSERT_EQUAL( 1, phyCloseCount );
+}
+
+/**
+ * @brief Test that the data is sent in UIH frames of at most N1 bytes.
+ */
+void test_Cellular_Cmux_Send( void )
+{
+    const CellularCommInterface_t * pChannelCommInterface = NULL;
+    CellularCommInterfaceHandle_t commInterfaceHandle = NULL;
+    uint8_t sendBuffer[ CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE + 1U ] = { 0 };
+    uint32_t receiveCount = 0;
+    uint32_t sentLength = 0;
+    const uint8_t expectedFrame[] = { 0xF9, 0x07, 0xEF, 0x07, 'A', 'T', '\r', 0xD3, 0xF9 };
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxInit( &mockCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 1, &pChannelCommInterface ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannelCommInterface->open( prvReceiveCallback, &receiveCount, &commInterfaceHandle ) );
+
+    phyTxLength = 0;
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannelCommInterface->send( commInterfaceHandle, ( const uint8_t * ) "AT\r", 3U, 100, &sentLength ) );
+    TEST_ASSERT_EQUAL( 3, sentLength );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame ), phyTxLength );
+    TEST_ASSERT_EQUAL_MEMORY( expectedFrame, phyTxBuffer, sizeof( expectedFrame ) );
+
+    /* One byte more than N1 is sent in two frames. */
+    phyTxLength = 0;
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannelCommInterface->send( commInterfaceHandle, sendBuffer, sizeof( sendBuffer ), 100, &sentLength ) );
+    TEST_ASSERT_EQUAL( sizeof( sendBuffer ), sentLength );
+    TEST_ASSERT_EQUAL( sizeof( sendBuffer ) + 12U, phyTxLength );
+    TEST_ASSERT_EQUAL( 0xF9, phyTxBuffer[ CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE + 5U ] );
+    TEST_ASSERT_EQUAL( 0x03, phyTxBuffer[ CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE + 9U ] );
+}
+
+/**
+ * @brief Test that the received frames are demultiplexed to the channels and
+ * invalid data is dropped.
+ */
+void test_Cellular_Cmux_Recv_Demux( void )
+{
+    const CellularCommInterface_t * pChannel1CommInterface = NULL;
+    const CellularCommInterface_t * pChannel2CommInterface = NULL;
+    CellularCommInterfaceHandle_t channel1Handle = NULL;
+    CellularCommInterfaceHandle_t channel2Handle = NULL;
+    uint8_t recvBuffer[ 32 ] = { 0 };
+    uint32_t channel1ReceiveCount = 0;
+    uint32_t channel2ReceiveCount = 0;
+    uint32_t receivedLength = 0;
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxInit( &mockCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 1, &pChannel1CommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 2, &pChannel2CommInterface ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel1CommInterface->open( prvReceiveCallback, &channel1ReceiveCount, &channel1Handle ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel2CommInterface->open( prvReceiveCallback, &channel2ReceiveCount, &channel2Handle ) );
+
+    /* Garbage, a frame with bad FCS and frames for both channels. */
+    phyRxBuffer[ phyRxLength ] = 0x55U;
+    phyRxLength++;
+    prvModemFrame( 1, 0xEFU, "BAD" );
+    phyRxBuffer[ phyRxLength - 2U ] ^= 0xFFU;
+    prvModemFrame( 2, 0xEFU, "DATA2" );
+    prvModemFrame( 1, 0xEFU, "OK\r\n" );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel1CommInterface->recv( channel1Handle, recvBuffer, sizeof( recvBuffer ), 100, &receivedLength ) );
+    TEST_ASSERT_EQUAL( 4, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( "OK\r\n", recvBuffer, 4 );
+
+    /* Channel 2 is not notified from the task context. It reads its data without
+     * receiving from the physical link. */
+    TEST_ASSERT_EQUAL( 0, channel1ReceiveCount );
+    TEST_ASSERT_EQUAL( 0, channel2ReceiveCount );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel2CommInterface->recv( channel2Handle, recvBuffer, sizeof( recvBuffer ), 100, &receivedLength ) );
+    TEST_ASSERT_EQUAL( 5, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( "DATA2", recvBuffer, 5 );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel2CommInterface->recv( channel2Handle, recvBuffer, sizeof( recvBuffer ), 100, &receivedLength ) );
+    TEST_ASSERT_EQUAL( 0, receivedLength );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, pChannel2CommInterface->close( channel2Handle ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, pChannel1CommInterface->close( channel1Handle ) );
+}
+
+/**
+ * @brief Test that the FCS of UI frames covers the information field.
+ */
+void test_Cellular_Cmux_Recv_UI_Frame( void )
+{
+    const CellularCommInterface_t * pChannelCommInterface = NULL;
+    CellularCommInterfaceHandle_t commInterfaceHandle = NULL;
+    uint8_t recvBuffer[ 32 ] = { 0 };
+    uint32_t receiveCount = 0;
+    uint32_t receivedLength = 0;
+    uint32_t badFrameOffset = 0;
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxInit( &mockCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 1, &pChannelCommInterface ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannelCommInterface->open( prvReceiveCallback, &receiveCount, &commInterfaceHandle ) );
+
+    /* A UI frame with the FCS of the header only is dropped. */
+    badFrameOffset = phyRxLength;
+    prvModemFrame( 1, CELLULAR_SAMPLE_CTRL_UIH, "BAD" );
+    phyRxBuffer[ badFrameOffset + 2U ] = CELLULAR_SAMPLE_CTRL_UI;
+    prvModemFrame( 1, CELLULAR_SAMPLE_CTRL_UI, "OK\r\n" );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannelCommInterface->recv( commInterfaceHandle, recvBuffer, sizeof( recvBuffer ), 100, &receivedLength ) );
+    TEST_ASSERT_EQUAL( 4, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( "OK\r\n", recvBuffer, 4 );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, pChannelCommInterface->close( commInterfaceHandle ) );
+}
+
+/**
+ * @brief Test that the modem is asked to stop sending on a DLCI when its buffer
+ * can't take another frame and to resume when the buffer is read.
+ */
+void test_Cellular_Cmux_Recv_Flow_Control( void )
+{
+    const CellularCommInterface_t * pChannel1CommInterface = NULL;
+    const CellularCommInterface_t * pChannel2CommInterface = NULL;
+    CellularCommInterfaceHandle_t channel1Handle = NULL;
+    CellularCommInterfaceHandle_t channel2Handle = NULL;
+    static uint8_t recvBuffer[ CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE ];
+    char fillInfo[ CELLULAR_SAMPLE_FILL_INFO_LENGTH + 1U ] = { 0 };
+    uint32_t channel1ReceiveCount = 0;
+    uint32_t channel2ReceiveCount = 0;
+    uint32_t receivedLength = 0;
+    uint32_t fillLength = 0;
+    const uint8_t expectedStop[] = { 0xF9, 0x03, 0xEF, 0x09, 0xE3, 0x05, 0x0B, 0x8F, 0xFB, 0xF9 };
+    const uint8_t expectedResume[] = { 0xF9, 0x03, 0xEF, 0x09, 0xE3, 0x05, 0x0B, 0x8D, 0xFB, 0xF9 };
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxInit( &mockCommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 1, &pChannel1CommInterface ) );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CmuxGetChannel( 2, &pChannel2CommInterface ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel1CommInterface->open( prvReceiveCallback, &channel1ReceiveCount, &channel1Handle ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel2CommInterface->open( prvReceiveCallback, &channel2ReceiveCount, &channel2Handle ) );
+
+    /* Fill the buffer of channel 2 until it can't take another frame. */
+    ( void ) memset( fillInfo, 'x', CELLULAR_SAMPLE_FILL_INFO_LENGTH );
+
+    while( ( CELLULAR_CONFIG_CMUX_CHANNEL_BUFFER_SIZE - fillLength ) >= CELLULAR_CONFIG_CMUX_MAX_FRAME_SIZE )
+    {
+        prvModemFrame( 2, CELLULAR_SAMPLE_CTRL_UIH, fillInfo );
+        fillLength = fillLength + CELLULAR_SAMPLE_FILL_INFO_LENGTH;
+    }
+
+    /* Channel 1 demultiplexes the frames from the physical link. */
+    phyTxLength = 0;
+
+    while( phyRxOffset < phyRxLength )
+    {
+        TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                           pChannel1CommInterface->recv( channel1Handle, recvBuffer, sizeof( recvBuffer ), 100, &receivedLength ) );
+        TEST_ASSERT_EQUAL( 0, receivedLength );
+    }
+
+    TEST_ASSERT_EQUAL( sizeof( expectedStop ), phyTxLength );
+    TEST_ASSERT_EQUAL_MEMORY( expectedStop, phyTxBuffer, sizeof( expectedStop ) );
+
+    /* Reading the buffer resumes the DLCI. */
+    phyTxLength = 0;
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pChannel2CommInterface->recv( channel2Handle, recvBuffer, sizeof( recvBuffer ), 100, &receivedLength ) );
+    TEST_ASSERT_EQUAL( fillLength, receivedLength );
+    TEST_ASSERT_EQUAL( sizeof( expectedResume ), phyTxLength );
+    TEST_ASSERT_EQUAL_MEMORY( expectedResume, phyTxBuffer, sizeof( expectedResume ) );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, pChannel2CommInterface->close( channel2Handle ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, pChannel1CommInterface->close( channel1Handle ) );
+}
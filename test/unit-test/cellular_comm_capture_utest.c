@@ -0,0 +1,409 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @file cellular_comm_capture_utest.c
+ * @brief Unit tests for functions in cellular_comm_capture.h.
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "unity.h"
+
+/* Include paths for public enums, structures, and macros. */
+#include "cellular_platform.h"
+
+#include "cellular_comm_capture.h"
+
+/**
+ * @brief Cellular sample AT command.
+ */
+#define CELLULAR_SAMPLE_AT_COMMAND     "AT+CSQ\r"
+
+/**
+ * @brief Cellular sample AT response.
+ */
+#define CELLULAR_SAMPLE_AT_RESPONSE    "\r\n+CSQ: 20,99\r\n\r\nOK\r\n"
+
+/**
+ * @brief Cellular sample ring buffer size.
+ */
+#define CELLULAR_SAMPLE_RING_SIZE      ( 64U )
+
+/**
+ * @brief Cellular sample dump buffer size.
+ */
+#define CELLULAR_SAMPLE_DUMP_SIZE      ( 128U )
+
+static uint32_t mockTimeMs = 0;
+static uint32_t sinkRecordCount = 0;
+static uint8_t sinkLastRecordType = 0;
+static CellularCommInterfaceReceiveCallback_t mockReceiveCallback = NULL;
+static void * pMockReceiveUserData = NULL;
+static uint8_t ringBuffer[ CELLULAR_SAMPLE_RING_SIZE ];
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    mockTimeMs = 0;
+    sinkRecordCount = 0;
+    sinkLastRecordType = 0;
+    mockReceiveCallback = NULL;
+    pMockReceiveUserData = NULL;
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+    Cellular_CommCaptureDeinit();
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void * mock_malloc( size_t size )
+{
+    return malloc( size );
+}
+
+uint32_t MockGetTimeMs( void )
+{
+    return mockTimeMs;
+}
+
+bool MockPlatformMutex_Create( PlatformMutex_t * pNewMutex,
+                               bool recursive )
+{
+    ( void ) recursive;
+    pNewMutex->created = true;
+    return true;
+}
+
+void MockPlatformMutex_Destroy( PlatformMutex_t * pMutex )
+{
+    pMutex->created = false;
+}
+
+void MockPlatformMutex_Lock( PlatformMutex_t * pMutex )
+{
+    ( void ) pMutex;
+}
+
+void MockPlatformMutex_Unlock( PlatformMutex_t * pMutex )
+{
+    ( void ) pMutex;
+}
+
+static CellularCommInterfaceError_t prvCommIntfOpen( CellularCommInterfaceReceiveCallback_t receiveCallback,
+                                                     void * pUserData,
+                                                     CellularCommInterfaceHandle_t * pCommInterfaceHandle )
+{
+    mockReceiveCallback = receiveCallback;
+    pMockReceiveUserData = pUserData;
+    *pCommInterfaceHandle = ( CellularCommInterfaceHandle_t ) 1;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvCommIntfSend( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                     const uint8_t * pData,
+                                                     uint32_t dataLength,
+                                                     uint32_t timeoutMilliseconds,
+                                                     uint32_t * pDataSentLength )
+{
+    ( void ) commInterfaceHandle;
+    ( void ) pData;
+    ( void ) timeoutMilliseconds;
+    *pDataSentLength = dataLength;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvCommIntfRecv( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                     uint8_t * pBuffer,
+                                                     uint32_t bufferLength,
+                                                     uint32_t timeoutMilliseconds,
+                                                     uint32_t * pDataReceivedLength )
+{
+    uint32_t length = ( uint32_t ) strlen( CELLULAR_SAMPLE_AT_RESPONSE );
+
+    ( void ) commInterfaceHandle;
+    ( void ) timeoutMilliseconds;
+
+    if( length > bufferLength )
+    {
+        length = bufferLength;
+    }
+
+    ( void ) memcpy( pBuffer, CELLULAR_SAMPLE_AT_RESPONSE, length );
+    *pDataReceivedLength = length;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvCommIntfClose( CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    ( void ) commInterfaceHandle;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvReceiveCallback( void * pUserData,
+                                                        CellularCommInterfaceHandle_t commInterfaceHandle )
+{
+    ( void ) commInterfaceHandle;
+    *( ( uint32_t * ) pUserData ) = *( ( uint32_t * ) pUserData ) + 1U;
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static void prvCaptureSink( const uint8_t * pRecordHeader,
+                            const uint8_t * pPayload,
+                            uint16_t payloadLength,
+                            void * pSinkContext )
+{
+    ( void ) pPayload;
+    ( void ) payloadLength;
+    ( void ) pSinkContext;
+    sinkRecordCount++;
+    sinkLastRecordType = pRecordHeader[ 0 ];
+}
+
+static CellularCommInterface_t mockCommInterface =
+{
+    prvCommIntfOpen,
+    prvCommIntfSend,
+    prvCommIntfRecv,
+    prvCommIntfClose
+};
+
+/* ========================================================================== */
+
+/**
+ * @brief Test that any invalid parameter causes Cellular_CommCaptureInit to return CELLULAR_BAD_PARAMETER.
+ */
+void test_Cellular_CommCaptureInit_Invalid_Param( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularCommCaptureConfig_t config = { 0 };
+    const CellularCommInterface_t * pCaptureCommInterface = NULL;
+
+    cellularStatus = Cellular_CommCaptureInit( NULL, &pCaptureCommInterface );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = Cellular_CommCaptureInit( &config, &pCaptureCommInterface );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* No ring buffer and no sink. */
+    config.pCommInterface = &mockCommInterface;
+    cellularStatus = Cellular_CommCaptureInit( &config, &pCaptureCommInterface );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* Ring buffer too small. */
+    config.pRingBuffer = ringBuffer;
+    config.ringBufferSize = CELLULAR_COMM_CAPTURE_REC_HDR_SIZE;
+    cellularStatus = Cellular_CommCaptureInit( &config, &pCaptureCommInterface );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test that send and recv chunks are recorded in the ring and dumped in order.
+ */
+void test_Cellular_CommCapture_Send_Recv_Dump( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularCommCaptureConfig_t config = { 0 };
+    const CellularCommInterface_t * pCaptureCommInterface = NULL;
+    CellularCommInterfaceHandle_t commInterfaceHandle = NULL;
+    uint8_t dumpBuffer[ CELLULAR_SAMPLE_DUMP_SIZE ] = { 0 };
+    uint8_t recvBuffer[ 32 ] = { 0 };
+    uint32_t dumpLength = 0;
+    uint32_t ioLength = 0;
+    uint32_t receiveCount = 0;
+    uint32_t offset = 0;
+
+    config.pCommInterface = &mockCommInterface;
+    config.pRingBuffer = ringBuffer;
+    config.ringBufferSize = CELLULAR_SAMPLE_RING_SIZE;
+
+    cellularStatus = Cellular_CommCaptureInit( &config, &pCaptureCommInterface );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pCaptureCommInterface->open( prvReceiveCallback, &receiveCount, &commInterfaceHandle ) );
+
+    /* The receive callback is forwarded with the capture handle. */
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       mockReceiveCallback( pMockReceiveUserData, ( CellularCommInterfaceHandle_t ) 1 ) );
+    TEST_ASSERT_EQUAL( 1, receiveCount );
+
+    mockTimeMs = 0x01020304U;
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pCaptureCommInterface->send( commInterfaceHandle, ( const uint8_t * ) CELLULAR_SAMPLE_AT_COMMAND,
+                                                    strlen( CELLULAR_SAMPLE_AT_COMMAND ), 100, &ioLength ) );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS,
+                       pCaptureCommInterface->recv( commInterfaceHandle, recvBuffer, sizeof( recvBuffer ), 100, &ioLength ) );
+
+    cellularStatus = Cellular_CommCaptureDump( dumpBuffer, sizeof( dumpBuffer ), &dumpLength );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_COMM_CAPTURE_FILE_HDR_SIZE + ( 3U * CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ) +
+                       strlen( CELLULAR_SAMPLE_AT_COMMAND ) + strlen( CELLULAR_SAMPLE_AT_RESPONSE ), dumpLength );
+    TEST_ASSERT_EQUAL_MEMORY( CELLULAR_COMM_CAPTURE_MAGIC, dumpBuffer, 4 );
+
+    /* Open record. */
+    offset = CELLULAR_COMM_CAPTURE_FILE_HDR_SIZE;
+    TEST_ASSERT_EQUAL( CELLULAR_COMM_CAPTURE_RECORD_OPEN, dumpBuffer[ offset ] );
+    offset = offset + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE;
+
+    /* Send record with little endian timestamp and length. */
+    TEST_ASSERT_EQUAL( CELLULAR_COMM_CAPTURE_RECORD_SEND, dumpBuffer[ offset ] );
+    TEST_ASSERT_EQUAL( 0x04, dumpBuffer[ offset + 1U ] );
+    TEST_ASSERT_EQUAL( 0x01, dumpBuffer[ offset + 4U ] );
+    TEST_ASSERT_EQUAL( strlen( CELLULAR_SAMPLE_AT_COMMAND ), dumpBuffer[ offset + 5U ] );
+    TEST_ASSERT_EQUAL_MEMORY( CELLULAR_SAMPLE_AT_COMMAND, &dumpBuffer[ offset + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ],
+                              strlen( CELLULAR_SAMPLE_AT_COMMAND ) );
+    offset = offset + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE + strlen( CELLULAR_SAMPLE_AT_COMMAND );
+
+    /* Recv record. */
+    TEST_ASSERT_EQUAL( CELLULAR_COMM_CAPTURE_RECORD_RECV, dumpBuffer[ offset ] );
+    TEST_ASSERT_EQUAL_MEMORY( CELLULAR_SAMPLE_AT_RESPONSE, &dumpBuffer[ offset + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE ],
+                              strlen( CELLULAR_SAMPLE_AT_RESPONSE ) );
+
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, pCaptureCommInterface->close( commInterfaceHandle ) );
+}
+
+/**
+ * @brief Test that the oldest records are dropped when the ring is full.
+ */
+void test_Cellular_CommCapture_Ring_Wrap( void )
+{
+    CellularCommCaptureConfig_t config = { 0 };
+    const CellularCommInterface_t * pCaptureCommInterface = NULL;
+    CellularCommInterfaceHandle_t commInterfaceHandle = NULL;
+    uint8_t dumpBuffer[ CELLULAR_SAMPLE_DUMP_SIZE ] = { 0 };
+    uint32_t dumpLength = 0;
+    uint32_t ioLength = 0;
+    uint32_t offset = 0;
+    uint32_t recordCount = 0;
+    uint8_t i = 0;
+
+    config.pCommInterface = &mockCommInterface;
+    config.pRingBuffer = ringBuffer;
+    config.ringBufferSize = CELLULAR_SAMPLE_RING_SIZE;
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CommCaptureInit( &config, &pCaptureCommInterface ) );
+    ( void ) pCaptureCommInterface->open( prvReceiveCallback, &ioLength, &commInterfaceHandle );
+
+    for( i = 0; i < 10U; i++ )
+    {
+        ( void ) pCaptureCommInterface->send( commInterfaceHandle, ( const uint8_t * ) CELLULAR_SAMPLE_AT_COMMAND,
+                                              strlen( CELLULAR_SAMPLE_AT_COMMAND ), 100, &ioLength );
+    }
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CommCaptureDump( dumpBuffer, sizeof( dumpBuffer ), &dumpLength ) );
+
+    /* Only complete send records are kept. */
+    offset = CELLULAR_COMM_CAPTURE_FILE_HDR_SIZE;
+
+    while( offset < dumpLength )
+    {
+        TEST_ASSERT_EQUAL( CELLULAR_COMM_CAPTURE_RECORD_SEND, dumpBuffer[ offset ] );
+        offset = offset + CELLULAR_COMM_CAPTURE_REC_HDR_SIZE + dumpBuffer[ offset + 5U ];
+        recordCount++;
+    }
+
+    TEST_ASSERT_EQUAL( dumpLength, offset );
+    TEST_ASSERT_EQUAL( CELLULAR_SAMPLE_RING_SIZE / ( CELLULAR_COMM_CAPTURE_REC_HDR_SIZE + strlen( CELLULAR_SAMPLE_AT_COMMAND ) ),
+                       recordCount );
+}
+
+/**
+ * @brief Test that a chunk larger than the ring is truncated and keeps the latest data.
+ */
+void test_Cellular_CommCapture_Truncated_Record( void )
+{
+    CellularCommCaptureConfig_t config = { 0 };
+    const CellularCommInterface_t * pCaptureCommInterface = NULL;
+    CellularCommInterfaceHandle_t commInterfaceHandle = NULL;
+    uint8_t dumpBuffer[ CELLULAR_SAMPLE_DUMP_SIZE ] = { 0 };
+    uint8_t sendBuffer[ CELLULAR_SAMPLE_RING_SIZE ] = { 0 };
+    uint32_t dumpLength = 0;
+    uint32_t ioLength = 0;
+    uint32_t offset = CELLULAR_COMM_CAPTURE_FILE_HDR_SIZE;
+
+    sendBuffer[ CELLULAR_SAMPLE_RING_SIZE - 1U ] = 0x5A;
+    config.pCommInterface = &mockCommInterface;
+    config.pRingBuffer = ringBuffer;
+    config.ringBufferSize = CELLULAR_SAMPLE_RING_SIZE;
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CommCaptureInit( &config, &pCaptureCommInterface ) );
+    ( void ) pCaptureCommInterface->open( prvReceiveCallback, &ioLength, &commInterfaceHandle );
+    ( void ) pCaptureCommInterface->send( commInterfaceHandle, sendBuffer, sizeof( sendBuffer ), 100, &ioLength );
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CommCaptureDump( dumpBuffer, sizeof( dumpBuffer ), &dumpLength ) );
+    TEST_ASSERT_EQUAL( CELLULAR_COMM_CAPTURE_FILE_HDR_SIZE + CELLULAR_SAMPLE_RING_SIZE, dumpLength );
+    TEST_ASSERT_EQUAL( CELLULAR_COMM_CAPTURE_RECORD_SEND | CELLULAR_COMM_CAPTURE_FLAG_TRUNCATED, dumpBuffer[ offset ] );
+    TEST_ASSERT_EQUAL( 0x5A, dumpBuffer[ dumpLength - 1U ] );
+}
+
+/**
+ * @brief Test that the user sink is called for each record and recording can be disabled.
+ */
+void test_Cellular_CommCapture_Sink( void )
+{
+    CellularCommCaptureConfig_t config = { 0 };
+    const CellularCommInterface_t * pCaptureCommInterface = NULL;
+    CellularCommInterfaceHandle_t commInterfaceHandle = NULL;
+    uint8_t dumpBuffer[ CELLULAR_SAMPLE_DUMP_SIZE ] = { 0 };
+    uint8_t recvBuffer[ 32 ] = { 0 };
+    uint32_t ioLength = 0;
+
+    config.pCommInterface = &mockCommInterface;
+    config.sink = prvCaptureSink;
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_CommCaptureInit( &config, &pCaptureCommInterface ) );
+    ( void ) pCaptureCommInterface->open( prvReceiveCallback, &ioLength, &commInterfaceHandle );
+    ( void ) pCaptureCommInterface->recv( commInterfaceHandle, recvBuffer, sizeof( recvBuffer ), 100, &ioLength );
+    TEST_ASSERT_EQUAL( 2, sinkRecordCount );
+    TEST_ASSERT_EQUAL( CELLULAR_COMM_CAPTURE_RECORD_RECV, sinkLastRecordType );
+
+    Cellular_CommCaptureEnable( false );
+    ( void ) pCaptureCommInterface->recv( commInterfaceHandle, recvBuffer, sizeof( recvBuffer ), 100, &ioLength );
+    TEST_ASSERT_EQUAL( 2, sinkRecordCount );
+
+    /* No ring to dump. */
+    TEST_ASSERT_EQUAL( CELLULAR_NOT_ALLOWED, Cellular_CommCaptureDump( dumpBuffer, sizeof( dumpBuffer ), &ioLength ) );
+}
@@ -273,6 +273,37 @@ static CellularCommInterface_t cellularCommInterface =
     .close = _prvCommIntfClose
 };
 
+static CellularError_t _prvSocketSend( CellularContext_t * pContext,
+                                       CellularSocketHandle_t socketHandle,
+                                       const uint8_t * pData,
+                                       uint32_t dataLength,
+                                       uint32_t * pSentDataLength )
+{
+    ( void ) pContext;
+    ( void ) socketHandle;
+    ( void ) pData;
+
+    *pSentDataLength = dataLength;
+
+    return CELLULAR_SUCCESS;
+}
+
+static CellularError_t _prvSocketRecv( CellularContext_t * pContext,
+                                       CellularSocketHandle_t socketHandle,
+                                       uint8_t * pBuffer,
+                                       uint32_t bufferLength,
+                                       uint32_t * pReceivedDataLength )
+{
+    ( void ) pContext;
+    ( void ) socketHandle;
+    ( void ) pBuffer;
+    ( void ) bufferLength;
+
+    *pReceivedDataLength = 0;
+
+    return CELLULAR_SUCCESS;
+}
+
 
 /* ========================================================================== */
 
@@ -351,11 +382,11 @@ void test_Cellular_CommonInit_Null_Token_Table( void )
 }
 
 /**
- * @brief Cellular_CommonInit - Test that _Cellular_LibInit returns error.
+ * @brief Cellular_CommonInit - Test that _Cellular_LibInitWithSocketTable returns error.
  *
  * <b>Coverage</b>
  * @code{c}
- * cellularStatus = _Cellular_LibInit( pCellularHandle, pCommInterface, pTokenTable );
+ * cellularStatus = _Cellular_LibInitWithSocketTable( pCellularHandle, pCommInterface, pTokenTable, pSocketTable );
  * ...
  * if( cellularStatus == CELLULAR_SUCCESS )
  * {
@@ -370,7 +401,7 @@ void test_Cellular_CommonInit_Lib_Init_error( void )
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
 
     /* Expectation. */
-    _Cellular_LibInit_IgnoreAndReturn( CELLULAR_RESOURCE_CREATION_FAIL );
+    _Cellular_LibInitWithSocketTable_IgnoreAndReturn( CELLULAR_RESOURCE_CREATION_FAIL );
 
     /* API call. */
     cellularStatus = Cellular_CommonInit( &pHandler, &cellularCommInterface, &tokenTable );
@@ -403,7 +434,7 @@ void test_Cellular_CommonInit_Module_Init_error( void )
     pContext = &xCellularContext;
 
     /* Expectation. */
-    _Cellular_LibInit_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_LibInitWithSocketTable_IgnoreAndReturn( CELLULAR_SUCCESS );
     Cellular_ModuleInit_ExpectAndReturn( &xCellularContext, &xCellularContext.pModuleContext, CELLULAR_INTERNAL_FAILURE );
     _Cellular_LibCleanup_ExpectAndReturn( &xCellularContext, CELLULAR_SUCCESS );
 
@@ -437,7 +468,7 @@ void test_Cellular_CommonInit_Module_Enable_UE_error( void )
     pContext = &xCellularContext;
 
     /* Expectation. */
-    _Cellular_LibInit_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_LibInitWithSocketTable_IgnoreAndReturn( CELLULAR_SUCCESS );
     Cellular_ModuleInit_ExpectAndReturn( &xCellularContext, &xCellularContext.pModuleContext, CELLULAR_SUCCESS );
     Cellular_ModuleEnableUE_ExpectAndReturn( &xCellularContext, CELLULAR_INTERNAL_FAILURE );
 
@@ -476,7 +507,7 @@ void test_Cellular_CommonInit_Module_Enable_URC_error( void )
     pContext = &xCellularContext;
 
     /* Expectation. */
-    _Cellular_LibInit_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_LibInitWithSocketTable_IgnoreAndReturn( CELLULAR_SUCCESS );
     Cellular_ModuleInit_ExpectAndReturn( &xCellularContext, &xCellularContext.pModuleContext, CELLULAR_SUCCESS );
     Cellular_ModuleEnableUE_ExpectAndReturn( &xCellularContext, CELLULAR_SUCCESS );
     Cellular_ModuleEnableUrc_ExpectAndReturn( &xCellularContext, CELLULAR_INTERNAL_FAILURE );
@@ -499,7 +530,7 @@ void test_Cellular_CommonInit_Happy_Path( void )
     CellularError_t cellularStatus = CELLULAR_SUCCESS;
     struct CellularContext handler;
 
-    _Cellular_LibInit_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_LibInitWithSocketTable_IgnoreAndReturn( CELLULAR_SUCCESS );
 
     Cellular_ModuleInit_IgnoreAndReturn( CELLULAR_SUCCESS );
 
@@ -512,6 +543,58 @@ void test_Cellular_CommonInit_Happy_Path( void )
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
 }
 
+/**
+ * @brief Cellular_CommonInitWithSocketTable - Test that _Cellular_LibInitWithSocketTable returns error.
+ */
+void test_Cellular_CommonInitWithSocketTable_Lib_Init_error( void )
+{
+    struct CellularContext xCellularContext = { 0 };
+    struct CellularContext * pContext;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketTable_t socketTable = { 0 };
+
+    /* Setup. */
+    pContext = &xCellularContext;
+
+    /* Expectation. */
+    _Cellular_LibInitWithSocketTable_ExpectAndReturn( &pContext, &cellularCommInterface, &tokenTable, &socketTable, CELLULAR_BAD_PARAMETER );
+
+    /* API call. */
+    cellularStatus = Cellular_CommonInitWithSocketTable( &pContext, &cellularCommInterface, &tokenTable, &socketTable );
+
+    /* Verification. */
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test that happy path case for Cellular_CommonInitWithSocketTable.
+ */
+void test_Cellular_CommonInitWithSocketTable_Happy_Path( void )
+{
+    struct CellularContext xCellularContext = { 0 };
+    struct CellularContext * pContext;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketContext_t * socketData[ 2 ] = { 0 };
+    CellularSocketTable_t socketTable = { 0 };
+
+    /* Setup. */
+    pContext = &xCellularContext;
+    socketTable.pSocketData = socketData;
+    socketTable.numSockets = 2;
+
+    /* Expectation. */
+    _Cellular_LibInitWithSocketTable_ExpectAndReturn( &pContext, &cellularCommInterface, &tokenTable, &socketTable, CELLULAR_SUCCESS );
+    Cellular_ModuleInit_ExpectAndReturn( &xCellularContext, &xCellularContext.pModuleContext, CELLULAR_SUCCESS );
+    Cellular_ModuleEnableUE_ExpectAndReturn( &xCellularContext, CELLULAR_SUCCESS );
+    Cellular_ModuleEnableUrc_ExpectAndReturn( &xCellularContext, CELLULAR_SUCCESS );
+
+    /* API call. */
+    cellularStatus = Cellular_CommonInitWithSocketTable( &pContext, &cellularCommInterface, &tokenTable, &socketTable );
+
+    /* Verification. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+}
+
 /**
  * @brief Test that null handler case for Cellular_CommonCleanup.
  */
@@ -1060,7 +1143,7 @@ void test_Cellular_CommonSocketSetSockOpt_Option_Unsupported_Failure_Path( void
 
     cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
                                                       CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
-                                                      CELLULAR_SOCKET_OPTION_SET_LOCAL_PORT + 1,
+                                                      CELLULAR_SOCKET_OPTION_SEND_COALESCE + 1,
                                                       ( const uint8_t * ) &optionValue, sizeof( uint32_t ) );
 
     TEST_ASSERT_EQUAL( CELLULAR_UNSUPPORTED, cellularStatus );
@@ -1253,6 +1336,77 @@ void test_Cellular_CommonSocketRegisterClosedCallback_Happy_Path( void )
     TEST_ASSERT_EQUAL( socketHandle.pClosedCallbackContext, testCallback );
 }
 
+/**
+ * @brief Test that null handler case for Cellular_CommonSocketPoll.
+ */
+void test_Cellular_CommonSocketPoll_Null_Handler( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketPollFd_t pollFd = { 0 };
+    uint8_t numReady = 0;
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_INVALID_HANDLE );
+
+    cellularStatus = Cellular_CommonSocketPoll( NULL, &pollFd, 1, 0, &numReady );
+
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+}
+
+/**
+ * @brief Test that happy path case for Cellular_CommonSocketPoll.
+ */
+void test_Cellular_CommonSocketPoll_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    CellularSocketPollFd_t pollFd = { 0 };
+    uint8_t numReady = 0;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    _Cellular_SocketPoll_ExpectAndReturn( &context, &pollFd, 1, 100, &numReady, CELLULAR_TIMEOUT );
+
+    cellularStatus = Cellular_CommonSocketPoll( &context, &pollFd, 1, 100, &numReady );
+
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+}
+
+/**
+ * @brief Test that null handler case for Cellular_CommonSocketGetStats.
+ */
+void test_Cellular_CommonSocketGetStats_Null_Handler( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketStats_t stats;
+
+    _Cellular_CheckLibraryStatus_ExpectAndReturn( NULL, CELLULAR_INVALID_HANDLE );
+
+    cellularStatus = Cellular_CommonSocketGetStats( NULL, NULL, &stats );
+
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+}
+
+/**
+ * @brief Test that happy path case for Cellular_CommonSocketGetStats.
+ */
+void test_Cellular_CommonSocketGetStats_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    struct CellularSocketContext socketData = { 0 };
+    CellularSocketStats_t stats;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    _Cellular_CheckLibraryStatus_ExpectAndReturn( &context, CELLULAR_SUCCESS );
+    _Cellular_SocketGetStats_ExpectAndReturn( &context, &socketData, &stats, CELLULAR_SUCCESS );
+
+    cellularStatus = Cellular_CommonSocketGetStats( &context, &socketData, &stats );
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+}
+
 /**
  * @brief Test that option set local port happy path case for Cellular_CommonSocketSetSockOpt.
  */
@@ -1327,3 +1481,204 @@ void test_Cellular_CommonSocketSetSockOpt_Option_SetLocalPort_WrongSize_Failure_
     TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
     TEST_ASSERT_EQUAL( 0, socketHandle.localPort );
 }
+
+/**
+ * @brief Test that option receive prefetch happy path case for Cellular_CommonSocketSetSockOpt.
+ */
+void test_Cellular_CommonSocketSetSockOpt_Option_RecvPrefetch_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t prefetchBuffer[ 16 ];
+    CellularSocketRecvPrefetchBuffer_t optionValue = { 0 };
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+    context.socketRecvFunc = _prvSocketRecv;
+
+    /* Set the prefetch buffer. */
+    optionValue.pBuffer = prefetchBuffer;
+    optionValue.bufferLength = sizeof( prefetchBuffer );
+    socketHandle.recvPrefetch.readIndex = 3;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_RECV_PREFETCH,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketRecvPrefetchBuffer_t ) );
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( prefetchBuffer, socketHandle.recvPrefetch.pBuffer );
+    TEST_ASSERT_EQUAL( sizeof( prefetchBuffer ), socketHandle.recvPrefetch.bufferLength );
+    TEST_ASSERT_EQUAL( 0, socketHandle.recvPrefetch.readIndex );
+
+    /* Disable the prefetch. */
+    optionValue.pBuffer = NULL;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_RECV_PREFETCH,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketRecvPrefetchBuffer_t ) );
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( NULL, socketHandle.recvPrefetch.pBuffer );
+    TEST_ASSERT_EQUAL( 0, socketHandle.recvPrefetch.bufferLength );
+}
+
+/**
+ * @brief Test that option receive prefetch failure path cases for Cellular_CommonSocketSetSockOpt.
+ */
+void test_Cellular_CommonSocketSetSockOpt_Option_RecvPrefetch_Failure_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t prefetchBuffer[ 16 ];
+    CellularSocketRecvPrefetchBuffer_t optionValue = { 0 };
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+
+    /* Wrong option size. */
+    optionValue.pBuffer = prefetchBuffer;
+    optionValue.bufferLength = sizeof( prefetchBuffer );
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_RECV_PREFETCH,
+                                                      ( const uint8_t * ) &optionValue, sizeof( uint32_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+
+    /* Zero buffer length. */
+    optionValue.bufferLength = 0;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_RECV_PREFETCH,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketRecvPrefetchBuffer_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* Data is buffered in the prefetch buffer. */
+    optionValue.bufferLength = sizeof( prefetchBuffer );
+    socketHandle.recvPrefetch.dataLength = 1;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_RECV_PREFETCH,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketRecvPrefetchBuffer_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+    TEST_ASSERT_EQUAL( NULL, socketHandle.recvPrefetch.pBuffer );
+
+    /* The module does not receive socket data with _Cellular_SocketRecvPrefetch. */
+    socketHandle.recvPrefetch.dataLength = 0;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_RECV_PREFETCH,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketRecvPrefetchBuffer_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_UNSUPPORTED, cellularStatus );
+    TEST_ASSERT_EQUAL( NULL, socketHandle.recvPrefetch.pBuffer );
+}
+
+/**
+ * @brief Test that option send coalesce happy path case for Cellular_CommonSocketSetSockOpt.
+ */
+void test_Cellular_CommonSocketSetSockOpt_Option_SendCoalesce_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t coalesceBuffer[ 16 ];
+    CellularSocketSendCoalesceBuffer_t optionValue = { 0 };
+
+    socketHandle.socketType = CELLULAR_SOCKET_TYPE_STREAM;
+    context.socketSendFunc = _prvSocketSend;
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+
+    /* Set the coalescing buffer. */
+    optionValue.pBuffer = coalesceBuffer;
+    optionValue.bufferLength = sizeof( coalesceBuffer );
+    optionValue.flushDelayMs = 20;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_SEND_COALESCE,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketSendCoalesceBuffer_t ) );
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( coalesceBuffer, socketHandle.sendCoalesce.pBuffer );
+    TEST_ASSERT_EQUAL( sizeof( coalesceBuffer ), socketHandle.sendCoalesce.bufferLength );
+    TEST_ASSERT_EQUAL( 20, socketHandle.sendCoalesce.flushDelayMs );
+
+    /* Disable the coalescing. */
+    optionValue.pBuffer = NULL;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_SEND_COALESCE,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketSendCoalesceBuffer_t ) );
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( NULL, socketHandle.sendCoalesce.pBuffer );
+    TEST_ASSERT_EQUAL( 0, socketHandle.sendCoalesce.bufferLength );
+    TEST_ASSERT_EQUAL( 0, socketHandle.sendCoalesce.flushDelayMs );
+}
+
+/**
+ * @brief Test that option send coalesce failure path cases for Cellular_CommonSocketSetSockOpt.
+ */
+void test_Cellular_CommonSocketSetSockOpt_Option_SendCoalesce_Failure_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t coalesceBuffer[ 16 ];
+    CellularSocketSendCoalesceBuffer_t optionValue = { 0 };
+
+    _Cellular_CheckLibraryStatus_IgnoreAndReturn( CELLULAR_SUCCESS );
+
+    /* Wrong option size. */
+    socketHandle.socketType = CELLULAR_SOCKET_TYPE_STREAM;
+    optionValue.pBuffer = coalesceBuffer;
+    optionValue.bufferLength = sizeof( coalesceBuffer );
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_SEND_COALESCE,
+                                                      ( const uint8_t * ) &optionValue, sizeof( uint32_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+
+    /* Zero buffer length. */
+    optionValue.bufferLength = 0;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_SEND_COALESCE,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketSendCoalesceBuffer_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* Data is buffered in the coalescing buffer. */
+    optionValue.bufferLength = sizeof( coalesceBuffer );
+    socketHandle.sendCoalesce.dataLength = 1;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_SEND_COALESCE,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketSendCoalesceBuffer_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+
+    /* Datagram socket. */
+    socketHandle.sendCoalesce.dataLength = 0;
+    socketHandle.socketType = CELLULAR_SOCKET_TYPE_DGRAM;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_SEND_COALESCE,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketSendCoalesceBuffer_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_UNSUPPORTED, cellularStatus );
+    TEST_ASSERT_EQUAL( NULL, socketHandle.sendCoalesce.pBuffer );
+
+    /* The module does not send socket data with _Cellular_SocketSendCoalesce. */
+    socketHandle.socketType = CELLULAR_SOCKET_TYPE_STREAM;
+    cellularStatus = Cellular_CommonSocketSetSockOpt( &context, &socketHandle,
+                                                      CELLULAR_SOCKET_OPTION_LEVEL_TRANSPORT,
+                                                      CELLULAR_SOCKET_OPTION_SEND_COALESCE,
+                                                      ( const uint8_t * ) &optionValue, sizeof( CellularSocketSendCoalesceBuffer_t ) );
+    TEST_ASSERT_EQUAL( CELLULAR_UNSUPPORTED, cellularStatus );
+    TEST_ASSERT_EQUAL( NULL, socketHandle.sendCoalesce.pBuffer );
+}
@@ -79,6 +79,52 @@ static int eventData = 0;
 
 static char * pData;
 
+static uint8_t recvModemData[ 4096 ];
+
+static uint32_t recvModemDataLength = 0;
+
+static uint32_t recvModemReadIndex = 0;
+
+static uint32_t recvModemReadCount = 0;
+
+static uint32_t recvModemLastReadLength = 0;
+
+static CellularError_t recvModemStatus = CELLULAR_SUCCESS;
+
+static bool recvModemDataReadyInRead = false;
+
+static int dataReadyCallbackCount = 0;
+
+static uint32_t mockTimeMs = 0;
+
+static uint8_t sendModemData[ 4096 ];
+
+static uint32_t sendModemDataLength = 0;
+
+static uint32_t sendModemSendCount = 0;
+
+static uint32_t sendModemAcceptLength = 0;
+
+static CellularError_t sendModemStatus = CELLULAR_SUCCESS;
+
+static uint32_t sendModemDelayMs = 0;
+
+static int eventGroupCreateFail = 0;
+
+static MockPlatformEventGroup_t pollEventGroup = { 0 };
+
+static uint32_t pollWaitCount = 0;
+
+static CellularSocketHandle_t pPollWaitSignalSocket = NULL;
+
+static uint8_t pollWaitSignalEvents = 0;
+
+static uint32_t pollWaitSignalDelayMs = 0;
+
+static CellularSocketHandle_t * pPollWaitCloseSlot = NULL;
+
+static CellularSocketContext_t * socketDataTable[ CELLULAR_NUM_SOCKET_MAX ] = { 0 };
+
 CellularHandle_t gCellularHandle = NULL;
 
 CellularAtParseTokenMap_t CellularUrcHandlerTable[] =
@@ -211,6 +257,12 @@ void setUp()
     mallocAllocFail = 0;
     eventData = 0;
     mockPlatformMutexCreateFlag = 0;
+    eventGroupCreateFail = 0;
+    pollWaitCount = 0;
+    pPollWaitSignalSocket = NULL;
+    pollWaitSignalEvents = 0;
+    pollWaitSignalDelayMs = 0;
+    pPollWaitCloseSlot = NULL;
     CellularCommInterface.open = _prvCommIntfOpen;
     CellularCommInterface.send = _prvCommIntfSend;
     CellularCommInterface.recv = _prvCommIntfReceive;
@@ -243,6 +295,17 @@ void dummyTaskEXIT_CRITICAL( void )
 {
 }
 
+uint32_t MockGetTimeMs( void )
+{
+    return mockTimeMs;
+}
+
+/* One tick is one millisecond in the unit test. */
+TickType_t MockxTaskGetTickCount( void )
+{
+    return ( TickType_t ) mockTimeMs;
+}
+
 static CellularCommInterfaceError_t _prvCommIntfOpen( CellularCommInterfaceReceiveCallback_t receiveCallback,
                                                       void * pUserData,
                                                       CellularCommInterfaceHandle_t * pCommInterfaceHandle )
@@ -361,6 +424,15 @@ CellularPktStatus_t cellularUndefinedRespCallback( void * pCallbackContext,
     return CELLULAR_PKT_STATUS_OK;
 }
 
+static void setSocketTable( CellularContext_t * pContext )
+{
+    memset( socketDataTable, 0, sizeof( socketDataTable ) );
+    pContext->pSocketData = socketDataTable;
+    pContext->pSocketSlab = NULL;
+    pContext->numSocketMax = CELLULAR_NUM_SOCKET_MAX;
+    pContext->bSocketTableAllocated = false;
+}
+
 void * mock_malloc( size_t size )
 {
     if( mallocAllocFail == 1 )
@@ -410,6 +482,82 @@ void MockPlatformMutex_Destroy( PlatformMutex_t * pMutex )
     pMutex->created = false;
 }
 
+MockPlatformEventGroupHandle_t MockPlatformEventGroup_Create( void )
+{
+    MockPlatformEventGroupHandle_t groupEvent = &pollEventGroup;
+
+    if( eventGroupCreateFail == 1 )
+    {
+        groupEvent = NULL;
+    }
+
+    return groupEvent;
+}
+
+uint16_t MockPlatformEventGroup_Delete( PlatformEventGroupHandle_t groupEvent )
+{
+    ( void ) groupEvent;
+    return 0U;
+}
+
+uint16_t MockPlatformEventGroup_ClearBits( PlatformEventGroupHandle_t groupEvent,
+                                           EventBits_t uxBitsToClear )
+{
+    ( void ) groupEvent;
+    ( void ) uxBitsToClear;
+    return 0U;
+}
+
+uint16_t MockPlatformEventGroup_SetBits( PlatformEventGroupHandle_t groupEvent,
+                                         EventBits_t event )
+{
+    groupEvent->mockedEventGroupValue = groupEvent->mockedEventGroupValue | ( uint16_t ) event;
+    return groupEvent->mockedEventGroupValue;
+}
+
+/* Socket events signaled after pollWaitSignalDelayMs while waiting are set with
+ * pPollWaitSignalSocket. The socket in pPollWaitCloseSlot is closed while waiting.
+ * Otherwise the wait times out. */
+uint16_t MockPlatformEventGroup_WaitBits( PlatformEventGroupHandle_t groupEvent,
+                                          EventBits_t uxBitsToWaitFor,
+                                          BaseType_t xClearOnExit,
+                                          BaseType_t xWaitForAllBits,
+                                          TickType_t xTicksToWait )
+{
+    uint16_t bits = 0;
+
+    ( void ) xClearOnExit;
+    ( void ) xWaitForAllBits;
+
+    pollWaitCount++;
+
+    if( pPollWaitSignalSocket != NULL )
+    {
+        pPollWaitSignalSocket->pollEvents = pPollWaitSignalSocket->pollEvents | pollWaitSignalEvents;
+        pPollWaitSignalSocket = NULL;
+        mockTimeMs = mockTimeMs + pollWaitSignalDelayMs;
+        groupEvent->mockedEventGroupValue = groupEvent->mockedEventGroupValue | ( uint16_t ) uxBitsToWaitFor;
+    }
+
+    if( pPollWaitCloseSlot != NULL )
+    {
+        *pPollWaitCloseSlot = NULL;
+        pPollWaitCloseSlot = NULL;
+        groupEvent->mockedEventGroupValue = groupEvent->mockedEventGroupValue | ( uint16_t ) uxBitsToWaitFor;
+    }
+
+    bits = groupEvent->mockedEventGroupValue & ( uint16_t ) uxBitsToWaitFor;
+
+    if( bits == 0U )
+    {
+        mockTimeMs = mockTimeMs + xTicksToWait;
+    }
+
+    groupEvent->mockedEventGroupValue = groupEvent->mockedEventGroupValue & ( uint16_t ) ( ~bits );
+
+    return bits;
+}
+
 
 static CellularPktStatus_t prvDummyInputBufferCallback( void * pInputBufferCallbackContext,
                                                         char * pBuffer,
@@ -424,6 +572,115 @@ static CellularPktStatus_t prvDummyInputBufferCallback( void * pInputBufferCallb
     return CELLULAR_PKT_STATUS_OK;
 }
 
+static void prvDummyPktioBufferCallback( void * pCallbackContext,
+                                         CellularPktioBufferEvent_t event,
+                                         const CellularPktioBufferStats_t * pStats )
+{
+    ( void ) pCallbackContext;
+    ( void ) event;
+    ( void ) pStats;
+}
+
+static void prvRecvModemSetup( uint32_t dataLength )
+{
+    uint32_t i = 0;
+
+    for( i = 0; i < dataLength; i++ )
+    {
+        recvModemData[ i ] = ( uint8_t ) i;
+    }
+
+    recvModemDataLength = dataLength;
+    recvModemReadIndex = 0;
+    recvModemReadCount = 0;
+    recvModemLastReadLength = 0;
+    recvModemStatus = CELLULAR_SUCCESS;
+    recvModemDataReadyInRead = false;
+}
+
+static CellularError_t prvRecvModemRead( CellularContext_t * pContext,
+                                         CellularSocketHandle_t socketHandle,
+                                         uint8_t * pBuffer,
+                                         uint32_t bufferLength,
+                                         uint32_t * pReceivedDataLength )
+{
+    uint32_t readLength = recvModemDataLength - recvModemReadIndex;
+
+    ( void ) pContext;
+
+    recvModemReadCount++;
+    recvModemLastReadLength = bufferLength;
+
+    if( readLength > bufferLength )
+    {
+        readLength = bufferLength;
+    }
+
+    if( recvModemStatus == CELLULAR_SUCCESS )
+    {
+        memcpy( pBuffer, &recvModemData[ recvModemReadIndex ], readLength );
+        recvModemReadIndex = recvModemReadIndex + readLength;
+        *pReceivedDataLength = readLength;
+    }
+
+    if( recvModemDataReadyInRead == true )
+    {
+        /* The modem informs more data during the read. */
+        recvModemDataReadyInRead = false;
+        _Cellular_SocketDataReady( pContext, socketHandle );
+    }
+
+    return recvModemStatus;
+}
+
+static void prvSendModemSetup( void )
+{
+    sendModemDataLength = 0;
+    sendModemSendCount = 0;
+    sendModemAcceptLength = CELLULAR_MAX_SEND_DATA_LEN;
+    sendModemStatus = CELLULAR_SUCCESS;
+    sendModemDelayMs = 0;
+    mockTimeMs = 0;
+}
+
+static CellularError_t prvSendModemSend( CellularContext_t * pContext,
+                                         CellularSocketHandle_t socketHandle,
+                                         const uint8_t * pData,
+                                         uint32_t dataLength,
+                                         uint32_t * pSentDataLength )
+{
+    uint32_t sentLength = dataLength;
+
+    ( void ) pContext;
+    ( void ) socketHandle;
+
+    sendModemSendCount++;
+    mockTimeMs = mockTimeMs + sendModemDelayMs;
+
+    if( sentLength > sendModemAcceptLength )
+    {
+        sentLength = sendModemAcceptLength;
+    }
+
+    if( sendModemStatus == CELLULAR_SUCCESS )
+    {
+        memcpy( &sendModemData[ sendModemDataLength ], pData, sentLength );
+        sendModemDataLength = sendModemDataLength + sentLength;
+        *pSentDataLength = sentLength;
+    }
+
+    return sendModemStatus;
+}
+
+static void prvDummyDataReadyCallback( CellularSocketHandle_t socketHandle,
+                                       void * pCallbackContext )
+{
+    ( void ) socketHandle;
+    ( void ) pCallbackContext;
+
+    dataReadyCallbackCount++;
+}
+
 /* ========================================================================== */
 
 /**
@@ -542,8 +799,9 @@ void test__Cellular_CreateSocketData_Mem_Alloc_Fail( void )
     CellularContext_t context;
     CellularSocketHandle_t socketHandle;
 
-    mallocAllocFail = 1;
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
+    mallocAllocFail = 1;
     cellularStatus = _Cellular_CreateSocketData( &context, 0, CELLULAR_SOCKET_DOMAIN_AF_INET,
                                                  CELLULAR_SOCKET_TYPE_DGRAM,
                                                  CELLULAR_SOCKET_PROTOCOL_TCP,
@@ -562,6 +820,7 @@ void test__Cellular_CreateSocketData_No_Socket_Data_Entry_Fail( void )
     uint32_t i = 0;
 
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
 
     for( i = 0; i < CELLULAR_NUM_SOCKET_MAX; i++ )
     {
@@ -585,6 +844,7 @@ void test__Cellular_CreateSocketData_Happy_Path( void )
     CellularSocketHandle_t socketHandle;
 
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
     cellularStatus = _Cellular_CreateSocketData( &context, 0, CELLULAR_SOCKET_DOMAIN_AF_INET,
                                                  CELLULAR_SOCKET_TYPE_DGRAM,
                                                  CELLULAR_SOCKET_PROTOCOL_TCP,
@@ -619,6 +879,7 @@ void test__Cellular_RemoveSocketData_No_Match_SocketHandle( void )
     uint32_t i = 0;
 
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
 
     for( i = 0; i < CELLULAR_NUM_SOCKET_MAX; i++ )
     {
@@ -642,6 +903,7 @@ void test__Cellular_RemoveSocketData_Happy_Path( void )
     int i = rand() % CELLULAR_NUM_SOCKET_MAX;
 
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
     socketHandle = malloc( sizeof( CellularSocketContext_t ) );
     context.pSocketData[ i ] = socketHandle;
 
@@ -651,6 +913,167 @@ void test__Cellular_RemoveSocketData_Happy_Path( void )
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
 }
 
+/**
+ * @brief Test that the modem socket ID index is updated by _Cellular_CreateSocketData
+ * and _Cellular_RemoveSocketData.
+ */
+void test__Cellular_CreateSocketData_RemoveSocketData_Modem_Socket_Id( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    CellularSocketHandle_t socketHandle = NULL;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
+    cellularStatus = _Cellular_CreateSocketData( &context, 0, CELLULAR_SOCKET_DOMAIN_AF_INET,
+                                                 CELLULAR_SOCKET_TYPE_STREAM,
+                                                 CELLULAR_SOCKET_PROTOCOL_TCP,
+                                                 &socketHandle );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    /* The socket is unbound until the modem socket ID is set. */
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_MODEM_SOCKET_ID, socketHandle->modemSocketId );
+    TEST_ASSERT_EQUAL_PTR( NULL, _Cellular_GetSocketDataByModemId( &context, socketHandle->socketId ) );
+
+    cellularStatus = _Cellular_SetSocketModemId( &context, socketHandle, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_PTR( socketHandle, _Cellular_GetSocketDataByModemId( &context, 0 ) );
+
+    cellularStatus = _Cellular_RemoveSocketData( &context, socketHandle );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_PTR( NULL, _Cellular_GetSocketDataByModemId( &context, 0 ) );
+}
+
+/**
+ * @brief Test that _Cellular_CreateSocketData fails without a socket table.
+ */
+void test__Cellular_CreateSocketData_No_Socket_Table( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    CellularSocketHandle_t socketHandle = NULL;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    cellularStatus = _Cellular_CreateSocketData( &context, 0, CELLULAR_SOCKET_DOMAIN_AF_INET,
+                                                 CELLULAR_SOCKET_TYPE_STREAM,
+                                                 CELLULAR_SOCKET_PROTOCOL_TCP,
+                                                 &socketHandle );
+    TEST_ASSERT_EQUAL( CELLULAR_NO_MEMORY, cellularStatus );
+}
+
+/**
+ * @brief Test that invalid parameter case for _Cellular_SetSocketTable.
+ */
+void test__Cellular_SetSocketTable_Invalid_Parameter( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    CellularSocketContext_t * socketData[ 2 ] = { 0 };
+    CellularSocketTable_t socketTable = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    cellularStatus = _Cellular_SetSocketTable( NULL, &socketTable );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SetSocketTable( &context, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    socketTable.numSockets = 2;
+    cellularStatus = _Cellular_SetSocketTable( &context, &socketTable );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    socketTable.pSocketData = socketData;
+    socketTable.numSockets = 0;
+    cellularStatus = _Cellular_SetSocketTable( &context, &socketTable );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* The socket table is already set. */
+    setSocketTable( &context );
+    socketTable.numSockets = 2;
+    cellularStatus = _Cellular_SetSocketTable( &context, &socketTable );
+    TEST_ASSERT_EQUAL( CELLULAR_NOT_ALLOWED, cellularStatus );
+}
+
+/**
+ * @brief Test that _Cellular_SetSocketTable replaces the default socket table
+ * only before the first socket is created.
+ */
+void test__Cellular_SetSocketTable_Replace_Default_Socket_Table( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    CellularSocketContext_t * socketData[ 2 ] = { 0 };
+    CellularSocketContext_t socketContext;
+    CellularSocketTable_t socketTable = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    socketTable.pSocketData = socketData;
+    socketTable.numSockets = 2;
+
+    /* A socket is created in the default socket table. */
+    context.pSocketData = calloc( CELLULAR_NUM_SOCKET_MAX, sizeof( CellularSocketContext_t * ) );
+    context.numSocketMax = CELLULAR_NUM_SOCKET_MAX;
+    context.bSocketTableAllocated = true;
+    context.pSocketData[ 1 ] = &socketContext;
+    cellularStatus = _Cellular_SetSocketTable( &context, &socketTable );
+    TEST_ASSERT_EQUAL( CELLULAR_NOT_ALLOWED, cellularStatus );
+
+    /* The default socket table is freed and replaced. */
+    context.pSocketData[ 1 ] = NULL;
+    cellularStatus = _Cellular_SetSocketTable( &context, &socketTable );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_PTR( socketData, context.pSocketData );
+    TEST_ASSERT_EQUAL( 2, context.numSocketMax );
+    TEST_ASSERT_EQUAL( false, context.bSocketTableAllocated );
+}
+
+/**
+ * @brief Test that sockets are created in the slab of the socket table set
+ * by _Cellular_SetSocketTable.
+ */
+void test__Cellular_SetSocketTable_Socket_Slab( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t context;
+    CellularSocketContext_t * socketData[ 2 ] = { 0 };
+    CellularSocketContext_t socketSlab[ 2 ];
+    CellularSocketTable_t socketTable = { 0 };
+    CellularSocketHandle_t socketHandle[ 3 ] = { 0 };
+    uint32_t i = 0;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    socketTable.pSocketData = socketData;
+    socketTable.pSocketSlab = socketSlab;
+    socketTable.numSockets = 2;
+
+    cellularStatus = _Cellular_SetSocketTable( &context, &socketTable );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    for( i = 0; i < 2; i++ )
+    {
+        cellularStatus = _Cellular_CreateSocketData( &context, 0, CELLULAR_SOCKET_DOMAIN_AF_INET,
+                                                     CELLULAR_SOCKET_TYPE_STREAM,
+                                                     CELLULAR_SOCKET_PROTOCOL_TCP,
+                                                     &socketHandle[ i ] );
+        TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+        TEST_ASSERT_EQUAL_PTR( &socketSlab[ i ], socketHandle[ i ] );
+    }
+
+    /* The socket table is full. */
+    cellularStatus = _Cellular_CreateSocketData( &context, 0, CELLULAR_SOCKET_DOMAIN_AF_INET,
+                                                 CELLULAR_SOCKET_TYPE_STREAM,
+                                                 CELLULAR_SOCKET_PROTOCOL_TCP,
+                                                 &socketHandle[ 2 ] );
+    TEST_ASSERT_EQUAL( CELLULAR_NO_MEMORY, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, _Cellular_IsValidSocket( &context, 2 ) );
+
+    /* The socket in the slab is not freed. */
+    cellularStatus = _Cellular_RemoveSocketData( &context, socketHandle[ 1 ] );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_PTR( NULL, socketData[ 1 ] );
+}
+
 /**
  * @brief Test that null context case for _Cellular_IsValidSocket.
  */
@@ -688,6 +1111,7 @@ void test__Cellular_IsValidSocket_Bad_Socket_Parameter( void )
     CellularContext_t context;
 
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
     cellularStatus = _Cellular_IsValidSocket( &context,
                                               0 );
 
@@ -704,6 +1128,7 @@ void test__Cellular_IsValidSocket_Happy_Path( void )
     int i = rand() % CELLULAR_NUM_SOCKET_MAX;
 
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
     context.pSocketData[ i ] = malloc( sizeof( CellularSocketContext_t ) );
     cellularStatus = _Cellular_IsValidSocket( &context,
                                               i );
@@ -1226,6 +1651,7 @@ void test__Cellular_GetSocketData_Null_SocketData( void )
     CellularContext_t context;
 
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
 
     pSocketData = _Cellular_GetSocketData( &context, 0 );
     TEST_ASSERT_EQUAL( NULL, pSocketData );
@@ -1241,6 +1667,7 @@ void test__Cellular_GetSocketData_Happy_Path( void )
     uint32_t i = rand() % CELLULAR_NUM_SOCKET_MAX;
 
     memset( &context, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &context );
     context.pSocketData[ i ] = malloc( sizeof( CellularSocketContext_t ) );
 
     pSocketData = _Cellular_GetSocketData( &context, i );
@@ -1347,6 +1774,33 @@ void test__Cellular_LibInit_Null_Tabletoken_Member( void )
     TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
 }
 
+/**
+ * @brief Test that null token lookup member case for _Cellular_LibInit.
+ */
+void test__Cellular_LibInit_Null_TokenLookup_Member( void )
+{
+    CellularHandle_t CellularHandle = NULL;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    uint16_t urcHashSlots[ 1 ] = { 0 };
+    uint32_t urcTokenHash[ 1 ] = { 0 };
+    uint16_t urcTokenLength[ 1 ] = { 0 };
+    CellularTokenLookup_t tokenLookupNoClassTable =
+    {
+        .urcHashSeed     = 0,
+        .urcHashSlotMask = 0,
+        .pUrcHashSlots   = urcHashSlots,
+        .pUrcTokenHash   = urcTokenHash,
+        .pUrcTokenLength = urcTokenLength,
+        .pFirstByteClass = NULL
+    };
+    CellularTokenTable_t tokenTableBadLookup = tokenTable;
+
+    tokenTableBadLookup.pTokenLookup = &tokenLookupNoClassTable;
+
+    cellularStatus = _Cellular_LibInit( &CellularHandle, &CellularCommInterface, &tokenTableBadLookup );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
 /**
  * @brief Test that memory allocation failure case for _Cellular_LibInit.
  */
@@ -1427,6 +1881,27 @@ void test__Cellular_LibInit_Cellular_CreatePktResponseMutex_Failure( void )
     TEST_ASSERT_EQUAL( CELLULAR_RESOURCE_CREATION_FAIL, cellularStatus );
 }
 
+/**
+ * @brief Test that socket poll event creation failure case for _Cellular_LibInit.
+ */
+void test__Cellular_LibInit_CreateSocketPollEvent_Failure( void )
+{
+    CellularHandle_t CellularHandle = NULL;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    /* Mock CreateLibStatusMutex, _Cellular_CreateAtDataMutex and _Cellular_CreatePktRequestMutex work. */
+    mockPlatformMutexCreateFlag = 0x0101;
+    _Cellular_CreatePktRequestMutex_IgnoreAndReturn( true );
+    _Cellular_CreatePktResponseMutex_IgnoreAndReturn( true );
+    _Cellular_DestroyPktResponseMutex_Ignore();
+    _Cellular_DestroyPktRequestMutex_Ignore();
+    eventGroupCreateFail = 1;
+
+    cellularStatus = _Cellular_LibInit( &CellularHandle, &CellularCommInterface, &tokenTable );
+
+    TEST_ASSERT_EQUAL( CELLULAR_RESOURCE_CREATION_FAIL, cellularStatus );
+}
+
 /**
  * @brief Test that pkio init failure case for _Cellular_LibInit.
  */
@@ -1471,6 +1946,10 @@ void test__Cellular_LibInit_Happy_Path( void )
     cellularStatus = _Cellular_LibInit( &CellularHandle, &CellularCommInterface, &tokenTable );
     gCellularHandle = CellularHandle;
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    /* The default socket table is allocated at init. */
+    TEST_ASSERT_EQUAL( CELLULAR_NUM_SOCKET_MAX, ( ( CellularContext_t * ) CellularHandle )->numSocketMax );
+    TEST_ASSERT_EQUAL( true, ( ( CellularContext_t * ) CellularHandle )->bSocketTableAllocated );
 }
 
 /**
@@ -1495,6 +1974,7 @@ void test__Cellular_LibCleanup_Happy_Path( void )
     int i = rand() % CELLULAR_NUM_SOCKET_MAX;
     CellularSocketContext_t * pSocketData = ( CellularSocketContext_t * ) malloc( sizeof( CellularSocketContext_t ) );
 
+    setSocketTable( pContext );
     pContext->pSocketData[ i ] = pSocketData;
 
     _Cellular_PktioShutdown_Ignore();
@@ -1507,6 +1987,43 @@ void test__Cellular_LibCleanup_Happy_Path( void )
     TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
 }
 
+/**
+ * @brief Test that _Cellular_LibInitWithSocketTable uses the socket table
+ * provided by the caller.
+ */
+void test__Cellular_LibInitWithSocketTable_Happy_Path( void )
+{
+    CellularHandle_t CellularHandle = NULL;
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularSocketContext_t * socketData[ 2 ] = { 0 };
+    CellularSocketTable_t socketTable = { 0 };
+
+    socketTable.pSocketData = socketData;
+    socketTable.numSockets = 2;
+
+    /* Mock CreateLibStatusMutex, _Cellular_CreateAtDataMutex and _Cellular_CreatePktRequestMutex work. */
+    mockPlatformMutexCreateFlag = 0x0101;
+    _Cellular_CreatePktRequestMutex_IgnoreAndReturn( true );
+    _Cellular_CreatePktResponseMutex_IgnoreAndReturn( true );
+    _Cellular_AtParseInit_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktHandlerInit_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioInit_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+
+    cellularStatus = _Cellular_LibInitWithSocketTable( &CellularHandle, &CellularCommInterface, &tokenTable, &socketTable );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_PTR( socketData, ( ( CellularContext_t * ) CellularHandle )->pSocketData );
+    TEST_ASSERT_EQUAL( 2, ( ( CellularContext_t * ) CellularHandle )->numSocketMax );
+    TEST_ASSERT_EQUAL( false, ( ( CellularContext_t * ) CellularHandle )->bSocketTableAllocated );
+
+    _Cellular_PktioShutdown_Ignore();
+    _Cellular_PktHandlerCleanup_Ignore();
+    _Cellular_DestroyPktRequestMutex_Ignore();
+    _Cellular_DestroyPktResponseMutex_Ignore();
+
+    cellularStatus = _Cellular_LibCleanup( CellularHandle );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+}
+
 /**
  * @brief Test that PktHandlerInit failure case for _Cellular_LibInit.
  */
@@ -1538,6 +2055,7 @@ void test__Cellular_LibCleanup_No_Pktio_Shutdown( void )
     int i = rand() % CELLULAR_NUM_SOCKET_MAX;
     CellularSocketContext_t * pSocketData = ( CellularSocketContext_t * ) malloc( sizeof( CellularSocketContext_t ) );
 
+    setSocketTable( pContext );
     pContext->pSocketData[ i ] = pSocketData;
     pContext->bLibOpened = false;
 
@@ -1717,3 +2235,1306 @@ void test__Cellular_RegisterInputBufferCallback_Happy_Path( void )
     TEST_ASSERT_EQUAL( prvDummyInputBufferCallback, cellularContext.inputBufferCallback );
     TEST_ASSERT_EQUAL( &inputBufferCallbackContext, cellularContext.pInputBufferCallbackContext );
 }
+
+/**
+ * @brief _Cellular_GetPktioBufferStats - parameter null context.
+ * pContext parameter is NULL. Verify the return value.
+ */
+void test__Cellular_GetPktioBufferStats_Null_Context( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularPktioBufferStats_t stats;
+
+    /* API call. */
+    cellularStatus = _Cellular_GetPktioBufferStats( NULL, &stats );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+}
+
+/**
+ * @brief _Cellular_GetPktioBufferStats - parameter null stats.
+ * pStats parameter is NULL. Verify the return value.
+ */
+void test__Cellular_GetPktioBufferStats_Null_Stats( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+
+    /* API call. */
+    cellularStatus = _Cellular_GetPktioBufferStats( &cellularContext, NULL );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief _Cellular_GetPktioBufferStats - Happy path.
+ * Verify the statistics in the context are returned with the buffer size.
+ */
+void test__Cellular_GetPktioBufferStats_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    CellularPktioBufferStats_t stats;
+
+    /* Setup internal variable. */
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    memset( &stats, 0, sizeof( CellularPktioBufferStats_t ) );
+    cellularContext.pktioBufferStats.highWaterMark = 100;
+    cellularContext.pktioBufferStats.overflowCount = 1;
+    cellularContext.pktioBufferStats.resyncCount = 2;
+    cellularContext.pktioBufferStats.bytesDropped = 300;
+
+    /* API call. */
+    cellularStatus = _Cellular_GetPktioBufferStats( &cellularContext, &stats );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_CONFIG_PKTIO_READ_BUFFER_SIZE, stats.bufferSize );
+    TEST_ASSERT_EQUAL( 100, stats.highWaterMark );
+    TEST_ASSERT_EQUAL( 1, stats.overflowCount );
+    TEST_ASSERT_EQUAL( 2, stats.resyncCount );
+    TEST_ASSERT_EQUAL( 300, stats.bytesDropped );
+}
+
+/**
+ * @brief _Cellular_ResetPktioBufferStats - parameter null context.
+ * pContext parameter is NULL. Verify the return value.
+ */
+void test__Cellular_ResetPktioBufferStats_Null_Context( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    /* API call. */
+    cellularStatus = _Cellular_ResetPktioBufferStats( NULL );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+}
+
+/**
+ * @brief _Cellular_ResetPktioBufferStats - Happy path.
+ * Verify the statistics in the context are cleaned.
+ */
+void test__Cellular_ResetPktioBufferStats_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+
+    /* Setup internal variable. */
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    cellularContext.pktioBufferStats.highWaterMark = 100;
+    cellularContext.pktioBufferStats.bytesDropped = 300;
+
+    /* API call. */
+    cellularStatus = _Cellular_ResetPktioBufferStats( &cellularContext );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, cellularContext.pktioBufferStats.highWaterMark );
+    TEST_ASSERT_EQUAL( 0, cellularContext.pktioBufferStats.bytesDropped );
+}
+
+/**
+ * @brief _Cellular_RegisterPktioBufferCallback - parameter null context.
+ * pContext parameter is NULL. Verify the return value.
+ */
+void test__Cellular_RegisterPktioBufferCallback_Null_Context( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    /* API call. */
+    cellularStatus = _Cellular_RegisterPktioBufferCallback( NULL, NULL, NULL );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+}
+
+/**
+ * @brief _Cellular_RegisterPktioBufferCallback - parameter NULL callback.
+ * pktioBufferCallback parameter is NULL. Verify the member variable is updated.
+ */
+void test__Cellular_RegisterPktioBufferCallback_Null_Callback( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    uint32_t callbackContext;
+
+    /* Setup internal variable. */
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    cellularContext.pktioBufferCallback = prvDummyPktioBufferCallback;
+    cellularContext.pPktioBufferCallbackContext = &callbackContext;
+
+    /* API call. */
+    cellularStatus = _Cellular_RegisterPktioBufferCallback( &cellularContext, NULL, &callbackContext );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( NULL, cellularContext.pktioBufferCallback );
+    TEST_ASSERT_EQUAL( NULL, cellularContext.pPktioBufferCallbackContext );
+}
+
+/**
+ * @brief _Cellular_RegisterPktioBufferCallback - Happy path.
+ * Verify the callback and callback context are set correctly.
+ */
+void test__Cellular_RegisterPktioBufferCallback_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    uint32_t callbackContext;
+
+    /* Setup internal variable. */
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+
+    /* API call. */
+    cellularStatus = _Cellular_RegisterPktioBufferCallback( &cellularContext, prvDummyPktioBufferCallback, &callbackContext );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( prvDummyPktioBufferCallback, cellularContext.pktioBufferCallback );
+    TEST_ASSERT_EQUAL( &callbackContext, cellularContext.pPktioBufferCallbackContext );
+}
+
+/**
+ * @brief _Cellular_SocketDataReady - Null handles and happy path.
+ * Verify the data ready flag is set, readable is signaled to poll and the data
+ * ready callback is called.
+ */
+void test__Cellular_SocketDataReady_Happy_Path( void )
+{
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    pollEventGroup.mockedEventGroupValue = 0;
+    cellularContext.pSocketPollEvent = &pollEventGroup;
+    dataReadyCallbackCount = 0;
+
+    /* API call. */
+    _Cellular_SocketDataReady( NULL, &socketHandle );
+    _Cellular_SocketDataReady( &cellularContext, NULL );
+    TEST_ASSERT_EQUAL( false, socketHandle.recvPrefetch.dataReady );
+    TEST_ASSERT_EQUAL( 0, pollEventGroup.mockedEventGroupValue );
+
+    _Cellular_SocketDataReady( &cellularContext, &socketHandle );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( true, socketHandle.recvPrefetch.dataReady );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_READABLE, socketHandle.pollEvents );
+    TEST_ASSERT_NOT_EQUAL( 0, pollEventGroup.mockedEventGroupValue );
+    TEST_ASSERT_EQUAL( 0, dataReadyCallbackCount );
+
+    socketHandle.dataReadyCallback = prvDummyDataReadyCallback;
+    _Cellular_SocketDataReady( &cellularContext, &socketHandle );
+    TEST_ASSERT_EQUAL( 1, dataReadyCallbackCount );
+}
+
+/**
+ * @brief _Cellular_SocketRecvPrefetch - Invalid parameters.
+ * Verify the return value and the modem is not read.
+ */
+void test__Cellular_SocketRecvPrefetch_Invalid_Parameter( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t buffer[ 8 ];
+    uint32_t receivedLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    prvRecvModemSetup( 8 );
+
+    cellularStatus = _Cellular_SocketRecvPrefetch( NULL, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, NULL, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, NULL, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, 0, &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), NULL, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    TEST_ASSERT_EQUAL( 0, recvModemReadCount );
+}
+
+/**
+ * @brief _Cellular_SocketRecvPrefetch - No prefetch buffer.
+ * Verify the modem is read once into the application buffer.
+ */
+void test__Cellular_SocketRecvPrefetch_No_Prefetch_Buffer( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t buffer[ CELLULAR_MAX_RECV_DATA_LEN + 100U ];
+    uint32_t receivedLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    prvRecvModemSetup( 4000 );
+
+    /* API call. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, recvModemReadCount );
+    TEST_ASSERT_EQUAL( CELLULAR_MAX_RECV_DATA_LEN, recvModemLastReadLength );
+    TEST_ASSERT_EQUAL( CELLULAR_MAX_RECV_DATA_LEN, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( recvModemData, buffer, receivedLength );
+}
+
+/**
+ * @brief _Cellular_SocketRecvPrefetch - Batched modem reads.
+ * A small receive reads the modem until the modem has no more data. Later receives
+ * are served from the prefetch buffer without reading the modem.
+ */
+void test__Cellular_SocketRecvPrefetch_Batched_Read( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t prefetchBuffer[ 4096 ];
+    uint8_t buffer[ 4096 ];
+    uint32_t receivedLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.recvPrefetch.pBuffer = prefetchBuffer;
+    socketHandle.recvPrefetch.bufferLength = sizeof( prefetchBuffer );
+    prvRecvModemSetup( 4000 );
+
+    /* Read a TLS record header. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, 5, &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 5, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( recvModemData, buffer, 5 );
+    TEST_ASSERT_EQUAL( 3, recvModemReadCount );
+    TEST_ASSERT_EQUAL( 3995, socketHandle.recvPrefetch.dataLength );
+
+    /* Read the rest of the record from the prefetch buffer. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 3995, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( &recvModemData[ 5 ], buffer, 3995 );
+    TEST_ASSERT_EQUAL( 3, recvModemReadCount );
+
+    /* The prefetch buffer is empty. The modem is read again. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, receivedLength );
+    TEST_ASSERT_EQUAL( 4, recvModemReadCount );
+}
+
+/**
+ * @brief _Cellular_SocketRecvPrefetch - Data ready with buffered data.
+ * Verify the modem data is appended after the buffered data across the end of
+ * the ring buffer.
+ */
+void test__Cellular_SocketRecvPrefetch_Data_Ready_Wrap_Around( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t prefetchBuffer[ 8 ];
+    uint8_t buffer[ 16 ];
+    uint32_t receivedLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.recvPrefetch.pBuffer = prefetchBuffer;
+    socketHandle.recvPrefetch.bufferLength = sizeof( prefetchBuffer );
+    prvRecvModemSetup( 20 );
+
+    /* Fill the prefetch buffer and receive 6 bytes. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, 6, &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 6, receivedLength );
+    TEST_ASSERT_EQUAL( 1, recvModemReadCount );
+
+    /* Buffered data without data ready does not read the modem. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, 1, &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, receivedLength );
+    TEST_ASSERT_EQUAL( 6, buffer[ 0 ] );
+    TEST_ASSERT_EQUAL( 1, recvModemReadCount );
+
+    /* Data ready reads the modem into the free space across the end of the buffer. */
+    _Cellular_SocketDataReady( &cellularContext, &socketHandle );
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 8, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( &recvModemData[ 7 ], buffer, 8 );
+    TEST_ASSERT_EQUAL( 2, recvModemReadCount );
+    TEST_ASSERT_EQUAL( 0, socketHandle.recvPrefetch.dataLength );
+    TEST_ASSERT_EQUAL( 0, socketHandle.recvPrefetch.readIndex );
+}
+
+/**
+ * @brief _Cellular_SocketRecvPrefetch - Data ready during a short modem read.
+ * Verify the modem is read again after a short read if data ready is informed
+ * during the read.
+ */
+void test__Cellular_SocketRecvPrefetch_Data_Ready_During_Read( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t prefetchBuffer[ 64 ];
+    uint8_t buffer[ 64 ];
+    uint32_t receivedLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.recvPrefetch.pBuffer = prefetchBuffer;
+    socketHandle.recvPrefetch.bufferLength = sizeof( prefetchBuffer );
+    prvRecvModemSetup( 10 );
+    recvModemDataReadyInRead = true;
+
+    /* API call. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 10, receivedLength );
+    TEST_ASSERT_EQUAL( 2, recvModemReadCount );
+    TEST_ASSERT_EQUAL( false, socketHandle.recvPrefetch.dataReady );
+}
+
+/**
+ * @brief _Cellular_SocketRecvPrefetch - Modem read failure.
+ * Verify the buffered data is received before the read error is returned.
+ */
+void test__Cellular_SocketRecvPrefetch_Read_Failure( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t prefetchBuffer[ 16 ];
+    uint8_t buffer[ 16 ];
+    uint32_t receivedLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.recvPrefetch.pBuffer = prefetchBuffer;
+    socketHandle.recvPrefetch.bufferLength = sizeof( prefetchBuffer );
+    prvRecvModemSetup( 8 );
+
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, 4, &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 4, receivedLength );
+
+    /* The read error with buffered data. The buffered data is received. */
+    recvModemStatus = CELLULAR_SOCKET_CLOSED;
+    _Cellular_SocketDataReady( &cellularContext, &socketHandle );
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, 2, &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 2, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( &recvModemData[ 4 ], buffer, 2 );
+    recvModemReadCount = 0;
+
+    /* The read error is returned by the next call without reading the modem. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_CLOSED, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, recvModemReadCount );
+
+    /* The remaining buffered data can still be received. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 2, receivedLength );
+    TEST_ASSERT_EQUAL_MEMORY( &recvModemData[ 6 ], buffer, 2 );
+    TEST_ASSERT_EQUAL( 0, recvModemReadCount );
+
+    /* The read error without buffered data. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_CLOSED, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, recvModemReadCount );
+}
+
+/**
+ * @brief _Cellular_RegisterSocketDataFunc - Register and unregister the socket data functions.
+ */
+void test__Cellular_RegisterSocketDataFunc_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+
+    cellularStatus = _Cellular_RegisterSocketDataFunc( NULL, prvSendModemSend, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_RegisterSocketDataFunc( &cellularContext, prvSendModemSend, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_PTR( prvSendModemSend, cellularContext.socketSendFunc );
+    TEST_ASSERT_EQUAL_PTR( prvRecvModemRead, cellularContext.socketRecvFunc );
+
+    cellularStatus = _Cellular_RegisterSocketDataFunc( &cellularContext, NULL, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_PTR( NULL, cellularContext.socketSendFunc );
+    TEST_ASSERT_EQUAL_PTR( NULL, cellularContext.socketRecvFunc );
+}
+
+/**
+ * @brief _Cellular_SocketSendCoalesce - Invalid parameters.
+ * Verify the return value and the modem is not written.
+ */
+void test__Cellular_SocketSendCoalesce_Invalid_Parameter( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t data[ 8 ] = { 0 };
+    uint32_t sentLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    prvSendModemSetup();
+
+    cellularStatus = _Cellular_SocketSendCoalesce( NULL, &socketHandle, data, sizeof( data ), &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, NULL, data, sizeof( data ), &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, NULL, sizeof( data ), &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, sizeof( data ), NULL, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, sizeof( data ), &sentLength, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketSendFlush( NULL, &socketHandle, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SocketSendFlush( &cellularContext, &socketHandle, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    TEST_ASSERT_EQUAL( 0, sendModemSendCount );
+}
+
+/**
+ * @brief _Cellular_SocketSendCoalesce - No coalescing buffer.
+ * Verify the data is sent directly up to CELLULAR_MAX_SEND_DATA_LEN.
+ */
+void test__Cellular_SocketSendCoalesce_No_Coalesce_Buffer( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t data[ CELLULAR_MAX_SEND_DATA_LEN + 10U ] = { 0 };
+    uint32_t sentLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    prvSendModemSetup();
+
+    /* API call. */
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, sizeof( data ), &sentLength, prvSendModemSend );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+    TEST_ASSERT_EQUAL( CELLULAR_MAX_SEND_DATA_LEN, sentLength );
+
+    /* Flush without coalescing buffer does nothing. */
+    cellularStatus = _Cellular_SocketSendFlush( &cellularContext, &socketHandle, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+}
+
+/**
+ * @brief _Cellular_SocketSendCoalesce - Flush by size.
+ * Small writes are merged until the next write does not fit in the buffer.
+ */
+void test__Cellular_SocketSendCoalesce_Flush_By_Size( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t coalesceBuffer[ 16 ];
+    const uint8_t data[] = "0123456789ABCDEFGHIJ";
+    uint32_t sentLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.sendCoalesce.pBuffer = coalesceBuffer;
+    socketHandle.sendCoalesce.bufferLength = sizeof( coalesceBuffer );
+    prvSendModemSetup();
+
+    /* Two small writes are buffered. */
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 5, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 5, sentLength );
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, &data[ 5 ], 5, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 5, sentLength );
+    TEST_ASSERT_EQUAL( 0, sendModemSendCount );
+
+    /* The third write does not fit. The buffered data is sent with one command. */
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, &data[ 10 ], 8, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 8, sentLength );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 10, sendModemDataLength );
+    TEST_ASSERT_EQUAL( 8, socketHandle.sendCoalesce.dataLength );
+
+    /* The write fills the buffer. The buffer is sent. */
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, &data[ 18 ], 2, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 2, sentLength );
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 6, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 2, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 26, sendModemDataLength );
+    TEST_ASSERT_EQUAL_MEMORY( data, sendModemData, 20 );
+    TEST_ASSERT_EQUAL_MEMORY( data, &sendModemData[ 20 ], 6 );
+    TEST_ASSERT_EQUAL( 0, socketHandle.sendCoalesce.dataLength );
+}
+
+/**
+ * @brief _Cellular_SocketSendCoalesce - Large write.
+ * Verify the buffered data is sent before the large write is sent directly.
+ */
+void test__Cellular_SocketSendCoalesce_Large_Write( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t coalesceBuffer[ 8 ];
+    const uint8_t data[] = "0123456789ABCDEFGHIJ";
+    uint32_t sentLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.sendCoalesce.pBuffer = coalesceBuffer;
+    socketHandle.sendCoalesce.bufferLength = sizeof( coalesceBuffer );
+    prvSendModemSetup();
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 3, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    /* API call. */
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, &data[ 3 ], 17, &sentLength, prvSendModemSend );
+
+    /* Validation. */
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 17, sentLength );
+    TEST_ASSERT_EQUAL( 2, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 20, sendModemDataLength );
+    TEST_ASSERT_EQUAL_MEMORY( data, sendModemData, 20 );
+}
+
+/**
+ * @brief _Cellular_SocketSendCoalesce - Flush by delay and push.
+ * Verify the buffered data is sent when the flush delay has elapsed or when the
+ * data length is 0.
+ */
+void test__Cellular_SocketSendCoalesce_Flush_By_Delay_And_Push( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t coalesceBuffer[ 64 ];
+    const uint8_t data[] = "0123456789";
+    uint32_t sentLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.sendCoalesce.pBuffer = coalesceBuffer;
+    socketHandle.sendCoalesce.bufferLength = sizeof( coalesceBuffer );
+    socketHandle.sendCoalesce.flushDelayMs = 20;
+    prvSendModemSetup();
+    mockTimeMs = 1000;
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 4, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    mockTimeMs = 1019;
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, &data[ 4 ], 2, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, sendModemSendCount );
+
+    /* The flush delay of the first buffered write has elapsed. */
+    mockTimeMs = 1020;
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, &data[ 6 ], 2, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 8, sendModemDataLength );
+
+    /* Push with zero length. */
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, &data[ 8 ], 2, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, NULL, 0, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, sentLength );
+    TEST_ASSERT_EQUAL( 2, sendModemSendCount );
+    TEST_ASSERT_EQUAL_MEMORY( data, sendModemData, 10 );
+}
+
+/**
+ * @brief _Cellular_SocketSendFlush - Partial send and failure.
+ * Verify the data not accepted by the modem is kept and sent in order.
+ */
+void test__Cellular_SocketSendFlush_Partial_Send( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t coalesceBuffer[ 16 ];
+    const uint8_t data[] = "0123456789";
+    uint32_t sentLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.sendCoalesce.pBuffer = coalesceBuffer;
+    socketHandle.sendCoalesce.bufferLength = sizeof( coalesceBuffer );
+    prvSendModemSetup();
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 10, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    /* The send failure keeps the buffered data. */
+    sendModemStatus = CELLULAR_TIMEOUT;
+    cellularStatus = _Cellular_SocketSendFlush( &cellularContext, &socketHandle, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+    TEST_ASSERT_EQUAL( 10, socketHandle.sendCoalesce.dataLength );
+
+    /* The modem accepts 4 bytes in each command. */
+    sendModemStatus = CELLULAR_SUCCESS;
+    sendModemAcceptLength = 4;
+    cellularStatus = _Cellular_SocketSendFlush( &cellularContext, &socketHandle, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 4, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 0, socketHandle.sendCoalesce.dataLength );
+    TEST_ASSERT_EQUAL_MEMORY( data, sendModemData, 10 );
+
+    /* The modem does not accept data. The buffered data is kept. */
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 10, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    sendModemAcceptLength = 0;
+    cellularStatus = _Cellular_SocketSendFlush( &cellularContext, &socketHandle, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 10, socketHandle.sendCoalesce.dataLength );
+}
+
+/**
+ * @brief _Cellular_SocketSendCoalesce - Send failure after the data is buffered.
+ * Verify the buffered data is reported as sent and the error is returned by the
+ * next call.
+ */
+void test__Cellular_SocketSendCoalesce_Flush_Failure_After_Buffered( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t coalesceBuffer[ 8 ];
+    const uint8_t data[] = "01234567";
+    uint32_t sentLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.sendCoalesce.pBuffer = coalesceBuffer;
+    socketHandle.sendCoalesce.bufferLength = sizeof( coalesceBuffer );
+    prvSendModemSetup();
+
+    /* The write fills the buffer and the send fails. */
+    sendModemStatus = CELLULAR_SOCKET_CLOSED;
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 8, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 8, sentLength );
+    TEST_ASSERT_EQUAL( 8, socketHandle.sendCoalesce.dataLength );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+
+    /* The error is returned without sending. */
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, NULL, 0, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_CLOSED, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, sentLength );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+
+    /* The buffered data is sent again. */
+    sendModemStatus = CELLULAR_SUCCESS;
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, NULL, 0, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 2, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 0, socketHandle.sendCoalesce.dataLength );
+    TEST_ASSERT_EQUAL_MEMORY( data, sendModemData, 8 );
+}
+
+/**
+ * @brief _Cellular_SocketRecvPrefetch - Send the coalesced data before receiving.
+ * Verify a lone small write is sent when the application receives, and the send
+ * error is returned by the next send.
+ */
+void test__Cellular_SocketRecvPrefetch_Flush_Coalesced_Data( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketHandle = { 0 };
+    uint8_t coalesceBuffer[ 16 ];
+    uint8_t buffer[ 8 ];
+    const uint8_t data[] = "0123";
+    uint32_t sentLength = 0;
+    uint32_t receivedLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    socketHandle.sendCoalesce.pBuffer = coalesceBuffer;
+    socketHandle.sendCoalesce.bufferLength = sizeof( coalesceBuffer );
+    prvSendModemSetup();
+    prvRecvModemSetup( 4 );
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 4, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    /* The send function is not registered. The data is kept. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 4, socketHandle.sendCoalesce.dataLength );
+
+    /* The send fails. The receive is not affected. */
+    cellularContext.socketSendFunc = prvSendModemSend;
+    sendModemStatus = CELLULAR_TIMEOUT;
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 4, socketHandle.sendCoalesce.dataLength );
+
+    /* The failed data is not sent again before the error is returned. */
+    sendModemStatus = CELLULAR_SUCCESS;
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketHandle, data, 4, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, sentLength );
+
+    /* The buffered data is sent before the modem is read. */
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketHandle, buffer, sizeof( buffer ), &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 2, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 0, socketHandle.sendCoalesce.dataLength );
+    TEST_ASSERT_EQUAL_MEMORY( data, sendModemData, 4 );
+}
+
+/**
+ * @brief _Cellular_SocketPoll - Invalid parameter.
+ */
+void test__Cellular_SocketPoll_Invalid_Parameter( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+    struct CellularSocketContext otherSocketData = { 0 };
+    CellularSocketPollFd_t pollFds[ CELLULAR_NUM_SOCKET_MAX + 1 ] = { 0 };
+    uint8_t numReady = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    cellularContext.pSocketPollEvent = &pollEventGroup;
+    socketData.socketId = 1;
+    cellularContext.pSocketData[ 1 ] = &socketData;
+    pollFds[ 0 ].socketHandle = &socketData;
+    pollFds[ 0 ].events = CELLULAR_SOCKET_POLL_READABLE;
+
+    cellularStatus = _Cellular_SocketPoll( NULL, pollFds, 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, NULL, 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 0, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 0, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, CELLULAR_NUM_SOCKET_MAX + 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* The socket is not created in the context. */
+    otherSocketData.socketId = 1;
+    pollFds[ 0 ].socketHandle = &otherSocketData;
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    pollFds[ 0 ].socketHandle = NULL;
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief _Cellular_SocketPoll - Signaled events.
+ * Verify the signaled events are reported once and the events not requested are kept.
+ */
+void test__Cellular_SocketPoll_Signaled_Events( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData[ 2 ] = { 0 };
+    CellularSocketPollFd_t pollFds[ 2 ] = { 0 };
+    uint8_t numReady = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    pollEventGroup.mockedEventGroupValue = 0;
+    cellularContext.pSocketPollEvent = &pollEventGroup;
+    socketData[ 0 ].socketId = 0;
+    socketData[ 1 ].socketId = 1;
+    cellularContext.pSocketData[ 0 ] = &socketData[ 0 ];
+    cellularContext.pSocketData[ 1 ] = &socketData[ 1 ];
+    pollFds[ 0 ].socketHandle = &socketData[ 0 ];
+    pollFds[ 0 ].events = CELLULAR_SOCKET_POLL_READABLE | CELLULAR_SOCKET_POLL_CLOSED;
+    pollFds[ 1 ].socketHandle = &socketData[ 1 ];
+    pollFds[ 1 ].events = CELLULAR_SOCKET_POLL_READABLE | CELLULAR_SOCKET_POLL_CLOSED;
+
+    _Cellular_SocketPollSignal( &cellularContext, &socketData[ 1 ], CELLULAR_SOCKET_POLL_CLOSED | CELLULAR_SOCKET_POLL_OPENED );
+
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 2, 100, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, numReady );
+    TEST_ASSERT_EQUAL( 0, pollFds[ 0 ].revents );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_CLOSED, pollFds[ 1 ].revents );
+    TEST_ASSERT_EQUAL( 0, pollWaitCount );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_OPENED, socketData[ 1 ].pollEvents );
+
+    /* The reported event is not reported again. The stale event bit wakes up the wait once. */
+    mockTimeMs = 0;
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 2, 100, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, numReady );
+    TEST_ASSERT_EQUAL( 2, pollWaitCount );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_OPENED, socketData[ 1 ].pollEvents );
+}
+
+/**
+ * @brief _Cellular_SocketPoll - Wait for events.
+ * Verify the event signaled during the wait is reported and the timeout is kept.
+ */
+void test__Cellular_SocketPoll_Wait_For_Events( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+    CellularSocketPollFd_t pollFds[ 1 ] = { 0 };
+    uint8_t numReady = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    pollEventGroup.mockedEventGroupValue = 0;
+    cellularContext.pSocketPollEvent = &pollEventGroup;
+    cellularContext.pSocketData[ 0 ] = &socketData;
+    pollFds[ 0 ].socketHandle = &socketData;
+    pollFds[ 0 ].events = CELLULAR_SOCKET_POLL_READABLE;
+
+    /* Data ready is informed while waiting. */
+    mockTimeMs = 0;
+    pPollWaitSignalSocket = &socketData;
+    pollWaitSignalEvents = CELLULAR_SOCKET_POLL_READABLE;
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 100, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_READABLE, pollFds[ 0 ].revents );
+    TEST_ASSERT_EQUAL( 1, pollWaitCount );
+
+    /* No event. The wait times out. */
+    pollWaitCount = 0;
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 100, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, numReady );
+    TEST_ASSERT_EQUAL( 0, pollFds[ 0 ].revents );
+    TEST_ASSERT_EQUAL( 1, pollWaitCount );
+    TEST_ASSERT_EQUAL( 100, mockTimeMs );
+
+    /* Zero timeout does not wait. */
+    pollWaitCount = 0;
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, pollWaitCount );
+}
+
+/**
+ * @brief _Cellular_SocketPoll - Events of other sockets.
+ * Verify the wake up by a socket not polled does not restart the timeout.
+ */
+void test__Cellular_SocketPoll_Other_Socket_Events( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData[ 2 ] = { 0 };
+    CellularSocketPollFd_t pollFds[ 1 ] = { 0 };
+    uint8_t numReady = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    pollEventGroup.mockedEventGroupValue = 0;
+    cellularContext.pSocketPollEvent = &pollEventGroup;
+    socketData[ 0 ].socketId = 0;
+    socketData[ 1 ].socketId = 1;
+    cellularContext.pSocketData[ 0 ] = &socketData[ 0 ];
+    cellularContext.pSocketData[ 1 ] = &socketData[ 1 ];
+    pollFds[ 0 ].socketHandle = &socketData[ 0 ];
+    pollFds[ 0 ].events = CELLULAR_SOCKET_POLL_READABLE;
+
+    /* Data ready on the other socket 60 ms after the wait starts. */
+    mockTimeMs = 1000;
+    pPollWaitSignalSocket = &socketData[ 1 ];
+    pollWaitSignalEvents = CELLULAR_SOCKET_POLL_READABLE;
+    pollWaitSignalDelayMs = 60;
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 100, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, numReady );
+    TEST_ASSERT_EQUAL( 2, pollWaitCount );
+    TEST_ASSERT_EQUAL( 1100, mockTimeMs );
+}
+
+/**
+ * @brief _Cellular_SocketPoll - Socket closed during the poll.
+ * Verify the closed socket is reported without reading the socket data.
+ */
+void test__Cellular_SocketPoll_Socket_Closed( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+    CellularSocketPollFd_t pollFds[ 1 ] = { 0 };
+    uint8_t numReady = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    pollEventGroup.mockedEventGroupValue = 0;
+    cellularContext.pSocketPollEvent = &pollEventGroup;
+    cellularContext.pSocketData[ 0 ] = &socketData;
+    pollFds[ 0 ].socketHandle = &socketData;
+    pollFds[ 0 ].events = CELLULAR_SOCKET_POLL_READABLE;
+    socketData.pollEvents = CELLULAR_SOCKET_POLL_OPENED;
+
+    mockTimeMs = 0;
+    pPollWaitCloseSlot = &cellularContext.pSocketData[ 0 ];
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 100, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_CLOSED, pollFds[ 0 ].revents );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_OPENED, socketData.pollEvents );
+}
+
+/**
+ * @brief _Cellular_SocketPoll - Prefetch buffer data.
+ * Verify readable is reported while data is buffered in the receive prefetch buffer.
+ */
+void test__Cellular_SocketPoll_Prefetch_Data( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+    CellularSocketPollFd_t pollFds[ 1 ] = { 0 };
+    uint8_t numReady = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    pollEventGroup.mockedEventGroupValue = 0;
+    cellularContext.pSocketPollEvent = &pollEventGroup;
+    cellularContext.pSocketData[ 0 ] = &socketData;
+    pollFds[ 0 ].socketHandle = &socketData;
+    pollFds[ 0 ].events = CELLULAR_SOCKET_POLL_READABLE;
+    socketData.recvPrefetch.dataLength = 10;
+
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_READABLE, pollFds[ 0 ].revents );
+
+    /* Closed is not requested. */
+    pollFds[ 0 ].events = CELLULAR_SOCKET_POLL_CLOSED;
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+}
+
+/**
+ * @brief _Cellular_SocketPoll - Send the coalesced data before waiting.
+ * Verify the data held in the coalescing buffer is sent when the socket is polled.
+ */
+void test__Cellular_SocketPoll_Flush_Coalesced_Data( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+    CellularSocketPollFd_t pollFds[ 1 ] = { 0 };
+    uint8_t coalesceBuffer[ 16 ];
+    const uint8_t data[] = "0123";
+    uint32_t sentLength = 0;
+    uint8_t numReady = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    pollEventGroup.mockedEventGroupValue = 0;
+    cellularContext.pSocketPollEvent = &pollEventGroup;
+    cellularContext.pSocketData[ 0 ] = &socketData;
+    cellularContext.socketSendFunc = prvSendModemSend;
+    pollFds[ 0 ].socketHandle = &socketData;
+    pollFds[ 0 ].events = CELLULAR_SOCKET_POLL_READABLE;
+    socketData.sendCoalesce.pBuffer = coalesceBuffer;
+    socketData.sendCoalesce.bufferLength = sizeof( coalesceBuffer );
+    prvSendModemSetup();
+
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketData, data, 4, &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 0, sendModemSendCount );
+
+    cellularStatus = _Cellular_SocketPoll( &cellularContext, pollFds, 1, 0, &numReady );
+    TEST_ASSERT_EQUAL( CELLULAR_TIMEOUT, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, sendModemSendCount );
+    TEST_ASSERT_EQUAL( 0, socketData.sendCoalesce.dataLength );
+    TEST_ASSERT_EQUAL_MEMORY( data, sendModemData, 4 );
+}
+
+/**
+ * @brief _Cellular_SocketPollSignal - Invalid parameter.
+ */
+void test__Cellular_SocketPollSignal_Invalid_Parameter( void )
+{
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+
+    _Cellular_SocketPollSignal( NULL, &socketData, CELLULAR_SOCKET_POLL_READABLE );
+    TEST_ASSERT_EQUAL( 0, socketData.pollEvents );
+
+    _Cellular_SocketPollSignal( &cellularContext, NULL, CELLULAR_SOCKET_POLL_READABLE );
+
+    /* The events are kept without the poll event. */
+    _Cellular_SocketPollSignal( &cellularContext, &socketData, CELLULAR_SOCKET_POLL_READABLE );
+    TEST_ASSERT_EQUAL( CELLULAR_SOCKET_POLL_READABLE, socketData.pollEvents );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief _Cellular_SetSocketModemId - Invalid parameter.
+ */
+void test__Cellular_SetSocketModemId_Invalid_Parameter( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+
+    cellularStatus = _Cellular_SetSocketModemId( NULL, &socketData, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SetSocketModemId( &cellularContext, NULL, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* The socket is not created. */
+    cellularStatus = _Cellular_SetSocketModemId( &cellularContext, &socketData, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularContext.pSocketData[ 0 ] = &socketData;
+    cellularStatus = _Cellular_SetSocketModemId( &cellularContext, &socketData, CELLULAR_MODEM_SOCKET_ID_MAX );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief _Cellular_SetSocketModemId - Bind, move and unbind modem socket IDs.
+ */
+void test__Cellular_SetSocketModemId_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData[ 2 ] = { 0 };
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    socketData[ 0 ].socketId = 0;
+    socketData[ 0 ].modemSocketId = CELLULAR_INVALID_MODEM_SOCKET_ID;
+    socketData[ 1 ].socketId = 1;
+    socketData[ 1 ].modemSocketId = CELLULAR_INVALID_MODEM_SOCKET_ID;
+    cellularContext.pSocketData[ 0 ] = &socketData[ 0 ];
+    cellularContext.pSocketData[ 1 ] = &socketData[ 1 ];
+
+    cellularStatus = _Cellular_SetSocketModemId( &cellularContext, &socketData[ 0 ], 1 );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, socketData[ 0 ].modemSocketId );
+    TEST_ASSERT_EQUAL_PTR( &socketData[ 0 ], _Cellular_GetSocketDataByModemId( &cellularContext, 1 ) );
+
+    /* Rebinding the socket releases the old modem socket ID. */
+    cellularStatus = _Cellular_SetSocketModemId( &cellularContext, &socketData[ 0 ], 2 );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL_PTR( NULL, _Cellular_GetSocketDataByModemId( &cellularContext, 1 ) );
+    TEST_ASSERT_EQUAL_PTR( &socketData[ 0 ], _Cellular_GetSocketDataByModemId( &cellularContext, 2 ) );
+
+    /* The modem socket ID is moved from the stale socket. */
+    cellularStatus = _Cellular_SetSocketModemId( &cellularContext, &socketData[ 1 ], 2 );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_MODEM_SOCKET_ID, socketData[ 0 ].modemSocketId );
+    TEST_ASSERT_EQUAL_PTR( &socketData[ 1 ], _Cellular_GetSocketDataByModemId( &cellularContext, 2 ) );
+
+    cellularStatus = _Cellular_SetSocketModemId( &cellularContext, &socketData[ 1 ], CELLULAR_INVALID_MODEM_SOCKET_ID );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_MODEM_SOCKET_ID, socketData[ 1 ].modemSocketId );
+    TEST_ASSERT_EQUAL_PTR( NULL, _Cellular_GetSocketDataByModemId( &cellularContext, 2 ) );
+}
+
+/**
+ * @brief _Cellular_GetSocketDataByModemId - Invalid parameter.
+ */
+void test__Cellular_GetSocketDataByModemId_Invalid_Parameter( void )
+{
+    CellularContext_t cellularContext;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+
+    TEST_ASSERT_EQUAL_PTR( NULL, _Cellular_GetSocketDataByModemId( NULL, 0 ) );
+    TEST_ASSERT_EQUAL_PTR( NULL, _Cellular_GetSocketDataByModemId( &cellularContext, CELLULAR_MODEM_SOCKET_ID_MAX ) );
+    TEST_ASSERT_EQUAL_PTR( NULL, _Cellular_GetSocketDataByModemId( &cellularContext, 0 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief _Cellular_SocketGetStats - Invalid parameter.
+ */
+void test__Cellular_SocketGetStats_Invalid_Parameter( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+    CellularSocketStats_t stats;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+
+    cellularStatus = _Cellular_SocketGetStats( NULL, &socketData, &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_INVALID_HANDLE, cellularStatus );
+
+    cellularStatus = _Cellular_SocketGetStats( &cellularContext, NULL, &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* The socket is not created. */
+    cellularStatus = _Cellular_SocketGetStats( &cellularContext, &socketData, &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    cellularContext.pSocketData[ 0 ] = &socketData;
+    cellularStatus = _Cellular_SocketGetStats( &cellularContext, &socketData, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+
+    /* The module does not send and receive socket data with the common helpers. */
+    cellularStatus = _Cellular_SocketGetStats( &cellularContext, &socketData, &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_UNSUPPORTED, cellularStatus );
+
+    cellularContext.socketRecvFunc = prvRecvModemRead;
+    cellularStatus = _Cellular_SocketGetStats( &cellularContext, &socketData, &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_UNSUPPORTED, cellularStatus );
+}
+
+/**
+ * @brief _Cellular_SocketGetStats - Send statistics.
+ * A partial send and a modem error are recorded with the send latency. Sending
+ * the coalesced data is not counted as a send call.
+ */
+void test__Cellular_SocketGetStats_Send( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+    CellularSocketStats_t stats;
+    uint8_t sendData[ 20 ] = { 0 };
+    uint8_t coalesceBuffer[ 32 ];
+    uint32_t sentLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    cellularContext.pSocketData[ 0 ] = &socketData;
+    ( void ) _Cellular_RegisterSocketDataFunc( &cellularContext, prvSendModemSend, prvRecvModemRead );
+    prvSendModemSetup();
+
+    /* The modem accepts half of the data. */
+    sendModemAcceptLength = 10;
+    sendModemDelayMs = 30;
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketData, sendData, sizeof( sendData ),
+                                                   &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    sendModemStatus = CELLULAR_INTERNAL_FAILURE;
+    sendModemDelayMs = 10;
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketData, sendData, sizeof( sendData ),
+                                                   &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_INTERNAL_FAILURE, cellularStatus );
+
+    cellularStatus = _Cellular_SocketGetStats( &cellularContext, &socketData, &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 10, stats.bytesSent );
+    TEST_ASSERT_EQUAL( 2, stats.sendCount );
+    TEST_ASSERT_EQUAL( 2, stats.modemSendCount );
+    TEST_ASSERT_EQUAL( 1, stats.partialSendCount );
+    TEST_ASSERT_EQUAL( 1, stats.modemErrorCount );
+    TEST_ASSERT_EQUAL( 10, stats.sendLatencyMs );
+    TEST_ASSERT_EQUAL( 30, stats.sendLatencyMaxMs );
+
+    /* One write is buffered and sent with a push. */
+    socketData.sendCoalesce.pBuffer = coalesceBuffer;
+    socketData.sendCoalesce.bufferLength = sizeof( coalesceBuffer );
+    sendModemStatus = CELLULAR_SUCCESS;
+    sendModemAcceptLength = CELLULAR_MAX_SEND_DATA_LEN;
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketData, sendData, 4,
+                                                   &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    cellularStatus = _Cellular_SocketSendCoalesce( &cellularContext, &socketData, NULL, 0,
+                                                   &sentLength, prvSendModemSend );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    cellularStatus = _Cellular_SocketGetStats( &cellularContext, &socketData, &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 14, stats.bytesSent );
+    TEST_ASSERT_EQUAL( 3, stats.sendCount );
+    TEST_ASSERT_EQUAL( 3, stats.modemSendCount );
+}
+
+/**
+ * @brief _Cellular_SocketGetStats - Receive statistics.
+ * The data ready latency is measured from the first data ready URC to the
+ * application receiving data.
+ */
+void test__Cellular_SocketGetStats_Recv( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularContext_t cellularContext;
+    struct CellularSocketContext socketData = { 0 };
+    CellularSocketStats_t stats;
+    uint8_t buffer[ 100 ];
+    uint32_t receivedLength = 0;
+
+    memset( &cellularContext, 0, sizeof( CellularContext_t ) );
+    setSocketTable( &cellularContext );
+    cellularContext.pSocketData[ 0 ] = &socketData;
+    ( void ) _Cellular_RegisterSocketDataFunc( &cellularContext, prvSendModemSend, prvRecvModemRead );
+    prvRecvModemSetup( 150 );
+
+    mockTimeMs = 100;
+    _Cellular_SocketDataReady( &cellularContext, &socketData );
+    mockTimeMs = 120;
+    _Cellular_SocketDataReady( &cellularContext, &socketData );
+    mockTimeMs = 150;
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketData, buffer, sizeof( buffer ),
+                                                   &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    /* No data ready URC before the second receive. */
+    mockTimeMs = 500;
+    cellularStatus = _Cellular_SocketRecvPrefetch( &cellularContext, &socketData, buffer, sizeof( buffer ),
+                                                   &receivedLength, prvRecvModemRead );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+
+    cellularStatus = _Cellular_SocketGetStats( &cellularContext, &socketData, &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 150, stats.bytesReceived );
+    TEST_ASSERT_EQUAL( 2, stats.recvCount );
+    TEST_ASSERT_EQUAL( 2, stats.modemRecvCount );
+    TEST_ASSERT_EQUAL( 0, stats.modemErrorCount );
+    TEST_ASSERT_EQUAL( 50, stats.dataReadyLatencyMs );
+    TEST_ASSERT_EQUAL( 50, stats.dataReadyLatencyMaxMs );
+}
@@ -83,6 +83,12 @@
  */
 #define CELLULAR_IP_ADDRESS_MAX_SIZE    ( 64U )
 
+/* Monotonic time source used by the statistics features. */
+#define CELLULAR_CONFIG_GET_TIME_MS()    MockGetTimeMs()
+
+/* Per socket statistics are tested in cellular_common_utest. */
+#define CELLULAR_CONFIG_SOCKET_STATS     ( 1 )
+
 /* Macro MOCK_LIB_TEST will be defined in test\unit-test\CMakeLists.txt for mock library.*/
 #ifdef MOCK_LIB_TEST
     typedef struct CellularContext
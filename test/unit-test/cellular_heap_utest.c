@@ -0,0 +1,245 @@
+/*
+ * FreeRTOS-Cellular-Interface
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ */
+
+/**
+ * @file cellular_heap_utest.c
+ * @brief Unit tests for functions in cellular_heap.h.
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "unity.h"
+
+/* Include paths for public enums, structures, and macros. */
+#include "cellular_platform.h"
+
+#include "cellular_api.h"
+#include "cellular_heap.h"
+
+/**
+ * @brief Cellular sample allocation size.
+ */
+#define CELLULAR_SAMPLE_ALLOC_SIZE    ( 32U )
+
+static int mallocAllocFail = 0;
+static uint32_t mockTimeMs = 0;
+
+/* ============================   UNITY FIXTURES ============================ */
+
+/* Called before each test method. */
+void setUp()
+{
+    mallocAllocFail = 0;
+    mockTimeMs = 0;
+    ( void ) Cellular_HeapResetStats();
+}
+
+/* Called after each test method. */
+void tearDown()
+{
+}
+
+/* Called at the beginning of the whole suite. */
+void suiteSetUp()
+{
+}
+
+/* Called at the end of the whole suite. */
+int suiteTearDown( int numFailures )
+{
+    return numFailures;
+}
+
+/* ========================================================================== */
+
+void * mock_malloc( size_t size )
+{
+    if( mallocAllocFail == 1 )
+    {
+        return NULL;
+    }
+
+    return malloc( size );
+}
+
+uint32_t MockGetTimeMs( void )
+{
+    return mockTimeMs;
+}
+
+void dummyTaskENTER_CRITICAL( void )
+{
+}
+
+void dummyTaskEXIT_CRITICAL( void )
+{
+}
+
+/* ========================================================================== */
+
+/**
+ * @brief Test that NULL parameter causes Cellular_HeapGetStats to return CELLULAR_BAD_PARAMETER.
+ */
+void test_Cellular_HeapGetStats_Invalid_Param( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+
+    cellularStatus = Cellular_HeapGetStats( NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_BAD_PARAMETER, cellularStatus );
+}
+
+/**
+ * @brief Test that allocation and free are accounted to the allocation site.
+ */
+void test__Cellular_Malloc_Free_Happy_Path( void )
+{
+    CellularError_t cellularStatus = CELLULAR_SUCCESS;
+    CellularHeapStats_t stats = { 0 };
+    void * pMem = NULL;
+    size_t allocBytes = 0;
+
+    pMem = _Cellular_Malloc( CELLULAR_SAMPLE_ALLOC_SIZE, CELLULAR_HEAP_SITE_SOCKET_DATA );
+    TEST_ASSERT_NOT_NULL( pMem );
+    ( void ) memset( pMem, 0xA5, CELLULAR_SAMPLE_ALLOC_SIZE );
+
+    cellularStatus = Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, stats.allocCount );
+    TEST_ASSERT_GREATER_OR_EQUAL( CELLULAR_SAMPLE_ALLOC_SIZE, stats.currentBytes );
+    TEST_ASSERT_EQUAL( stats.currentBytes, stats.peakBytes );
+    TEST_ASSERT_EQUAL( 1, stats.sites[ CELLULAR_HEAP_SITE_SOCKET_DATA ].allocCount );
+    TEST_ASSERT_EQUAL( stats.currentBytes, stats.sites[ CELLULAR_HEAP_SITE_SOCKET_DATA ].currentBytes );
+    TEST_ASSERT_EQUAL( 0, stats.sites[ CELLULAR_HEAP_SITE_CONTEXT ].allocCount );
+    allocBytes = stats.currentBytes;
+
+    _Cellular_Free( pMem );
+
+    cellularStatus = Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, cellularStatus );
+    TEST_ASSERT_EQUAL( 1, stats.freeCount );
+    TEST_ASSERT_EQUAL( 0, stats.currentBytes );
+    TEST_ASSERT_EQUAL( allocBytes, stats.peakBytes );
+    TEST_ASSERT_EQUAL( 1, stats.sites[ CELLULAR_HEAP_SITE_SOCKET_DATA ].freeCount );
+    TEST_ASSERT_EQUAL( 0, stats.sites[ CELLULAR_HEAP_SITE_SOCKET_DATA ].currentBytes );
+}
+
+/**
+ * @brief Test that failed allocation is counted and not accounted as used memory.
+ */
+void test__Cellular_Malloc_Alloc_Fail( void )
+{
+    CellularHeapStats_t stats = { 0 };
+    void * pMem = NULL;
+
+    mallocAllocFail = 1;
+    pMem = _Cellular_Malloc( CELLULAR_SAMPLE_ALLOC_SIZE, CELLULAR_HEAP_SITE_OPERATOR_INFO );
+    TEST_ASSERT_NULL( pMem );
+
+    ( void ) Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( 0, stats.allocCount );
+    TEST_ASSERT_EQUAL( 1, stats.failCount );
+    TEST_ASSERT_EQUAL( 1, stats.sites[ CELLULAR_HEAP_SITE_OPERATOR_INFO ].failCount );
+    TEST_ASSERT_EQUAL( 0, stats.currentBytes );
+}
+
+/**
+ * @brief Test that freeing NULL pointer doesn't change the statistics.
+ */
+void test__Cellular_Free_Null( void )
+{
+    CellularHeapStats_t stats = { 0 };
+
+    _Cellular_Free( NULL );
+
+    ( void ) Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( 0, stats.freeCount );
+}
+
+/**
+ * @brief Test that the peak value is kept after the memory is freed and reset to
+ * the current value by Cellular_HeapResetStats.
+ */
+void test_Cellular_HeapResetStats_Peak( void )
+{
+    CellularHeapStats_t stats = { 0 };
+    void * pMem1 = NULL;
+    void * pMem2 = NULL;
+    size_t peakBytes = 0;
+
+    pMem1 = _Cellular_Malloc( CELLULAR_SAMPLE_ALLOC_SIZE, CELLULAR_HEAP_SITE_AT_RESPONSE );
+    pMem2 = _Cellular_Malloc( CELLULAR_SAMPLE_ALLOC_SIZE, CELLULAR_HEAP_SITE_AT_LINE );
+    ( void ) Cellular_HeapGetStats( &stats );
+    peakBytes = stats.peakBytes;
+
+    _Cellular_Free( pMem2 );
+    ( void ) Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( peakBytes, stats.peakBytes );
+    TEST_ASSERT_LESS_THAN( peakBytes, stats.currentBytes );
+
+    TEST_ASSERT_EQUAL( CELLULAR_SUCCESS, Cellular_HeapResetStats() );
+    ( void ) Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( stats.currentBytes, stats.peakBytes );
+    TEST_ASSERT_EQUAL( 0, stats.allocCount );
+    TEST_ASSERT_EQUAL( 0, stats.sites[ CELLULAR_HEAP_SITE_AT_LINE ].currentBytes );
+
+    _Cellular_Free( pMem1 );
+}
+
+/**
+ * @brief Test the allocation rate is computed after a complete window.
+ */
+void test_Cellular_HeapGetStats_Alloc_Rate( void )
+{
+    CellularHeapStats_t stats = { 0 };
+    void * pMem[ 4 ] = { NULL };
+    uint8_t i = 0;
+
+    for( i = 0; i < 4U; i++ )
+    {
+        pMem[ i ] = _Cellular_Malloc( CELLULAR_SAMPLE_ALLOC_SIZE, CELLULAR_HEAP_SITE_AT_LINE );
+    }
+
+    ( void ) Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( 0, stats.allocRatePerSecond );
+
+    /* Four allocations in a one second window. */
+    mockTimeMs = 1000U;
+    ( void ) Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( 4, stats.allocRatePerSecond );
+
+    /* No allocation in the next window. */
+    mockTimeMs = 2000U;
+    ( void ) Cellular_HeapGetStats( &stats );
+    TEST_ASSERT_EQUAL( 0, stats.allocRatePerSecond );
+
+    for( i = 0; i < 4U; i++ )
+    {
+        _Cellular_Free( pMem[ i ] );
+    }
+}
@@ -69,6 +69,13 @@ static bool passCompareString = false;
 static char * pCompareString = NULL;
 static int32_t undefinedCallbackContext = 0;
 static uint32_t lastDelayTimeMs = 0U;
+static uint32_t bulkChunkCount = 0U;
+static uint32_t bulkChunkLength[ 4 ] = { 0U };
+static CellularPktStatus_t bulkChunkCallbackReturn = CELLULAR_PKT_STATUS_OK;
+static uint32_t sendDataShortCallNum = 0U;
+static uint32_t sendDatavSegmentCount = 0U;
+static uint32_t sendDatavLastSegmentLength = 0U;
+static uint32_t sendDatavSentLength = 0U;
 
 void cellularAtParseTokenHandler( CellularContext_t * pContext,
                                   char * pInputStr );
@@ -174,6 +181,45 @@ CellularTokenTable_t tokenTableWoMapSize =
     .cellularSrcExtraTokenSuccessTableSize = 0
 };
 
+/* URC handler table is not sorted. The sort check is skipped with token lookup. */
+CellularAtParseTokenMap_t CellularUrcHandlerTableLookupCase[] =
+{
+    { "RDY",  cellularAtParseTokenHandler },
+    { "CREG", cellularAtParseTokenHandler }
+};
+#define CellularUrcHandlerTableLookupCaseSize    ( sizeof( CellularUrcHandlerTableLookupCase ) / sizeof( CellularAtParseTokenMap_t ) )
+
+/* Hash seed 0 and 4 slots. "RDY" is in slot 2 and "CREG" is in slot 0. */
+static const uint16_t urcHashSlots[ 4 ] = { 2U, 0U, 1U, 0U };
+static const uint32_t urcTokenHash[ 2 ] = { 0xBCD1304EU, 0xE13B2568U };
+static const uint16_t urcTokenLength[ 2 ] = { 3U, 4U };
+static const uint8_t firstByteClass[ 256 ] = { 0 };
+
+static const CellularTokenLookup_t tokenLookup =
+{
+    .urcHashSeed     = 0U,
+    .urcHashSlotMask = 3U,
+    .pUrcHashSlots   = urcHashSlots,
+    .pUrcTokenHash   = urcTokenHash,
+    .pUrcTokenLength = urcTokenLength,
+    .pFirstByteClass = firstByteClass
+};
+
+CellularTokenTable_t tokenTableLookupCase =
+{
+    .pCellularUrcHandlerTable              = CellularUrcHandlerTableLookupCase,
+    .cellularPrefixToParserMapSize         = CellularUrcHandlerTableLookupCaseSize,
+    .pCellularSrcTokenErrorTable           = NULL,
+    .cellularSrcTokenErrorTableSize        = 0,
+    .pCellularSrcTokenSuccessTable         = NULL,
+    .cellularSrcTokenSuccessTableSize      = 0,
+    .pCellularUrcTokenWoPrefixTable        = NULL,
+    .cellularUrcTokenWoPrefixTableSize     = 0,
+    .pCellularSrcExtraTokenSuccessTable    = NULL,
+    .cellularSrcExtraTokenSuccessTableSize = 0,
+    .pTokenLookup                          = &tokenLookup
+};
+
 /* ============================   UNITY FIXTURES ============================ */
 
 /* Called before each test method. */
@@ -183,6 +229,13 @@ void setUp()
     queueReturnFail = 0;
     pktRespCBReturn = 0;
     lastDelayTimeMs = 0U;
+    bulkChunkCount = 0U;
+    memset( bulkChunkLength, 0, sizeof( bulkChunkLength ) );
+    bulkChunkCallbackReturn = CELLULAR_PKT_STATUS_OK;
+    sendDataShortCallNum = 0U;
+    sendDatavSegmentCount = 0U;
+    sendDatavLastSegmentLength = 0U;
+    sendDatavSentLength = 0U;
 }
 
 /* Called after each test method. */
@@ -456,6 +509,119 @@ static CellularPktStatus_t undefinedRespCallback( void * pCallbackContext,
     return undefineReturnStatus;
 }
 
+static CellularPktStatus_t bulkChunkCallback( void * pCallbackContext,
+                                              uint32_t chunkLength,
+                                              CellularAtReq_t * pAtReq )
+{
+    ( void ) pCallbackContext;
+
+    if( bulkChunkCount < 4U )
+    {
+        bulkChunkLength[ bulkChunkCount ] = chunkLength;
+    }
+
+    bulkChunkCount++;
+
+    pAtReq->pAtCmd = "AT+QISEND=0";
+    pAtReq->atCmdType = CELLULAR_AT_NO_RESULT;
+    pAtReq->pAtRspPrefix = NULL;
+    pAtReq->respCallback = NULL;
+    pAtReq->pData = NULL;
+    pAtReq->dataLen = 0;
+
+    return bulkChunkCallbackReturn;
+}
+
+static uint32_t _Cellular_PktioSendData_ShortWrite( CellularContext_t * pContext,
+                                                    const uint8_t * pData,
+                                                    uint32_t dataLen,
+                                                    int cmock_num_calls )
+{
+    uint32_t sentLength = dataLen;
+
+    ( void ) pContext;
+    ( void ) pData;
+
+    /* Short write at call number sendDataShortCallNum. */
+    if( ( ( uint32_t ) cmock_num_calls + 1U ) == sendDataShortCallNum )
+    {
+        sentLength = dataLen / 2U;
+    }
+
+    return sentLength;
+}
+
+static uint32_t _Cellular_PktioSendDatav_Record( CellularContext_t * pContext,
+                                                 const CellularDataSegment_t * pSegments,
+                                                 uint32_t segmentCount,
+                                                 int cmock_num_calls )
+{
+    uint32_t sentLength = 0U;
+    uint32_t i = 0U;
+
+    ( void ) pContext;
+    ( void ) cmock_num_calls;
+
+    sendDatavSegmentCount = segmentCount;
+    sendDatavLastSegmentLength = pSegments[ segmentCount - 1U ].dataLength;
+
+    for( i = 0U; i < segmentCount; i++ )
+    {
+        sentLength = sentLength + pSegments[ i ].dataLength;
+    }
+
+    /* Short write if sendDatavSentLength is set. */
+    if( sendDatavSentLength > 0U )
+    {
+        sentLength = sendDatavSentLength;
+    }
+
+    return sentLength;
+}
+
+/* The comm interface sendv is not called. pktio is mocked. */
+static CellularCommInterfaceError_t prvCommIntfSendv( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                      const CellularDataSegment_t * pSegments,
+                                                      uint32_t segmentCount,
+                                                      uint32_t timeoutMilliseconds,
+                                                      uint32_t * pDataSentLength )
+{
+    ( void ) commInterfaceHandle;
+    ( void ) pSegments;
+    ( void ) segmentCount;
+    ( void ) timeoutMilliseconds;
+    ( void ) pDataSentLength;
+
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterface_t commInterfaceSendv =
+{
+    .sendv = prvCommIntfSendv
+};
+
+/* The comm interface sendAsync is not called. pktio is mocked. */
+static CellularCommInterfaceError_t prvCommIntfSendAsync( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                          const uint8_t * pData,
+                                                          uint32_t dataLength,
+                                                          uint32_t timeoutMilliseconds,
+                                                          CellularCommInterfaceSendCallback_t sendCallback,
+                                                          void * pUserData )
+{
+    ( void ) commInterfaceHandle;
+    ( void ) pData;
+    ( void ) dataLength;
+    ( void ) timeoutMilliseconds;
+    ( void ) sendCallback;
+    ( void ) pUserData;
+
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterface_t commInterfaceSendAsync =
+{
+    .sendAsync = prvCommIntfSendAsync
+};
 
 /* ========================================================================== */
 
@@ -749,6 +915,58 @@ void test__Cellular_HandlePacket_AT_UNSOLICITED_Input_String_Less_Than_Urc_Token
     TEST_ASSERT_EQUAL( true, passCompareString );
 }
 
+/**
+ * @brief Test that URC handler is found with token lookup for _Cellular_HandlePacket.
+ */
+void test__Cellular_HandlePacket_AT_UNSOLICITED_Token_Lookup_Happy_Path( void )
+{
+    CellularContext_t context;
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    ( void ) memcpy( &context.tokenTable, &tokenTableLookupCase, sizeof( CellularTokenTable_t ) );
+    Cellular_ATStrDup_StubWithCallback( _CMOCK_Cellular_ATStrDup_CALLBACK );
+
+    /* set for cellularAtParseTokenHandler function */
+    passCompareString = false;
+    pCompareString = getStringAfterColon( CELLULAR_URC_TOKEN_STRING_INPUT_WITH_PAYLOAD );
+
+    pktStatus = _Cellular_HandlePacket( &context, AT_UNSOLICITED, CELLULAR_URC_TOKEN_STRING_INPUT_WITH_PAYLOAD );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( true, passCompareString );
+}
+
+/**
+ * @brief Test that unknown URC tokens are not matched with token lookup for _Cellular_HandlePacket.
+ *
+ * "RDYY" hashes to an empty slot. "RDA" hashes to the slot of "RDY" with the same length.
+ */
+void test__Cellular_HandlePacket_AT_UNSOLICITED_Token_Lookup_Mismatch( void )
+{
+    CellularContext_t context;
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    ( void ) memcpy( &context.tokenTable, &tokenTableLookupCase, sizeof( CellularTokenTable_t ) );
+    Cellular_ATStrDup_StubWithCallback( _CMOCK_Cellular_ATStrDup_CALLBACK );
+    _Cellular_GenericCallback_Stub( _CMOCK_Cellular_Generic_CALLBACK );
+
+    /* set for generic callback function */
+    passCompareString = false;
+    pCompareString = CELLULAR_URC_TOKEN_STRING_GREATER_INPUT;
+
+    pktStatus = _Cellular_HandlePacket( &context, AT_UNSOLICITED, CELLULAR_URC_TOKEN_STRING_GREATER_INPUT );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( true, passCompareString );
+
+    passCompareString = false;
+    pCompareString = "RDA";
+
+    pktStatus = _Cellular_HandlePacket( &context, AT_UNSOLICITED, "RDA" );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( true, passCompareString );
+}
+
 /**
  * @brief Test that null buffer invalid message type case for _Cellular_HandlePacket.
  */
@@ -1308,6 +1526,247 @@ void test__Cellular_AtcmdDataSend_call__Cellular_DataSendWithTimeoutDelayRaw_Une
     TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_SEND_ERROR, pktStatus );
 }
 
+/**
+ * @brief Test that data segments case for _Cellular_AtcmdDataSend.
+ *
+ * The end pattern is sent as the last segment.
+ */
+void test__Cellular_AtcmdDataSend_Segments_Happy_Path( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t header[ 2 ] = { 0 };
+    uint8_t payload[ 10 ] = { 0 };
+    uint8_t endPattern[ 3 ] = { 0 };
+    CellularDataSegment_t segments[ 2 ] = { { header, sizeof( header ) }, { payload, sizeof( payload ) } };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq =
+    {
+        NULL,
+        sizeof( header ) + sizeof( payload ),
+        &sentDataLength,
+        endPattern,
+        sizeof( endPattern ),
+        segments,
+        2
+    };
+    CellularAtReq_t atReq = { "AT+QISEND=0,12", CELLULAR_AT_NO_RESULT, NULL, NULL, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendDatav_StubWithCallback( _Cellular_PktioSendDatav_Record );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( sizeof( header ) + sizeof( payload ), sentDataLength );
+    TEST_ASSERT_EQUAL( 3U, sendDatavSegmentCount );
+    TEST_ASSERT_EQUAL( sizeof( endPattern ), sendDatavLastSegmentLength );
+}
+
+/**
+ * @brief Test that the data and the end pattern are sent with one comm interface
+ * call if the comm interface supports sendv.
+ */
+void test__Cellular_AtcmdDataSend_Comm_Interface_Sendv( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t payload[ 10 ] = { 0 };
+    uint8_t endPattern[ 3 ] = { 0 };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { payload, sizeof( payload ), &sentDataLength, endPattern, sizeof( endPattern ) };
+    CellularAtReq_t atReq = { "AT+KTCPSND=1,10", CELLULAR_AT_NO_RESULT, NULL, NULL, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &commInterfaceSendv;
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendDatav_StubWithCallback( _Cellular_PktioSendDatav_Record );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( sizeof( payload ), sentDataLength );
+    TEST_ASSERT_EQUAL( 2U, sendDatavSegmentCount );
+    TEST_ASSERT_EQUAL( sizeof( endPattern ), sendDatavLastSegmentLength );
+}
+
+/**
+ * @brief Test that the data is sent with the asynchronous send if the comm
+ * interface supports sendAsync.
+ */
+void test__Cellular_AtcmdDataSend_Comm_Interface_SendAsync( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t payload[ 10 ] = { 0 };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { payload, sizeof( payload ), &sentDataLength, NULL, 0 };
+    CellularAtReq_t atReq = { "AT+QISEND=0,10", CELLULAR_AT_NO_RESULT, NULL, NULL, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &commInterfaceSendAsync;
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendDataAsync_ExpectAndReturn( &context, payload, sizeof( payload ), CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendDataWait_ExpectAndReturn( &context, CELLULAR_COMM_IF_SEND_TIMEOUT_MS, sizeof( payload ) );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( sizeof( payload ), sentDataLength );
+}
+
+/**
+ * @brief Test that the asynchronous send returns CELLULAR_PKT_STATUS_SEND_ERROR
+ * if the data is not sent completely.
+ */
+void test__Cellular_AtcmdDataSend_Comm_Interface_SendAsync_Incomplete( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t payload[ 10 ] = { 0 };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { payload, sizeof( payload ), &sentDataLength, NULL, 0 };
+    CellularAtReq_t atReq = { "AT+QISEND=0,10", CELLULAR_AT_NO_RESULT, NULL, NULL, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &commInterfaceSendAsync;
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendDataAsync_ExpectAndReturn( &context, payload, sizeof( payload ), CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendDataWait_ExpectAndReturn( &context, CELLULAR_COMM_IF_SEND_TIMEOUT_MS, 5 );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_SEND_ERROR, pktStatus );
+    TEST_ASSERT_EQUAL( 5, sentDataLength );
+}
+
+/**
+ * @brief Test that the asynchronous send failing to start returns
+ * CELLULAR_PKT_STATUS_SEND_ERROR.
+ */
+void test__Cellular_AtcmdDataSend_Comm_Interface_SendAsync_Start_Fail( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t payload[ 10 ] = { 0 };
+    uint32_t sentDataLength = 1;
+    CellularAtDataReq_t atDataReq = { payload, sizeof( payload ), &sentDataLength, NULL, 0 };
+    CellularAtReq_t atReq = { "AT+QISEND=0,10", CELLULAR_AT_NO_RESULT, NULL, NULL, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &commInterfaceSendAsync;
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendDataAsync_ExpectAndReturn( &context, payload, sizeof( payload ), CELLULAR_PKT_STATUS_SEND_ERROR );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_SEND_ERROR, pktStatus );
+    TEST_ASSERT_EQUAL( 0, sentDataLength );
+}
+
+/**
+ * @brief Test that invalid data segments case for _Cellular_AtcmdDataSend.
+ */
+void test__Cellular_AtcmdDataSend_Segments_Invalid( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t payload[ 10 ] = { 0 };
+    CellularDataSegment_t segments[ CELLULAR_MAX_SEND_DATA_SEGMENTS + 1U ];
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { NULL, sizeof( payload ), &sentDataLength, NULL, 0, segments, 1 };
+    CellularAtReq_t atReq = { "AT+QISEND=0,10", CELLULAR_AT_NO_RESULT, NULL, NULL, NULL, 0 };
+    CellularContext_t context;
+    uint32_t i = 0;
+
+    for( i = 0; i < ( CELLULAR_MAX_SEND_DATA_SEGMENTS + 1U ); i++ )
+    {
+        segments[ i ].pData = payload;
+        segments[ i ].dataLength = 0;
+    }
+
+    segments[ 0 ].dataLength = sizeof( payload );
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    /* No segment. */
+    atDataReq.segmentCount = 0;
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+
+    /* Too many segments. */
+    atDataReq.segmentCount = CELLULAR_MAX_SEND_DATA_SEGMENTS + 1U;
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+
+    /* dataLen is not the total length of the segments. */
+    atDataReq.segmentCount = 1;
+    atDataReq.dataLen = sizeof( payload ) + 1U;
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+
+    /* Segment lengths wrap around to dataLen. */
+    atDataReq.segmentCount = 2;
+    atDataReq.dataLen = sizeof( payload );
+    segments[ 1 ].dataLength = UINT32_MAX;
+    segments[ 0 ].dataLength = sizeof( payload ) + 1U;
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+    segments[ 0 ].dataLength = sizeof( payload );
+    segments[ 1 ].dataLength = 0;
+
+    /* NULL segment data. */
+    atDataReq.segmentCount = 1;
+    atDataReq.dataLen = sizeof( payload );
+    segments[ 0 ].pData = NULL;
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+}
+
+/**
+ * @brief Test that data segments short write case for _Cellular_AtcmdDataSend.
+ */
+void test__Cellular_AtcmdDataSend_Segments_Short_Write( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t header[ 2 ] = { 0 };
+    uint8_t payload[ 10 ] = { 0 };
+    uint8_t endPattern[ 3 ] = { 0 };
+    CellularDataSegment_t segments[ 2 ] = { { header, sizeof( header ) }, { payload, sizeof( payload ) } };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq =
+    {
+        NULL,
+        sizeof( header ) + sizeof( payload ),
+        &sentDataLength,
+        endPattern,
+        sizeof( endPattern ),
+        segments,
+        2
+    };
+    CellularAtReq_t atReq = { "AT+QISEND=0,12", CELLULAR_AT_NO_RESULT, NULL, NULL, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendDatav_StubWithCallback( _Cellular_PktioSendDatav_Record );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    /* The payload is not sent completely. */
+    sendDatavSentLength = 5U;
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_SEND_ERROR, pktStatus );
+    TEST_ASSERT_EQUAL( 5U, sentDataLength );
+
+    /* The end pattern is not sent completely. */
+    sendDatavSentLength = sizeof( header ) + sizeof( payload ) + 1U;
+    pktStatus = _Cellular_AtcmdDataSend( &context, atReq, atDataReq, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_SEND_ERROR, pktStatus );
+    TEST_ASSERT_EQUAL( sizeof( header ) + sizeof( payload ), sentDataLength );
+}
+
 /**
  * @brief Test xQueueReceive return ok, but the data is not CELLULAR_PKT_STATUS_OK failure case for _Cellular_AtcmdDataSend.
  */
@@ -1483,6 +1942,133 @@ void test__Cellular_TimeoutAtcmdDataSendRequestWithCallback_Null_Param( void )
     TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_INVALID_HANDLE, pktStatus );
 }
 
+/**
+ * @brief Test that null context case for _Cellular_AtcmdDataSendBulk.
+ */
+void test__Cellular_AtcmdDataSendBulk_Null_Context( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t dataBuf[ CELLULAR_AT_CMD_TYPICAL_MAX_SIZE ] = { 0 };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { dataBuf, sizeof( dataBuf ), &sentDataLength, NULL, 0 };
+
+    pktStatus = _Cellular_AtcmdDataSendBulk( NULL, atDataReq, bulkChunkCallback, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_INVALID_HANDLE, pktStatus );
+}
+
+/**
+ * @brief Test that null parameter case for _Cellular_AtcmdDataSendBulk.
+ */
+void test__Cellular_AtcmdDataSendBulk_Null_Param( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t dataBuf[ CELLULAR_AT_CMD_TYPICAL_MAX_SIZE ] = { 0 };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { dataBuf, sizeof( dataBuf ), &sentDataLength, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    pktStatus = _Cellular_AtcmdDataSendBulk( &context, atDataReq, NULL, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_PARAM, pktStatus );
+
+    atDataReq.pSentDataLength = NULL;
+    pktStatus = _Cellular_AtcmdDataSendBulk( &context, atDataReq, bulkChunkCallback, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_PARAM, pktStatus );
+}
+
+/**
+ * @brief Test that data segments are not supported by _Cellular_AtcmdDataSendBulk.
+ */
+void test__Cellular_AtcmdDataSendBulk_Segments_Not_Supported( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t dataBuf[ CELLULAR_AT_CMD_TYPICAL_MAX_SIZE ] = { 0 };
+    CellularDataSegment_t segment = { dataBuf, sizeof( dataBuf ) };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { dataBuf, sizeof( dataBuf ), &sentDataLength, NULL, 0, &segment, 1 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    pktStatus = _Cellular_AtcmdDataSendBulk( &context, atDataReq, bulkChunkCallback, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_PARAM, pktStatus );
+}
+
+/**
+ * @brief Test that happy path case for _Cellular_AtcmdDataSendBulk.
+ *
+ * The data is sent in chunks of CELLULAR_MAX_SEND_DATA_LEN bytes.
+ */
+void test__Cellular_AtcmdDataSendBulk_Happy_Path( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    static uint8_t dataBuf[ ( CELLULAR_MAX_SEND_DATA_LEN * 2U ) + 10U ] = { 0 };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { dataBuf, sizeof( dataBuf ), &sentDataLength, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendData_StubWithCallback( _Cellular_PktioSendData_ShortWrite );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    pktStatus = _Cellular_AtcmdDataSendBulk( &context, atDataReq, bulkChunkCallback, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( sizeof( dataBuf ), sentDataLength );
+    TEST_ASSERT_EQUAL( 3U, bulkChunkCount );
+    TEST_ASSERT_EQUAL( CELLULAR_MAX_SEND_DATA_LEN, bulkChunkLength[ 0 ] );
+    TEST_ASSERT_EQUAL( CELLULAR_MAX_SEND_DATA_LEN, bulkChunkLength[ 1 ] );
+    TEST_ASSERT_EQUAL( 10U, bulkChunkLength[ 2 ] );
+}
+
+/**
+ * @brief Test that partial send case for _Cellular_AtcmdDataSendBulk.
+ *
+ * The send stops at the failed chunk. Only the acknowledged chunks are counted.
+ */
+void test__Cellular_AtcmdDataSendBulk_Partial_Send( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    static uint8_t dataBuf[ ( CELLULAR_MAX_SEND_DATA_LEN * 2U ) + 10U ] = { 0 };
+    uint32_t sentDataLength = 0;
+    CellularAtDataReq_t atDataReq = { dataBuf, sizeof( dataBuf ), &sentDataLength, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    _Cellular_PktioSendAtCmd_IgnoreAndReturn( CELLULAR_PKT_STATUS_OK );
+    _Cellular_PktioSendData_StubWithCallback( _Cellular_PktioSendData_ShortWrite );
+    queueData = CELLULAR_PKT_STATUS_OK;
+
+    /* The second chunk is not completely written. */
+    sendDataShortCallNum = 2U;
+
+    pktStatus = _Cellular_AtcmdDataSendBulk( &context, atDataReq, bulkChunkCallback, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_SEND_ERROR, pktStatus );
+    TEST_ASSERT_EQUAL( CELLULAR_MAX_SEND_DATA_LEN, sentDataLength );
+    TEST_ASSERT_EQUAL( 2U, bulkChunkCount );
+}
+
+/**
+ * @brief Test that chunk callback failure case for _Cellular_AtcmdDataSendBulk.
+ */
+void test__Cellular_AtcmdDataSendBulk_Chunk_Callback_Failure( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    uint8_t dataBuf[ CELLULAR_AT_CMD_TYPICAL_MAX_SIZE ] = { 0 };
+    uint32_t sentDataLength = 1;
+    CellularAtDataReq_t atDataReq = { dataBuf, sizeof( dataBuf ), &sentDataLength, NULL, 0 };
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    bulkChunkCallbackReturn = CELLULAR_PKT_STATUS_FAILURE;
+
+    pktStatus = _Cellular_AtcmdDataSendBulk( &context, atDataReq, bulkChunkCallback, NULL, NULL, 0, 0, 0 );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_FAILURE, pktStatus );
+    TEST_ASSERT_EQUAL( 0U, sentDataLength );
+    TEST_ASSERT_EQUAL( 1U, bulkChunkCount );
+}
+
 /**
  * @brief Test that null context case for _Cellular_PktHandlerInit.
  */
@@ -1667,6 +2253,21 @@ void test__Cellular_AtParseInit_Check_Sort_Fail( void )
     TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_PARAM, pktStatus );
 }
 
+/**
+ * @brief Test that sort check is skipped with token lookup for _Cellular_AtParseInit.
+ */
+void test__Cellular_AtParseInit_Token_Lookup_Skip_Sort_Check( void )
+{
+    CellularContext_t context;
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    /* copy the token table. */
+    ( void ) memcpy( &context.tokenTable, &tokenTableLookupCase, sizeof( CellularTokenTable_t ) );
+    pktStatus = _Cellular_AtParseInit( &context );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+}
+
 /**
  * @brief Test that token table fail case case for _Cellular_AtParseInit.
  */
@@ -1746,3 +2347,114 @@ void test__Cellular_AtcmdRequestSuccessToken_Cellular_PktioSendAtCmd_Return_OK(
     pktStatus = _Cellular_AtcmdRequestSuccessToken( &context, atReqGetMccMnc, PACKET_REQ_TIMEOUT_MS, successTokenTable, 1 );
     TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
 }
+
+/**
+ * @brief Test that _Cellular_AtCmdClassHash hashes the AT command form without parameters.
+ */
+void test__Cellular_AtCmdClassHash_Command_Class( void )
+{
+    uint32_t hashSet = _Cellular_AtCmdClassHash( "AT+CGDCONT=1,\"IP\",\"apn\"" );
+    uint32_t hashSetOther = _Cellular_AtCmdClassHash( "AT+CGDCONT=2,\"IPV6\",\"internet\"" );
+    uint32_t hashGet = _Cellular_AtCmdClassHash( "AT+CGDCONT?" );
+    uint32_t hashTest = _Cellular_AtCmdClassHash( "AT+CGDCONT=?" );
+    uint32_t hashExec = _Cellular_AtCmdClassHash( "AT+CGDCONT" );
+    uint32_t hashOther = _Cellular_AtCmdClassHash( "AT+COPS?" );
+
+    /* Parameters are excluded. */
+    TEST_ASSERT_EQUAL_UINT32( hashSet, hashSetOther );
+
+    /* Set, read, test and execute forms are different classes. */
+    TEST_ASSERT_NOT_EQUAL( hashSet, hashGet );
+    TEST_ASSERT_NOT_EQUAL( hashSet, hashTest );
+    TEST_ASSERT_NOT_EQUAL( hashGet, hashTest );
+    TEST_ASSERT_NOT_EQUAL( hashExec, hashSet );
+    TEST_ASSERT_NOT_EQUAL( hashExec, hashGet );
+    TEST_ASSERT_NOT_EQUAL( hashGet, hashOther );
+    TEST_ASSERT_EQUAL_UINT32( _Cellular_AtCmdClassHash( "" ), _Cellular_AtCmdClassHash( NULL ) );
+}
+
+/**
+ * @brief Test that _Cellular_AtCmdLatencyGetTimeout returns the fixed timeout before enough samples.
+ */
+void test__Cellular_AtCmdLatencyGetTimeout_Not_Enough_Samples( void )
+{
+    CellularAtCmdLatency_t latency = { 0 };
+
+    _Cellular_AtCmdLatencyUpdate( &latency, 100U );
+    TEST_ASSERT_EQUAL_UINT32( PACKET_REQ_TIMEOUT_MS, _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS ) );
+    TEST_ASSERT_EQUAL_UINT32( PACKET_REQ_TIMEOUT_MS, _Cellular_AtCmdLatencyGetTimeout( NULL, PACKET_REQ_TIMEOUT_MS ) );
+}
+
+/**
+ * @brief Test that _Cellular_AtCmdLatencyGetTimeout follows a stable latency within the caller timeout.
+ */
+void test__Cellular_AtCmdLatencyGetTimeout_Stable_Latency( void )
+{
+    CellularAtCmdLatency_t latency = { 0 };
+    uint32_t i = 0;
+
+    for( i = 0; i < 32U; i++ )
+    {
+        _Cellular_AtCmdLatencyUpdate( &latency, 1000U );
+    }
+
+    /* SRTT converges to 1000 ms with small variance. */
+    TEST_ASSERT_EQUAL_UINT32( 1000U, latency.srttScaled >> 3 );
+    TEST_ASSERT_LESS_THAN_UINT32( 1200U, _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS ) );
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32( 1000U, _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS ) );
+
+    /* Never exceed the caller timeout. */
+    TEST_ASSERT_EQUAL_UINT32( 800U, _Cellular_AtCmdLatencyGetTimeout( &latency, 800U ) );
+}
+
+/**
+ * @brief Test that _Cellular_AtCmdLatencyGetTimeout shortens the caller timeout for a fast command class.
+ */
+void test__Cellular_AtCmdLatencyGetTimeout_Min_Bound( void )
+{
+    CellularAtCmdLatency_t latency = { 0 };
+    uint32_t i = 0;
+
+    for( i = 0; i < 32U; i++ )
+    {
+        _Cellular_AtCmdLatencyUpdate( &latency, 30U );
+    }
+
+    /* A hung modem is detected after the minimum timeout instead of the caller timeout. */
+    TEST_ASSERT_EQUAL_UINT32( CELLULAR_CONFIG_ADAPTIVE_TIMEOUT_MIN_MS, _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS ) );
+    TEST_ASSERT_LESS_THAN_UINT32( PACKET_REQ_TIMEOUT_MS, _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS ) );
+
+    /* The caller timeout is used if it is lower than the minimum. */
+    TEST_ASSERT_EQUAL_UINT32( 100U, _Cellular_AtCmdLatencyGetTimeout( &latency, 100U ) );
+}
+
+/**
+ * @brief Test that _Cellular_AtCmdLatencyBackoff doubles the timeout and a sample resets it.
+ */
+void test__Cellular_AtCmdLatencyBackoff_Happy_Path( void )
+{
+    CellularAtCmdLatency_t latency = { 0 };
+    uint32_t baseTimeout = 0;
+    uint32_t i = 0;
+
+    for( i = 0; i < 32U; i++ )
+    {
+        _Cellular_AtCmdLatencyUpdate( &latency, 1000U );
+    }
+
+    baseTimeout = _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS );
+    _Cellular_AtCmdLatencyBackoff( &latency );
+    TEST_ASSERT_EQUAL_UINT32( baseTimeout << 1, _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS ) );
+
+    for( i = 0; i < 8U; i++ )
+    {
+        _Cellular_AtCmdLatencyBackoff( &latency );
+    }
+
+    /* Backoff is capped at the caller timeout. */
+    TEST_ASSERT_EQUAL_UINT32( PACKET_REQ_TIMEOUT_MS, _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS ) );
+
+    _Cellular_AtCmdLatencyUpdate( &latency, 1000U );
+    TEST_ASSERT_EQUAL_UINT8( 0U, latency.backoffShift );
+    TEST_ASSERT_EQUAL_UINT32( baseTimeout, _Cellular_AtCmdLatencyGetTimeout( &latency, PACKET_REQ_TIMEOUT_MS ) );
+}
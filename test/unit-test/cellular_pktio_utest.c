@@ -48,6 +48,7 @@
 #define PKTIO_EVT_MASK_ABORT                                 ( 0x0002UL )
 #define PKTIO_EVT_MASK_ABORTED                               ( 0x0004UL )
 #define PKTIO_EVT_MASK_RX_DATA                               ( 0x0008UL )
+#define PKTIO_EVT_MASK_TX_DONE                               ( 0x0010UL )
 
 #define CELLULAR_URC_TOKEN_STRING_INPUT                      "RDY"
 #define CELLULAR_AT_CMD_MULTI_WO_PREFIX                      "\rTEST1\r\n_TEST2\n_TEST3\r\n\0TEST4"
@@ -146,6 +147,55 @@ static void * inputBufferCallbackContext = NULL;
 static int dataUrcPktHandlerCallbackIsCalled = 0;
 static char * pInputBufferPkthandlerString;
 
+static int pktioBufferEventCount = 0;
+
+/* The comm interface send writes at most commIntfSendMaxLength bytes if not 0. */
+static uint32_t commIntfSendMaxLength = 0;
+static uint32_t commIntfSendCount = 0;
+static uint32_t commIntfSendvCount = 0;
+static uint32_t commIntfSendvSegmentCount = 0;
+static uint8_t commIntfSendvData[ 64 ] = { 0 };
+static CellularPktioBufferEvent_t lastPktioBufferEvent = CELLULAR_PKTIO_BUFFER_EVENT_HIGH_WATER_MARK;
+
+/* The comm interface recvBorrow lends commIntfBorrowBuffer. */
+static char commIntfBorrowBuffer[ PKTIO_READ_BUFFER_SIZE + 1 ] = { 0 };
+static uint32_t commIntfReleaseCount = 0;
+static uint32_t commIntfReleaseLength = 0;
+static char borrowUrcLine[ 32 ] = { 0 };
+
+/* The comm interface sendAsync completes sending commIntfSendAsyncLength bytes. */
+static uint32_t commIntfSendAsyncCount = 0;
+static uint32_t commIntfSendAsyncLength = 0;
+static CellularCommInterfaceError_t commIntfSendAsyncReturn = IOT_COMM_INTERFACE_SUCCESS;
+static CellularCommInterfaceError_t commIntfSendCallbackReturn = IOT_COMM_INTERFACE_SUCCESS;
+
+/* The send callback is called later by the test if commIntfSendAsyncDefer is set. */
+static bool commIntfSendAsyncDefer = false;
+static CellularCommInterfaceSendCallback_t commIntfSendCallback = NULL;
+static void * pCommIntfSendUserData = NULL;
+
+/* Data mode callback results. */
+static uint8_t dataModeRecvData[ 64 ] = { 0 };
+static uint32_t dataModeRecvLength = 0;
+static uint32_t dataModeExitCount = 0;
+static char * pCommIntfRecvNextString = NULL;
+
+/* The dial command passed to _Cellular_PktioDataModeStart. */
+static const char dataModeDialCmd[] = "ATD*99***1#";
+
+/* The context updated by the packet IO thread while _Cellular_PktioDataModeEscape waits. */
+static CellularContext_t * pDataModeEscapeContext = NULL;
+static _pktioDataMode_t dataModeEscapeResult = PKTIO_DATA_MODE_ESCAPING;
+
+/* The context completed by the comm interface while _Cellular_PktioSendDataWait waits.
+ * The completion is reported after sendDoneStaleCount stale events. */
+static CellularContext_t * pSendDoneContext = NULL;
+static uint32_t sendDoneStaleCount = 0;
+
+/* The tick count advances by tickCountIncrement for each read. */
+static TickType_t tickCount = 0;
+static TickType_t tickCountIncrement = 0;
+
 /* Try to Keep this map in Alphabetical order. */
 /* FreeRTOS Cellular Common Library porting interface. */
 /* coverity[misra_c_2012_rule_8_7_violation] */
@@ -224,6 +274,37 @@ CellularTokenTable_t tokenTableWithoutSuccessTable =
     .cellularSrcExtraTokenSuccessTableSize = CellularSrcExtraTokenSuccessTableSize
 };
 
+/* First byte classes of the token tables above. */
+static const uint8_t firstByteClass[ 256 ] =
+{
+    [ '>' ] = CELLULAR_TOKEN_CLASS_SUCCESS,
+    [ '+' ] = CELLULAR_TOKEN_CLASS_ERROR,
+    [ 'A' ] = CELLULAR_TOKEN_CLASS_ERROR,
+    [ 'B' ] = CELLULAR_TOKEN_CLASS_ERROR,
+    [ 'C' ] = CELLULAR_TOKEN_CLASS_SUCCESS,
+    [ 'E' ] = CELLULAR_TOKEN_CLASS_ERROR,
+    [ 'N' ] = CELLULAR_TOKEN_CLASS_ERROR | CELLULAR_TOKEN_CLASS_URC_WO_PREFIX,
+    [ 'O' ] = CELLULAR_TOKEN_CLASS_SUCCESS,
+    [ 'P' ] = CELLULAR_TOKEN_CLASS_URC_WO_PREFIX,
+    [ 'R' ] = CELLULAR_TOKEN_CLASS_URC_WO_PREFIX,
+    [ 'S' ] = CELLULAR_TOKEN_CLASS_SUCCESS | CELLULAR_TOKEN_CLASS_ERROR
+};
+
+/* The URC handler table is not used by pktio. */
+static const uint16_t urcHashSlots[ 1 ] = { 0 };
+static const uint32_t urcTokenHash[ 1 ] = { 0 };
+static const uint16_t urcTokenLength[ 1 ] = { 0 };
+
+static const CellularTokenLookup_t tokenLookup =
+{
+    .urcHashSeed     = 0U,
+    .urcHashSlotMask = 0U,
+    .pUrcHashSlots   = urcHashSlots,
+    .pUrcTokenHash   = urcTokenHash,
+    .pUrcTokenLength = urcTokenLength,
+    .pFirstByteClass = firstByteClass
+};
+
 /* ============================   UNITY FIXTURES ============================ */
 
 /* Called before each test method. */
@@ -245,6 +326,32 @@ void setUp()
     testCommIfRecvType = COMM_IF_RECV_NORMAL;
     pCommIntfRecvCustomString = NULL;
     pCommIntfRecvCustomStringCallback = NULL;
+    commIntfSendMaxLength = 0;
+    commIntfSendCount = 0;
+    commIntfSendvCount = 0;
+    commIntfSendvSegmentCount = 0;
+    memset( commIntfSendvData, 0, sizeof( commIntfSendvData ) );
+    memset( commIntfBorrowBuffer, 0, sizeof( commIntfBorrowBuffer ) );
+    commIntfReleaseCount = 0;
+    commIntfReleaseLength = 0;
+    memset( borrowUrcLine, 0, sizeof( borrowUrcLine ) );
+    commIntfSendAsyncCount = 0;
+    commIntfSendAsyncLength = 0;
+    commIntfSendAsyncReturn = IOT_COMM_INTERFACE_SUCCESS;
+    commIntfSendCallbackReturn = IOT_COMM_INTERFACE_SUCCESS;
+    commIntfSendAsyncDefer = false;
+    commIntfSendCallback = NULL;
+    pCommIntfSendUserData = NULL;
+    memset( dataModeRecvData, 0, sizeof( dataModeRecvData ) );
+    dataModeRecvLength = 0;
+    dataModeExitCount = 0;
+    pCommIntfRecvNextString = NULL;
+    pDataModeEscapeContext = NULL;
+    dataModeEscapeResult = PKTIO_DATA_MODE_ESCAPING;
+    pSendDoneContext = NULL;
+    sendDoneStaleCount = 0;
+    tickCount = 0;
+    tickCountIncrement = 0;
 }
 
 /* Called after each test method. */
@@ -270,6 +377,14 @@ void dummyDelay( uint32_t milliseconds )
     ( void ) milliseconds;
 }
 
+void dummyTaskENTER_CRITICAL( void )
+{
+}
+
+void dummyTaskEXIT_CRITICAL( void )
+{
+}
+
 void MockPlatformMutex_Unlock( PlatformMutex_t * pMutex )
 {
     ( void ) pMutex;
@@ -304,6 +419,15 @@ MockPlatformEventGroupHandle_t MockPlatformEventGroup_Create( void )
     return evtGroupHandle;
 }
 
+TickType_t MockxTaskGetTickCount( void )
+{
+    TickType_t ret = tickCount;
+
+    tickCount = tickCount + tickCountIncrement;
+
+    return ret;
+}
+
 uint16_t MockPlatformEventGroup_WaitBits( PlatformEventGroupHandle_t groupEvent,
                                           EventBits_t uxBitsToWaitFor,
                                           BaseType_t xClearOnExit,
@@ -316,6 +440,26 @@ uint16_t MockPlatformEventGroup_WaitBits( PlatformEventGroupHandle_t groupEvent,
     ( void ) xWaitForAllBits;
     ( void ) xTicksToWait;
 
+    /* The packet IO thread receives the response to the escape sequence. */
+    if( pDataModeEscapeContext != NULL )
+    {
+        pDataModeEscapeContext->dataMode = dataModeEscapeResult;
+    }
+
+    /* The comm interface completes the current send after the stale events. */
+    if( pSendDoneContext != NULL )
+    {
+        if( sendDoneStaleCount > 0U )
+        {
+            sendDoneStaleCount--;
+        }
+        else
+        {
+            pSendDoneContext->pktioSendAsyncLength = 4;
+            pSendDoneContext->pktioSendAsyncDoneSequence = pSendDoneContext->pktioSendAsyncSequence;
+        }
+    }
+
     if( testInfiniteLoop > 0 )
     {
         testInfiniteLoop--;
@@ -464,11 +608,47 @@ static CellularCommInterfaceError_t prvCommIntfSend( CellularCommInterfaceHandle
     ( void ) timeoutMilliseconds;
     ( void ) pDataSentLength;
 
+    commIntfSendCount++;
     *pDataSentLength = dataLength;
 
+    if( ( commIntfSendMaxLength > 0U ) && ( dataLength > commIntfSendMaxLength ) )
+    {
+        *pDataSentLength = commIntfSendMaxLength;
+    }
+
     return commIntRet;
 }
 
+/* Sends the segments to commIntfSendvData. */
+static CellularCommInterfaceError_t prvCommIntfSendv( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                      const CellularDataSegment_t * pSegments,
+                                                      uint32_t segmentCount,
+                                                      uint32_t timeoutMilliseconds,
+                                                      uint32_t * pDataSentLength )
+{
+    uint32_t i = 0;
+    uint32_t sentLength = 0;
+
+    ( void ) commInterfaceHandle;
+    ( void ) timeoutMilliseconds;
+
+    commIntfSendvCount++;
+    commIntfSendvSegmentCount = segmentCount;
+
+    for( i = 0; i < segmentCount; i++ )
+    {
+        if( ( sentLength + pSegments[ i ].dataLength ) <= sizeof( commIntfSendvData ) )
+        {
+            memcpy( &commIntfSendvData[ sentLength ], pSegments[ i ].pData, pSegments[ i ].dataLength );
+            sentLength = sentLength + pSegments[ i ].dataLength;
+        }
+    }
+
+    *pDataSentLength = sentLength;
+
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
 static CellularCommInterfaceError_t prvCommIntfReceiveNormal( CellularCommInterfaceHandle_t commInterfaceHandle,
                                                               uint8_t * pBuffer,
                                                               uint32_t bufferLength,
@@ -676,6 +856,77 @@ static CellularCommInterfaceError_t prvCommIntfReceive( CellularCommInterfaceHan
     return commIfRet;
 }
 
+/* Lends commIntfBorrowBuffer with pCommIntfRecvCustomString. */
+static CellularCommInterfaceError_t prvCommIntfRecvBorrow( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                           uint8_t ** ppBuffer,
+                                                           uint32_t bufferLength,
+                                                           uint32_t timeoutMilliseconds,
+                                                           uint32_t * pDataReceivedLength )
+{
+    ( void ) commInterfaceHandle;
+    ( void ) timeoutMilliseconds;
+
+    if( recvCount > 0 )
+    {
+        recvCount--;
+
+        ( void ) strncpy( commIntfBorrowBuffer, pCommIntfRecvCustomString, bufferLength );
+        *ppBuffer = ( uint8_t * ) commIntfBorrowBuffer;
+        *pDataReceivedLength = strlen( pCommIntfRecvCustomString );
+    }
+    else
+    {
+        *pDataReceivedLength = 0;
+    }
+
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+static CellularCommInterfaceError_t prvCommIntfRecvRelease( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                            uint32_t bufferLength )
+{
+    ( void ) commInterfaceHandle;
+
+    commIntfReleaseCount++;
+    commIntfReleaseLength = bufferLength;
+
+    /* The borrowed buffer is reused by the comm interface. */
+    memset( commIntfBorrowBuffer, 0, sizeof( commIntfBorrowBuffer ) );
+
+    return IOT_COMM_INTERFACE_SUCCESS;
+}
+
+/* Completes the transfer in this function. */
+static CellularCommInterfaceError_t prvCommIntfSendAsync( CellularCommInterfaceHandle_t commInterfaceHandle,
+                                                          const uint8_t * pData,
+                                                          uint32_t dataLength,
+                                                          uint32_t timeoutMilliseconds,
+                                                          CellularCommInterfaceSendCallback_t sendCallback,
+                                                          void * pUserData )
+{
+    ( void ) pData;
+    ( void ) timeoutMilliseconds;
+
+    commIntfSendAsyncCount++;
+
+    if( commIntfSendAsyncReturn != IOT_COMM_INTERFACE_SUCCESS )
+    {
+        /* The transfer is not started. */
+    }
+    else if( commIntfSendAsyncDefer == true )
+    {
+        commIntfSendCallback = sendCallback;
+        pCommIntfSendUserData = pUserData;
+    }
+    else
+    {
+        commIntfSendAsyncLength = dataLength;
+        commIntfSendCallbackReturn = sendCallback( pUserData, commInterfaceHandle, dataLength );
+    }
+
+    return commIntfSendAsyncReturn;
+}
+
 static CellularCommInterface_t CellularCommInterface =
 {
     .open  = prvCommIntfOpen,
@@ -684,6 +935,35 @@ static CellularCommInterface_t CellularCommInterface =
     .close = prvCommIntfClose
 };
 
+static CellularCommInterface_t CellularCommInterfaceSendv =
+{
+    .open  = prvCommIntfOpen,
+    .send  = prvCommIntfSend,
+    .recv  = prvCommIntfReceive,
+    .close = prvCommIntfClose,
+    .sendv = prvCommIntfSendv
+};
+
+static CellularCommInterface_t CellularCommInterfaceSendAsync =
+{
+    .open      = prvCommIntfOpen,
+    .send      = prvCommIntfSend,
+    .recv      = prvCommIntfReceive,
+    .close     = prvCommIntfClose,
+    .sendAsync = prvCommIntfSendAsync
+};
+
+static CellularCommInterface_t CellularCommInterfaceRecvBorrow =
+{
+    .open        = prvCommIntfOpen,
+    .send        = prvCommIntfSend,
+    .recv        = prvCommIntfReceive,
+    .close       = prvCommIntfClose,
+    .sendv       = NULL,
+    .recvBorrow  = prvCommIntfRecvBorrow,
+    .recvRelease = prvCommIntfRecvRelease
+};
+
 static void _shutdownCallback( CellularContext_t * pContext )
 {
     if( pContext != NULL )
@@ -756,6 +1036,20 @@ CellularPktStatus_t PktioHandlePacketCallback_t( CellularContext_t * pContext,
     return status;
 }
 
+static CellularPktStatus_t prvBorrowHandlePacket( CellularContext_t * pContext,
+                                                  _atRespType_t atRespType,
+                                                  const void * pBuffer )
+{
+    ( void ) pContext;
+
+    if( atRespType == AT_UNSOLICITED )
+    {
+        ( void ) strncpy( borrowUrcLine, ( const char * ) pBuffer, sizeof( borrowUrcLine ) - 1U );
+    }
+
+    return CELLULAR_PKT_STATUS_OK;
+}
+
 CellularPktStatus_t cellularATCommandDataPrefixCallback( void * pCallbackContext,
                                                          char * pLine,
                                                          uint32_t lineLength,
@@ -969,6 +1263,16 @@ static CellularPktStatus_t prvDataUrcPktHandlerCallback( CellularContext_t * pCo
     return CELLULAR_PKT_STATUS_OK;
 }
 
+static void prvPktioBufferCallback( void * pCallbackContext,
+                                    CellularPktioBufferEvent_t event,
+                                    const CellularPktioBufferStats_t * pStats )
+{
+    TEST_ASSERT_EQUAL_PTR( &customCallbackContext, pCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_CONFIG_PKTIO_READ_BUFFER_SIZE, pStats->bufferSize );
+    lastPktioBufferEvent = event;
+    pktioBufferEventCount++;
+}
+
 static void prvInputBufferCommIntfRecvCallback( void )
 {
     pCommIntfRecvCustomString = URC_DATA_CALLBACK_MATCH_STR_PART2;
@@ -995,6 +1299,43 @@ static CellularPktStatus_t prvPacketCallbackError( CellularContext_t * pContext,
     return CELLULAR_PKT_STATUS_OK;
 }
 
+/* Appends the data received in data mode to dataModeRecvData. */
+static void prvDataModeReceiveCallback( const uint8_t * pData,
+                                        uint32_t dataLength,
+                                        void * pCallbackContext )
+{
+    TEST_ASSERT_EQUAL_PTR( &customCallbackContext, pCallbackContext );
+    TEST_ASSERT_LESS_OR_EQUAL( sizeof( dataModeRecvData ), dataModeRecvLength + dataLength );
+
+    memcpy( &dataModeRecvData[ dataModeRecvLength ], pData, dataLength );
+    dataModeRecvLength = dataModeRecvLength + dataLength;
+}
+
+static void prvDataModeExitCallback( void * pCallbackContext )
+{
+    TEST_ASSERT_EQUAL_PTR( &customCallbackContext, pCallbackContext );
+    dataModeExitCount++;
+}
+
+/* Switches the custom string to pCommIntfRecvNextString for the next receive. */
+static void prvDataModeCommIntfRecvCallback( void )
+{
+    pCommIntfRecvCustomString = pCommIntfRecvNextString;
+}
+
+/* Accepts the dial command response. */
+static CellularPktStatus_t prvDataModeHandlePacket( CellularContext_t * pContext,
+                                                    _atRespType_t atRespType,
+                                                    const void * pBuffer )
+{
+    ( void ) pContext;
+    ( void ) pBuffer;
+
+    TEST_ASSERT_EQUAL( AT_SOLICITED, atRespType );
+
+    return CELLULAR_PKT_STATUS_OK;
+}
+
 static CellularPktStatus_t prvPacketCallbackSuccess( CellularContext_t * pContext,
                                                      _atRespType_t atRespType,
                                                      const void * pBuffer )
@@ -1491,9 +1832,7 @@ void test__Cellular_PktioInit_Thread_Rx_Data_Event__preprocessInputBuffer_prefix
  * else if( pktStatus != CELLULAR_PKT_STATUS_OK )
  * {
  *     ...
- *     ( void ) memset( pContext->pktioReadBuf, 0, PKTIO_READ_BUFFER_SIZE + 1U );
- *     pContext->pPktioReadPtr = NULL;
- *     pContext->partialDataRcvdLen = 0;
+ *     _resetReadBuffer( pContext, *pBytesRead );
  *     keepProcess = false;
  * }
  * @endcode
@@ -1537,6 +1876,57 @@ void test__Cellular_PktioInit_Thread_Rx_Data_Event__preprocessInputBuffer_other_
     TEST_ASSERT_EQUAL( 0, dataUrcPktHandlerCallbackIsCalled );
 }
 
+/**
+ * @brief _resetReadBuffer - inputBufferCallback returns other error.
+ *
+ * The read buffer is cleaned. Verify that the resync event is counted and the
+ * registered pktio buffer callback is called.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event__preprocessInputBuffer_other_error_buffer_stats( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    CellularCommInterface_t * pCommIntf = &CellularCommInterface;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = pCommIntf;
+    context.pPktioShutdownCB = _shutdownCallback;
+
+    /* copy the token table. */
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    /* RX data event for RX thread. */
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+
+    /* Setup the URC data callback and buffer callback for testing. */
+    context.inputBufferCallback = cellularInputBufferCallback;
+    context.pInputBufferCallbackContext = NULL;
+    context.pktioBufferCallback = prvPktioBufferCallback;
+    context.pPktioBufferCallbackContext = &customCallbackContext;
+    pktioBufferEventCount = 0;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_RESULT;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = URC_DATA_CALLBACK_OTHER_ERROR_STR;
+
+    /* API call. */
+    pktStatus = _Cellular_PktioInit( &context, prvDataUrcPktHandlerCallback );
+
+    /* Verification. */
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( strlen( URC_DATA_CALLBACK_OTHER_ERROR_STR ), context.pktioBufferStats.highWaterMark );
+    TEST_ASSERT_EQUAL( 1, context.pktioBufferStats.resyncCount );
+    TEST_ASSERT_EQUAL( 0, context.pktioBufferStats.overflowCount );
+    TEST_ASSERT_EQUAL( strlen( URC_DATA_CALLBACK_OTHER_ERROR_STR ), context.pktioBufferStats.bytesDropped );
+
+    /* High-water mark event and resync event. */
+    TEST_ASSERT_EQUAL( 2, pktioBufferEventCount );
+    TEST_ASSERT_EQUAL( CELLULAR_PKTIO_BUFFER_EVENT_RESYNC, lastPktioBufferEvent );
+}
+
 /**
  * @brief _preprocessInputBuffer - inputBufferCallback returns incorrect buffer length.
  *
@@ -1548,9 +1938,7 @@ void test__Cellular_PktioInit_Thread_Rx_Data_Event__preprocessInputBuffer_other_
  * else if( bufferLength > *pBytesRead )
  * {
  *     ...
- *     ( void ) memset( pContext->pktioReadBuf, 0, PKTIO_READ_BUFFER_SIZE + 1U );
- *     pContext->pPktioReadPtr = NULL;
- *     pContext->partialDataRcvdLen = 0;
+ *     _resetReadBuffer( pContext, *pBytesRead );
  *     keepProcess = false;
  * }
  * @endcode
@@ -2481,6 +2869,76 @@ void test__Cellular_PktioInit_Thread_Rx_Data_Event_TOKEN_TABLE_ERROR_TOKEN( void
     TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
 }
 
+/**
+ * @brief Test thread receiving rx data event with error token and token lookup for _Cellular_PktioInit to return CELLULAR_PKT_STATUS_OK.
+ *
+ * The success token table is skipped for the first byte of the error token.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_TOKEN_LOOKUP_ERROR_TOKEN( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    CellularCommInterface_t * pCommIntf = &CellularCommInterface;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = pCommIntf;
+    context.pPktioShutdownCB = _shutdownCallback;
+
+    /* Test the rx_data event with CELLULAR_AT_WO_PREFIX resp. */
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    atCmdType = CELLULAR_AT_WO_PREFIX;
+    /* copy the token table. */
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+    context.tokenTable.pTokenLookup = &tokenLookup;
+    context.pktDataPrefixCB = NULL;
+    context.pRespPrefix = NULL;
+
+    /* Set error token. */
+    tokenTableType = 2;
+    recvCount = 2;
+    /* Check that CELLULAR_PKT_STATUS_OK is returned. */
+    pktStatus = _Cellular_PktioInit( &context, PktioHandlePacketCallback_t );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+}
+
+/**
+ * @brief Test thread receiving rx data event with intermediate response and token lookup for _Cellular_PktioInit to return CELLULAR_PKT_STATUS_OK.
+ *
+ * The success and error token tables are skipped for the first byte of the response.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_TOKEN_LOOKUP_NO_TOKEN_CLASS( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    CellularCommInterface_t * pCommIntf = &CellularCommInterface;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = pCommIntf;
+    context.pPktioShutdownCB = _shutdownCallback;
+
+    /* Test the rx_data event with CELLULAR_AT_WO_PREFIX resp. */
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    atCmdType = CELLULAR_AT_WO_PREFIX;
+    /* copy the token table. */
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+    context.tokenTable.pTokenLookup = &tokenLookup;
+    context.pktDataPrefixCB = NULL;
+    context.pRespPrefix = NULL;
+
+    /* Intermediate response. */
+    tokenTableType = 0;
+    recvCount = 2;
+    /* Check that CELLULAR_PKT_STATUS_OK is returned. */
+    pktStatus = _Cellular_PktioInit( &context, PktioHandlePacketCallback_t );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+}
+
 /**
  * @brief Test thread receiving rx data event with extra token for _Cellular_PktioInit to return CELLULAR_PKT_STATUS_OK.
  */
@@ -2940,6 +3398,29 @@ void test__Cellular_PktioSendAtCmd_Happy_Path( void )
     TEST_ASSERT_EQUAL( &context.pktRespPrefixBuf, context.pRespPrefix );
 }
 
+/**
+ * @brief Test that _Cellular_PktioSendAtCmd sends the command and \r with one
+ * sendv call of the comm interface.
+ */
+void test__Cellular_PktioSendAtCmd_Sendv( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &CellularCommInterfaceSendv;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+
+    pktStatus = _Cellular_PktioSendAtCmd( &context, "AT+CSQ", CELLULAR_AT_WITH_PREFIX, "+CSQ" );
+
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( 1, commIntfSendvCount );
+    TEST_ASSERT_EQUAL( 0, commIntfSendCount );
+    TEST_ASSERT_EQUAL( 2, commIntfSendvSegmentCount );
+    TEST_ASSERT_EQUAL_STRING( "AT+CSQ\r", ( const char * ) commIntfSendvData );
+}
+
 /**
  * @brief Test that happy path for _Cellular_PktioSendAtCmd.
  */
@@ -3342,6 +3823,1022 @@ void test__Cellular_PktioSendData_Happy_Path( void )
     TEST_ASSERT_EQUAL( strlen( pString ) + 1, sentLen );
 }
 
+/**
+ * @brief Test that any NULL parameter for _Cellular_PktioSendDatav.
+ */
+void test__Cellular_PktioSendDatav_Invalid_Param( void )
+{
+    uint32_t sentLen = 0;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+    uint8_t data[ 4 ] = { 0 };
+    CellularDataSegment_t segments[ 2 ] = { { data, sizeof( data ) }, { NULL, 4 } };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    sentLen = _Cellular_PktioSendDatav( NULL, segments, 1 );
+    TEST_ASSERT_EQUAL( 0, sentLen );
+
+    /* Not assign pCommIntf and hPktioCommIntf. */
+    sentLen = _Cellular_PktioSendDatav( &context, segments, 1 );
+    TEST_ASSERT_EQUAL( 0, sentLen );
+
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    sentLen = _Cellular_PktioSendDatav( &context, NULL, 1 );
+    TEST_ASSERT_EQUAL( 0, sentLen );
+
+    /* The segment with NULL pData is not sent. */
+    sentLen = _Cellular_PktioSendDatav( &context, segments, 2 );
+    TEST_ASSERT_EQUAL( sizeof( data ), sentLen );
+    TEST_ASSERT_EQUAL( 1, commIntfSendCount );
+}
+
+/**
+ * @brief Test that happy path for _Cellular_PktioSendDatav.
+ */
+void test__Cellular_PktioSendDatav_Happy_Path( void )
+{
+    uint32_t sentLen = 0;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+    uint8_t header[ 2 ] = { 0 };
+    uint8_t payload[ 10 ] = { 0 };
+    CellularDataSegment_t segments[ 2 ] = { { header, sizeof( header ) }, { payload, sizeof( payload ) } };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+
+    sentLen = _Cellular_PktioSendDatav( &context, segments, 2 );
+    TEST_ASSERT_EQUAL( sizeof( header ) + sizeof( payload ), sentLen );
+    TEST_ASSERT_EQUAL( 2, commIntfSendCount );
+}
+
+/**
+ * @brief Test that _Cellular_PktioSendDatav sends the segments with one sendv
+ * call of the comm interface.
+ */
+void test__Cellular_PktioSendDatav_Sendv( void )
+{
+    uint32_t sentLen = 0;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+    uint8_t header[ 2 ] = { 'H', 'D' };
+    uint8_t payload[ 4 ] = { 'D', 'A', 'T', 'A' };
+    CellularDataSegment_t segments[ 2 ] = { { header, sizeof( header ) }, { payload, sizeof( payload ) } };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &CellularCommInterfaceSendv;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+
+    sentLen = _Cellular_PktioSendDatav( &context, segments, 2 );
+    TEST_ASSERT_EQUAL( sizeof( header ) + sizeof( payload ), sentLen );
+    TEST_ASSERT_EQUAL( 1, commIntfSendvCount );
+    TEST_ASSERT_EQUAL( 0, commIntfSendCount );
+    TEST_ASSERT_EQUAL_STRING( "HDDATA", ( const char * ) commIntfSendvData );
+}
+
+/**
+ * @brief Test that _Cellular_PktioSendDatav stops at the segment not sent completely.
+ */
+void test__Cellular_PktioSendDatav_Short_Write( void )
+{
+    uint32_t sentLen = 0;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+    uint8_t header[ 2 ] = { 0 };
+    uint8_t payload[ 10 ] = { 0 };
+    CellularDataSegment_t segments[ 3 ] =
+    {
+        { header,  sizeof( header )  },
+        { payload, sizeof( payload ) },
+        { header,  sizeof( header )  }
+    };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    commIntfSendMaxLength = 5;
+
+    sentLen = _Cellular_PktioSendDatav( &context, segments, 3 );
+    TEST_ASSERT_EQUAL( sizeof( header ) + 5U, sentLen );
+    TEST_ASSERT_EQUAL( 2, commIntfSendCount );
+}
+
+/**
+ * @brief Test that invalid parameter for _Cellular_PktioSendDataAsync.
+ */
+void test__Cellular_PktioSendDataAsync_Invalid_Param( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+    uint8_t payload[ 4 ] = { 0 };
+
+    pktStatus = _Cellular_PktioSendDataAsync( NULL, payload, sizeof( payload ) );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_INVALID_HANDLE, pktStatus );
+
+    /* The comm interface doesn't support sendAsync. */
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    pktStatus = _Cellular_PktioSendDataAsync( &context, payload, sizeof( payload ) );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_INVALID_HANDLE, pktStatus );
+
+    context.pCommIntf = &CellularCommInterfaceSendAsync;
+    pktStatus = _Cellular_PktioSendDataAsync( &context, NULL, sizeof( payload ) );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_PARAM, pktStatus );
+    TEST_ASSERT_EQUAL( 0, commIntfSendAsyncCount );
+}
+
+/**
+ * @brief Test that the comm interface failing to start the transfer for
+ * _Cellular_PktioSendDataAsync.
+ */
+void test__Cellular_PktioSendDataAsync_Comm_Interface_Fail( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+    uint8_t payload[ 4 ] = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &CellularCommInterfaceSendAsync;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    commIntfSendAsyncReturn = IOT_COMM_INTERFACE_DRIVER_ERROR;
+
+    pktStatus = _Cellular_PktioSendDataAsync( &context, payload, sizeof( payload ) );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_SEND_ERROR, pktStatus );
+    TEST_ASSERT_EQUAL( 1, commIntfSendAsyncCount );
+}
+
+/**
+ * @brief Test that _Cellular_PktioSendDataWait returns the data length reported
+ * by the send callback of the comm interface.
+ */
+void test__Cellular_PktioSendDataAsync_Happy_Path( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+    uint8_t payload[ 4 ] = { 0 };
+    uint32_t sentLen = 0;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &CellularCommInterfaceSendAsync;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    setBitFromIsrReturn = 1;
+    higherPriorityTaskWokenReturn = 1;
+
+    pktStatus = _Cellular_PktioSendDataAsync( &context, payload, sizeof( payload ) );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, commIntfSendCallbackReturn );
+
+    /* The send completion event is set. */
+    pktioEvtMask = PKTIO_EVT_MASK_TX_DONE;
+    testInfiniteLoop = 1;
+    sentLen = _Cellular_PktioSendDataWait( &context, CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( sizeof( payload ), sentLen );
+}
+
+/**
+ * @brief Test that the completion of a send which is no longer waited for is ignored.
+ */
+void test__Cellular_PktioSendDataAsync_Stale_Completion( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+    uint8_t payload[ 4 ] = { 0 };
+    CellularCommInterfaceSendCallback_t firstCallback = NULL;
+    void * pFirstUserData = NULL;
+    uint32_t sentLen = 0;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pCommIntf = &CellularCommInterfaceSendAsync;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    commIntfSendAsyncDefer = true;
+
+    /* The first send is not completed before the wait times out. */
+    pktStatus = _Cellular_PktioSendDataAsync( &context, payload, sizeof( payload ) );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    firstCallback = commIntfSendCallback;
+    pFirstUserData = pCommIntfSendUserData;
+    pktioEvtMask = 0;
+    testInfiniteLoop = 1;
+    sentLen = _Cellular_PktioSendDataWait( &context, CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( 0, sentLen );
+
+    /* The first send completes late, before and after the next send is started. */
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_BUSY, firstCallback( pFirstUserData, context.hPktioCommIntf, 3 ) );
+    TEST_ASSERT_EQUAL( 0, context.pktioSendAsyncLength );
+    pktStatus = _Cellular_PktioSendDataAsync( &context, payload, sizeof( payload ) );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_NOT_EQUAL( pFirstUserData, pCommIntfSendUserData );
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_BUSY, firstCallback( pFirstUserData, context.hPktioCommIntf, 3 ) );
+    TEST_ASSERT_EQUAL( 0, context.pktioSendAsyncLength );
+
+    /* The completion of the second send is reported. */
+    setBitFromIsrReturn = 1;
+    higherPriorityTaskWokenReturn = 1;
+    TEST_ASSERT_EQUAL( IOT_COMM_INTERFACE_SUCCESS, commIntfSendCallback( pCommIntfSendUserData, context.hPktioCommIntf, 4 ) );
+    TEST_ASSERT_EQUAL( 4, context.pktioSendAsyncLength );
+}
+
+/**
+ * @brief Test that _Cellular_PktioSendDataWait keeps waiting when the event is
+ * set by a deferred completion of the previous send.
+ */
+void test__Cellular_PktioSendDataWait_Stale_Event( void )
+{
+    CellularContext_t context;
+    uint32_t sentLen = 0;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+
+    /* The previous send completed in the ISR before the current send started. */
+    context.pktioSendAsyncSequence = 2;
+    context.pktioSendAsyncDoneSequence = 1;
+    context.pktioSendAsyncLength = 3;
+
+    pSendDoneContext = &context;
+    sendDoneStaleCount = 1;
+    tickCountIncrement = 1;
+    pktioEvtMask = PKTIO_EVT_MASK_TX_DONE;
+    testInfiniteLoop = 2;
+    sentLen = _Cellular_PktioSendDataWait( &context, CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( 4, sentLen );
+    TEST_ASSERT_EQUAL( 0, testInfiniteLoop );
+    TEST_ASSERT_EQUAL( 2, context.pktioSendAsyncSequence );
+}
+
+/**
+ * @brief Test that _Cellular_PktioSendDataWait times out if only the previous
+ * send completes before the timeout.
+ */
+void test__Cellular_PktioSendDataWait_Stale_Event_Timeout( void )
+{
+    CellularContext_t context;
+    uint32_t sentLen = 0;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    context.pktioSendAsyncSequence = 2;
+    context.pktioSendAsyncDoneSequence = 1;
+    context.pktioSendAsyncLength = 3;
+
+    /* The timeout expires when the stale event is received. */
+    pSendDoneContext = &context;
+    sendDoneStaleCount = 1;
+    tickCountIncrement = pdMS_TO_TICKS( CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+    pktioEvtMask = PKTIO_EVT_MASK_TX_DONE;
+    testInfiniteLoop = 2;
+    sentLen = _Cellular_PktioSendDataWait( &context, CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( 0, sentLen );
+    TEST_ASSERT_EQUAL( 1, testInfiniteLoop );
+
+    /* The completion of the timed out send is ignored. */
+    TEST_ASSERT_EQUAL( 3, context.pktioSendAsyncSequence );
+}
+
+/**
+ * @brief Test that _Cellular_PktioSendDataWait returns 0 if the send is not completed.
+ */
+void test__Cellular_PktioSendDataWait_Timeout( void )
+{
+    CellularContext_t context;
+    uint32_t sentLen = 0;
+
+    sentLen = _Cellular_PktioSendDataWait( NULL, CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( 0, sentLen );
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    context.pktioSendAsyncLength = 4;
+
+    /* No event is set. */
+    pktioEvtMask = 0;
+    testInfiniteLoop = 1;
+    sentLen = _Cellular_PktioSendDataWait( &context, CELLULAR_COMM_IF_SEND_TIMEOUT_MS );
+    TEST_ASSERT_EQUAL( 0, sentLen );
+}
+
+/**
+ * @brief Test that pktio parses a complete line in the buffer borrowed from the
+ * comm interface without copying it to the read buffer.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_RecvBorrow_Complete_Line( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterfaceRecvBorrow;
+    context.pPktioShutdownCB = _shutdownCallback;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "+CEREG: 1\r\n";
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioInit( &context, prvBorrowHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    /* The URC is handled in the borrowed buffer. */
+    TEST_ASSERT_EQUAL_STRING( "+CEREG: 1", borrowUrcLine );
+    TEST_ASSERT_EQUAL( 1, commIntfReleaseCount );
+    TEST_ASSERT_EQUAL( strlen( "+CEREG: 1\r\n" ), commIntfReleaseLength );
+
+    /* Nothing is copied to the read buffer. */
+    TEST_ASSERT_NULL( context.pPktioReadPtr );
+    TEST_ASSERT_EQUAL( 0, context.partialDataRcvdLen );
+    TEST_ASSERT_EQUAL( '\0', context.pktioReadBuf[ 0 ] );
+    TEST_ASSERT_EQUAL( 0, context.pktioBufferStats.highWaterMark );
+}
+
+/**
+ * @brief Test that pktio copies the partial line in the borrowed buffer to the
+ * read buffer before releasing the borrowed buffer.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_RecvBorrow_Partial_Line( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterfaceRecvBorrow;
+    context.pPktioShutdownCB = _shutdownCallback;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "\r\n+CEREG: 1";
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioInit( &context, prvBorrowHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL_STRING( "", borrowUrcLine );
+    TEST_ASSERT_EQUAL( 1, commIntfReleaseCount );
+    TEST_ASSERT_EQUAL( strlen( "\r\n+CEREG: 1" ), commIntfReleaseLength );
+
+    /* Only the partial line is copied to the read buffer. */
+    TEST_ASSERT_EQUAL_PTR( context.pktioReadBuf, context.pPktioReadPtr );
+    TEST_ASSERT_EQUAL( strlen( "+CEREG: 1" ), context.partialDataRcvdLen );
+    TEST_ASSERT_EQUAL_STRING( "+CEREG: 1", context.pktioReadBuf );
+    TEST_ASSERT_EQUAL( strlen( "+CEREG: 1" ), context.pktioBufferStats.highWaterMark );
+}
+
+/**
+ * @brief Test that invalid parameters for _Cellular_PktioDataModeStart.
+ */
+void test__Cellular_PktioDataModeStart_Invalid_Param( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( NULL, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_INVALID_HANDLE, pktStatus );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, NULL, prvDataModeExitCallback, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_PARAM, pktStatus );
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, NULL, prvDataModeReceiveCallback, prvDataModeExitCallback, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_PARAM, pktStatus );
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+}
+
+/**
+ * @brief Test that _Cellular_PktioDataModeStart can't be called again before
+ * _Cellular_PktioDataModeStop.
+ */
+void test__Cellular_PktioDataModeStart_Already_Started( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_STARTING, context.dataMode );
+
+    /* Data mode is active after CONNECT. */
+    TEST_ASSERT_EQUAL( false, _Cellular_PktioDataModeIsActive( &context ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+
+    _Cellular_PktioDataModeStop( &context );
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+    TEST_ASSERT_NULL( context.dataModeRecvCB );
+}
+
+/**
+ * @brief Test that pktio passes the data after CONNECT to the data mode consumer.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Connect( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_DIALING;
+
+    /* The dial command response is followed by PPP data in the same read. */
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_RESULT;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "\r\nCONNECT 150000000\r\n~\x7D\x23~";
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( true, _Cellular_PktioDataModeIsActive( &context ) );
+    TEST_ASSERT_EQUAL( 4, dataModeRecvLength );
+    TEST_ASSERT_EQUAL_MEMORY( "~\x7D\x23~", dataModeRecvData, 4 );
+    TEST_ASSERT_NULL( context.pPktioReadPtr );
+    TEST_ASSERT_EQUAL( 0, context.partialDataRcvdLen );
+    TEST_ASSERT_EQUAL( 0, dataModeExitCount );
+}
+
+/**
+ * @brief Test that pktio doesn't enter data mode when the dial command fails.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Dial_Error( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_DIALING;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_RESULT;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "\r\nNO CARRIER\r\n";
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_DIALING, context.dataMode );
+    TEST_ASSERT_EQUAL( 0, dataModeRecvLength );
+    TEST_ASSERT_EQUAL( 0, dataModeExitCount );
+}
+
+/**
+ * @brief Test that pktio only enters data mode when the dial command completes with CONNECT.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Dial_Ok( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_DIALING;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_RESULT;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "\r\nOK\r\n";
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_DIALING, context.dataMode );
+    TEST_ASSERT_EQUAL( 0, dataModeRecvLength );
+}
+
+/**
+ * @brief Test that _Cellular_PktioSendAtCmd waits for CONNECT only for the dial command.
+ */
+void test__Cellular_PktioSendAtCmd_DataMode_Dial( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    /* Another command sent before the dial command. */
+    pktStatus = _Cellular_PktioSendAtCmd( &context, "AT", CELLULAR_AT_NO_RESULT, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_STARTING, context.dataMode );
+
+    pktStatus = _Cellular_PktioSendAtCmd( &context, dataModeDialCmd, CELLULAR_AT_NO_RESULT, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_DIALING, context.dataMode );
+    TEST_ASSERT_EQUAL( false, _Cellular_PktioDataModeIsActive( &context ) );
+}
+
+/**
+ * @brief Test that pktio leaves data mode with NO CARRIER split between two reads.
+ *
+ * The bytes matching the beginning of NO CARRIER are not passed to the consumer.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_No_Carrier( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ON;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 2;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "~\r~\r\nNO CAR";
+    pCommIntfRecvNextString = "RIER\r\n";
+    pCommIntfRecvCustomStringCallback = prvDataModeCommIntfRecvCallback;
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+    TEST_ASSERT_EQUAL( 3, dataModeRecvLength );
+    TEST_ASSERT_EQUAL_MEMORY( "~\r~", dataModeRecvData, 3 );
+    TEST_ASSERT_EQUAL( 1, dataModeExitCount );
+    TEST_ASSERT_NULL( context.dataModeRecvCB );
+}
+
+/**
+ * @brief Test that the held bytes are passed to the consumer when the following
+ * data doesn't match NO CARRIER.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Partial_No_Carrier( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ON;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 2;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "~\r\nNO";
+    pCommIntfRecvNextString = "~";
+    pCommIntfRecvCustomStringCallback = prvDataModeCommIntfRecvCallback;
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_ON, context.dataMode );
+    TEST_ASSERT_EQUAL( 6, dataModeRecvLength );
+    TEST_ASSERT_EQUAL_MEMORY( "~\r\nNO~", dataModeRecvData, 6 );
+    TEST_ASSERT_EQUAL( 0, dataModeExitCount );
+}
+
+/**
+ * @brief Test that pktio passes the borrowed buffer to the consumer in data mode.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_RecvBorrow( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterfaceRecvBorrow;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ON;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "~OK\r\n~";
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    /* The data is not parsed as AT response. */
+    TEST_ASSERT_EQUAL( 6, dataModeRecvLength );
+    TEST_ASSERT_EQUAL_MEMORY( "~OK\r\n~", dataModeRecvData, 6 );
+    TEST_ASSERT_EQUAL( 1, commIntfReleaseCount );
+    TEST_ASSERT_EQUAL( 6, commIntfReleaseLength );
+    TEST_ASSERT_NULL( context.pPktioReadPtr );
+}
+
+/**
+ * @brief Test that OK is passed to the consumer when the escape sequence is not sent.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Ok_Not_Escaping( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ON;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "~\r\nOK\r\n~";
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_ON, context.dataMode );
+    TEST_ASSERT_EQUAL( 8, dataModeRecvLength );
+    TEST_ASSERT_EQUAL_MEMORY( "~\r\nOK\r\n~", dataModeRecvData, 8 );
+}
+
+/**
+ * @brief Test that pktio leaves data mode with OK split between two reads after
+ * the escape sequence. The exit callback is not called.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Escape_Ok( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ESCAPING;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 2;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "~\r\nO";
+    pCommIntfRecvNextString = "K\r\n";
+    pCommIntfRecvCustomStringCallback = prvDataModeCommIntfRecvCallback;
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+    TEST_ASSERT_EQUAL( 1, dataModeRecvLength );
+    TEST_ASSERT_EQUAL_MEMORY( "~", dataModeRecvData, 1 );
+    TEST_ASSERT_EQUAL( 0, dataModeExitCount );
+    TEST_ASSERT_NULL( context.dataModeRecvCB );
+}
+
+/**
+ * @brief Test that pktio leaves data mode with NO CARRIER after the escape sequence.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Escape_No_Carrier( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ESCAPING;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "~\r\nNO CARRIER\r\n";
+
+    pktStatus = _Cellular_PktioInit( &context, prvDataModeHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+    TEST_ASSERT_EQUAL( 1, dataModeRecvLength );
+    TEST_ASSERT_EQUAL( 1, dataModeExitCount );
+}
+
+/**
+ * @brief Test that pktio parses the URC received with NO CARRIER in the same read.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_No_Carrier_Urc( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ON;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "~\r\nNO CARRIER\r\n+CEREG: 1\r\n";
+
+    pktStatus = _Cellular_PktioInit( &context, prvBorrowHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+    TEST_ASSERT_EQUAL( 1, dataModeRecvLength );
+    TEST_ASSERT_EQUAL_MEMORY( "~", dataModeRecvData, 1 );
+    TEST_ASSERT_EQUAL( 1, dataModeExitCount );
+    TEST_ASSERT_EQUAL_STRING( "+CEREG: 1", borrowUrcLine );
+}
+
+/**
+ * @brief Test that pktio keeps the partial line received with OK in the borrowed
+ * buffer and parses it with the next read.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Escape_Ok_RecvBorrow_Partial_Urc( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterfaceRecvBorrow;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ESCAPING;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_COMMAND;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "~\r\nOK\r\n+CEREG: 1";
+
+    pktStatus = _Cellular_PktioInit( &context, prvBorrowHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+    TEST_ASSERT_EQUAL( 1, dataModeRecvLength );
+    TEST_ASSERT_EQUAL( 0, dataModeExitCount );
+    TEST_ASSERT_EQUAL( 1, commIntfReleaseCount );
+
+    /* The partial line is copied to the pktioReadBuf before the borrowed buffer is released. */
+    TEST_ASSERT_EQUAL_STRING( "", borrowUrcLine );
+    TEST_ASSERT_EQUAL_PTR( context.pktioReadBuf, context.pPktioReadPtr );
+    TEST_ASSERT_EQUAL( strlen( "+CEREG: 1" ), context.partialDataRcvdLen );
+    TEST_ASSERT_EQUAL_MEMORY( "+CEREG: 1", context.pPktioReadPtr, context.partialDataRcvdLen );
+}
+
+/**
+ * @brief Test that pktio parses the URC received with CONNECT, the data and NO CARRIER
+ * in the same read.
+ */
+void test__Cellular_PktioInit_Thread_Rx_Data_Event_DataMode_Connect_No_Carrier_Urc( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+
+    threadReturn = true;
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    /* Assign the comm interface to pContext. */
+    context.pCommIntf = &CellularCommInterface;
+    context.pPktioShutdownCB = _shutdownCallback;
+    ( void ) memcpy( &context.tokenTable, &tokenTable, sizeof( CellularTokenTable_t ) );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_DIALING;
+
+    pktioEvtMask = PKTIO_EVT_MASK_RX_DATA;
+    recvCount = 1;
+    atCmdType = CELLULAR_AT_NO_RESULT;
+    testCommIfRecvType = COMM_IF_RECV_CUSTOM_STRING;
+    pCommIntfRecvCustomString = "\r\nCONNECT\r\n~\r\nNO CARRIER\r\n+CEREG: 1\r\n";
+
+    pktStatus = _Cellular_PktioInit( &context, prvBorrowHandlePacket );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+
+    TEST_ASSERT_EQUAL( PKTIO_DATA_MODE_OFF, context.dataMode );
+    TEST_ASSERT_EQUAL( 1, dataModeRecvLength );
+    TEST_ASSERT_EQUAL( 1, dataModeExitCount );
+    TEST_ASSERT_EQUAL_STRING( "+CEREG: 1", borrowUrcLine );
+}
+
+/**
+ * @brief Test that _Cellular_PktioSendAtCmd returns CELLULAR_PKT_STATUS_BAD_REQUEST in data mode.
+ */
+void test__Cellular_PktioSendAtCmd_Data_Mode( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    context.dataMode = PKTIO_DATA_MODE_ON;
+
+    pktStatus = _Cellular_PktioSendAtCmd( &context, "AT", CELLULAR_AT_NO_RESULT, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+    TEST_ASSERT_EQUAL( 0, commIntfSendCount );
+
+    /* The modem is still in data mode until it responds to the escape sequence. */
+    context.dataMode = PKTIO_DATA_MODE_ESCAPING;
+
+    pktStatus = _Cellular_PktioSendAtCmd( &context, "AT", CELLULAR_AT_NO_RESULT, NULL );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+    TEST_ASSERT_EQUAL( 0, commIntfSendCount );
+}
+
+/**
+ * @brief Test that _Cellular_PktioDataModeEscape sends the escape sequence and leaves data mode.
+ */
+void test__Cellular_PktioDataModeEscape_Happy_Path( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+
+    /* No event group. */
+    pktStatus = _Cellular_PktioDataModeEscape( &context );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_INVALID_HANDLE, pktStatus );
+
+    /* Not in data mode. */
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    pktStatus = _Cellular_PktioDataModeEscape( &context );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_BAD_REQUEST, pktStatus );
+
+    pktStatus = _Cellular_PktioDataModeStart( &context, dataModeDialCmd, prvDataModeReceiveCallback, prvDataModeExitCallback, &customCallbackContext );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    context.dataMode = PKTIO_DATA_MODE_ON;
+
+    /* The packet IO thread receives OK. */
+    pDataModeEscapeContext = &context;
+    dataModeEscapeResult = PKTIO_DATA_MODE_OFF;
+
+    pktStatus = _Cellular_PktioDataModeEscape( &context );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_OK, pktStatus );
+    TEST_ASSERT_EQUAL( 1, commIntfSendCount );
+    TEST_ASSERT_EQUAL( false, _Cellular_PktioDataModeIsActive( &context ) );
+
+    /* The exit callback is not called when leaving data mode with the escape sequence. */
+    TEST_ASSERT_EQUAL( 0, dataModeExitCount );
+}
+
+/**
+ * @brief Test that _Cellular_PktioDataModeEscape stays in data mode if the escape
+ * sequence is not sent completely.
+ */
+void test__Cellular_PktioDataModeEscape_Send_Error( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    context.dataMode = PKTIO_DATA_MODE_ON;
+    commIntfSendMaxLength = 1;
+
+    pktStatus = _Cellular_PktioDataModeEscape( &context );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_SEND_ERROR, pktStatus );
+    TEST_ASSERT_EQUAL( true, _Cellular_PktioDataModeIsActive( &context ) );
+}
+
+/**
+ * @brief Test that _Cellular_PktioDataModeEscape stays in data mode if the modem
+ * doesn't respond to the escape sequence, and data can't be sent while waiting.
+ */
+void test__Cellular_PktioDataModeEscape_Timeout( void )
+{
+    CellularPktStatus_t pktStatus = CELLULAR_PKT_STATUS_OK;
+    CellularContext_t context;
+    struct _cellularCommContext commInterfaceHandle = { 0 };
+
+    memset( &context, 0, sizeof( CellularContext_t ) );
+
+    context.pCommIntf = &CellularCommInterface;
+    context.hPktioCommIntf = ( CellularCommInterfaceHandle_t ) &commInterfaceHandle;
+    context.pPktioCommEvent = ( PlatformEventGroupHandle_t ) evtGroupHandle;
+    context.dataMode = PKTIO_DATA_MODE_ON;
+
+    /* Data mode is not active while waiting for the response. */
+    pDataModeEscapeContext = &context;
+    dataModeEscapeResult = PKTIO_DATA_MODE_ESCAPING;
+    pktStatus = _Cellular_PktioDataModeEscape( &context );
+    TEST_ASSERT_EQUAL( CELLULAR_PKT_STATUS_TIMED_OUT, pktStatus );
+    TEST_ASSERT_EQUAL( 1, commIntfSendCount );
+    TEST_ASSERT_EQUAL( true, _Cellular_PktioDataModeIsActive( &context ) );
+
+    context.dataMode = PKTIO_DATA_MODE_ESCAPING;
+    TEST_ASSERT_EQUAL( false, _Cellular_PktioDataModeIsActive( &context ) );
+}
+
 /**
  * @brief Test that any null parameter for _Cellular_PktioShutdown.
  */
@@ -59,6 +59,7 @@
 #define xQueueSend                           MockxQueueSend
 #define xQueueReceive                        MockxQueueReceive
 #define xQueueCreate                         MockxQueueCreate
+#define xTaskGetTickCount                    MockxTaskGetTickCount
 
 #define PlatformMutex_Create                 MockPlatformMutex_Create
 #define PlatformMutex_Destroy                MockPlatformMutex_Destroy
@@ -257,4 +258,8 @@ void dummyTaskENTER_CRITICAL( void );
 
 void dummyTaskEXIT_CRITICAL( void );
 
+uint32_t MockGetTimeMs( void );
+
+TickType_t MockxTaskGetTickCount( void );
+
 #endif /* __CELLULAR_PLATFORM_H__ */
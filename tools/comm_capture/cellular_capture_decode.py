@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+# FreeRTOS-Cellular-Interface
+# Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# https://www.FreeRTOS.org
+# https://github.com/FreeRTOS
+#
+"""Decode comm interface captures produced by Cellular_CommCaptureDump.
+
+The capture starts with an 8 bytes file header ("CCAP", version, 3 reserved
+bytes). A capture written by a user sink may omit the file header. Each record
+is 1 byte type, 4 bytes little endian timestamp in milliseconds, 2 bytes little
+endian payload length and the payload.
+
+Usage:
+    cellular_capture_decode.py capture.bin             # text to stdout
+    cellular_capture_decode.py capture.bin -o out.pcap # pcap, LINKTYPE_USER0
+
+In the pcap output each packet is prefixed with one byte record type so that
+the direction can be filtered with "user0[0] == 0" (send) or "== 1" (recv).
+"""
+
+import argparse
+import struct
+import sys
+
+CAPTURE_MAGIC = b"CCAP"
+CAPTURE_VERSION = 1
+FILE_HDR_SIZE = 8
+REC_HDR_SIZE = 7
+FLAG_TRUNCATED = 0x80
+LINKTYPE_USER0 = 147
+
+RECORD_TYPES = {0: "SEND", 1: "RECV", 2: "OPEN", 3: "CLOSE"}
+
+
+def parse_records(data):
+    """Yield (type, truncated, timestamp_ms, payload) with unwrapped timestamps."""
+    offset = 0
+    if data[:4] == CAPTURE_MAGIC:
+        if data[4] != CAPTURE_VERSION:
+            raise ValueError("Unsupported capture version %d" % data[4])
+        offset = FILE_HDR_SIZE
+
+    last_ts = None
+    wrap = 0
+    while offset + REC_HDR_SIZE <= len(data):
+        rec_type, ts, length = struct.unpack_from("<BIH", data, offset)
+        offset += REC_HDR_SIZE
+        if offset + length > len(data):
+            sys.stderr.write("Incomplete record at offset %d\n" % (offset - REC_HDR_SIZE))
+            break
+        payload = data[offset:offset + length]
+        offset += length
+        if last_ts is not None and ts < last_ts and (last_ts - ts) > 0x80000000:
+            wrap += 1 << 32
+        last_ts = ts
+        yield rec_type & 0x7F, bool(rec_type & FLAG_TRUNCATED), ts + wrap, payload
+
+
+def printable(payload):
+    out = []
+    for b in payload:
+        if b == 0x0D:
+            out.append("\\r")
+        elif b == 0x0A:
+            out.append("\\n")
+        elif 0x20 <= b < 0x7F:
+            out.append(chr(b))
+        else:
+            out.append("\\x%02x" % b)
+    return "".join(out)
+
+
+def write_text(records, out):
+    first_ts = None
+    for rec_type, truncated, ts, payload in records:
+        if first_ts is None:
+            first_ts = ts
+        name = RECORD_TYPES.get(rec_type, "TYPE%d" % rec_type)
+        out.write("%10.3f %-5s %5d%s %s\n" % ((ts - first_ts) / 1000.0, name, len(payload),
+                                              "+" if truncated else " ", printable(payload)))
+
+
+def write_pcap(records, out):
+    out.write(struct.pack("<IHHiIII", 0xA1B2C3D4, 2, 4, 0, 0, 0xFFFF, LINKTYPE_USER0))
+    for rec_type, _, ts, payload in records:
+        packet = bytes([rec_type]) + payload
+        out.write(struct.pack("<IIII", ts // 1000, (ts % 1000) * 1000, len(packet), len(packet)))
+        out.write(packet)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode cellular comm interface captures.")
+    parser.add_argument("capture", help="binary capture file")
+    parser.add_argument("-o", "--output", help="write pcap to this file instead of text to stdout")
+    args = parser.parse_args()
+
+    with open(args.capture, "rb") as f:
+        data = f.read()
+
+    if args.output:
+        with open(args.output, "wb") as out:
+            write_pcap(parse_records(data), out)
+    else:
+        write_text(parse_records(data), sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+#
+# FreeRTOS-Cellular-Interface
+# Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# https://www.FreeRTOS.org
+# https://github.com/FreeRTOS
+#
+"""Generate cellular module token tables with precomputed lookup data.
+
+The input is a JSON description of the module token tables. The output is a C
+source file which defines the token tables, a CellularTokenLookup_t and the
+CellularTokenTable_t passed to Cellular_CommonInit. The URC handler table is
+sorted, the URC tokens are indexed with a collision free seeded FNV-1a hash and
+each byte has the classes of the tokens starting with it. The library skips the
+sort check in _Cellular_AtParseInit for a generated table.
+
+Usage:
+    cellular_token_table_gen.py module_tokens.json -o cellular_module_token_table.c
+    cellular_token_table_gen.py module_tokens.json -o table.c --header table.h
+
+See README.md for the JSON description.
+"""
+
+import argparse
+import json
+import sys
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+SEED_TRIES = 4096
+MAX_SLOTS = 65536
+
+TOKEN_CLASS_SUCCESS = 0x01
+TOKEN_CLASS_ERROR = 0x02
+TOKEN_CLASS_URC_WO_PREFIX = 0x04
+
+GENERATED_HEADER = """/*
+ * This file is generated by tools/token_table/cellular_token_table_gen.py.
+ * Do not edit. Regenerate from %s.
+ */
+"""
+
+
+def token_hash(token, seed):
+    """Seeded FNV-1a hash. Same as _urcTokenHash in cellular_pkthandler.c."""
+    value = (FNV_OFFSET ^ seed) & 0xFFFFFFFF
+    for byte in token.encode("ascii"):
+        value = ((value ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return value
+
+
+def find_perfect_hash(tokens):
+    """Return (seed, slot count) with no two tokens in the same slot."""
+    slots = 1
+    while slots < len(tokens):
+        slots *= 2
+    while slots <= MAX_SLOTS:
+        for seed in range(SEED_TRIES):
+            used = set(token_hash(t, seed) & (slots - 1) for t in tokens)
+            if len(used) == len(tokens):
+                return seed, slots
+        slots *= 2
+    raise ValueError("No collision free hash for %d URC tokens" % len(tokens))
+
+
+def check_tokens(name, tokens, allow_empty_list=True):
+    """Tokens are non-empty printable ASCII without quote or backslash."""
+    if not allow_empty_list and len(tokens) == 0:
+        raise ValueError("%s should not be empty" % name)
+    if len(set(tokens)) != len(tokens):
+        raise ValueError("%s has duplicate tokens" % name)
+    for token in tokens:
+        if len(token) == 0 or len(token) > 0xFFFF:
+            raise ValueError("%s has invalid token length %r" % (name, token))
+        for char in token:
+            if not (0x20 <= ord(char) < 0x7F) or char in "\"\\":
+                raise ValueError("%s token %r has invalid character" % (name, token))
+
+
+def load_description(path):
+    """Load and validate the JSON description."""
+    with open(path, "r") as desc_file:
+        desc = json.load(desc_file)
+
+    urc_handlers = desc.get("urc_handlers", {})
+    result = {
+        "name": desc.get("name", "CellularTokenTable"),
+        "includes": desc.get("includes", []),
+        "urc_handlers": sorted(urc_handlers.items(), key=lambda item: item[0].encode("ascii")),
+        "success_tokens": desc.get("success_tokens", []),
+        "error_tokens": desc.get("error_tokens", []),
+        "urc_tokens_without_prefix": desc.get("urc_tokens_without_prefix", []),
+        "extra_success_tokens": desc.get("extra_success_tokens", []),
+    }
+
+    check_tokens("urc_handlers", [item[0] for item in result["urc_handlers"]], False)
+    check_tokens("success_tokens", result["success_tokens"], False)
+    check_tokens("error_tokens", result["error_tokens"], False)
+    check_tokens("urc_tokens_without_prefix", result["urc_tokens_without_prefix"])
+    check_tokens("extra_success_tokens", result["extra_success_tokens"])
+    return result
+
+
+def c_string_array(lines, name, tokens):
+    """Emit a const char * array. An empty list is a 1 entry array of NULL."""
+    if len(tokens) == 0:
+        lines.append("static const char * %s[ 1 ] = { NULL };" % name)
+    else:
+        lines.append("static const char * %s[] =" % name)
+        lines.append("{")
+        lines.append(",\n".join('    "%s"' % t for t in tokens))
+        lines.append("};")
+    lines.append("")
+
+
+def c_number_array(lines, c_type, name, values, fmt, per_line):
+    """Emit a static const number array."""
+    lines.append("static const %s %s[ %d ] =" % (c_type, name, len(values)))
+    lines.append("{")
+    rows = []
+    for i in range(0, len(values), per_line):
+        rows.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]))
+    lines.append(",\n".join(rows))
+    lines.append("};")
+    lines.append("")
+
+
+def c_static_assert(lines, name, conditions):
+    """C90 compatible static assertion with a negative array size."""
+    lines.append("typedef char %s[ ( %s ) ? 1 : -1 ];" % (name, " &&\n    ".join(conditions)))
+    lines.append("")
+
+
+def c_count(array):
+    return "( sizeof( %s ) / sizeof( %s[ 0 ] ) )" % (array, array)
+
+
+def generate_source(desc, desc_path):
+    """Return the generated C source."""
+    name = desc["name"]
+    urc_tokens = [item[0] for item in desc["urc_handlers"]]
+    seed, slot_count = find_perfect_hash(urc_tokens)
+
+    hashes = [token_hash(t, seed) for t in urc_tokens]
+    slots = [0] * slot_count
+    for index, value in enumerate(hashes):
+        slots[value & (slot_count - 1)] = index + 1
+
+    first_byte_class = [0] * 256
+    for token in desc["success_tokens"]:
+        first_byte_class[ord(token[0])] |= TOKEN_CLASS_SUCCESS
+    for token in desc["error_tokens"]:
+        first_byte_class[ord(token[0])] |= TOKEN_CLASS_ERROR
+    for token in desc["urc_tokens_without_prefix"]:
+        first_byte_class[ord(token[0])] |= TOKEN_CLASS_URC_WO_PREFIX
+
+    lines = [GENERATED_HEADER % desc_path.replace("\\", "/")]
+    lines.append("#ifndef CELLULAR_DO_NOT_USE_CUSTOM_CONFIG")
+    lines.append("    /* Include custom config file before other headers. */")
+    lines.append('    #include "cellular_config.h"')
+    lines.append("#endif")
+    lines.append('#include "cellular_config_defaults.h"')
+    lines.append("")
+    lines.append("#include <stddef.h>")
+    lines.append("#include <stdint.h>")
+    lines.append("")
+    lines.append('#include "cellular_common.h"')
+    for include in desc["includes"]:
+        lines.append('#include "%s"' % include)
+    lines.append("")
+    lines.append("/*-----------------------------------------------------------*/")
+    lines.append("")
+
+    lines.append("static CellularAtParseTokenMap_t %sUrcHandler[] =" % name)
+    lines.append("{")
+    lines.append(",\n".join('    { "%s", %s }' % (token, handler if handler else "NULL")
+                            for token, handler in desc["urc_handlers"]))
+    lines.append("};")
+    lines.append("")
+    c_string_array(lines, name + "Error", desc["error_tokens"])
+    c_string_array(lines, name + "Success", desc["success_tokens"])
+    c_string_array(lines, name + "UrcWoPrefix", desc["urc_tokens_without_prefix"])
+    if len(desc["extra_success_tokens"]) > 0:
+        c_string_array(lines, name + "ExtraSuccess", desc["extra_success_tokens"])
+
+    c_number_array(lines, "uint16_t", name + "UrcHashSlots", slots, "%uU", 16)
+    c_number_array(lines, "uint32_t", name + "UrcTokenHash", hashes, "0x%08XU", 4)
+    c_number_array(lines, "uint16_t", name + "UrcTokenLength", [len(t) for t in urc_tokens], "%uU", 16)
+    c_number_array(lines, "uint8_t", name + "FirstByteClass", first_byte_class, "0x%02XU", 16)
+
+    # The checks fail the build if the tables are edited by hand.
+    conditions = [
+        "%s == %dU" % (c_count(name + "UrcHandler"), len(urc_tokens)),
+        "%s == %dU" % (c_count(name + "UrcTokenHash"), len(urc_tokens)),
+        "%s == %dU" % (c_count(name + "UrcTokenLength"), len(urc_tokens)),
+        "%s == %dU" % (c_count(name + "UrcHashSlots"), slot_count),
+        "%s == 256U" % c_count(name + "FirstByteClass"),
+    ]
+    conditions += ['( sizeof( "%s" ) - 1U ) == %dU' % (t, len(t)) for t in urc_tokens]
+    c_static_assert(lines, name + "Check_t", conditions)
+
+    lines.append("static const CellularTokenLookup_t %sLookup =" % name)
+    lines.append("{")
+    lines.append("    0x%08XU," % seed)
+    lines.append("    0x%08XU," % (slot_count - 1))
+    lines.append("    %sUrcHashSlots," % name)
+    lines.append("    %sUrcTokenHash," % name)
+    lines.append("    %sUrcTokenLength," % name)
+    lines.append("    %sFirstByteClass" % name)
+    lines.append("};")
+    lines.append("")
+
+    extra = name + "ExtraSuccess" if len(desc["extra_success_tokens"]) > 0 else "NULL"
+    lines.append("CellularTokenTable_t %s =" % name)
+    lines.append("{")
+    lines.append("    %sUrcHandler," % name)
+    lines.append("    %dU," % len(urc_tokens))
+    lines.append("    %sError," % name)
+    lines.append("    %dU," % len(desc["error_tokens"]))
+    lines.append("    %sSuccess," % name)
+    lines.append("    %dU," % len(desc["success_tokens"]))
+    lines.append("    %sUrcWoPrefix," % name)
+    lines.append("    %dU," % len(desc["urc_tokens_without_prefix"]))
+    lines.append("    %s," % extra)
+    lines.append("    %dU," % len(desc["extra_success_tokens"]))
+    lines.append("    &%sLookup" % name)
+    lines.append("};")
+    lines.append("")
+    lines.append("/*-----------------------------------------------------------*/")
+    return "\n".join(lines) + "\n"
+
+
+def generate_header(desc, desc_path, header_path):
+    """Return the generated header declaring the token table."""
+    guard = "".join(c if c.isalnum() else "_" for c in header_path.split("/")[-1]).upper() + "_"
+    lines = [GENERATED_HEADER % desc_path.replace("\\", "/")]
+    lines.append("#ifndef %s" % guard)
+    lines.append("#define %s" % guard)
+    lines.append("")
+    lines.append('#include "cellular_common.h"')
+    lines.append("")
+    lines.append("extern CellularTokenTable_t %s;" % desc["name"])
+    lines.append("")
+    lines.append("#endif /* %s */" % guard)
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate cellular module token tables.")
+    parser.add_argument("description", help="JSON description of the module token tables")
+    parser.add_argument("-o", "--output", required=True, help="generated C source file")
+    parser.add_argument("--header", help="also generate a header declaring the token table")
+    args = parser.parse_args()
+
+    try:
+        desc = load_description(args.description)
+        source = generate_source(desc, args.description)
+    except (OSError, ValueError) as err:
+        sys.stderr.write("%s\n" % err)
+        sys.exit(1)
+
+    with open(args.output, "w") as out_file:
+        out_file.write(source)
+
+    if args.header is not None:
+        with open(args.header, "w") as out_file:
+            out_file.write(generate_header(desc, args.description, args.header))
+
+
+if __name__ == "__main__":
+    main()